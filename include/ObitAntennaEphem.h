@@ -0,0 +1,154 @@
+/* $Id$        */
+/*--------------------------------------------------------------------*/
+/*;  Copyright (C) 2026                                               */
+/*;  Associated Universities, Inc. Washington DC, USA.                */
+/*;                                                                   */
+/*;  This program is free software; you can redistribute it and/or    */
+/*;  modify it under the terms of the GNU General Public License as   */
+/*;  published by the Free Software Foundation; either version 2 of   */
+/*;  the License, or (at your option) any later version.              */
+/*;                                                                   */
+/*;  This program is distributed in the hope that it will be useful,  */
+/*;  but WITHOUT ANY WARRANTY; without even the implied warranty of   */
+/*;  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    */
+/*;  GNU General Public License for more details.                     */
+/*;                                                                   */
+/*;  You should have received a copy of the GNU General Public        */
+/*;  License along with this program; if not, write to the Free       */
+/*;  Software Foundation, Inc., 675 Massachusetts Ave, Cambridge,     */
+/*;  MA 02139, USA.                                                   */
+/*;                                                                   */
+/*;Correspondence about this software should be addressed as follows: */
+/*;         Internet email: bcotton@nrao.edu.                         */
+/*;         Postal address: William Cotton                            */
+/*;                         National Radio Astronomy Observatory      */
+/*;                         520 Edgemont Road                         */
+/*;                         Charlottesville, VA 22903-2475 USA        */
+/*--------------------------------------------------------------------*/
+#ifndef OBITANTENNAEPHEM_H 
+#define OBITANTENNAEPHEM_H 
+
+#include "Obit.h"
+#include "ObitErr.h"
+#include "ObitThread.h"
+#include "ObitAntennaList.h"
+#include "ObitSource.h"
+
+/*-------- Obit: Merx mollis mortibus nuper ------------------*/
+/**
+ * \file ObitAntennaEphem.h
+ *
+ * ObitAntennaEphem provides source elevation, azimuth and parallactic 
+ * angle for each antenna in an antenna (AN table) list.
+ * Values are tabulated per source on a regular time grid covering a 
+ * window around the times requested and are interpolated from the 
+ * grid; the window is recomputed as needed when requests move outside 
+ * of it.  Smooth components (sine of elevation and the two arguments 
+ * of the arctangents for azimuth and parallactic angle) are tabulated 
+ * so interpolation is well behaved near the zenith.
+ * Source positions used are the apparent positions in the ObitSource 
+ * (e.g. from an SU table); tabulations are kept per source ID and 
+ * redone if the source position changes.
+ * Values for all antennas at a time are obtained with 
+ * #ObitAntennaEphemGeom, arrays are indexed by entry in the antenna list.
+ * Access is locked so an object may be shared between threads.
+ * 
+ * \section ObitAntennaEphemaccess Creators and Destructors
+ * An ObitAntennaEphem will usually be created using ObitAntennaEphemCreate 
+ * which allows specifying a name for the object as well as other information.
+ *
+ * A copy of a pointer to an ObitAntennaEphem should always be made using the
+ * #ObitAntennaEphemRef function which updates the reference count in the object.
+ * Then whenever freeing an ObitAntennaEphem or changing a pointer, the function
+ * #ObitAntennaEphemUnref will decrement the reference count and destroy the 
+ * object when the reference count hits 0.
+ * There is no explicit destructor.
+ */
+
+/*--------------Class definitions-------------------------------------*/
+/** ObitAntennaEphem Class structure. */
+typedef struct {
+#include "ObitAntennaEphemDef.h"   /* this class definition */
+} ObitAntennaEphem;
+
+/*----------------- Macroes ---------------------------*/
+/** 
+ * Macro to unreference (and possibly destroy) an ObitAntennaEphem
+ * returns a ObitAntennaEphem*.
+ * in = object to unreference
+ */
+#define ObitAntennaEphemUnref(in) ObitUnref (in)
+
+/** 
+ * Macro to reference (update reference count) an ObitAntennaEphem.
+ * returns a ObitAntennaEphem*.
+ * in = object to reference
+ */
+#define ObitAntennaEphemRef(in) ObitRef (in)
+
+/** 
+ * Macro to determine if an object is the member of this or a 
+ * derived class.
+ * Returns TRUE if a member, else FALSE
+ * in = object to reference
+ */
+#define ObitAntennaEphemIsA(in) ObitIsA (in, ObitAntennaEphemGetClass())
+
+/*---------------Public functions---------------------------*/
+/** Public: Class initializer. */
+void ObitAntennaEphemClassInit (void);
+
+/** Public: Default Constructor. */
+ObitAntennaEphem* newObitAntennaEphem (gchar* name);
+
+/** Public: Create/initialize ObitAntennaEphem structures */
+ObitAntennaEphem* ObitAntennaEphemCreate (gchar* name, ObitAntennaList *AntList,
+					  ofloat delTime);
+/** Typedef for definition of class pointer structure */
+typedef ObitAntennaEphem* (*ObitAntennaEphemCreateFP) (gchar* name, 
+						       ObitAntennaList *AntList,
+						       ofloat delTime);
+
+/** Public: ClassInfo pointer */
+gconstpointer ObitAntennaEphemGetClass (void);
+
+/** Public: Elevation, azimuth, parallactic angle for all antennas */
+void ObitAntennaEphemGeom (ObitAntennaEphem *in, ofloat time, ObitSource *Source,
+			   ofloat *elev, ofloat *az, ofloat *parAng);
+/** Typedef for definition of class pointer structure */
+typedef void (*ObitAntennaEphemGeomFP) (ObitAntennaEphem *in, ofloat time, 
+					ObitSource *Source, ofloat *elev, 
+					ofloat *az, ofloat *parAng);
+
+/** Public: Source elevation for one antenna */
+ofloat ObitAntennaEphemElev (ObitAntennaEphem *in, olong ant, ofloat time, 
+			     ObitSource *Source);
+/** Typedef for definition of class pointer structure */
+typedef ofloat (*ObitAntennaEphemElevFP) (ObitAntennaEphem *in, olong ant, 
+					  ofloat time, ObitSource *Source);
+
+/** Public: Source azimuth for one antenna */
+ofloat ObitAntennaEphemAz (ObitAntennaEphem *in, olong ant, ofloat time, 
+			   ObitSource *Source);
+/** Typedef for definition of class pointer structure */
+typedef ofloat (*ObitAntennaEphemAzFP) (ObitAntennaEphem *in, olong ant, 
+					ofloat time, ObitSource *Source);
+
+/** Public: Parallactic angle for one antenna */
+ofloat ObitAntennaEphemParAng (ObitAntennaEphem *in, olong ant, ofloat time, 
+			       ObitSource *Source);
+/** Typedef for definition of class pointer structure */
+typedef ofloat (*ObitAntennaEphemParAngFP) (ObitAntennaEphem *in, olong ant, 
+					    ofloat time, ObitSource *Source);
+
+/*----------- ClassInfo Structure -----------------------------------*/
+/**
+ * ClassInfo Structure.
+ * Contains class name, a pointer to any parent class
+ * (NULL if none) and function pointers.
+ */
+typedef struct  {
+#include "ObitAntennaEphemClassDef.h"
+} ObitAntennaEphemClassInfo; 
+
+#endif /* OBITANTENNAEPHEM_H */ 
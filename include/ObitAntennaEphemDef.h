@@ -0,0 +1,59 @@
+/* $Id$        */
+/*--------------------------------------------------------------------*/
+/*;  Copyright (C) 2026                                               */
+/*;  Associated Universities, Inc. Washington DC, USA.                */
+/*;                                                                   */
+/*;  This program is free software; you can redistribute it and/or    */
+/*;  modify it under the terms of the GNU General Public License as   */
+/*;  published by the Free Software Foundation; either version 2 of   */
+/*;  the License, or (at your option) any later version.              */
+/*;                                                                   */
+/*;  This program is distributed in the hope that it will be useful,  */
+/*;  but WITHOUT ANY WARRANTY; without even the implied warranty of   */
+/*;  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    */
+/*;  GNU General Public License for more details.                     */
+/*;                                                                   */
+/*;  You should have received a copy of the GNU General Public        */
+/*;  License along with this program; if not, write to the Free       */
+/*;  Software Foundation, Inc., 675 Massachusetts Ave, Cambridge,     */
+/*;  MA 02139, USA.                                                   */
+/*;                                                                   */
+/*;Correspondence about this software should be addressed as follows: */
+/*;         Internet email: bcotton@nrao.edu.                         */
+/*;         Postal address: William Cotton                            */
+/*;                         National Radio Astronomy Observatory      */
+/*;                         520 Edgemont Road                         */
+/*;                         Charlottesville, VA 22903-2475 USA        */
+/*--------------------------------------------------------------------*/
+/*  Define the basic components of the ObitAntennaEphem structure     */
+/*  This is intended to be included in a class structure definition   */
+/* and to be used as the template for generating new classes derived  */
+/* from ObitAntennaEphem.                                             */
+/**
+ * \file ObitAntennaEphemDef.h
+ * ObitAntennaEphem structure members for this and any derived classes.
+ */
+#include "ObitDef.h"  /* Parent class instance definitions */
+/** Threading info member object, tabulations are locked while in use */
+ObitThread *thread;
+/** Antenna list */
+ObitAntennaList *AntList;
+/** Number of antennas (entries in AntList) */
+olong nant;
+/** Maximum antenna number */
+olong maxAnt;
+/** Antenna number index into AntList */
+olong *antIndex;
+/** Spacing of time grid (day) */
+ofloat delTime;
+/** Number of grid times per tabulation */
+olong nGrid;
+/** Tabulations, one per source, most recently used first */
+GSList *segList;
+/** Per antenna cos/sin of latitude and longitude, then same for 
+    parallactic angle [8*nant] */
+odouble *antGeom;
+/** Per antenna, is antenna valid? */
+gboolean *isValid;
+/** Per antenna, is parallactic angle needed (Alt-Az mount)? */
+gboolean *isAltAz;
@@ -32,6 +32,7 @@
 #include "ObitErr.h"
 #include "ObitImage.h"
 #include "ObitFInterpolate.h"
+#include "ObitPBUtil.h"
 
 /*-------- Obit: Merx mollis mortibus nuper ------------------*/
 /**
@@ -61,3 +61,5 @@ odouble icellSize;
 ObitImageDesc *myDesc;
 /** Interpolator for tabulated Beam */
 ObitFInterpolate *myFI;
+/** Tabulated analytic beam shape, NULL if not used */
+ObitPBUtilTab *PBTab;
@@ -92,6 +92,68 @@ typedef struct {
 #define MAXCARRAYDIM 10
 #endif
 
+/** Maximum number of operations in an ObitCArrayExpr */
+#ifndef MAXCAEXPRSTEP
+#define MAXCAEXPRSTEP 32
+#endif
+
+/**
+ * Elementwise operations for fused expressions (ObitCArrayExpr).
+ * acc is the running (complex) value of the expression, carr a CArray 
+ * operand, farr an FArray operand and (s1,s2) the scalar operands.
+ * No blanking.
+ */
+enum obitCArrayExprOp {
+  /** acc = acc + carr */
+  OBIT_CAExpr_Add=0, 
+  /** acc = acc - carr */
+  OBIT_CAExpr_Sub, 
+  /** acc = acc * carr */
+  OBIT_CAExpr_Mul, 
+  /** acc = acc * farr */
+  OBIT_CAExpr_FMul, 
+  /** acc = acc / farr */
+  OBIT_CAExpr_FDiv, 
+  /** real(acc) = real(acc) + farr */
+  OBIT_CAExpr_FAdd, 
+  /** acc = acc * s1 */
+  OBIT_CAExpr_SMul, 
+  /** acc = acc * (s1,s2) */
+  OBIT_CAExpr_CSMul, 
+  /** acc = acc + (s1,s2) */
+  OBIT_CAExpr_CSAdd, 
+  /** acc = conjugate(acc) */
+  OBIT_CAExpr_Conjg, 
+  /** acc = -acc */
+  OBIT_CAExpr_Neg, 
+  /** acc = acc * conjugate(carr) */
+  OBIT_CAExpr_MulConjg
+}; /* end enum obitCArrayExprOp */
+/** typedef for enum for ObitCArrayExpr operations. */
+typedef enum obitCArrayExprOp ObitCArrayExprOp;
+
+/**
+ * Recorded sequence of elementwise operations on ObitCArrays.
+ * Operations are added with ObitCArrayExprCArr, ObitCArrayExprFArr and
+ * ObitCArrayExprScalar and nothing is computed until ObitCArrayExprRun
+ * which evaluates the whole sequence in one (threaded) pass through memory.
+ * All arrays must have the same geometry.
+ */
+typedef struct {
+  /** Number of operations */
+  olong nstep;
+  /** Array giving the initial value */
+  ObitCArray *in;
+  /** Operations */
+  ObitCArrayExprOp op[MAXCAEXPRSTEP];
+  /** CArray operands, NULL if none */
+  ObitCArray *carr[MAXCAEXPRSTEP];
+  /** FArray operands, NULL if none */
+  ObitFArray *farr[MAXCAEXPRSTEP];
+  /** Scalar operands */
+  ofloat s[MAXCAEXPRSTEP][2];
+} ObitCArrayExpr;
+
 /*---------------Public functions---------------------------*/
 /** Public: Class initializer. */
 void ObitCArrayClassInit (void);
@@ -253,6 +315,37 @@ void ObitCArrayMatrixMult (ObitCArray* in1, ObitCArray* in2, ObitCArray* out);
 typedef void (*ObitCArrayMatrixMultFP) (ObitCArray* in1, ObitCArray* in2, 
 					ObitCArray* out);
 
+/*---------------Fused expression functions------------------------*/
+/** Public: Start fused expression with initial value in */
+ObitCArrayExpr* ObitCArrayExprCreate (ObitCArray* in);
+typedef ObitCArrayExpr* (*ObitCArrayExprCreateFP) (ObitCArray* in);
+
+/** Public: Delete fused expression */
+ObitCArrayExpr* ObitCArrayExprFree (ObitCArrayExpr* expr);
+typedef ObitCArrayExpr* (*ObitCArrayExprFreeFP) (ObitCArrayExpr* expr);
+
+/** Public: Add CArray operation to fused expression */
+void ObitCArrayExprCArr (ObitCArrayExpr* expr, ObitCArrayExprOp op, 
+			 ObitCArray* carr);
+typedef void (*ObitCArrayExprCArrFP) (ObitCArrayExpr* expr, ObitCArrayExprOp op, 
+				      ObitCArray* carr);
+
+/** Public: Add FArray operation to fused expression */
+void ObitCArrayExprFArr (ObitCArrayExpr* expr, ObitCArrayExprOp op, 
+			 ObitFArray* farr);
+typedef void (*ObitCArrayExprFArrFP) (ObitCArrayExpr* expr, ObitCArrayExprOp op, 
+				      ObitFArray* farr);
+
+/** Public: Add scalar operation to fused expression */
+void ObitCArrayExprScalar (ObitCArrayExpr* expr, ObitCArrayExprOp op, 
+			   ofloat s1, ofloat s2);
+typedef void (*ObitCArrayExprScalarFP) (ObitCArrayExpr* expr, ObitCArrayExprOp op, 
+					ofloat s1, ofloat s2);
+
+/** Public: Evaluate fused expression into out */
+void ObitCArrayExprRun (ObitCArrayExpr* expr, ObitCArray* out);
+typedef void (*ObitCArrayExprRunFP) (ObitCArrayExpr* expr, ObitCArray* out);
+
 /*----------- ClassInfo Structure -----------------------------------*/
 /**
  * ClassInfo Structure.
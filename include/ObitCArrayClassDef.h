@@ -95,3 +95,15 @@ ObitCArray2DCenterFullFP ObitCArray2DCenterFull;
 ObitCArrayAddConjgFP ObitCArrayAddConjg;
 /** Function pointer to Matrix inner multiply */
 ObitCArrayMatrixMultFP ObitCArrayMatrixMult;
+/** Function pointer to start fused expression */
+ObitCArrayExprCreateFP ObitCArrayExprCreate;
+/** Function pointer to delete fused expression */
+ObitCArrayExprFreeFP ObitCArrayExprFree;
+/** Function pointer to add CArray operation to fused expression */
+ObitCArrayExprCArrFP ObitCArrayExprCArr;
+/** Function pointer to add FArray operation to fused expression */
+ObitCArrayExprFArrFP ObitCArrayExprFArr;
+/** Function pointer to add scalar operation to fused expression */
+ObitCArrayExprScalarFP ObitCArrayExprScalar;
+/** Function pointer to evaluate fused expression */
+ObitCArrayExprRunFP ObitCArrayExprRun;
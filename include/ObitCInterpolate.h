@@ -114,6 +114,10 @@ void ObitCInterpolatePosition (ObitCInterpolate *in, odouble *coord, ofloat out[
 void ObitCInterpolateOffset (ObitCInterpolate *in, ofloat *offset, ofloat out[2],
 			     ObitErr *err);
 
+/** Public: Interpolate list of Offsets in 2D array */
+void ObitCInterpolateOffsetRow (ObitCInterpolate *in, olong n, ofloat *uOff, 
+				ofloat *vOff, ofloat *out);
+
 /*----------- ClassInfo Structure -----------------------------------*/
 /**
  * ClassInfo Structure.
@@ -52,6 +52,12 @@ void ObitConvUtilConvGauss (ObitImage *inImage, ofloat Gaumaj,ofloat Gaumin,
 			    ofloat GauPA,  ofloat rescale,
 			    ObitImage *outImage, ObitErr *err);
 
+/*  Public: Convolve a 2-D array with a Gaussian */
+ObitFArray* ObitConvUtilConvGaussArray (ObitFArray *in, ofloat *cells, 
+					ofloat maprot, ofloat Gaumaj, 
+					ofloat Gaumin, ofloat GauPA, 
+					ofloat rescale, ObitErr *err);
+
 /*  Public: Create Gaussian array */
 ObitFArray* ObitConvUtilGaus (ObitImage *inImage, ofloat Beam[3]);
 
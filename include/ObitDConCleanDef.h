@@ -79,6 +79,14 @@ ofloat *imgRMS;
 ofloat *imgPeakRMS;
 /** Beam Peak/RMS per field, -1=> uninitialized */
 ofloat *beamPeakRMS;
+/** Image "writeGen" at last image statistics per field, -1=> none */
+olong *statGen;
+/** Window modCount at last image statistics per field */
+olong *statWinMod;
+/** Beam "writeGen" at last beam statistics per field, -1=> none */
+olong *beamStatGen;
+/** Plane of last statistics, change invalidates all fields */
+olong statPlane[IM_MAXDIM-2];
 /** min. minor cycle flux for auto Window feature */
 ofloat autoWinFlux ;
 /** Min. fraction of residual peak to CLEAN to */
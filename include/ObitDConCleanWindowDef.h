@@ -45,3 +45,5 @@ GSList **Lists;
 gboolean autoWindow;
 /** Array of outer windows (as WindowListElem), one per field */
 gpointer *outWindow;
+/** Modification count per field, incremented on any window change */
+olong *modCount;
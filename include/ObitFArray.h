@@ -98,6 +98,99 @@ typedef struct {
 #define MAXFARRAYDIM 10
 #endif
 
+/** Maximum number of operations in an ObitFArrayExpr */
+#ifndef MAXFAEXPRSTEP
+#define MAXFAEXPRSTEP 32
+#endif
+
+/** Number of quantiles in an ObitFArrayStat */
+#define FASTATNQUANT 7
+
+/**
+ * Summary statistics of the pixel distribution in an ObitFArray
+ * as returned by ObitFArrayStats.
+ * Quantiles are given at fractions 0.01, 0.05, 0.25, 0.5, 0.75, 0.95, 0.99
+ * of the valid pixels.
+ */
+typedef struct {
+  /** Number of valid (unblanked) pixels */
+  ollong count;
+  /** Number of blanked pixels */
+  ollong nBlank;
+  /** Minimum and maximum valid values */
+  ofloat min, max;
+  /** Mean and RMS about the mean (as ObitFArrayRawRMS) */
+  ofloat mean, rawRMS;
+  /** Robust RMS from the width of the peak about the mode (as ObitFArrayRMS) */
+  ofloat RMS;
+  /** Mode (as ObitFArrayMode) */
+  ofloat mode;
+  /** Quantiles */
+  ofloat quantile[FASTATNQUANT];
+} ObitFArrayStat;
+
+/**
+ * Elementwise operations for fused expressions (ObitFArrayExpr).
+ * acc is the running value of the expression, arr the array operand 
+ * and s1, s2, s3 the scalar operands; except as noted blanked acc 
+ * values stay blanked.
+ */
+enum obitFArrayExprOp {
+  /** acc = acc + arr, blanked if either is blanked */
+  OBIT_FAExpr_Add=0, 
+  /** acc = acc - arr, blanked if either is blanked */
+  OBIT_FAExpr_Sub, 
+  /** acc = acc * arr, blanked if either is blanked */
+  OBIT_FAExpr_Mul, 
+  /** acc = acc / arr, blanked if either is blanked or arr is zero */
+  OBIT_FAExpr_Div, 
+  /** acc blanked where arr is blanked */
+  OBIT_FAExpr_Blank, 
+  /** acc = acc + arr or whichever is not blanked */
+  OBIT_FAExpr_SumArr, 
+  /** acc = MAX (acc, arr) or whichever is not blanked */
+  OBIT_FAExpr_MaxArr, 
+  /** acc = MIN (acc, arr) or whichever is not blanked */
+  OBIT_FAExpr_MinArr, 
+  /** acc = acc + s1 */
+  OBIT_FAExpr_SAdd, 
+  /** acc = acc * s1 */
+  OBIT_FAExpr_SMul, 
+  /** acc = s3 where acc < s1 or acc > s2 */
+  OBIT_FAExpr_Clip, 
+  /** acc = s3 where s1 <= acc <= s2 */
+  OBIT_FAExpr_InClip, 
+  /** acc = s1 where acc is blanked */
+  OBIT_FAExpr_Deblank, 
+  /** acc = -acc */
+  OBIT_FAExpr_Neg, 
+  /** acc = |acc| */
+  OBIT_FAExpr_Abs
+}; /* end enum obitFArrayExprOp */
+/** typedef for enum for ObitFArrayExpr operations. */
+typedef enum obitFArrayExprOp ObitFArrayExprOp;
+
+/**
+ * Recorded sequence of elementwise operations on ObitFArrays.
+ * Operations are added with ObitFArrayExprArr/ObitFArrayExprScalar and
+ * nothing is computed until ObitFArrayExprRun which evaluates the whole
+ * sequence in one (threaded) pass through memory, cache sized blocks of 
+ * the running value being taken through all operations in turn.
+ * All arrays must have the same geometry.
+ */
+typedef struct {
+  /** Number of operations */
+  olong nstep;
+  /** Array giving the initial value */
+  ObitFArray *in;
+  /** Operations */
+  ObitFArrayExprOp op[MAXFAEXPRSTEP];
+  /** Array operands, NULL for scalar operations */
+  ObitFArray *arr[MAXFAEXPRSTEP];
+  /** Scalar operands */
+  ofloat s[MAXFAEXPRSTEP][3];
+} ObitFArrayExpr;
+
 /*---------------Public functions---------------------------*/
 /** Public: Class initializer. */
 void ObitFArrayClassInit (void);
@@ -186,6 +279,10 @@ typedef void (*ObitFArrayQuantFP) (ObitFArray* in, ofloat *quant, ofloat *zero);
 ofloat ObitFArrayMode (ObitFArray* in);
 typedef ofloat (*ObitFArrayModeFP) (ObitFArray* in);
 
+/** Public: Robust statistics of pixel distribution in two passes */
+void ObitFArrayStats (ObitFArray* in, ObitFArrayStat *stat);
+typedef void (*ObitFArrayStatsFP) (ObitFArray* in, ObitFArrayStat *stat);
+
 /** Public: Mean of pixel distribution. */
 ofloat ObitFArrayMean (ObitFArray* in);
 typedef ofloat (*ObitFArrayMeanFP) (ObitFArray* in);
@@ -400,6 +497,30 @@ typedef ofloat  (*ObitFArrayRandomFP) (ofloat mean, ofloat sigma);
 void ObitFArrayRandomFill (ObitFArray* in, ofloat mean, ofloat sigma);
 typedef void  (*ObitFArrayRandomFillFP) (ObitFArray* in, ofloat mean, ofloat sigma);
 
+/** Public: Start fused expression with initial value in */
+ObitFArrayExpr* ObitFArrayExprCreate (ObitFArray* in);
+typedef ObitFArrayExpr* (*ObitFArrayExprCreateFP) (ObitFArray* in);
+
+/** Public: Delete fused expression */
+ObitFArrayExpr* ObitFArrayExprFree (ObitFArrayExpr* expr);
+typedef ObitFArrayExpr* (*ObitFArrayExprFreeFP) (ObitFArrayExpr* expr);
+
+/** Public: Add array operation to fused expression */
+void ObitFArrayExprArr (ObitFArrayExpr* expr, ObitFArrayExprOp op, 
+			ObitFArray* arr);
+typedef void (*ObitFArrayExprArrFP) (ObitFArrayExpr* expr, ObitFArrayExprOp op, 
+				     ObitFArray* arr);
+
+/** Public: Add scalar operation to fused expression */
+void ObitFArrayExprScalar (ObitFArrayExpr* expr, ObitFArrayExprOp op, 
+			   ofloat s1, ofloat s2, ofloat s3);
+typedef void (*ObitFArrayExprScalarFP) (ObitFArrayExpr* expr, ObitFArrayExprOp op, 
+					ofloat s1, ofloat s2, ofloat s3);
+
+/** Public: Evaluate fused expression into out */
+void ObitFArrayExprRun (ObitFArrayExpr* expr, ObitFArray* out);
+typedef void (*ObitFArrayExprRunFP) (ObitFArrayExpr* expr, ObitFArray* out);
+
 /*----------- ClassInfo Structure -----------------------------------*/
 /**
  * ClassInfo Structure.
@@ -57,6 +57,8 @@ ObitFArrayRMS0FP ObitFArrayRMS0;
 ObitFArrayRMSQuantFP ObitFArrayRMSQuant;
 /** Function pointer to find  Mode of pixel distribution.*/
 ObitFArrayModeFP ObitFArrayMode;
+/** Function pointer to robust statistics of pixel distribution.*/
+ObitFArrayStatsFP ObitFArrayStats;
 /** Function pointer to find Mean of pixel distribution */
 ObitFArrayMeanFP ObitFArrayMean;
 /** Function pointer to fill elements of an FArray */
@@ -151,3 +153,13 @@ ObitFArrayPowFP ObitFArrayPow;
 ObitFArrayRandomFP ObitFArrayRandom;
 /** Function pointer to fill with Gaussian distributed random numbers */
 ObitFArrayRandomFillFP ObitFArrayRandomFill;
+/** Function pointer to start fused expression */
+ObitFArrayExprCreateFP ObitFArrayExprCreate;
+/** Function pointer to delete fused expression */
+ObitFArrayExprFreeFP ObitFArrayExprFree;
+/** Function pointer to add array operation to fused expression */
+ObitFArrayExprArrFP ObitFArrayExprArr;
+/** Function pointer to add scalar operation to fused expression */
+ObitFArrayExprScalarFP ObitFArrayExprScalar;
+/** Function pointer to evaluate fused expression */
+ObitFArrayExprRunFP ObitFArrayExprRun;
@@ -29,6 +29,8 @@
 #define OBITFARRAYUTIL_H 
 
 #include "ObitFArray.h"
+#include "ObitCArray.h"
+#include "ObitFFT.h"
 #include "ObitErr.h"
 
 /*-------- Obit: Merx mollis mortibus nuper ------------------*/
@@ -63,4 +65,14 @@ ObitFArray* ObitFArrayUtilCorrel (ObitFArray *in1, ObitFArray *in2,
 /** Public: Create Gaussian UV Taper*/
 ObitFArray* ObitFArrayUtilUVGaus (olong *naxis, ofloat *cells, ofloat maprot,
 				  ofloat Gaumaj, ofloat Gaumin, ofloat GauPA);
+/** Public: Get cached 2-D half complex FFT */
+ObitFFT* ObitFArrayUtilGetFFT (ObitFFTdir dir, olong nx, olong ny);
+/** Public: Get cached transform of a convolving kernel */
+ObitCArray* ObitFArrayUtilKernelFT (ObitFArray *kernel, olong nx, olong ny);
+/** Public: Get cached transform of a Gaussian convolving function */
+ObitCArray* ObitFArrayUtilGausFT (olong nx, olong ny, ofloat *cells, 
+				  ofloat maprot, ofloat Gaumaj, ofloat Gaumin, 
+				  ofloat GauPA);
+/** Public: Release cached FFTs and kernel transforms */
+void ObitFArrayUtilConvCacheClear (void);
 #endif /* OBITFARRAYUTIL_H */ 
@@ -87,6 +87,24 @@
  * set using #ObitFFTNThreads; setting nThreads to 1 turns off threading.
  * After all ObitFFT objects are destroyed, calling #ObitFFTClearThreads
  * will clean up after the threading.
+ *
+ * \section Batches Batches of planes
+ * Several planes of the geometry of an ObitFFT can be transformed in one call.
+ * #ObitFFTR2CBatch, #ObitFFTC2RBatch and #ObitFFTC2CBatch take planes 
+ * stored contiguously (e.g. the planes of a cube) and use a single FFTW 
+ * "many" plan.
+ * #ObitFFTC2RPlanes takes planes in separate arrays (e.g. the grids of
+ * the spectral channels of an ObitUVGridMF).
+ * Small planes are done in parallel, one per thread, large planes one at a 
+ * time using threads inside each transform.
+ *
+ * \section Pruned Pruned transforms
+ * #ObitFFTC2RPruned does a 2D half complex to real transform when only the
+ * first part of each input row can be nonzero (e.g. a uv grid with nothing
+ * beyond the longest baseline) and/or only the inner part of the output 
+ * is wanted.  Transforms of columns known to be zero and of rows not
+ * wanted are skipped.  When there is little to skip the ordinary 2D
+ * transform is used.
  */
 
 /*-------------- enumerations -------------------------------------*/
@@ -186,6 +204,38 @@ void ObitFFTC2C (ObitFFT *in, ObitCArray *inArray, ObitCArray *outArray);
 typedef void (*ObitFFTC2CFP) (ObitFFT *in, ObitCArray *inArray, 
 			    ObitCArray *outArray);
 
+/** Public: Batch of contiguous Real to half Complex. */
+void ObitFFTR2CBatch (ObitFFT *in, olong nPlane, ObitFArray *inArray, 
+		      ObitCArray *outArray);
+typedef void (*ObitFFTR2CBatchFP) (ObitFFT *in, olong nPlane, 
+				   ObitFArray *inArray, ObitCArray *outArray);
+
+/** Public: Batch of contiguous Half Complex to Real. */
+void ObitFFTC2RBatch (ObitFFT *in, olong nPlane, ObitCArray *inArray, 
+		      ObitFArray *outArray);
+typedef void (*ObitFFTC2RBatchFP) (ObitFFT *in, olong nPlane, 
+				   ObitCArray *inArray, ObitFArray *outArray);
+
+/** Public: Batch of contiguous Full Complex to Complex. */
+void ObitFFTC2CBatch (ObitFFT *in, olong nPlane, ObitCArray *inArray, 
+		      ObitCArray *outArray);
+typedef void (*ObitFFTC2CBatchFP) (ObitFFT *in, olong nPlane, 
+				   ObitCArray *inArray, ObitCArray *outArray);
+
+/** Public: Half Complex to Real on a set of separate planes. */
+void ObitFFTC2RPlanes (ObitFFT *in, olong nPlane, ObitCArray **inArrays, 
+		       ObitFArray **outArrays);
+typedef void (*ObitFFTC2RPlanesFP) (ObitFFT *in, olong nPlane, 
+				    ObitCArray **inArrays, 
+				    ObitFArray **outArrays);
+
+/** Public: Pruned 2D Half Complex to Real. */
+void ObitFFTC2RPruned (ObitFFT *in, ObitCArray *inArray, olong nUsed,
+		       olong nKeepX, olong nKeepY, ObitFArray *outArray);
+typedef void (*ObitFFTC2RPrunedFP) (ObitFFT *in, ObitCArray *inArray, 
+				    olong nUsed, olong nKeepX, olong nKeepY,
+				    ObitFArray *outArray);
+
 /*----------- ClassInfo Structure -----------------------------------*/
 /**
  * ClassInfo Structure.
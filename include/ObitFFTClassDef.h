@@ -35,4 +35,14 @@ ObitFFTR2CFP ObitFFTR2C;
 ObitFFTC2RFP ObitFFTC2R;
 /** Function pointer to Full Complex to Complex. */
 ObitFFTC2CFP ObitFFTC2C;
+/** Function pointer to batch of Real to half Complex. */
+ObitFFTR2CBatchFP ObitFFTR2CBatch;
+/** Function pointer to batch of Half Complex to Real. */
+ObitFFTC2RBatchFP ObitFFTC2RBatch;
+/** Function pointer to batch of Full Complex to Complex. */
+ObitFFTC2CBatchFP ObitFFTC2CBatch;
+/** Function pointer to Half Complex to Real on separate planes. */
+ObitFFTC2RPlanesFP ObitFFTC2RPlanes;
+/** Function pointer to pruned 2D Half Complex to Real. */
+ObitFFTC2RPrunedFP ObitFFTC2RPruned;
 
@@ -46,6 +46,22 @@ olong dim[7];
 fftwf_plan CPlan;
 /** FFTW3 plan for Half Complex/Real transforms */
 fftwf_plan RPlan;
+/** FFTW3 "many" plan for batches of contiguous planes */
+fftwf_plan BPlan;
+/** Number of planes in BPlan */
+olong nBPlan;
+/** Number of threads BPlan was made with */
+olong nBThread;
+/** Single threaded FFTW3 plan for planes done in parallel */
+fftwf_plan PPlan;
+/** FFTW3 plan for the columns of a pruned Half Complex to Real */
+fftwf_plan VPlan;
+/** Number of columns in VPlan */
+olong nVPlan;
+/** FFTW3 plan for the rows of a pruned Half Complex to Real */
+fftwf_plan UPlan;
+/** Number of rows in UPlan */
+olong nUPlan;
 
 #elif HAVE_FFTW==1  /* FFTW 2 version */
 /** FFTW plan for full Complex transforms*/
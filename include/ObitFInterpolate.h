@@ -105,6 +105,10 @@ void ObitFInterpolateReplace (ObitFInterpolate *in, ObitFArray *newArray);
 /** Public: Interpolate Pixel in 2D array */
 ofloat ObitFInterpolatePixel (ObitFInterpolate *in, ofloat *pixel, ObitErr *err);
 
+/** Public: Interpolate a row of pixels in 2D array */
+void ObitFInterpolateRow (ObitFInterpolate *in, olong n, ofloat *xPix, ofloat *yPix,
+			  ofloat *out);
+
 /** Public: Interpolate value in 1- array */
 ofloat ObitFInterpolate1D (ObitFInterpolate *in, ofloat pixel);
 
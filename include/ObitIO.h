@@ -206,6 +206,16 @@ typedef void (*ObitIOCreateBufferFP) (ofloat **data, ollong *size, ObitIO *in,
 void ObitIOFreeBuffer (ofloat *buffer);
 typedef void (*ObitIOFreeBufferFP) (ofloat *buffer);
 
+/** Public: Get buffer from pool */
+ofloat* ObitIOGetBuffer (ofloat *data, ollong size, const gchar *name, 
+			 gboolean zero);
+
+/** Public: Set maximum size of buffer pool */
+void ObitIOSetBufferPool (olong maxMByte);
+
+/** Public: Release buffers held in pool */
+void ObitIOTrimBufferPool (void);
+
 /** Public: Create an associated Table 
  * Typed as base class to avoid problems. */
 Obit* newObitIOTable (ObitIO *in, ObitIOAccess access, 
@@ -293,6 +293,9 @@ void ObitImageCloneMem (ObitImage *in, ObitImage *out, ObitErr *err);
 ObitIOCode ObitImageOpen (ObitImage *in, ObitIOAccess access, 
 			  ObitErr *err);
 
+/** Public: Count of opens for write of the underlying file */
+olong ObitImageGetWriteGen (ObitImage *in);
+
 /** Public: Close file and become inactive */
 ObitIOCode ObitImageClose (ObitImage *in, ObitErr *err);
 
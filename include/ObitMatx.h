@@ -185,6 +185,10 @@ typedef void (*ObitMatxOuterMult2CFP) (ObitMatx *in1, ObitMatx *in2, ObitMatx *o
 /** 4x4 complex matrix * 4x1 complex vector multiply */
 void ObitMatxVec4Mult(ObitMatx *in1, ObitMatx *in2, ObitMatx *out);
 typedef void (*ObitMatxVec4MultFP) (ObitMatx *in1, ObitMatx *in2, ObitMatx *out);
+/** Batch of 4x4 complex matrix * 4x1 complex vector multiplies */
+void ObitMatxVec4MultBatch(ofloat *mat, olong minc, ofloat *vec, ofloat *out, olong n);
+typedef void (*ObitMatxVec4MultBatchFP) (ofloat *mat, olong minc, ofloat *vec, 
+					 ofloat *out, olong n);
 
 /*----------- ClassInfo Structure -----------------------------------*/
 /**
@@ -77,6 +77,24 @@ void ObitMemPrint (FILE *file);
 /** Public: Summary of contents */
 void ObitMemSummary (olong *number, olong *total);
 
+/** Public: High water mark of total allocation */
+olong ObitMemHighWater (void);
+
+/** Public: Enable/disable accounting */
+void ObitMemSetAccount (gboolean doAccount);
+
+/** Public: Set size of cache of freed large blocks */
+void ObitMemSetCache (olong maxMByte);
+
+/** Public: Release cached large blocks */
+void ObitMemTrim (olong keepMByte);
+
+/** Public: Count memory held by another cache against cache limit */
+gboolean ObitMemCacheHold (gsize bytes);
+
+/** Public: Return memory held by ObitMemCacheHold */
+void ObitMemCacheRelease (gsize bytes);
+
 /*-------------------Class Info--------------------------*/
 /**
  * ClassInfo Structure.
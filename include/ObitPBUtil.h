@@ -40,6 +40,48 @@
  */
 
 
+/*-------------- enumerations -------------------------------------*/
+/**
+ * \enum obitPBUtilType
+ * enum for analytic beam shape tabulated in an ObitPBUtilTab
+ */
+enum obitPBUtilType {
+  /** VLA polynomial, ObitPBUtilPoly */
+  OBIT_PBUtil_Poly,
+  /** Uniformly illuminated aperture, ObitPBUtilJinc */
+  OBIT_PBUtil_Jinc,
+  /** KAT-7 polynomial, ObitPBUtilKAT7 */
+  OBIT_PBUtil_KAT7
+}; /* end enum obitPBUtilType */
+/** typedef for enum for ObitPBUtilTab beam shape. */
+typedef enum obitPBUtilType ObitPBUtilType;
+
+/*-------------- structures -------------------------------------*/
+/**
+ * Tabulated beam shape.
+ * The analytic beams are functions of Angle*Freq within a frequency band
+ * so a single table in that product serves all frequencies in the band.
+ * Values beyond the table or out of the band are computed directly.
+ */
+typedef struct {
+  /** Beam shape */
+  ObitPBUtilType type;
+  /** Antenna diameter (m) */
+  ofloat antSize;
+  /** Minimum gain */
+  ofloat pbmin;
+  /** Range of frequency (Hz) for which table valid */
+  odouble freqLo, freqHi;
+  /** Maximum Angle*Freq (deg*GHz) in table */
+  odouble maxArg;
+  /** Inverse of table spacing in Angle*Freq (deg*GHz) */
+  odouble iDelta;
+  /** Number of table entries */
+  olong n;
+  /** Power gain table */
+  ofloat *gain;
+} ObitPBUtilTab;
+
 /*---------------Public functions---------------------------*/
 /** Use polynomial beam shape - useful for VLA frequencies < 1.0 GHz */
 ofloat ObitPBUtilPoly (odouble Angle, odouble Freq, ofloat pbmin);
@@ -58,6 +100,27 @@ ofloat ObitPBUtilRelPB (odouble Angle, olong nfreq, odouble *Freq, ofloat antSiz
 ofloat ObitPBUtilPntErr (odouble Angle, odouble AngleO, ofloat antSize, 
 			 ofloat pbmin, odouble Freq);
 
+/** Create tabulated beam shape */
+ObitPBUtilTab* ObitPBUtilTabCreate (ObitPBUtilType type, odouble Freq, 
+				    ofloat antSize, ofloat pbmin, ofloat maxErr);
+
+/** Copy tabulated beam shape */
+ObitPBUtilTab* ObitPBUtilTabCopy (ObitPBUtilTab *in);
+
+/** Delete tabulated beam shape */
+ObitPBUtilTab* ObitPBUtilTabFree (ObitPBUtilTab *in);
+
+/** Is tabulated beam shape usable for a given frequency/antenna size/min gain? */
+gboolean ObitPBUtilTabValid (ObitPBUtilTab *in, odouble Freq, ofloat antSize, 
+			     ofloat pbmin);
+
+/** Beam gain from tabulated beam shape */
+ofloat ObitPBUtilTabGain (ObitPBUtilTab *in, odouble Angle, odouble Freq);
+
+/** Beam gains for an array of angles from tabulated beam shape */
+void ObitPBUtilTabGainVec (ObitPBUtilTab *in, olong n, ofloat *Angle, 
+			   odouble Freq, ofloat *gain);
+
 /** Correct ObitTableCC for relative Primary Beam */
 ObitTableCC *ObitPBUtilCCCor(ObitImage *image, olong inCCver, olong *outCCver, 
 			     olong nfreq, odouble *Freq, ofloat antSize, ofloat pbmin,
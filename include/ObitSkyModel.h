@@ -88,8 +88,16 @@
  * \li  "BComp" OBIT_int (?,1,1) Start CC to use per table, 1-rel [def 1 ]
  * \li  "EComp" OBIT_int (?,1,1) Highest CC to use per table, 1-rel [def to end ]
  * \li "prtLv" OBIT_int message level  [def 0]
+ * \li "clusTol" OBIT_float (1,1,1) If >0, point components in a DFT model are 
+ *               grouped in spatial clusters and each cluster transformed by a 
+ *               series expansion about its center when the error relative to
+ *               the cluster flux is less than clusTol [def 0 = no clustering]
  */
 
+/*--------------Class definitions-------------------------------------*/
+/** Maximum number of levels of DFT component clusters */
+#define SKYMODEL_MAXCLUSLEV 12
+
 /*-------------- enumerations -------------------------------------*/
 /**
  * \enum obitSkyModelType
@@ -250,6 +258,18 @@ ObitIOCode ObitSkyModelDivUV (ObitSkyModel *in, ObitUV *indata, ObitUV *outdata,
 typedef ObitIOCode (*ObitSkyModelDivUVFP) (ObitSkyModel *in, ObitUV *indata, 
 					  ObitUV *outdata, ObitErr *err);
 
+/** Public: Start subtracting model from an ObitUV as it is read */
+gboolean ObitSkyModelSubUVStream (ObitSkyModel *in, ObitUV *uvdata, 
+				  ObitErr *err);
+typedef gboolean (*ObitSkyModelSubUVStreamFP) (ObitSkyModel *in, ObitUV *uvdata, 
+					       ObitErr *err);
+
+/** Public: Stop subtracting model from an ObitUV as it is read */
+void ObitSkyModelSubUVStreamEnd (ObitSkyModel *in, ObitUV *uvdata, 
+				 ObitErr *err);
+typedef void (*ObitSkyModelSubUVStreamEndFP) (ObitSkyModel *in, ObitUV *uvdata, 
+					      ObitErr *err);
+
 /** Public: Load specified image and plane */
 gboolean ObitSkyModelLoad (ObitSkyModel *in, olong image, ObitUV *uvdata,
 			     ObitErr *err);
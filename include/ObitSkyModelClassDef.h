@@ -43,6 +43,10 @@ ObitSkyModelLoadFP ObitSkyModelLoad;
 ObitSkyModelSubUVFP ObitSkyModelSubUV;
 /** Function pointer to  Divide model into an ObitUV */
 ObitSkyModelDivUVFP ObitSkyModelDivUV;
+/** Function pointer to Start subtracting model from an ObitUV as read */
+ObitSkyModelSubUVStreamFP ObitSkyModelSubUVStream;
+/** Function pointer to Stop subtracting model from an ObitUV as read */
+ObitSkyModelSubUVStreamEndFP ObitSkyModelSubUVStreamEnd;
 /** Function pointer to Calculate Fourier transform of model for 
     current buffer in an ObitUV*/
 ObitSkyModelFTFP ObitSkyModelFT;
@@ -133,6 +133,33 @@ gpointer **threadArgs;
 ObitThreadFunc DFTFunc;
 /** Gridded Fourier transform routine  */
 ObitThreadFunc GridFunc;
+/** Incremental subtraction: only subtract components not already 
+    subtracted from the output of the previous call */
+gboolean doIncr;
+/** Incremental: number of images in incrStart, incrComp, incrVer */
+olong incrNumber;
+/** Incremental: first component per image in subtracted model, NULL => none */
+olong *incrStart;
+/** Incremental: highest component per image already subtracted */
+olong *incrComp;
+/** Incremental: CC table version per image of subtracted model */
+olong *incrVer;
+/** Incremental: factor used for subtracted model */
+ofloat incrFactor;
+/** Incremental: input and output data of previous subtraction */
+ObitUV *incrIn, *incrOut;
+/** Maximum error of component cluster expansions in the DFT relative
+    to the cluster flux, <=0 => no clustering */
+ofloat clusTol;
+/** Number of levels of component clusters, 0 => none */
+olong nClusLev;
+/** Per level: number of clusters, first cluster, maximum cluster radius */
+olong clusNum[SKYMODEL_MAXCLUSLEV], clusOff[SKYMODEL_MAXCLUSLEV];
+ofloat clusRad[SKYMODEL_MAXCLUSLEV];
+/** Per cluster: first (0-rel) component in comps and number of components */
+olong *clusFirst, *clusCount;
+/** Cluster table, per row: x,y,z phase terms of center, radius, moments */
+ObitFArray *clusTab;
 #if HAVE_GPU==1  /*  GPU? */
 ObitGPUSkyModel *GPUSkyModel;
 #else            /* Dummy pointer */
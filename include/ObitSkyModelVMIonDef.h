@@ -40,6 +40,9 @@ ObitFArray *uRotTab;
 ObitFArray *ZernY;
 /** Table of Zernike Y gradient terms,  ncoef needed per row (field) */
 ObitFArray *ZernX;
+/** Table of position offset (x,y,z phase terms) per unit Zernike coefficient
+    including rotation, 3*ncoef needed per row (field) */
+ObitFArray *ZernXYZ;
 /** if true need 3D rotation multiply by matrix */
 gboolean do3Dmul;
 /** cosine, sine of rotation difference between uv, image */
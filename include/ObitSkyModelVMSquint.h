@@ -36,6 +36,8 @@
 #include "ObitImageMosaic.h"
 #include "ObitUV.h"
 #include "ObitSkyModelVM.h"
+#include "ObitAntennaEphem.h"
+#include "ObitPBUtil.h"
 
 /*-------- Obit: Merx mollis mortibus nuper ------------------*/
 /**
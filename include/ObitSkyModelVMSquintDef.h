@@ -52,6 +52,10 @@ gboolean *isEVLA;
 olong numAntList;
 /** Antenna List for parallactic angle */
 ObitAntennaList **AntList;
+/** Parallactic angle ephemeris per subarray */
+ObitAntennaEphem **AntEphem;
+/** Tabulated beam shape for squint gains */
+ObitPBUtilTab *PBTab;
 /** Current source */
 ObitSource *curSource;
 /** Save Stokes request */
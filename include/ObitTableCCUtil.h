@@ -87,6 +87,11 @@ enum obitCCCompType {
 /** typedef for enum for ObitCCCompType. */
 typedef enum obitCCCompType ObitCCCompType;
 
+/*-------------- structures -------------------------------------*/
+/** Sky position index of the CC components of a set of images,
+    contents private to ObitTableCCUtil */
+typedef struct ObitTableCCUtilSkyIndexStr ObitTableCCUtilSkyIndex;
+
 /*---------------Public functions---------------------------*/
 /** Public: grid components onto a grid */
 ObitIOCode ObitTableCCUtilGrid (ObitTableCC *in, olong OverSample, 
@@ -110,6 +115,28 @@ ObitTableCCUtilCrossList (ObitTableCC *inCC, ObitImageDesc *inDesc,
 			  ObitImageDesc *outDesc, ofloat gparm[3], 
 			  olong *ncomps, ObitErr *err);
 
+/** Public: Create sky position index of CCs for a set of images */
+ObitTableCCUtilSkyIndex* ObitTableCCUtilSkyIndexCreate (olong nfield);
+
+/** Public: Add the CCs of one field to a sky index */
+void ObitTableCCUtilSkyIndexAdd (ObitTableCCUtilSkyIndex *index, olong ifield,
+				 ObitTableCC *inCC, ObitImageDesc *inDesc, 
+				 ObitErr *err);
+
+/** Public: May CCs of a field in a sky index be in another image? */
+gboolean ObitTableCCUtilSkyIndexOverlap (ObitTableCCUtilSkyIndex *index, 
+					 olong ifield, ObitImageDesc *outDesc);
+
+/** Public: return list of CC from one indexed field overlapping an image */
+ObitFArray* 
+ObitTableCCUtilSkyIndexCrossList (ObitTableCCUtilSkyIndex *index, olong ifield,
+				  ObitImageDesc *outDesc, ofloat gparm[3], 
+				  olong *ncomps, ObitErr *err);
+
+/** Public: Delete sky index */
+ObitTableCCUtilSkyIndex* 
+ObitTableCCUtilSkyIndexFree (ObitTableCCUtilSkyIndex *index);
+
 /** Public: return list of spectral components from one image overlapping another */
 ObitFArray* 
 ObitTableCCUtilCrossListSpec (ObitTableCC *inCC, ObitImageDesc *inDesc,  
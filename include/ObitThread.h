@@ -40,6 +40,11 @@
  * read accesses but only a single write (and no concurrent reads).
  * Needs OBIT_THREADS_ENABLED defined at compile time and the output of 
  * pkg-config --libs gthread-2.0 added to the libraries.
+ *
+ * On Linux the worker threads of ObitThreadIterator may be pinned to 
+ * cores or NUMA nodes (see ObitThreadSetAffinity); thread number i of 
+ * a call is always placed on the same core/node so that memory first 
+ * touched by job i (ObitThreadFirstTouch) stays local to it.
  */
 /*--------------Class definitions-------------------------------------*/
 /*-------------------Class Info--------------------------*/
@@ -56,6 +61,8 @@ typedef struct  {
   gboolean haveThreads;
   /** Number of processors for determining number of threads */
   olong nProcessor;
+  /** Thread placement, 0=none, 1=pin to cores, 2=pin to NUMA nodes */
+  olong affinity;
 } ObitThreadClassInfo; 
 
 
@@ -73,6 +80,8 @@ typedef struct {
   gint32 ReferenceCount; 
   /** class info */
   ObitThreadClassInfo *myClassInfo;
+  /** Function the current Thread pool was started for */
+  gpointer poolFunc;
 #ifdef OBIT_THREADS_ENABLED
   /** Pool of threads */
   GThreadPool *pool;
@@ -157,6 +166,16 @@ void ObitThreadAllowThreads (ObitThread* in, olong nThreads);
 /** Public: Returns number of processors which can be multithreaded */
 olong ObitThreadNumProc (ObitThread* in);
 
+/** Public: Sets placement of worker threads on cores/NUMA nodes */
+void ObitThreadSetAffinity (ObitThread* in, olong mode);
+
+/** Public: Returns placement mode of worker threads */
+olong ObitThreadGetAffinity (ObitThread* in);
+
+/** Public: Zero memory in chunks from the threads that will use them */
+void ObitThreadFirstTouch (ObitThread* in, olong nthreads, 
+			   gpointer mem, gsize size);
+
 /** Public: Initializes Thread Pool */
 void ObitThreadPoolInit (ObitThread* in, olong nthreads,
 			 ObitThreadFunc func, gpointer **args);
@@ -73,6 +73,17 @@
  * The following apply to both types of files:
  * \li "nVisPIO", OBIT_int, Max. Number of visibilities per
  *     "Read" or "Write" operation.  Default = 1.
+ * \li "doMemCache", OBIT_bool (1,1,1) If TRUE, the first complete 
+ *     read only pass (Read or ReadSelect) after an Open is saved in memory 
+ *     in compressed form and later passes with the same selection are 
+ *     served from memory without disk I/O or recalibration.
+ *     Visibilities and weights are stored as 16 bit integers scaled 
+ *     per visibility, flagged correlations are returned with 
+ *     zero amplitude.  The copy is discarded on any write to this object 
+ *     and must not be used if the data are modified through another object.
+ *     Default = FALSE.
+ * \li "maxMemCache", OBIT_float (1,1,1) Maximum size of the memory copy 
+ *     in MByte, larger data sets are read from disk.  Default = no limit.
  *
  * \subsection UVFITS FITS files
  * This implementation uses cfitsio which allows using, in addition to
@@ -138,6 +149,85 @@
  */
 
 /*--------------Class definitions-------------------------------------*/
+/** 
+ * Compressed memory resident copy of one pass through the data.
+ * Random parameters are kept as floats followed by the scaling of
+ * the visibilities and of the weights, the (real, imaginary, weight)
+ * of each correlation as scaled 16 bit integers.
+ * The division of the pass into buffers is kept to be replayed.
+ */
+typedef struct {
+  /** Access (OBIT_IO_ReadOnly or OBIT_IO_ReadCal) of the saved pass */
+  ObitIOAccess access;
+  /** TRUE if a complete pass has been saved */
+  gboolean complete;
+  /** TRUE while a pass is being saved */
+  gboolean filling;
+  /** Length of record, number of random parameters, number of correlations */
+  olong lrec, nrparm, ncorr;
+  /** Selection of the saved pass: channels, IFs, Stokes */
+  olong startChann, numberChann, startIF, numberIF;
+  /** Selection of the saved pass: Stokes */
+  gchar Stokes[5];
+  /** Selection of the saved pass: calibration, bandpass, flagging */
+  olong calVersion, BPversion, doBand, FGversion;
+  /** Selection of the saved pass: calibration flags */
+  gboolean doCal, doFlag, doPolCal;
+  /** Selection of the saved pass: time and UV range */
+  ofloat timeRange[2], UVRange[2];
+  /** Selection of the saved pass: visibilities per buffer */
+  olong nVisPIO;
+  /** Selection of the saved pass: channel/IF increments, subarray, FreqID */
+  olong channInc, IFInc, SubA, FreqID;
+  /** Selection of the saved pass: correlation type, BL cal, BP cal */
+  olong corrType, BLversion;
+  /** Selection of the saved pass: calibration flags */
+  gboolean doBLCal, doBPCal, doCalWt, passAll, transPol, bothCorr, dropSubA;
+  /** Selection of the saved pass: smoothing, spectral index */
+  ofloat smooth[3], alpha;
+  /** Selection of the saved pass: spectral index reference frequency */
+  odouble alphaRefF;
+  /** Selection of the saved pass: IF selection flags */
+  olong nifsel;
+  gboolean *IFSel;
+  /** Selection of the saved pass: antenna list and (de)select flag */
+  olong numberAntList;
+  olong *ants;
+  gboolean selectAnts;
+  /** Selection of the saved pass: source list and (de)select flag */
+  olong numberSourcesList;
+  olong *sources;
+  gboolean selectSources;
+  /** Maximum number of bytes to use, <=0 => no limit */
+  ollong maxBytes;
+  /** Number of visibilities saved and allocated */
+  ollong nvis, maxVis;
+  /** Number of buffers saved and allocated */
+  olong nblock, maxBlock;
+  /** Next buffer to return */
+  olong nextBlock;
+  /** First visibility of next buffer */
+  ollong nextVis;
+  /** First visibility number (1-rel) per buffer */
+  olong *blockFirst;
+  /** Number of visibilities per buffer */
+  olong *blockNum;
+  /** Random parameters, visibility scale and weight scale per visibility */
+  ofloat *rparm;
+  /** Scaled real, imaginary, weight per correlation */
+  gint16 *data;
+} ObitUVMemCache;
+
+/** 
+ * Function applied to each buffer of data read, see ObitUVSetReadFilter.
+ * \param arg    Object given to ObitUVSetReadFilter
+ * \param uvdata ObitUV just read
+ * \param data   Buffer containing data read
+ * \param err    Obit error stack object.
+ */
+typedef void (*ObitUVReadFilterFP) (Obit *arg, gpointer uvdata, ofloat *data, 
+				    ObitErr *err);
+
 /** ObitUV Class structure. */
 typedef struct {
 #include "ObitUVDef.h"   /* this class definition */
@@ -409,6 +499,12 @@ void ObitUVReadKeyword(ObitUV *in,
                        gchar *name, ObitInfoType *type, gint32 *dim,
                        gpointer data, ObitErr *err);
 
+/** Public: Discard memory resident copy of data */
+void ObitUVMemCacheFree (ObitUV *in);
+
+/** Public: Set function applied to each buffer read */
+void ObitUVSetReadFilter (ObitUV *in, ObitUVReadFilterFP func, Obit *arg);
+
 /** Public: Channel selection in FG table */
 olong ObitUVChanSel(ObitUV *in, gint32 *dim, olong *IChanSel, ObitErr *err);
 typedef olong(*ObitUVChanSelFP)(ObitUV *in, gint32 *dim, olong *IChanSel,
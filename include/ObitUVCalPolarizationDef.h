@@ -28,6 +28,7 @@
 #ifndef OBITUVCALPOLARIZATIONDEF_H 
 #define OBITUVCALPOLARIZATIONDEF_H 
 #include "ObitAntennaList.h"
+#include "ObitAntennaEphem.h"
 #include "ObitSourceList.h"
 #include "ObitPolCalList.h"
 
@@ -84,12 +85,19 @@ typedef struct {
   /** Array  current parallactic angles, one per antenna 
    as cosine and sine */
   ofloat *curPA, *curCosPA, *curSinPA;
+  /** Parallactic angle ephemeris for subarray ephemSubA */
+  ObitAntennaEphem *ephem;
+  /** Subarray of ephem */
+  olong ephemSubA;
   /** Subarray inverse Jones matrices (2x2 complex per IF or 
       channel/IF) per antenna */
   ofloat **Jones;
   /** Polarization Mueller matrix for one baseline, all IFs or 
       channel/IFs */
   ofloat *PolCal;
+  /** Work space for data vectors of all selected channels in an IF 
+      as structure of arrays, input then output, 16 * numChan */
+  ofloat *workVec;
   /** Current source RA (rad) */
   odouble curRA;
   /** Cosine current source Declination */
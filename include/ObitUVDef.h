@@ -45,3 +45,9 @@ olong nParallel;
 ObitIO** multiBufIO;
 /** Array of parallel buffers */
 ofloat** multiBuf;
+/** Memory resident compressed copy of the data, see "doMemCache" */
+ObitUVMemCache *memCache;
+/** Function applied to each buffer read, see ObitUVSetReadFilter */
+ObitUVReadFilterFP readFilter;
+/** Argument (referenced) of readFilter */
+Obit *readFilterArg;
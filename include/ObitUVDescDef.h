@@ -158,6 +158,9 @@
   olong ilocid;
   /** 0-rel axis order: Weight-scale parameters for compressed data */
   olong ilocws;
+  /** Random parameter offset: Visibility scale for compressed data 
+      with weights, -1 if none */
+  olong ilocvs;
   /** 0-rel axis order: Complex values */
   olong jlocc;
   /** 0-rel axis order: Stokes' parameters */
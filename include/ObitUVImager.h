@@ -32,6 +32,7 @@
 #include "ObitErr.h"
 #include "ObitUV.h"
 #include "ObitImageMosaic.h"
+#include "ObitSkyModel.h"
 
 /*-------- Obit: Merx mollis mortibus nuper ------------------*/
 /**
@@ -266,6 +267,16 @@ void ObitUVImagerImage (ObitUVImager *in, olong *field, gboolean doWeight,
 typedef void (*ObitUVImagerImageFP) (ObitUVImager *in, olong *field, gboolean doWeight, 
 				     gboolean doBeam, gboolean doFlatten, ObitErr *err);
 
+/** Public: Form residual Image */
+void ObitUVImagerImageResid (ObitUVImager *in, ObitSkyModel *skyModel,
+			     olong *field, gboolean doWeight,
+			     gboolean doBeam, gboolean doFlatten, ObitErr *err);
+/** Typedef for definition of class pointer structure */
+typedef void (*ObitUVImagerImageResidFP) (ObitUVImager *in, ObitSkyModel *skyModel,
+					  olong *field, gboolean doWeight,
+					  gboolean doBeam, gboolean doFlatten,
+					  ObitErr *err);
+
 /** Public: Shift image for 2D */
 void ObitUVImagerShifty (ObitUVImager *in, olong *field, gboolean doall, ObitErr *err);
 /** Typedef for definition of class pointer structure */
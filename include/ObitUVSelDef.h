@@ -79,6 +79,8 @@ olong FreqID;
 gboolean doCalSelect;
 /** Input data compressed? */
 gboolean Compress;
+/** Compressed output keeps a weight per correlation */
+gboolean CompressWt;
 /** Translate Stokes? */
 gboolean transPol;
 /** Need both correlations to form output Stokes parameter? */
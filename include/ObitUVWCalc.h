@@ -113,6 +113,13 @@ typedef void (*ObitUVWCalcUVWFP) (ObitUVWCalc *in, ofloat time, olong SId,
 				  olong subA, olong ant1, olong ant2, 
 				  ofloat *uvw, ObitErr *err);
 
+/** Public: Calculate u,v,w for a buffer of visibilities */
+void ObitUVWCalcUVWBuffer (ObitUVWCalc *in, ObitUVDesc *desc, ofloat *buffer, 
+			   olong nvis, ObitErr *err);
+/** Typedef for definition of class pointer structure */
+typedef void (*ObitUVWCalcUVWBufferFP) (ObitUVWCalc *in, ObitUVDesc *desc, 
+					ofloat *buffer, olong nvis, ObitErr *err);
+
 /*----------- ClassInfo Structure -----------------------------------*/
 /**
  * ClassInfo Structure.
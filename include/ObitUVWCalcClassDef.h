@@ -30,3 +30,5 @@
 ObitUVWCalcCreateFP ObitUVWCalcCreate;
 /** Function pointer to Calculate uvw. */
 ObitUVWCalcUVWFP ObitUVWCalcUVW;
+/** Function pointer to Calculate uvw for a buffer. */
+ObitUVWCalcUVWBufferFP ObitUVWCalcUVWBuffer;
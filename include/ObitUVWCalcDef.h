@@ -77,3 +77,7 @@ odouble cRA, sRA;
 odouble obsPos[3];
 /** Antenna coordinates in celestial frame */
 odouble *xm, *ym, *zm;
+/** u,v,w (wavelengths) per antenna for current time, source */
+odouble *uAnt, *vAnt, *wAnt;
+/** Are uAnt, vAnt, wAnt valid for current time, source? */
+gboolean uvwValid;
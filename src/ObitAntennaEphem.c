@@ -0,0 +1,622 @@
+/* $Id$        */
+/*--------------------------------------------------------------------*/
+/*;  Copyright (C) 2026                                               */
+/*;  Associated Universities, Inc. Washington DC, USA.                */
+/*;                                                                   */
+/*;  This program is free software; you can redistribute it and/or    */
+/*;  modify it under the terms of the GNU General Public License as   */
+/*;  published by the Free Software Foundation; either version 2 of   */
+/*;  the License, or (at your option) any later version.              */
+/*;                                                                   */
+/*;  This program is distributed in the hope that it will be useful,  */
+/*;  but WITHOUT ANY WARRANTY; without even the implied warranty of   */
+/*;  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    */
+/*;  GNU General Public License for more details.                     */
+/*;                                                                   */
+/*;  You should have received a copy of the GNU General Public        */
+/*;  License along with this program; if not, write to the Free       */
+/*;  Software Foundation, Inc., 675 Massachusetts Ave, Cambridge,     */
+/*;  MA 02139, USA.                                                   */
+/*;                                                                   */
+/*;Correspondence about this software should be addressed as follows: */
+/*;         Internet email: bcotton@nrao.edu.                         */
+/*;         Postal address: William Cotton                            */
+/*;                         National Radio Astronomy Observatory      */
+/*;                         520 Edgemont Road                         */
+/*;                         Charlottesville, VA 22903-2475 USA        */
+/*--------------------------------------------------------------------*/
+
+#include "ObitAntennaEphem.h"
+
+/*----------------Obit: Merx mollis mortibus nuper ------------------*/
+/**
+ * \file ObitAntennaEphem.c
+ * ObitAntennaEphem class function definitions.
+ * This class is derived from the Obit base class.
+ */
+
+/** name of the class defined in this file */
+static gchar *myClassName = "ObitAntennaEphem";
+
+/** Function to obtain parent ClassInfo */
+static ObitGetClassFP ObitParentGetClass = ObitGetClass;
+
+/**
+ * ClassInfo structure ObitAntennaEphemClassInfo.
+ * This structure is used by class objects to access class functions.
+ */
+static ObitAntennaEphemClassInfo myClassInfo = {FALSE};
+
+/*--------------- File Global Variables  ----------------*/
+/** Default grid spacing (day) = 1 min */
+#define EPHEMDELTIME (1.0/1440.0)
+/** Number of grid times in a tabulation */
+#define EPHEMNGRID 61
+/** Maximum number of source tabulations kept */
+#define EPHEMMAXSEG 64
+
+/*---------------Private structures----------------*/
+/** Tabulation for one source */
+typedef struct {
+  /** Source ID */
+  olong SourID;
+  /** Apparent position (deg) used */
+  odouble RAApp, DecApp;
+  /** Time (day) of first grid point */
+  odouble tStart;
+  /** Sine of elevation [nGrid][nant] */
+  ofloat *sinEl;
+  /** Azimuth arctangent arguments [nGrid][nant] */
+  ofloat *azNum, *azDen;
+  /** Parallactic angle arctangent arguments [nGrid][nant] */
+  ofloat *paNum, *paDen;
+} ObitAntennaEphemSeg;
+
+/*---------------Private function prototypes----------------*/
+/** Private: Initialize newly instantiated object. */
+void  ObitAntennaEphemInit  (gpointer in);
+
+/** Private: Deallocate members. */
+void  ObitAntennaEphemClear (gpointer in);
+
+/** Private: Set Class function pointers. */
+static void ObitAntennaEphemClassInfoDefFn (gpointer inClass);
+
+/** Private: Find/compute tabulation for source, time */
+static ObitAntennaEphemSeg* ObitAntennaEphemGetSeg (ObitAntennaEphem *in, 
+						    ofloat time, 
+						    ObitSource *Source);
+
+/** Private: Fill tabulation */
+static void ObitAntennaEphemFillSeg (ObitAntennaEphem *in, 
+				     ObitAntennaEphemSeg *seg);
+
+/** Private: Delete tabulation */
+static void ObitAntennaEphemFreeSeg (ObitAntennaEphemSeg *seg);
+
+/** Private: Interpolate values for one antenna */
+static void ObitAntennaEphemInterp (ObitAntennaEphem *in, 
+				    ObitAntennaEphemSeg *seg, ofloat time, 
+				    olong iant, ofloat *elev, ofloat *az, 
+				    ofloat *parAng);
+
+/*----------------------Public functions---------------------------*/
+/**
+ * Constructor.
+ * Initializes class if needed on first call.
+ * \param name An optional name for the object.
+ * \return the new object.
+ */
+ObitAntennaEphem* newObitAntennaEphem (gchar* name)
+{
+  ObitAntennaEphem* out;
+
+  /* Class initialization if needed */
+  if (!myClassInfo.initialized) ObitAntennaEphemClassInit();
+
+  /* allocate/init structure */
+  out = g_malloc0(sizeof(ObitAntennaEphem));
+
+  /* initialize values */
+  if (name!=NULL) out->name = g_strdup(name);
+  else out->name = g_strdup("Noname");
+
+  /* set ClassInfo */
+  out->ClassInfo = (gpointer)&myClassInfo;
+
+  /* initialize other stuff */
+  ObitAntennaEphemInit((gpointer)out);
+
+ return out;
+} /* end newObitAntennaEphem */
+
+/**
+ * Returns ClassInfo pointer for the class.
+ * \return pointer to the class structure.
+ */
+gconstpointer ObitAntennaEphemGetClass (void)
+{
+  /* Class initialization if needed */
+  if (!myClassInfo.initialized) ObitAntennaEphemClassInit();
+
+  return (gconstpointer)&myClassInfo;
+} /* end ObitAntennaEphemGetClass */
+
+/**
+ * Creates an ObitAntennaEphem for an antenna list
+ * \param name    An optional name for the object.
+ * \param AntList Antenna list (e.g. from AN table), reference kept
+ * \param delTime Spacing of the time grid (day), <=0 => 1 min.
+ * \return the new object.
+ */
+ObitAntennaEphem* ObitAntennaEphemCreate (gchar* name, ObitAntennaList *AntList,
+					  ofloat delTime)
+{
+  ObitAntennaEphem* out;
+  ObitAntenna *ant;
+  olong i;
+  odouble alat, along;
+
+  /* Create basic structure */
+  out = newObitAntennaEphem (name);
+
+  out->AntList = ObitAntennaListRef(AntList);
+  out->nant    = AntList->number;
+  if (delTime>0.0) out->delTime = delTime;
+  else             out->delTime = EPHEMDELTIME;
+  out->nGrid   = EPHEMNGRID;
+
+  /* Antenna number index, if missing use first as ObitAntennaList does */
+  out->maxAnt = 0;
+  for (i=0; i<out->nant; i++) 
+    out->maxAnt = MAX (out->maxAnt, AntList->ANlist[i]->AntID);
+  out->antIndex = g_malloc0((out->maxAnt+2)*sizeof(olong));
+  for (i=0; i<out->nant; i++) 
+    if (AntList->ANlist[i]->AntID>=0)
+      out->antIndex[AntList->ANlist[i]->AntID] = i;
+
+  /* Antenna locations */
+  out->antGeom = g_malloc0((8*out->nant+1)*sizeof(odouble));
+  out->isValid = g_malloc0((out->nant+1)*sizeof(gboolean));
+  out->isAltAz = g_malloc0((out->nant+1)*sizeof(gboolean));
+  for (i=0; i<out->nant; i++) {
+    ant = AntList->ANlist[i];
+    out->isValid[i] = ant->AntID>=0;
+    alat  = ant->AntLat;
+    along = ant->AntLong;
+    out->antGeom[i*8+0] = cos(alat);
+    out->antGeom[i*8+1] = sin(alat);
+    out->antGeom[i*8+2] = cos(along);
+    out->antGeom[i*8+3] = sin(along);
+    /* If EVLA - all should have ~ same PA */
+    if (AntList->isVLA) {
+      alat  =   34.0787492*DG2RAD; /* VLA Latitude */
+      along = -107.618283*DG2RAD;  /* VLA Longitude */
+      out->isAltAz[i] = TRUE;
+    } else {
+      out->isAltAz[i] = ant->AntMount==0;
+    }
+    out->antGeom[i*8+4] = cos(alat);
+    out->antGeom[i*8+5] = sin(alat);
+    out->antGeom[i*8+6] = cos(along);
+    out->antGeom[i*8+7] = sin(along);
+  } /* end loop over antennas */
+
+  return out;
+} /* end ObitAntennaEphemCreate */
+
+/**
+ * Return source elevation, azimuth and parallactic angle for all antennas
+ * Values are interpolated from a tabulation for the source.
+ * Output arrays are indexed by entry in the antenna list, values 
+ * are as given by ObitAntennaListElev, ObitAntennaListAz and 
+ * ObitAntennaListParAng.
+ * \param in      The ephemeris object
+ * \param time    Time in Days
+ * \param Source  Source structure, uses SourID, RAApp, DecApp
+ * \param elev    [out] elevation in radians, fblank if antenna 
+ *                not present, may be NULL if not wanted
+ * \param az      [out] azimuth in radians, fblank if antenna 
+ *                not present, may be NULL if not wanted
+ * \param parAng  [out] parallactic angle in radians, 0 if not Alt-Az 
+ *                mount, may be NULL if not wanted
+ */
+void ObitAntennaEphemGeom (ObitAntennaEphem *in, ofloat time, ObitSource *Source,
+			   ofloat *elev, ofloat *az, ofloat *parAng)
+{
+  ObitAntennaEphemSeg *seg;
+  olong iant;
+
+  ObitThreadLock(in->thread);
+  seg = ObitAntennaEphemGetSeg (in, time, Source);
+  for (iant=0; iant<in->nant; iant++) 
+    ObitAntennaEphemInterp (in, seg, time, iant, 
+			    elev   ? &elev[iant]   : NULL,
+			    az     ? &az[iant]     : NULL,
+			    parAng ? &parAng[iant] : NULL);
+  ObitThreadUnlock(in->thread);
+} /* end ObitAntennaEphemGeom */
+
+/**
+ * Return source elevation in radians for a given antenna, time, and source.
+ * \param in      The ephemeris object
+ * \param ant     Antenna number (1-rel)
+ * \param time    Time in Days
+ * \param Source  Source structure
+ * \return elevation in radians (fblank if antenna not present )
+ */
+ofloat ObitAntennaEphemElev (ObitAntennaEphem *in, olong ant, ofloat time, 
+			     ObitSource *Source)
+{
+  ObitAntennaEphemSeg *seg;
+  ofloat elev;
+  olong iant;
+
+  iant = ((ant>=0) && (ant<=in->maxAnt)) ? in->antIndex[ant] : 0;
+  ObitThreadLock(in->thread);
+  seg  = ObitAntennaEphemGetSeg (in, time, Source);
+  ObitAntennaEphemInterp (in, seg, time, iant, &elev, NULL, NULL);
+  ObitThreadUnlock(in->thread);
+  return elev;
+} /* end ObitAntennaEphemElev */
+
+/**
+ * Return source azimuth in radians for a given antenna, time, and source.
+ * \param in      The ephemeris object
+ * \param ant     Antenna number (1-rel)
+ * \param time    Time in Days
+ * \param Source  Source structure
+ * \return azimuth in radians (fblank if antenna not present )
+ */
+ofloat ObitAntennaEphemAz (ObitAntennaEphem *in, olong ant, ofloat time, 
+			   ObitSource *Source)
+{
+  ObitAntennaEphemSeg *seg;
+  ofloat az;
+  olong iant;
+
+  iant = ((ant>=0) && (ant<=in->maxAnt)) ? in->antIndex[ant] : 0;
+  ObitThreadLock(in->thread);
+  seg  = ObitAntennaEphemGetSeg (in, time, Source);
+  ObitAntennaEphemInterp (in, seg, time, iant, NULL, &az, NULL);
+  ObitThreadUnlock(in->thread);
+  return az;
+} /* end ObitAntennaEphemAz */
+
+/**
+ * Return parallactic angle in radians for a given antenna, time, and source.
+ * \param in      The ephemeris object
+ * \param ant     Antenna number (1-rel)
+ * \param time    Time in Days
+ * \param Source  Source structure
+ * \return parallactic angle in radians (fblank if antenna not present )
+ */
+ofloat ObitAntennaEphemParAng (ObitAntennaEphem *in, olong ant, ofloat time, 
+			       ObitSource *Source)
+{
+  ObitAntennaEphemSeg *seg;
+  ofloat parAng;
+  olong iant;
+
+  iant = ((ant>=0) && (ant<=in->maxAnt)) ? in->antIndex[ant] : 0;
+  ObitThreadLock(in->thread);
+  seg  = ObitAntennaEphemGetSeg (in, time, Source);
+  ObitAntennaEphemInterp (in, seg, time, iant, NULL, NULL, &parAng);
+  ObitThreadUnlock(in->thread);
+  return parAng;
+} /* end ObitAntennaEphemParAng */
+
+/**
+ * Initialize global ClassInfo Structure.
+ */
+void ObitAntennaEphemClassInit (void)
+{
+  if (myClassInfo.initialized) return;  /* only once */
+  
+  /* Set name and parent for this class */
+  myClassInfo.ClassName   = g_strdup(myClassName);
+  myClassInfo.ParentClass = ObitParentGetClass();
+
+  /* Set function pointers */
+  ObitAntennaEphemClassInfoDefFn ((gpointer)&myClassInfo);
+ 
+  myClassInfo.initialized = TRUE; /* Now initialized */
+ 
+} /* end ObitAntennaEphemClassInit */
+
+/**
+ * Initialize global ClassInfo Function pointers.
+ */
+static void ObitAntennaEphemClassInfoDefFn (gpointer inClass)
+{
+  ObitAntennaEphemClassInfo *theClass = (ObitAntennaEphemClassInfo*)inClass;
+  ObitClassInfo *ParentClass = (ObitClassInfo*)myClassInfo.ParentClass;
+
+  if (theClass->initialized) return;  /* only once */
+
+  /* Check type of inClass */
+  g_assert (ObitInfoIsA(inClass, (ObitClassInfo*)&myClassInfo));
+
+  /* Initialize (recursively) parent class first */
+  if ((ParentClass!=NULL) && 
+      (ParentClass->ObitClassInfoDefFn!=NULL))
+    ParentClass->ObitClassInfoDefFn(theClass);
+
+  /* function pointers defined or overloaded this class */
+  theClass->ObitClassInit = (ObitClassInitFP)ObitAntennaEphemClassInit;
+  theClass->ObitClassInfoDefFn = (ObitClassInfoDefFnFP)ObitAntennaEphemClassInfoDefFn;
+  theClass->ObitGetClass  = (ObitGetClassFP)ObitAntennaEphemGetClass;
+  theClass->newObit       = (newObitFP)newObitAntennaEphem;
+  theClass->ObitCopy      = NULL;
+  theClass->ObitClone     = NULL;
+  theClass->ObitClear     = (ObitClearFP)ObitAntennaEphemClear;
+  theClass->ObitInit      = (ObitInitFP)ObitAntennaEphemInit;
+  theClass->ObitAntennaEphemCreate = 
+    (ObitAntennaEphemCreateFP)ObitAntennaEphemCreate;
+  theClass->ObitAntennaEphemGeom   = (ObitAntennaEphemGeomFP)ObitAntennaEphemGeom;
+  theClass->ObitAntennaEphemElev   = (ObitAntennaEphemElevFP)ObitAntennaEphemElev;
+  theClass->ObitAntennaEphemAz     = (ObitAntennaEphemAzFP)ObitAntennaEphemAz;
+  theClass->ObitAntennaEphemParAng = 
+    (ObitAntennaEphemParAngFP)ObitAntennaEphemParAng;
+} /* end ObitAntennaEphemClassDefFn */
+
+/*---------------Private functions--------------------------*/
+
+/**
+ * Creates empty member objects, initialize reference count.
+ * Parent classes portions are (recursively) initialized first
+ * \param inn Pointer to the object to initialize.
+ */
+void ObitAntennaEphemInit  (gpointer inn)
+{
+  ObitClassInfo *ParentClass;
+  ObitAntennaEphem *in = inn;
+
+  /* error checks */
+  g_assert (in != NULL);
+
+  /* recursively initialize parent class members */
+  ParentClass = (ObitClassInfo*)(myClassInfo.ParentClass);
+  if ((ParentClass!=NULL) && ( ParentClass->ObitInit!=NULL)) 
+    ParentClass->ObitInit (inn);
+
+  /* set members in this class */
+  in->thread   = newObitThread();
+  in->AntList  = NULL;
+  in->antIndex = NULL;
+  in->antGeom  = NULL;
+  in->isValid  = NULL;
+  in->isAltAz  = NULL;
+  in->segList  = NULL;
+  in->nant     = 0;
+  in->maxAnt   = 0;
+  in->delTime  = EPHEMDELTIME;
+  in->nGrid    = EPHEMNGRID;
+
+} /* end ObitAntennaEphemInit */
+
+/**
+ * Deallocates member objects.
+ * Does (recursive) deallocation of parent class members.
+ * \param  inn Pointer to the object to deallocate.
+ *           Actually it should be an ObitAntennaEphem* cast to an Obit*.
+ */
+void ObitAntennaEphemClear (gpointer inn)
+{
+  ObitClassInfo *ParentClass;
+  ObitAntennaEphem *in = inn;
+  GSList *tmp;
+
+  /* error checks */
+  g_assert (ObitIsA(in, &myClassInfo));
+
+  /* delete this class members */
+  in->thread  = ObitThreadUnref(in->thread);
+  in->AntList = ObitAntennaListUnref (in->AntList);
+  if (in->antIndex) {g_free(in->antIndex); in->antIndex = NULL;}
+  if (in->antGeom)  {g_free(in->antGeom);  in->antGeom  = NULL;}
+  if (in->isValid)  {g_free(in->isValid);  in->isValid  = NULL;}
+  if (in->isAltAz)  {g_free(in->isAltAz);  in->isAltAz  = NULL;}
+  tmp = in->segList;
+  while (tmp) {
+    ObitAntennaEphemFreeSeg ((ObitAntennaEphemSeg*)tmp->data);
+    tmp = g_slist_next(tmp);
+  }
+  if (in->segList) {g_slist_free(in->segList); in->segList = NULL;}
+  
+  /* unlink parent class members */
+  ParentClass = (ObitClassInfo*)(myClassInfo.ParentClass);
+  /* delete parent class members */
+  if ((ParentClass!=NULL) && ( ParentClass->ObitClear!=NULL)) 
+    ParentClass->ObitClear (inn);
+  
+} /* end ObitAntennaEphemClear */
+
+/**
+ * Find tabulation for a source covering a given time, 
+ * creating or recomputing as needed.
+ * The tabulation found is moved to the front of the list and the least 
+ * recently used is dropped if there are too many.
+ * \param in      The ephemeris object
+ * \param time    Time in Days
+ * \param Source  Source structure
+ * \return tabulation
+ */
+static ObitAntennaEphemSeg* ObitAntennaEphemGetSeg (ObitAntennaEphem *in, 
+						    ofloat time, 
+						    ObitSource *Source)
+{
+  ObitAntennaEphemSeg *seg=NULL;
+  GSList *tmp;
+  odouble tEnd, tGrid;
+
+  /* Look for source */
+  tmp = in->segList;
+  while (tmp) {
+    if (((ObitAntennaEphemSeg*)tmp->data)->SourID==Source->SourID) {
+      seg = (ObitAntennaEphemSeg*)tmp->data;
+      break;
+    }
+    tmp = g_slist_next(tmp);
+  }
+
+  if (seg) {
+    /* Move to front */
+    if (tmp!=in->segList) {
+      in->segList = g_slist_remove (in->segList, seg);
+      in->segList = g_slist_prepend (in->segList, seg);
+    }
+    /* Valid for this time and position? */
+    tEnd = seg->tStart + (in->nGrid-1)*(odouble)in->delTime;
+    if ((time>=seg->tStart) && (time<=tEnd) &&
+	(seg->RAApp==Source->RAApp) && (seg->DecApp==Source->DecApp)) 
+      return seg;
+  } else {
+    /* New tabulation */
+    seg = g_malloc0(sizeof(ObitAntennaEphemSeg));
+    seg->sinEl = g_malloc0(in->nGrid*(in->nant+1)*sizeof(ofloat));
+    seg->azNum = g_malloc0(in->nGrid*(in->nant+1)*sizeof(ofloat));
+    seg->azDen = g_malloc0(in->nGrid*(in->nant+1)*sizeof(ofloat));
+    seg->paNum = g_malloc0(in->nGrid*(in->nant+1)*sizeof(ofloat));
+    seg->paDen = g_malloc0(in->nGrid*(in->nant+1)*sizeof(ofloat));
+    seg->tStart = -1.0e20;  /* Not yet valid */
+    in->segList = g_slist_prepend (in->segList, seg);
+    /* Too many? drop least recently used */
+    if (g_slist_length(in->segList)>EPHEMMAXSEG) {
+      tmp = g_slist_last (in->segList);
+      ObitAntennaEphemFreeSeg ((ObitAntennaEphemSeg*)tmp->data);
+      in->segList = g_slist_delete_link (in->segList, tmp);
+    }
+  }
+
+  /* Set window - grid point at or before time, if moving back in 
+     time put time near the end of the window */
+  tGrid = floor (time / in->delTime) * in->delTime;
+  if (time<seg->tStart) tGrid -= (in->nGrid-2) * (odouble)in->delTime;
+  seg->tStart = tGrid;
+  seg->SourID = Source->SourID;
+  seg->RAApp  = Source->RAApp;
+  seg->DecApp = Source->DecApp;
+  ObitAntennaEphemFillSeg (in, seg);
+
+  return seg;
+} /* end ObitAntennaEphemGetSeg */
+
+/**
+ * Compute tabulation
+ * Following ObitAntennaListElev, ObitAntennaListAz and ObitAntennaListParAng
+ * the hour angle of each antenna is obtained by rotating that at 
+ * Greenwich by the antenna longitude.
+ * \param in   The ephemeris object
+ * \param seg  Tabulation with time and source position set
+ */
+static void ObitAntennaEphemFillSeg (ObitAntennaEphem *in, 
+				     ObitAntennaEphemSeg *seg)
+{
+  olong i, iant, indx;
+  odouble t, gst, ha0, cha0, sha0, cha, sha, cdec, sdec, ra, *geom;
+
+  /* Source position in radians */
+  ra   = seg->RAApp * DG2RAD;
+  cdec = cos (seg->DecApp * DG2RAD);
+  sdec = sin (seg->DecApp * DG2RAD);
+
+  for (i=0; i<in->nGrid; i++) {
+    t = seg->tStart + i*(odouble)in->delTime;
+    /* Greenwich siderial time in radians */
+    gst = in->AntList->GSTIAT0  + t*in->AntList->RotRate - in->AntList->dataIat;
+    /* Greenwich hour angle */
+    ha0  = gst - ra;
+    cha0 = cos (ha0);
+    sha0 = sin (ha0);
+    indx = i*in->nant;
+    for (iant=0; iant<in->nant; iant++) {
+      geom = &in->antGeom[iant*8];
+      /* Local hour angle */
+      cha = cha0*geom[2] - sha0*geom[3];
+      sha = sha0*geom[2] + cha0*geom[3];
+      seg->sinEl[indx+iant] = geom[1]*sdec + geom[0]*cdec*cha;
+      seg->azNum[indx+iant] = -cdec*sha;
+      seg->azDen[indx+iant] = sdec*geom[0] - cdec*geom[1]*cha;
+      /* Parallactic angle location */
+      cha = cha0*geom[6] - sha0*geom[7];
+      sha = sha0*geom[6] + cha0*geom[7];
+      seg->paNum[indx+iant] = geom[4]*sha;
+      seg->paDen[indx+iant] = geom[5]*cdec - geom[4]*sdec*cha;
+    } /* end antenna loop */
+  } /* end time loop */
+} /* end ObitAntennaEphemFillSeg */
+
+/**
+ * Delete tabulation
+ * \param seg  Tabulation to delete
+ */
+static void ObitAntennaEphemFreeSeg (ObitAntennaEphemSeg *seg)
+{
+  if (seg==NULL) return;
+  if (seg->sinEl) g_free(seg->sinEl);
+  if (seg->azNum) g_free(seg->azNum);
+  if (seg->azDen) g_free(seg->azDen);
+  if (seg->paNum) g_free(seg->paNum);
+  if (seg->paDen) g_free(seg->paDen);
+  g_free(seg);
+} /* end ObitAntennaEphemFreeSeg */
+
+/**
+ * Interpolate values for one antenna
+ * \param in      The ephemeris object
+ * \param seg     Tabulation covering time
+ * \param time    Time in Days
+ * \param iant    Antenna entry in list (0-rel)
+ * \param elev    [out] elevation (rad) if non NULL
+ * \param az      [out] azimuth (rad) if non NULL
+ * \param parAng  [out] parallactic angle (rad) if non NULL
+ */
+static void ObitAntennaEphemInterp (ObitAntennaEphem *in, 
+				    ObitAntennaEphemSeg *seg, ofloat time, 
+				    olong iant, ofloat *elev, ofloat *az, 
+				    ofloat *parAng)
+{
+  olong i, i1, i2;
+  ofloat w1, w2, arg, num, den, fblank = ObitMagicF();
+  odouble x, daz;
+
+  /* Interpolation weights */
+  x  = (time - seg->tStart) / in->delTime;
+  i  = (olong)x;
+  i  = MAX (0, MIN (i, in->nGrid-2));
+  w2 = (ofloat)(x - i);
+  w1 = 1.0 - w2;
+  i1 = i*in->nant + iant;
+  i2 = i1 + in->nant;
+
+  /* Elevation */
+  if (elev) {
+    if (in->isValid[iant]) {
+      arg = w1*seg->sinEl[i1] + w2*seg->sinEl[i2];
+      *elev = (ofloat)asin (MAX (-1.0, MIN (arg, 1.0)));
+    } else *elev = fblank;
+  }
+
+  /* Azimuth */
+  if (az) {
+    if (in->isValid[iant]) {
+      num = w1*seg->azNum[i1] + w2*seg->azNum[i2];
+      den = w1*seg->azDen[i1] + w2*seg->azDen[i2];
+      daz = atan2 (num, den);
+      if (daz<0.0) daz += 2.0*G_PI;
+      *az = (ofloat)daz;
+    } else *az = fblank;
+  }
+
+  /* Parallactic angle */
+  if (parAng) {
+    if (!in->isAltAz[iant]) *parAng = 0.0;
+    else if (!in->isValid[iant] && !in->AntList->isVLA) *parAng = fblank;
+    else {
+      num = w1*seg->paNum[i1] + w2*seg->paNum[i2];
+      den = w1*seg->paDen[i1] + w2*seg->paDen[i2];
+      *parAng = (ofloat)atan2 (num, den);
+    }
+  }
+} /* end ObitAntennaEphemInterp */
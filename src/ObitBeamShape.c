@@ -164,6 +164,8 @@ ObitBeamShape* ObitBeamShapeCopy  (ObitBeamShape *in, ObitBeamShape *out, ObitEr
   out->itabRefFreq = in->itabRefFreq;
   out->icellSize   = in->icellSize;
   if (in->myFI) out->myFI = ObitFInterpolateCopy(in->myFI,  out->myFI, err);
+  out->PBTab = ObitPBUtilTabFree(out->PBTab);
+  out->PBTab = ObitPBUtilTabCopy(in->PBTab);
   ObitImageDescGetPoint(out->myDesc, &out->raPnt, &out->decPnt) ;
   out->raPnt      *= DG2RAD;
   out->decPnt     *= DG2RAD;
@@ -207,6 +209,8 @@ void ObitBeamShapeClone  (ObitBeamShape *in, ObitBeamShape *out, ObitErr *err)
   out->itabRefFreq = in->itabRefFreq;
   out->icellSize   = in->icellSize;
   out->myFI        = ObitFInterpolateCopy(in->myFI,  out->myFI, err);
+  out->PBTab       = ObitPBUtilTabFree(out->PBTab);
+  out->PBTab       = ObitPBUtilTabCopy(in->PBTab);
   ObitImageDescGetPoint(out->myDesc, &out->raPnt, &out->decPnt) ;
   out->raPnt      *= DG2RAD;
   out->decPnt     *= DG2RAD;
@@ -256,6 +260,19 @@ ObitBeamShape* ObitBeamShapeCreate (gchar* name, ObitImage *image,
   if (doVLITE) FindVLITEBeam(out);   /* Use VLITE beam  */
   else if (doTab)   FindTabBeam(out);     /* Use standard if available */
 
+  /* Tabulate analytic beam if it will be used */
+  if (out->doGain && !out->doTab && !out->doVLITE && !out->doMeerKAT) {
+    if (!strncmp(out->myDesc->teles, "KAT-7",5))
+      out->PBTab = ObitPBUtilTabCreate (OBIT_PBUtil_KAT7, out->refFreq, 
+					out->antSize, 0.0, 0.0);
+    else if (out->doJinc)
+      out->PBTab = ObitPBUtilTabCreate (OBIT_PBUtil_Jinc, out->refFreq, 
+					out->antSize, out->pbmin, 0.0);
+    else
+      out->PBTab = ObitPBUtilTabCreate (OBIT_PBUtil_Poly, out->refFreq, 
+					out->antSize, out->pbmin, 0.0);
+  }
+
   return out;
 } /* end ObitBeamShapeCreate */
 
@@ -286,6 +303,8 @@ ofloat ObitBeamShapeGain (ObitBeamShape *in, odouble ra, odouble dec,
 
   /* Compute */
   if (in->doTab)  gain = GetTabBeam (in, Angle);
+  else if (in->PBTab && (in->PBTab->type!=OBIT_PBUtil_KAT7)) 
+    gain = ObitPBUtilTabGain(in->PBTab, Angle, in->refFreq);
   else if (in->doJinc) gain = ObitPBUtilJinc(Angle, in->refFreq, in->antSize, in->pbmin);
   else                 gain = ObitPBUtilPoly(Angle, in->refFreq, in->pbmin);
   return gain;
@@ -311,6 +330,7 @@ ofloat ObitBeamShapeGainSym (ObitBeamShape *in, odouble Angle)
   if (in->doTab)          gain = GetTabBeam (in, Angle);
   else if (in->doVLITE)   gain = GetTabBeam (in, Angle);
   else if (in->doMeerKAT) gain = GetMKBeam (in, Angle);
+  else if (in->PBTab)     gain = ObitPBUtilTabGain(in->PBTab, Angle, in->refFreq);
   else if (doKAT)         gain = ObitPBUtilKAT7 (Angle, in->refFreq, 0.0);
   else if (in->doJinc)    gain = ObitPBUtilJinc(Angle, in->refFreq, in->antSize, in->pbmin);
   else                    gain = ObitPBUtilPoly(Angle, in->refFreq, in->pbmin);
@@ -414,6 +434,7 @@ void ObitBeamShapeInit  (gpointer inn)
   /* set members in this class */
   in->myDesc     = NULL;
   in->myFI       = NULL;
+  in->PBTab      = NULL;
   in->pbmin      = 0.0;
   in->antSize    = 0.0;
   in->icellSize  = 0.0;
@@ -443,6 +464,7 @@ void ObitBeamShapeClear (gpointer inn)
   /* delete this class members */
   in->myDesc  = ObitImageDescUnref(in->myDesc);
   in->myFI    = ObitFInterpolateUnref(in->myFI);
+  in->PBTab   = ObitPBUtilTabFree(in->PBTab);
 
   /* unlink parent class members */
   ParentClass = (ObitClassInfo*)(myClassInfo.ParentClass);
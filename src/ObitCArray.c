@@ -66,6 +66,7 @@ typedef ALIGN32_BEG union {
 
 #include "ObitCArray.h"
 #include "ObitMem.h"
+#include <string.h>
 
 /*----------------Obit: Merx mollis mortibus nuper ------------------*/
 /**
@@ -105,9 +106,26 @@ typedef struct {
     olong        pos[MAXFARRAYDIM];
     /* thread number  */
     olong        ithread;
+    /* Fused expression */
+    ObitCArrayExpr *expr;
 } CAFuncArg;
 
 /*--------------- File Global Variables  ----------------*/
+/** Number of complex cells per block in fused expressions */
+#define CAEXPRBLOCK 1024
+
+#if (HAVE_AVX512==1) || (HAVE_AVX==1)
+/**
+ * Coefficients of x^2, x^4 ... x^16 in the polynomial
+ * atan(x) = x(1 + c[0]x^2 + c[1]x^4 + ...), 0<=x<=1, error <= 2e-8
+ * (Abramowitz & Stegun 4.4.49), used for vector phases.
+ */
+static const ofloat CAAtanCoef[8] = {
+    -0.3333314528, 0.1999355085, -0.1420889944, 0.1065626393,
+    -0.0752896400, 0.0429096138, -0.0161657367, 0.0028662257
+};
+#endif
+
 /**
  * ClassInfo structure ObitCArrayClassInfo.
  * This structure is used by class objects to access class functions.
@@ -136,6 +154,9 @@ static gpointer ThreadCAMul(gpointer arg);
 /** Private: Threaded Divide */
 static gpointer ThreadCADiv(gpointer arg);
 
+/** Private: Threaded Multiply by FArray */
+static gpointer ThreadCAFMul(gpointer arg);
+
 /** Private: Threaded Fill */
 static gpointer ThreadCAFill(gpointer arg);
 
@@ -145,6 +166,16 @@ static gpointer ThreadCAAmp(gpointer arg);
 /** Private: Threaded Phase */
 static gpointer ThreadCAPhase(gpointer arg);
 
+/** Private: Reverse and conjugate a row */
+static void CAFlipConjg(olong n, const ofloat *inp, ofloat *outp);
+
+/** Private: Threaded fused expression */
+static gpointer ThreadCAExpr(gpointer arg);
+
+/** Private: Fused expression operation on a block */
+static void CAExprBlock(ObitCArrayExprOp op, olong n, ofloat *acc,
+                        const ofloat *x, const ofloat *s);
+
 /** Private: Make Threaded args */
 static olong MakeCAFuncArgs(ObitThread *thread, ObitCArray *in,
                             ObitCArray *in2, ObitCArray *out, ObitFArray *fout,
@@ -1187,8 +1218,9 @@ gboolean ObitCArrayIsFCompatable(ObitCArray *Cin, ObitFArray *Fin)
  */
 void ObitCArrayFMul(ObitCArray *Cin, ObitFArray *Fin, ObitCArray *out)
 {
-    olong i, j;
-    ofloat trc, tic, tr;
+    olong i;
+    olong nTh, nElem, loElem, hiElem, nElemPerThread, nThreads;
+    CAFuncArg **threadArgs;
 
     /* error checks */
     g_assert(ObitCArrayIsA(Cin));
@@ -1196,17 +1228,48 @@ void ObitCArrayFMul(ObitCArray *Cin, ObitFArray *Fin, ObitCArray *out)
     g_assert(ObitCArrayIsCompatable(Cin, out));
     g_assert(ObitCArrayIsFCompatable(Cin, Fin));
 
-    /* Multiply */
-    j = 0;
+    /* Initialize Threading */
+    nThreads = MakeCAFuncArgs(Cin->thread, Cin, NULL, out, Fin, 0, 0, 0, 0, 0, 0, 0,
+                              &threadArgs);
 
-    for (i = 0; i < 2 * Cin->arraySize; i += 2) {
-        trc = Cin->array[i];
-        tic = Cin->array[i + 1];
-        tr  = Fin->array[j];
-        out->array[i]   = trc * tr;
-        out->array[i + 1] = tic * tr;
-        j++;
+    /* Divide up work */
+    nElem = Cin->arraySize;
+    /* At least 100,000 per thread */
+    nTh = MAX(1, MIN((olong)(0.5 + nElem / 100000.), nThreads));
+    nElemPerThread = nElem / nTh;
+
+    if (nElem < 100000) {
+        nElemPerThread = nElem;
+        nTh = 1;
+    }
+
+    loElem = 1;
+    hiElem = nElemPerThread;
+    hiElem = MIN(hiElem, nElem);
+
+    /* Set up thread arguments */
+    for (i = 0; i < nTh; i++) {
+        if (i == (nTh - 1)) hiElem = nElem; /* Make sure do all */
+
+        threadArgs[i]->first   = loElem;
+        threadArgs[i]->last    = hiElem;
+
+        if (nTh > 1) threadArgs[i]->ithread = i;
+        else threadArgs[i]->ithread = -1;
+
+        /* Update which Elem */
+        loElem += nElemPerThread;
+        hiElem += nElemPerThread;
+        hiElem = MIN(hiElem, nElem);
     }
+
+    /* Do operation */
+    ObitThreadIterator(Cin->thread, nTh,
+                       (ObitThreadFunc)ThreadCAFMul,
+                       (gpointer **)threadArgs);
+
+    /* Free local objects */
+    KillCAFuncArgs(nThreads, threadArgs);
 }  /* end ObitCArrayFMul */
 
 /**
@@ -1699,7 +1762,7 @@ void ObitCArray2DCenterFull(ObitCArray *in)
  */
 ObitCArray *ObitCArrayAddConjg(ObitCArray *in, olong numConjCol)
 {
-    olong ndim, i1, i2;
+    olong ndim, i2;
     olong naxis[MAXFARRAYDIM], ipos[2], opos[2];
     ObitCArray *out = NULL;
     gchar *outName;
@@ -1736,7 +1799,7 @@ ObitCArray *ObitCArrayAddConjg(ObitCArray *in, olong numConjCol)
 
     /* Copy in to end of output rows */
     for (i2 = 0; i2 < in->naxis[1]; i2++) { /* second dimension*/
-        for (i1 = 0; i1 < 2 * in->naxis[0]; i1++) outp[i1] = inp[i1];
+        memcpy(outp, inp, 2 * in->naxis[0] * sizeof(ofloat));
 
         inp  += 2 * in->naxis[0];
         outp += 2 * out->naxis[0];
@@ -1753,11 +1816,8 @@ ObitCArray *ObitCArrayAddConjg(ObitCArray *in, olong numConjCol)
         opos[1] = in->naxis[1] - i2;
         outp = ObitCArrayIndex(out, opos);
 
-        for (i1 = 0; i1 < 2 * numConjCol; i1 += 2) {
-            /* Loop down row, flipping, conjugating */
-            outp[-i1]   =  inp[i1];
-            outp[-i1 + 1] = -inp[i1 + 1];
-        }
+        /* Loop down row, flipping, conjugating */
+        CAFlipConjg(numConjCol, inp, outp);
     } /* end loop over second dimension */
 
     /* Now 0th row */
@@ -1768,11 +1828,8 @@ ObitCArray *ObitCArrayAddConjg(ObitCArray *in, olong numConjCol)
     opos[1] = 0;
     outp = ObitCArrayIndex(out, opos);
 
-    for (i1 = 0; i1 < 2 * numConjCol; i1 += 2) {
-        /* Loop down row, flipping, conjugating */
-        outp[-i1]   =  inp[i1];
-        outp[-i1 + 1] = -inp[i1 + 1];
-    }
+    /* Loop down row, flipping, conjugating */
+    CAFlipConjg(numConjCol, inp, outp);
 
     return out;
 } /* end ObitCArrayAddConjg */
@@ -1923,6 +1980,188 @@ void ObitCArrayMatrixMult(ObitCArray *in1, ObitCArray *in2, ObitCArray *out)
 
 } /* end ObitCArrayMatrixMult */
 
+/**
+ * Start a fused elementwise expression.
+ * Operations are added with ObitCArrayExprCArr, ObitCArrayExprFArr and
+ * ObitCArrayExprScalar and evaluated together by ObitCArrayExprRun 
+ * in a single pass.
+ * \param in  Array giving the initial value of the expression
+ * \return new expression, delete with ObitCArrayExprFree
+ */
+ObitCArrayExpr* ObitCArrayExprCreate(ObitCArray *in)
+{
+    ObitCArrayExpr *expr;
+
+    /* error checks */
+    g_assert(ObitCArrayIsA(in));
+    g_assert(in->array != NULL);
+
+    expr = g_malloc0(sizeof(ObitCArrayExpr));
+    expr->in    = ObitCArrayRef(in);
+    expr->nstep = 0;
+    return expr;
+} /* end ObitCArrayExprCreate */
+
+/**
+ * Delete fused expression, unreferencing arrays
+ * \param expr  Expression to delete
+ * \return NULL pointer
+ */
+ObitCArrayExpr* ObitCArrayExprFree(ObitCArrayExpr *expr)
+{
+    olong i;
+
+    if (expr == NULL) return NULL;
+
+    expr->in = ObitCArrayUnref(expr->in);
+
+    for (i = 0; i < expr->nstep; i++) {
+        if (expr->carr[i]) expr->carr[i] = ObitCArrayUnref(expr->carr[i]);
+
+        if (expr->farr[i]) expr->farr[i] = ObitFArrayUnref(expr->farr[i]);
+    }
+
+    g_free(expr);
+    return NULL;
+} /* end ObitCArrayExprFree */
+
+/**
+ * Add an operation with a CArray operand to a fused expression.
+ * Nothing is computed until ObitCArrayExprRun.
+ * \param expr  Expression
+ * \param op    Operation, OBIT_CAExpr_Add, OBIT_CAExpr_Sub, OBIT_CAExpr_Mul
+ *              or OBIT_CAExpr_MulConjg
+ * \param carr  Array operand, same geometry as the expression input
+ */
+void ObitCArrayExprCArr(ObitCArrayExpr *expr, ObitCArrayExprOp op,
+                        ObitCArray *carr)
+{
+    /* error checks */
+    g_assert(expr != NULL);
+    g_assert(ObitCArrayIsA(carr));
+    g_assert(ObitCArrayIsCompatable(expr->in, carr));
+    g_assert((op <= OBIT_CAExpr_Mul) || (op == OBIT_CAExpr_MulConjg));
+    g_assert(expr->nstep < MAXCAEXPRSTEP);
+
+    expr->op[expr->nstep]   = op;
+    expr->carr[expr->nstep] = ObitCArrayRef(carr);
+    expr->farr[expr->nstep] = NULL;
+    expr->s[expr->nstep][0] = expr->s[expr->nstep][1] = 0.0;
+    expr->nstep++;
+} /* end ObitCArrayExprCArr */
+
+/**
+ * Add an operation with an FArray operand to a fused expression.
+ * Nothing is computed until ObitCArrayExprRun.
+ * \param expr  Expression
+ * \param op    Operation, OBIT_CAExpr_FMul, OBIT_CAExpr_FDiv or OBIT_CAExpr_FAdd
+ * \param farr  Array operand, same geometry as the expression input
+ */
+void ObitCArrayExprFArr(ObitCArrayExpr *expr, ObitCArrayExprOp op,
+                        ObitFArray *farr)
+{
+    /* error checks */
+    g_assert(expr != NULL);
+    g_assert(ObitFArrayIsA(farr));
+    g_assert(ObitCArrayIsFCompatable(expr->in, farr));
+    g_assert((op >= OBIT_CAExpr_FMul) && (op <= OBIT_CAExpr_FAdd));
+    g_assert(expr->nstep < MAXCAEXPRSTEP);
+
+    expr->op[expr->nstep]   = op;
+    expr->carr[expr->nstep] = NULL;
+    expr->farr[expr->nstep] = ObitFArrayRef(farr);
+    expr->s[expr->nstep][0] = expr->s[expr->nstep][1] = 0.0;
+    expr->nstep++;
+} /* end ObitCArrayExprFArr */
+
+/**
+ * Add an operation with scalar operands to a fused expression.
+ * Nothing is computed until ObitCArrayExprRun.
+ * \param expr  Expression
+ * \param op    Operation, OBIT_CAExpr_SMul ... OBIT_CAExpr_Neg
+ * \param s1    First scalar operand (real part)
+ * \param s2    Second scalar operand (imaginary part)
+ */
+void ObitCArrayExprScalar(ObitCArrayExpr *expr, ObitCArrayExprOp op,
+                          ofloat s1, ofloat s2)
+{
+    /* error checks */
+    g_assert(expr != NULL);
+    g_assert((op >= OBIT_CAExpr_SMul) && (op <= OBIT_CAExpr_Neg));
+    g_assert(expr->nstep < MAXCAEXPRSTEP);
+
+    expr->op[expr->nstep]   = op;
+    expr->carr[expr->nstep] = NULL;
+    expr->farr[expr->nstep] = NULL;
+    expr->s[expr->nstep][0] = s1;
+    expr->s[expr->nstep][1] = s2;
+    expr->nstep++;
+} /* end ObitCArrayExprScalar */
+
+/**
+ * Evaluate a fused expression.
+ * The array is divided among threads and each thread takes blocks of
+ * CAEXPRBLOCK cells through all operations before writing them,
+ * so each array is read (and out written) only once.
+ * \param expr  Expression
+ * \param out   Output array, may be the input or any CArray operand.
+ */
+void ObitCArrayExprRun(ObitCArrayExpr *expr, ObitCArray *out)
+{
+    olong i;
+    olong nTh, nElem, loElem, hiElem, nElemPerThread, nThreads;
+    CAFuncArg **threadArgs;
+
+    /* error checks */
+    g_assert(expr != NULL);
+    g_assert(ObitCArrayIsA(out));
+    g_assert(ObitCArrayIsCompatable(expr->in, out));
+
+    /* Initialize Threading */
+    nThreads = MakeCAFuncArgs(expr->in->thread, expr->in, NULL, out, NULL,
+                              0, 0, 0, 0, 0, 0, 0, &threadArgs);
+
+    /* Divide up work - by complex cell */
+    nElem = expr->in->arraySize;
+    /* At least 50,000 cells per thread */
+    nTh = MAX(1, MIN((olong)(0.5 + nElem / 50000.), nThreads));
+    nElemPerThread = nElem / nTh;
+
+    if (nElem < 500000) {
+        nElemPerThread = nElem;
+        nTh = 1;
+    }
+
+    loElem = 1;
+    hiElem = nElemPerThread;
+    hiElem = MIN(hiElem, nElem);
+
+    /* Set up thread arguments */
+    for (i = 0; i < nTh; i++) {
+        if (i == (nTh - 1)) hiElem = nElem; /* Make sure do all */
+
+        threadArgs[i]->first   = loElem;
+        threadArgs[i]->last    = hiElem;
+        threadArgs[i]->expr    = expr;
+
+        if (nTh > 1) threadArgs[i]->ithread = i;
+        else threadArgs[i]->ithread = -1;
+
+        /* Update which Elem */
+        loElem += nElemPerThread;
+        hiElem += nElemPerThread;
+        hiElem = MIN(hiElem, nElem);
+    }
+
+    /* Do operation */
+    ObitThreadIterator(expr->in->thread, nTh,
+                       (ObitThreadFunc)ThreadCAExpr,
+                       (gpointer **)threadArgs);
+
+    /* Free local objects */
+    KillCAFuncArgs(nThreads, threadArgs);
+} /* end ObitCArrayExprRun */
+
 /**
  * Initialize global ClassInfo Structure.
  */
@@ -2001,6 +2240,12 @@ static void ObitCArrayClassInfoDefFn(gpointer inClass)
     theClass->ObitCArray2DCenter = (ObitCArray2DCenterFP)ObitCArray2DCenter;
     theClass->ObitCArrayAddConjg = (ObitCArrayAddConjgFP)ObitCArrayAddConjg;
     theClass->ObitCArrayMatrixMult  = (ObitCArrayMatrixMultFP)ObitCArrayMatrixMult ;
+    theClass->ObitCArrayExprCreate  = (ObitCArrayExprCreateFP)ObitCArrayExprCreate;
+    theClass->ObitCArrayExprFree    = (ObitCArrayExprFreeFP)ObitCArrayExprFree;
+    theClass->ObitCArrayExprCArr    = (ObitCArrayExprCArrFP)ObitCArrayExprCArr;
+    theClass->ObitCArrayExprFArr    = (ObitCArrayExprFArrFP)ObitCArrayExprFArr;
+    theClass->ObitCArrayExprScalar  = (ObitCArrayExprScalarFP)ObitCArrayExprScalar;
+    theClass->ObitCArrayExprRun     = (ObitCArrayExprRunFP)ObitCArrayExprRun;
 } /* end ObitCArrayClassDefFn */
 
 /*---------------Private functions--------------------------*/
@@ -2390,14 +2635,102 @@ static gpointer ThreadCADiv(gpointer arg)
     olong      loElem     = largs->first - 1;
     olong      hiElem     = largs->last;
 
-    olong i;
+    olong i, iLast;
     ofloat tr1, ti1, tr2, ti2, denom;
     ofloat  fblank = ObitMagicF();
 
+#if HAVE_AVX512==1
+    CV16SF v1r, v2r, v1i, v2i, vb, vz, vt1, vt2, vr, vi, vd, vm;
+    MASK16 msk1, selMask;
+#elif HAVE_AVX==1
+    CV8SF vm1, vm2;
+    CV8SF v1r, v1i, vb, vz, v2r, v2i, vt1, vt2, vr, vi, vd, vm;
+#endif
+
     if (hiElem < loElem) goto finish;
 
+    /* A blank in either part of either operand or a zero divisor blanks
+       both parts of the output */
+#if HAVE_AVX512==1  /* Vector AVX 512 */
+    vb.v   = _mm512_set1_ps(fblank);  /* vector of blanks */
+    vz.v   = _mm512_setzero_ps();     /* vector of zeroes */
+    selMask = _mm512_int2mask(0xaaaa); /* alternating mask */
 
-    for (i = loElem; i < hiElem; i++) {
+    /* Do blocks of 16 as vector  = 8 complex **/
+    for (i = loElem; i < hiElem - 8; i += 8) {
+        v1r.v = _mm512_loadu_ps(&in1->array[2 * i]);
+        v2r.v = _mm512_loadu_ps(&in2->array[2 * i]);
+        msk1  = _mm512_cmp_ps_mask(v1r.v, vb.v, _CMP_EQ_OQ) |
+                _mm512_cmp_ps_mask(v2r.v, vb.v, _CMP_EQ_OQ); /* find blanks */
+        msk1 |= ((msk1 >> 1) & 0x5555) | ((msk1 << 1) & 0xaaaa); /* both parts */
+        /* convert to pairs of real/imag */
+        v1i.v = _mm512_movehdup_ps(v1r.v);
+        v2i.v = _mm512_movehdup_ps(v2r.v);
+        v1r.v = _mm512_moveldup_ps(v1r.v);
+        v2r.v = _mm512_moveldup_ps(v2r.v);
+        /* Divisor |in2|^2 */
+        vt1.v = _mm512_mul_ps(v2r.v, v2r.v);
+        vt2.v = _mm512_mul_ps(v2i.v, v2i.v);
+        vd.v  = _mm512_add_ps(vt1.v, vt2.v);
+        msk1 |= _mm512_cmp_ps_mask(vd.v, vz.v, _CMP_EQ_OQ);  /* zero divisor */
+        /* Multiply by conjugate */
+        vt1.v = _mm512_mul_ps(v1r.v, v2r.v);
+        vt2.v = _mm512_mul_ps(v1i.v, v2i.v);
+        vr.v  = _mm512_add_ps(vt1.v, vt2.v);   /* Real part */
+        vt1.v = _mm512_mul_ps(v1i.v, v2r.v);
+        vt2.v = _mm512_mul_ps(v1r.v, v2i.v);
+        vi.v  = _mm512_sub_ps(vt1.v, vt2.v);   /* Imaginary part */
+        vm.v  = _mm512_mask_blend_ps(selMask, vr.v, vi.v);
+        vm.v  = _mm512_div_ps(vm.v, vd.v);
+        vm.v  = _mm512_mask_blend_ps(msk1, vm.v, vb.v);  /* replace blanks */
+        _mm512_storeu_ps(&out->array[2 * i], vm.v);      /* Save */
+    }
+
+    iLast = i;  /* How far did I get? */
+#elif HAVE_AVX==1  /* Vector AVX */
+    vb.v   = _mm256_broadcast_ss(&fblank);  /* vector of blanks */
+    vz.v   = _mm256_setzero_ps();           /* vector of zeroes */
+
+    /* Do blocks of 8 as vector = 4 complex */
+    for (i = loElem; i < hiElem - 4; i += 4) {
+        v1r.v = _mm256_loadu_ps(&in1->array[2 * i]);
+        v2r.v = _mm256_loadu_ps(&in2->array[2 * i]);
+        vm1.v = _mm256_or_ps(_mm256_cmp_ps(v1r.v, vb.v, _CMP_EQ_OQ),
+                             _mm256_cmp_ps(v2r.v, vb.v, _CMP_EQ_OQ)); /* find blanks */
+        vm1.v = _mm256_or_ps(_mm256_moveldup_ps(vm1.v),
+                             _mm256_movehdup_ps(vm1.v)); /* both parts */
+        /* convert to pairs of real/imag */
+        v1i.v = _mm256_movehdup_ps(v1r.v);
+        v2i.v = _mm256_movehdup_ps(v2r.v);
+        v1r.v = _mm256_moveldup_ps(v1r.v);
+        v2r.v = _mm256_moveldup_ps(v2r.v);
+        /* Divisor |in2|^2 */
+        vt1.v = _mm256_mul_ps(v2r.v, v2r.v);
+        vt2.v = _mm256_mul_ps(v2i.v, v2i.v);
+        vd.v  = _mm256_add_ps(vt1.v, vt2.v);
+        vm2.v = _mm256_cmp_ps(vd.v, vz.v, _CMP_EQ_OQ);  /* zero divisor */
+        /* Multiply by conjugate */
+        vt1.v = _mm256_mul_ps(v1r.v, v2r.v);
+        vt2.v = _mm256_mul_ps(v1i.v, v2i.v);
+        vr.v  = _mm256_add_ps(vt1.v, vt2.v);   /* Real part */
+        vt1.v = _mm256_mul_ps(v1i.v, v2r.v);
+        vt2.v = _mm256_mul_ps(v1r.v, v2i.v);
+        vi.v  = _mm256_sub_ps(vt1.v, vt2.v);   /* Imaginary part */
+        /* Merge (blend) AVX no Mask*/
+        vm.v  = _mm256_blend_ps(vr.v, vi.v, 0xaa);
+        vm.v  = _mm256_div_ps(vm.v, vd.v);
+        vm.v  = _mm256_blendv_ps(vm.v, vb.v, vm1.v);  /* replace blanks */
+        vm.v  = _mm256_blendv_ps(vm.v, vb.v, vm2.v);  /* replace zero divisors */
+        _mm256_storeu_ps(&out->array[2 * i], vm.v);   /* Save */
+    }
+
+    iLast = i;  /* How far did I get? */
+#else /* Scalar */
+    iLast = loElem;  /* Do all */
+#endif
+
+    /* Finish up or scalar */
+    for (i = iLast; i < hiElem; i++) {
         tr1 = in1->array[2 * i];
         ti1 = in1->array[2 * i + 1];
         tr2 = in2->array[2 * i];
@@ -2409,8 +2742,14 @@ static gpointer ThreadCADiv(gpointer arg)
             if (denom != 0.0) {
                 out->array[2 * i]   = (tr1 * tr2 + ti1 * ti2) / denom;
                 out->array[2 * i + 1] = (ti1 * tr2 - tr1 * ti2) / denom;
-            } else out->array[2 * i] = fblank;
-        } else out->array[2 * i] = fblank;
+            } else {
+                out->array[2 * i]     = fblank;
+                out->array[2 * i + 1] = fblank;
+            }
+        } else {
+            out->array[2 * i]     = fblank;
+            out->array[2 * i + 1] = fblank;
+        }
     } /* end loop */
 
     /* Indicate completion */
@@ -2422,6 +2761,86 @@ finish:
     return NULL;
 } /* end ThreadCADiv */
 
+/**
+ * Multiply portions of a CArray by an FArray, out = in * fout
+ * Callable as thread
+ * \param arg Pointer to CAFuncArg argument with elements:
+ * \li in       ObitCArray to work on
+ * \li fout     ObitFArray multiplier
+ * \li out      Output ObitCArray
+ * \li first    First element (1-rel) number
+ * \li last     Highest element (1-rel) number
+ * \li ithread  thread number, <0 -> no threading
+ * \return NULL
+ */
+static gpointer ThreadCAFMul(gpointer arg)
+{
+    /* Get arguments from structure */
+    CAFuncArg *largs = (CAFuncArg *)arg;
+    ObitCArray *in1       = largs->in;
+    ObitFArray *fin       = largs->fout;
+    ObitCArray *out       = largs->out;
+    olong      loElem     = largs->first - 1;
+    olong      hiElem     = largs->last;
+
+    olong i, iLast;
+    ofloat tr;
+
+#if HAVE_AVX512==1
+    CV16SF vc, vf;
+    IV16SF vindx;
+#elif HAVE_AVX==1
+    CV8SF vc, vf;
+    __m128 vf4;
+#endif
+
+    if (hiElem < loElem) goto finish;
+
+#if HAVE_AVX512==1  /* Vector AVX 512 */
+    vindx.v = _mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0); /* duplicate */
+
+    /* Do blocks of 16 as vector  = 8 complex **/
+    for (i = loElem; i < hiElem - 8; i += 8) {
+        vc.v = _mm512_loadu_ps(&in1->array[2 * i]);
+        vf.v = _mm512_castps256_ps512(_mm256_loadu_ps(&fin->array[i]));
+        vf.v = _mm512_permutexvar_ps(vindx.v, vf.v);  /* real factor for both parts */
+        vc.v = _mm512_mul_ps(vc.v, vf.v);
+        _mm512_storeu_ps(&out->array[2 * i], vc.v);   /* Save */
+    }
+
+    iLast = i;  /* How far did I get? */
+#elif HAVE_AVX==1  /* Vector AVX */
+    /* Do blocks of 8 as vector = 4 complex */
+    for (i = loElem; i < hiElem - 4; i += 4) {
+        vc.v = _mm256_loadu_ps(&in1->array[2 * i]);
+        vf4  = _mm_loadu_ps(&fin->array[i]);
+        vf.v = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_unpacklo_ps(vf4, vf4)),
+                                    _mm_unpackhi_ps(vf4, vf4), 1); /* real factor for both parts */
+        vc.v = _mm256_mul_ps(vc.v, vf.v);
+        _mm256_storeu_ps(&out->array[2 * i], vc.v);   /* Save */
+    }
+
+    iLast = i;  /* How far did I get? */
+#else /* Scalar */
+    iLast = loElem;  /* Do all */
+#endif
+
+    /* Finish up or scalar */
+    for (i = iLast; i < hiElem; i++) {
+        tr = fin->array[i];
+        out->array[2 * i]     = in1->array[2 * i] * tr;
+        out->array[2 * i + 1] = in1->array[2 * i + 1] * tr;
+    }
+
+    /* Indicate completion */
+finish:
+
+    if (largs->ithread >= 0)
+        ObitThreadPoolDone(largs->thread, (gpointer)&largs->ithread);
+
+    return NULL;
+} /* end ThreadCAFMul */
+
 /**
  * scalar fill portions a CArray
  * Callable as thread
@@ -2488,6 +2907,8 @@ static gpointer ThreadCAAmp(gpointer arg)
     CV16SF vr, vi, vb, vamp;
     IV16SF vindxr, vindxi;
     MASK16 msk1, msk2;
+#elif HAVE_AVX==1
+    CV8SF vlo, vhi, vr, vi, vb, vm, vamp;
 #endif
 
     if (hiElem < loElem) goto finish;
@@ -2512,6 +2933,30 @@ static gpointer ThreadCAAmp(gpointer arg)
         _mm512_storeu_ps(&fout->array[i], vamp.v);                   /* Save */
     }
 
+    ilast = i;  /* How far did I get? */
+#elif HAVE_AVX==1  /* Vector length 8 */
+    vb.v     = _mm256_broadcast_ss(&fblank);  /* vector of blanks */
+
+    /* Do blocks of 8 complex */
+    for (i = loElem; i < hiElem - 8; i += 8) {
+        vlo.v = _mm256_loadu_ps(&in1->array[2 * i]);       /* cells 0-3 */
+        vhi.v = _mm256_loadu_ps(&in1->array[2 * i + 8]);   /* cells 4-7 */
+        /* Swap 128 bit halves so that the shuffles below leave cells in order */
+        vr.v  = _mm256_permute2f128_ps(vlo.v, vhi.v, 0x20); /* cells 0,1,4,5 */
+        vi.v  = _mm256_permute2f128_ps(vlo.v, vhi.v, 0x31); /* cells 2,3,6,7 */
+        vlo.v = vr.v; vhi.v = vi.v;
+        vr.v  = _mm256_shuffle_ps(vlo.v, vhi.v, 0x88);     /* Reals */
+        vi.v  = _mm256_shuffle_ps(vlo.v, vhi.v, 0xdd);     /* Imaginaries */
+        vm.v  = _mm256_or_ps(_mm256_cmp_ps(vr.v, vb.v, _CMP_EQ_OQ),
+                             _mm256_cmp_ps(vi.v, vb.v, _CMP_EQ_OQ)); /* find blanks */
+        vr.v  = _mm256_mul_ps(vr.v, vr.v);                 /* Real squared */
+        vi.v  = _mm256_mul_ps(vi.v, vi.v);                 /* Imag squared */
+        vamp.v  = _mm256_add_ps(vr.v, vi.v);               /* R^2 + i^2 */
+        vamp.v  = _mm256_sqrt_ps(vamp.v);                  /* sqrt(R^2 + i^2) */
+        vamp.v  = _mm256_blendv_ps(vamp.v, vb.v, vm.v);    /* replace blanks */
+        _mm256_storeu_ps(&fout->array[i], vamp.v);          /* Save */
+    }
+
     ilast = i;  /* How far did I get? */
 #else /* Scalar */
     ilast = loElem;  /* Do all */
@@ -2556,12 +3001,110 @@ static gpointer ThreadCAPhase(gpointer arg)
     olong      loElem     = largs->first - 1;
     olong      hiElem     = largs->last;
 
-    olong i;
+    olong i, ilast;
     ofloat  tr1, ti1, fblank = ObitMagicF();
+#if (HAVE_AVX512==1) || (HAVE_AVX==1)
+    olong k;
+    ofloat  halfPi = 0.5 * G_PI, pi = G_PI;
+#endif
+#if HAVE_AVX512==1
+    CV16SF vr, vi, vb, vz, vax, vay, vmn, vmx, va, vs, vp, vph;
+    IV16SF vindxr, vindxi;
+    MASK16 msk1, msk2;
+#elif HAVE_AVX==1
+    CV8SF vlo, vhi, vr, vi, vb, vz, vsign, vax, vay, vmn, vmx, va, vs, vp, vph, vm;
+#endif
 
     if (hiElem < loElem) goto finish;
 
-    for (i = loElem; i < hiElem; i++) {
+    /* Vector versions reduce to 0 <= |imag|/|real| <= 1 (or the
+       reciprocal), evaluate the polynomial for atan and then
+       unfold the octant */
+#if HAVE_AVX512==1  /* Vector length 16 */
+    vb.v     = _mm512_set1_ps(fblank);  /* vector of blanks */
+    vz.v     = _mm512_setzero_ps();     /* vector of zeroes */
+    vindxr.v = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0); /* Reals*/
+    vindxi.v = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1); /* Imags */
+
+    /* Do blocks of 16 as vector */
+    for (i = loElem; i < hiElem - 16; i += 16) {
+        vr.v  = _mm512_i32gather_ps(vindxr.v, &in1->array[2 * i], 4); /* Load Reals */
+        vi.v  = _mm512_i32gather_ps(vindxi.v, &in1->array[2 * i], 4); /* Load Imaginaries */
+        vax.v = _mm512_abs_ps(vr.v);
+        vay.v = _mm512_abs_ps(vi.v);
+        vmn.v = _mm512_min_ps(vax.v, vay.v);
+        vmx.v = _mm512_max_ps(vax.v, vay.v);
+        va.v  = _mm512_div_ps(vmn.v, vmx.v);
+        msk1  = _mm512_cmp_ps_mask(vmx.v, vz.v, _CMP_EQ_OQ);          /* 0/0 */
+        va.v  = _mm512_mask_blend_ps(msk1, va.v, vz.v);
+        vs.v  = _mm512_mul_ps(va.v, va.v);
+        vp.v  = _mm512_set1_ps(CAAtanCoef[7]);
+
+        for (k = 6; k >= 0; k--)
+            vp.v = _mm512_add_ps(_mm512_mul_ps(vp.v, vs.v), _mm512_set1_ps(CAAtanCoef[k]));
+
+        vp.v  = _mm512_add_ps(_mm512_mul_ps(vp.v, vs.v), _mm512_set1_ps(1.0));
+        vph.v = _mm512_mul_ps(va.v, vp.v);                            /* atan(mn/mx) */
+        msk1  = _mm512_cmp_ps_mask(vay.v, vax.v, _CMP_GT_OQ);         /* |imag|>|real| */
+        vph.v = _mm512_mask_sub_ps(vph.v, msk1, _mm512_set1_ps(halfPi), vph.v);
+        msk1  = _mm512_cmp_ps_mask(vr.v, vz.v, _CMP_LT_OQ);           /* real<0 */
+        vph.v = _mm512_mask_sub_ps(vph.v, msk1, _mm512_set1_ps(pi), vph.v);
+        msk1  = _mm512_cmp_ps_mask(vi.v, vz.v, _CMP_LT_OQ);           /* imag<0 */
+        vph.v = _mm512_mask_sub_ps(vph.v, msk1, vz.v, vph.v);
+        msk1  = _mm512_cmp_ps_mask(vr.v, vb.v, _CMP_EQ_OQ);           /* find blanks */
+        msk2  = _mm512_cmp_ps_mask(vi.v, vb.v, _CMP_EQ_OQ);
+        vph.v = _mm512_mask_blend_ps(msk1 | msk2, vph.v, vb.v);       /* replace blanks */
+        _mm512_storeu_ps(&fout->array[i], vph.v);                     /* Save */
+    }
+
+    ilast = i;  /* How far did I get? */
+#elif HAVE_AVX==1  /* Vector length 8 */
+    vb.v    = _mm256_broadcast_ss(&fblank);  /* vector of blanks */
+    vz.v    = _mm256_setzero_ps();           /* vector of zeroes */
+    vsign.v = _mm256_set1_ps(-0.0);          /* sign bits */
+
+    /* Do blocks of 8 complex */
+    for (i = loElem; i < hiElem - 8; i += 8) {
+        vlo.v = _mm256_loadu_ps(&in1->array[2 * i]);       /* cells 0-3 */
+        vhi.v = _mm256_loadu_ps(&in1->array[2 * i + 8]);   /* cells 4-7 */
+        vr.v  = _mm256_permute2f128_ps(vlo.v, vhi.v, 0x20); /* cells 0,1,4,5 */
+        vi.v  = _mm256_permute2f128_ps(vlo.v, vhi.v, 0x31); /* cells 2,3,6,7 */
+        vlo.v = vr.v; vhi.v = vi.v;
+        vr.v  = _mm256_shuffle_ps(vlo.v, vhi.v, 0x88);     /* Reals */
+        vi.v  = _mm256_shuffle_ps(vlo.v, vhi.v, 0xdd);     /* Imaginaries */
+        vax.v = _mm256_andnot_ps(vsign.v, vr.v);
+        vay.v = _mm256_andnot_ps(vsign.v, vi.v);
+        vmn.v = _mm256_min_ps(vax.v, vay.v);
+        vmx.v = _mm256_max_ps(vax.v, vay.v);
+        va.v  = _mm256_div_ps(vmn.v, vmx.v);
+        vm.v  = _mm256_cmp_ps(vmx.v, vz.v, _CMP_EQ_OQ);    /* 0/0 */
+        va.v  = _mm256_blendv_ps(va.v, vz.v, vm.v);
+        vs.v  = _mm256_mul_ps(va.v, va.v);
+        vp.v  = _mm256_broadcast_ss(&CAAtanCoef[7]);
+
+        for (k = 6; k >= 0; k--)
+            vp.v = _mm256_add_ps(_mm256_mul_ps(vp.v, vs.v), _mm256_broadcast_ss(&CAAtanCoef[k]));
+
+        vp.v  = _mm256_add_ps(_mm256_mul_ps(vp.v, vs.v), _mm256_set1_ps(1.0));
+        vph.v = _mm256_mul_ps(va.v, vp.v);                             /* atan(mn/mx) */
+        vm.v  = _mm256_cmp_ps(vay.v, vax.v, _CMP_GT_OQ);               /* |imag|>|real| */
+        vph.v = _mm256_blendv_ps(vph.v, _mm256_sub_ps(_mm256_set1_ps(halfPi), vph.v), vm.v);
+        vm.v  = _mm256_cmp_ps(vr.v, vz.v, _CMP_LT_OQ);                 /* real<0 */
+        vph.v = _mm256_blendv_ps(vph.v, _mm256_sub_ps(_mm256_set1_ps(pi), vph.v), vm.v);
+        vm.v  = _mm256_and_ps(_mm256_cmp_ps(vi.v, vz.v, _CMP_LT_OQ), vsign.v); /* imag<0 */
+        vph.v = _mm256_xor_ps(vph.v, vm.v);
+        vm.v  = _mm256_or_ps(_mm256_cmp_ps(vr.v, vb.v, _CMP_EQ_OQ),
+                             _mm256_cmp_ps(vi.v, vb.v, _CMP_EQ_OQ));  /* find blanks */
+        vph.v = _mm256_blendv_ps(vph.v, vb.v, vm.v);                   /* replace blanks */
+        _mm256_storeu_ps(&fout->array[i], vph.v);                       /* Save */
+    }
+
+    ilast = i;  /* How far did I get? */
+#else /* Scalar */
+    ilast = loElem;  /* Do all */
+#endif
+
+    for (i = ilast; i < hiElem; i++) {
         tr1 = in1->array[2 * i];
         ti1 = in1->array[2 * i + 1];
 
@@ -2579,6 +3122,178 @@ finish:
     return NULL;
 } /* end ThreadCAPhase */
 
+/**
+ * Copy the conjugates of n complex values in reverse order,
+ * outp[-i] = conjg(inp[i]), i=0...n-1 (complex indices)
+ * \param n     Number of complex values
+ * \param inp   First input value
+ * \param outp  Location for the conjugate of the first input,
+ *              earlier output cells receive the later values.
+ */
+static void CAFlipConjg(olong n, const ofloat *inp, ofloat *outp)
+{
+    olong i, iLast;
+#if (HAVE_AVX512==1) || (HAVE_AVX==1)
+    __m256 v, vneg;
+#endif
+
+#if (HAVE_AVX512==1) || (HAVE_AVX==1)  /* Vector AVX */
+    vneg = _mm256_set_ps(-0.0, 0.0, -0.0, 0.0, -0.0, 0.0, -0.0, 0.0); /* imag sign bits */
+
+    /* Do blocks of 8 as vector = 4 complex */
+    for (i = 0; i < n - 4; i += 4) {
+        v = _mm256_loadu_ps(&inp[2 * i]);
+        v = _mm256_permute2f128_ps(v, v, 0x01);      /* swap halves */
+        v = _mm256_permute_ps(v, 0x4e);              /* swap cells in halves */
+        v = _mm256_xor_ps(v, vneg);                  /* conjugate */
+        _mm256_storeu_ps(&outp[-2 * (i + 3)], v);    /* Save */
+    }
+
+    iLast = i;  /* How far did I get? */
+#else /* Scalar */
+    iLast = 0;  /* Do all */
+#endif
+
+    /* Finish up or scalar */
+    for (i = iLast; i < n; i++) {
+        outp[-2 * i]     =  inp[2 * i];
+        outp[-2 * i + 1] = -inp[2 * i + 1];
+    }
+} /* end CAFlipConjg */
+
+/**
+ * Evaluate fused expression on a range of cells.
+ * Blocks of CAEXPRBLOCK cells are copied to a local buffer, taken
+ * through all operations and then written to the output.
+ * Callable as thread
+ * \param arg Pointer to CAFuncArg argument with elements:
+ * \li in       ObitCArray with initial values
+ * \li out      Output ObitCArray
+ * \li first    First cell (1-rel) number
+ * \li last     Highest cell (1-rel) number
+ * \li expr     ObitCArrayExpr to evaluate
+ * \li ithread  thread number, <0 -> no threading
+ * \return NULL
+ */
+static gpointer ThreadCAExpr(gpointer arg)
+{
+    /* Get arguments from structure */
+    CAFuncArg *largs = (CAFuncArg *)arg;
+    ObitCArray *in        = largs->in;
+    ObitCArray *out       = largs->out;
+    ObitCArrayExpr *expr  = largs->expr;
+    olong      loElem     = largs->first - 1;
+    olong      hiElem     = largs->last;
+
+    /* local */
+    olong   i, n, istep;
+    ofloat  acc[2 * CAEXPRBLOCK];
+
+    if (hiElem < loElem) goto finish;
+
+    /* Loop over blocks */
+    for (i = loElem; i < hiElem; i += CAEXPRBLOCK) {
+        n = MIN(CAEXPRBLOCK, hiElem - i);
+        memcpy(acc, &in->array[2 * i], 2 * n * sizeof(ofloat));
+
+        for (istep = 0; istep < expr->nstep; istep++) {
+            if (expr->carr[istep])
+                CAExprBlock(expr->op[istep], n, acc,
+                            &expr->carr[istep]->array[2 * i], expr->s[istep]);
+            else if (expr->farr[istep])
+                CAExprBlock(expr->op[istep], n, acc,
+                            &expr->farr[istep]->array[i], expr->s[istep]);
+            else
+                CAExprBlock(expr->op[istep], n, acc, NULL, expr->s[istep]);
+        }
+
+        memcpy(&out->array[2 * i], acc, 2 * n * sizeof(ofloat));
+    } /* end loop over blocks */
+
+    /* Indicate completion */
+finish:
+
+    if (largs->ithread >= 0)
+        ObitThreadPoolDone(largs->thread, (gpointer)&largs->ithread);
+
+    return NULL;
+} /* end ThreadCAExpr */
+
+/**
+ * Apply one fused expression operation to a block of complex cells.
+ * \param op   Operation
+ * \param n    Number of cells
+ * \param acc  [in/out] Running values as (real,imaginary) pairs
+ * \param x    Array operand for this block, complex for CArray operations,
+ *             real for FArray operations, NULL if none
+ * \param s    Scalar operands
+ */
+static void CAExprBlock(ObitCArrayExprOp op, olong n, ofloat *acc,
+                        const ofloat *x, const ofloat *s)
+{
+    olong i;
+    ofloat tr, ti, s1 = s[0], s2 = s[1];
+
+    switch (op) {
+    case OBIT_CAExpr_Add:
+        for (i = 0; i < 2 * n; i++) acc[i] += x[i];
+        break;
+    case OBIT_CAExpr_Sub:
+        for (i = 0; i < 2 * n; i++) acc[i] -= x[i];
+        break;
+    case OBIT_CAExpr_Mul:
+        for (i = 0; i < n; i++) {
+            tr = acc[2 * i] * x[2 * i]     - acc[2 * i + 1] * x[2 * i + 1];
+            ti = acc[2 * i] * x[2 * i + 1] + acc[2 * i + 1] * x[2 * i];
+            acc[2 * i] = tr; acc[2 * i + 1] = ti;
+        }
+        break;
+    case OBIT_CAExpr_FMul:
+        for (i = 0; i < n; i++) {
+            acc[2 * i] *= x[i]; acc[2 * i + 1] *= x[i];
+        }
+        break;
+    case OBIT_CAExpr_FDiv:
+        for (i = 0; i < n; i++) {
+            acc[2 * i] /= x[i]; acc[2 * i + 1] /= x[i];
+        }
+        break;
+    case OBIT_CAExpr_FAdd:
+        for (i = 0; i < n; i++) acc[2 * i] += x[i];
+        break;
+    case OBIT_CAExpr_SMul:
+        for (i = 0; i < 2 * n; i++) acc[i] *= s1;
+        break;
+    case OBIT_CAExpr_CSMul:
+        for (i = 0; i < n; i++) {
+            tr = acc[2 * i] * s1 - acc[2 * i + 1] * s2;
+            ti = acc[2 * i] * s2 + acc[2 * i + 1] * s1;
+            acc[2 * i] = tr; acc[2 * i + 1] = ti;
+        }
+        break;
+    case OBIT_CAExpr_CSAdd:
+        for (i = 0; i < n; i++) {
+            acc[2 * i] += s1; acc[2 * i + 1] += s2;
+        }
+        break;
+    case OBIT_CAExpr_Conjg:
+        for (i = 0; i < n; i++) acc[2 * i + 1] = -acc[2 * i + 1];
+        break;
+    case OBIT_CAExpr_Neg:
+        for (i = 0; i < 2 * n; i++) acc[i] = -acc[i];
+        break;
+    case OBIT_CAExpr_MulConjg:
+        for (i = 0; i < n; i++) {
+            tr = acc[2 * i] * x[2 * i]     + acc[2 * i + 1] * x[2 * i + 1];
+            ti = acc[2 * i + 1] * x[2 * i] - acc[2 * i] * x[2 * i + 1];
+            acc[2 * i] = tr; acc[2 * i + 1] = ti;
+        }
+        break;
+    default:
+        g_assert_not_reached(); /* unknown, barf */
+    } /* end switch */
+} /* end CAExprBlock */
+
 /**
  * Make arguments for a Threaded ThreadCAFunc?
  * \param thread     ObitThread object to be used
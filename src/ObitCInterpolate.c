@@ -577,6 +577,90 @@ void ObitCInterpolateOffset (ObitCInterpolate *in, ofloat *off, ofloat out[2],
   ObitCInterpolatePixel (in, pixel, out, err);
 } /* end ObitCInterpolateOffset */
 
+/**
+ * Interpolate values at a list of offsets from the reference position.
+ * Equivalent to calling ObitCInterpolateOffset for each entry but with the
+ * per call overhead hoisted out of the loop, the sums done along contiguous
+ * rows of the grid and the result of the previous entry reused when an entry
+ * selects the same grid cells and tabulated kernals (e.g. adjacent channels).
+ * Only the first plane is used.
+ * \param in    The object to interpolate, must have an image descriptor
+ * \param n     Number of entries
+ * \param uOff  Offsets on first axis
+ * \param vOff  Offsets on second axis
+ * \param out   [out] Complex interpolated values as (real,Imag) pairs,
+ *              2*n entries, magic value blanked
+ */
+void ObitCInterpolateOffsetRow (ObitCInterpolate *in, olong n, ofloat *uOff, 
+				ofloat *vOff, ofloat *out)
+{
+  ofloat fblank =  ObitMagicF();
+  ofloat sumR, sumI, sumwt, rsumR, rsumI, rwt, xmax, ymax;
+  ofloat xPix, yPix, xcrpix, ycrpix, xscale, yscale;
+  ofloat *xKernal=NULL, *yKernal=NULL, *lastX=NULL, *lastY=NULL, *data, *drow;
+  olong i, j, k, nx, xStart=0, yStart=0, iwidX=0, iwidY=0;
+  olong lastXStart=-1, lastYStart=-1, lastk=-1;
+
+  /* Local versions of things */
+  data   = in->array;
+  nx     = in->nx;
+  xmax   = (ofloat)in->myArray->naxis[0];
+  ymax   = (ofloat)in->myArray->naxis[1];
+  xcrpix = in->myDesc->crpix[0];
+  ycrpix = in->myDesc->crpix[1];
+  xscale = 1.0 / in->myDesc->cdelt[0];
+  yscale = 1.0 / in->myDesc->cdelt[1];
+
+  for (k=0; k<n; k++) {
+    out[2*k] = fblank; out[2*k+1] = fblank;
+    /* convert to pixel - assume linear */
+    xPix = xcrpix + uOff[k] * xscale;
+    yPix = ycrpix + vOff[k] * yscale;
+
+    /* Must be inside array */
+    if ((xPix<1.0) || (xPix>xmax) || (yPix<1.0) || (yPix>ymax)) continue;
+
+    /* Convolving x, y kernals */
+    SetConvKernal (in, xPix, in->nx, &xStart, &iwidX, &xKernal);
+    SetConvKernal (in, yPix, in->ny, &yStart, &iwidY, &yKernal);
+
+    /* Same cells and kernals as the last valid entry? */
+    if ((lastk>=0) && (xKernal==lastX) && (yKernal==lastY) && 
+	(xStart==lastXStart) && (yStart==lastYStart)) {
+      out[2*k]   = out[2*lastk];
+      out[2*k+1] = out[2*lastk+1];
+      continue;
+    }
+    lastk = k; lastX = xKernal; lastY = yKernal;
+    lastXStart = xStart; lastYStart = yStart;
+
+    /* Sum rows of data times "X" kernal then weight by "Y" kernal */
+    sumR = sumI = 0.0;
+    sumwt = 0.0;
+    for (j=0; j<iwidY; j++) {
+      drow = data + 2*(xStart + (yStart + j) * nx);
+      rsumR = rsumI = 0.0;
+      rwt = 0.0;
+      for (i=0; i<iwidX; i++) {
+	if (drow[2*i] != fblank) {
+	  rsumR += drow[2*i]   * xKernal[i];
+	  rsumI += drow[2*i+1] * xKernal[i];
+	  rwt   += xKernal[i];
+	}
+      }
+      sumR  += rsumR * yKernal[j];
+      sumI  += rsumI * yKernal[j];
+      sumwt += rwt   * yKernal[j];
+    }
+
+    /* normalize sum if not excessive blanking */
+    if (sumwt > 0.5) {
+      out[2*k]   = sumR / sumwt;
+      out[2*k+1] = sumI / sumwt;
+    }
+  } /* end loop over entries */
+} /* end ObitCInterpolateOffsetRow */
+
 /**
  * Initialize global ClassInfo Structure.
  */
@@ -40,8 +40,30 @@
  */
 
 
+/*--------------- File Global Variables  ----------------*/
+/** Largest 4 sigma (pixels) for direct separable Gaussian convolution */
+#define CONVDIRECTMAX 16.0
+/** Smallest sigma (pixels) for direct Gaussian convolution */
+#define CONVDIRECTSIGMA 0.6
+/** FFT size beyond which Gaussian convolution is done in tiles */
+#define CONVTILESIZE 4096
+
 /*----------------------Private functions---------------------------*/
-/** Private: */
+/** Private: Separable direct Gaussian convolution */
+static ObitFArray* ConvGaussDirect (ObitFArray *in, ofloat *sigma, 
+				    ofloat rescale);
+
+/** Private: Overlap-save Gaussian convolution in tiles */
+static ObitFArray* ConvGaussTiled (ObitFArray *in, olong tileSize, olong H,
+				   ofloat *cells, ofloat maprot, ofloat Gaumaj, 
+				   ofloat Gaumin, ofloat GauPA, ofloat rescale,
+				   ObitErr *err);
+
+/** Private: Whole array FFT Gaussian convolution */
+static ObitFArray* ConvGaussFFT (ObitFArray *in, ofloat *cells, 
+				 ofloat maprot, ofloat Gaumaj, 
+				 ofloat Gaumin, ofloat GauPA, 
+				 ofloat rescale, ObitErr *err);
 
 /*----------------------Public functions---------------------------*/
 
@@ -49,7 +71,8 @@
  * (de)Convolve an Image with an FArray and write outImage  
  *  This routine convolves all selected planes in inImage with convFn if 
  *  doDivide is FALSE, else it does a linear deconvolution
- *  Operations are performed using FFTs
+ *  Operations are performed using FFTs; the FFT plans and the transform
+ *  of convFn are cached between calls (see ObitFArrayUtilKernelFT).
  * \param inImage   Input ObitImage 
  * \param convFn    Convolving Function    
  * \param doDovide  If true divide FT of convFn into FT of inImage,
@@ -71,8 +94,9 @@ void ObitConvUtilConv (ObitImage *inImage, ObitFArray *convFn,
   olong ttrc[IM_MAXDIM] = {0,0,0,0,0,0,0};
   ofloat Beam[3], maxval;
   ObitFFT    *FFTfor=NULL, *FFTrev=NULL;
-  ObitFArray *padConvFn=NULL, *padImage=NULL, *tmpArray=NULL;
-  ObitCArray *wtArray=NULL, *FTArray=NULL;
+  ObitFArray *padImage=NULL, *tmpArray=NULL;
+  ObitCArray *wtArray=NULL, *FTArray=NULL, *cacheFT=NULL;
+  ObitFArrayExpr *expr=NULL;
   ObitFArray *wtAmp=NULL, *wtPhase=NULL; /*, *wtReal=NULL, *wtImag=NULL;*/
   gchar *routine = "ObitConvUtilConv";
 
@@ -87,23 +111,21 @@ void ObitConvUtilConv (ObitImage *inImage, ObitFArray *convFn,
   ObitImageDescCopyDesc (inImage->myDesc, outImage->myDesc, err);
   if (err->error) Obit_traceback_msg (err, routine, outImage->name);
 
-  /* Create FFTs */
-  FFTfor = ObitFeatherUtilCreateFFT(inImage, OBIT_FFT_Forward);
-  FFTrev = ObitFeatherUtilCreateFFT(inImage, OBIT_FFT_Reverse);
+  /* Get FFTs */
+  naxis[0] = ObitFFTSuggestSize (inImage->myDesc->inaxes[0]);
+  naxis[1] = ObitFFTSuggestSize (inImage->myDesc->inaxes[1]);
+  FFTfor = ObitFArrayUtilGetFFT (OBIT_FFT_Forward, naxis[0], naxis[1]);
+  FFTrev = ObitFArrayUtilGetFFT (OBIT_FFT_Reverse, naxis[0], naxis[1]);
 
-  /* Pad convolving function */
-  naxis[0] = FFTfor->dim[0];  naxis[1] = FFTfor->dim[1]; 
-  padConvFn = ObitFArrayCreate("Pad Conv Fn", ndim, naxis);
-  ObitFeatherUtilPadArray (FFTfor, convFn, padConvFn);
-  /*ObitImageUtilArray2Image ("convFn.fits",0,padConvFn, err);DEBUG*/
+  /* FFT of padded convolving function to wtArray, from cache if possible */
+  wtArray = ObitFArrayUtilKernelFT (convFn, naxis[0], naxis[1]);
 
-  /* FFT Convolving function to wtArray */
-  wtArray = ObitFeatherUtilCreateFFTArray (FFTfor);
-  ObitFArray2DCenter (padConvFn); /* Swaparoonie to FFT order */
-  ObitFFTR2C (FFTfor, padConvFn, wtArray);
-
-  /* If doSub modify wtArray */
+  /* If doSub modify a copy of wtArray */
   if (doSub) {
+    cacheFT = wtArray;
+    wtArray = ObitCArrayCopy (cacheFT, NULL, err);
+    cacheFT = ObitCArrayUnref(cacheFT);
+    if (err->error) goto cleanup;
     wtAmp   = ObitFArrayCreate("Amp",wtArray->ndim,wtArray->naxis);
     wtPhase = ObitFArrayCreate("Phase",wtArray->ndim,wtArray->naxis);
     /*wtReal  = ObitFArrayCreate("Real",wtArray->ndim,wtArray->naxis);
@@ -197,11 +219,12 @@ void ObitConvUtilConv (ObitImage *inImage, ObitFArray *convFn,
     tmpArray = ObitFArraySubArr(padImage, blc, trc, err);
     if (err->error) goto cleanup;
 
-    /* rescale units */
-    ObitFArraySMul (tmpArray, rescale);
-
-    /* Blank output where input blanked */
-    ObitFArrayBlank (tmpArray, inImage->image, tmpArray);
+    /* rescale units, blank output where input blanked */
+    expr = ObitFArrayExprCreate (tmpArray);
+    ObitFArrayExprScalar (expr, OBIT_FAExpr_SMul, rescale, 0.0, 0.0);
+    ObitFArrayExprArr (expr, OBIT_FAExpr_Blank, inImage->image);
+    ObitFArrayExprRun (expr, tmpArray);
+    expr = ObitFArrayExprFree (expr);
 
     /* DEBUG
     ObitImageUtilArray2Image ("ConvolDebug1.fits",1,tmpArray, err); */
@@ -228,7 +251,6 @@ void ObitConvUtilConv (ObitImage *inImage, ObitFArray *convFn,
  cleanup:
   wtArray   = ObitCArrayUnref(wtArray);
   FTArray   = ObitCArrayUnref(FTArray);
-  padConvFn = ObitFArrayUnref(padConvFn);
   padImage  = ObitFArrayUnref(padImage);
   tmpArray  = ObitFArrayUnref(tmpArray);
   FFTfor    = ObitFFTUnref(FFTfor);
@@ -239,7 +261,8 @@ void ObitConvUtilConv (ObitImage *inImage, ObitFArray *convFn,
 /**
  *  Convolve an Image with an FArray and write outImage  
  *  This routine convolves all selected planes in a Gaussian
- *  Operations are performed using FFTs
+ *  Operations are performed by ObitConvUtilConvGaussArray using 
+ *  direct, tiled or whole plane FFT convolution.
  * \param inImage   Input ObitImage 
  * \param Gaumaj    Major axis of Gaussian in image plane (arcsec)
  * \param Gaumin    Minor axis of Gaussian in image plane (arcsec)
@@ -254,14 +277,10 @@ void ObitConvUtilConvGauss (ObitImage *inImage, ofloat Gaumaj, ofloat Gaumin,
 			    ObitImage *outImage, ObitErr *err)
 {
   ObitIOCode   iretCode;
-  olong      ndim=2, naxis[2], blc[2], trc[2], cen[2];
   olong tblc[IM_MAXDIM] = {1,1,1,1,1,1,1};
   olong ttrc[IM_MAXDIM] = {0,0,0,0,0,0,0};
   ofloat Beam[3], cells[2], maprot;
-  ObitFFT    *FFTfor=NULL, *FFTrev=NULL;
-  ObitFArray *xferFn=NULL, *subXferFn=NULL, *zeroArray=NULL;
-  ObitFArray *padImage=NULL, *tmpArray=NULL;
-  ObitCArray *wtArray=NULL, *FTArray=NULL;
+  ObitFArray *tmpArray=NULL;
   ObitImageDesc *desc=NULL;
   gchar *routine = "ObitConvUtilConvGauss";
 
@@ -293,38 +312,10 @@ void ObitConvUtilConvGauss (ObitImage *inImage, ofloat Gaumaj, ofloat Gaumin,
   ObitImageDescCopyDesc (inImage->myDesc, outImage->myDesc, err);
   if (err->error) Obit_traceback_msg (err, routine, outImage->name);
 
-  /* Create FFTs */
-  FFTfor = ObitFeatherUtilCreateFFT(inImage, OBIT_FFT_Forward);
-  FFTrev = ObitFeatherUtilCreateFFT(inImage, OBIT_FFT_Reverse);
-
-  /* Create transfer function function */
-  naxis[0] = FFTfor->dim[0];  naxis[1] = FFTfor->dim[1]; 
+  /* Gaussian geometry */
   cells[0] = inImage->myDesc->cdelt[0] * 3600.0;
   cells[1] = inImage->myDesc->cdelt[1] * 3600.0;
   maprot   = inImage->myDesc->crota[1];
-  /* Get Gaussian for real part */
-  xferFn = ObitFArrayUtilUVGaus(naxis, &cells[0], maprot, 
-				Gaumaj, Gaumin, GauPA);
-  /* Only need half in u */
-  blc[0] = (naxis[0]/2)-1; blc[1] = 0;
-  trc[0] = naxis[0]-1;     trc[1] = naxis[1]-1;
-  subXferFn = ObitFArraySubArr (xferFn, blc, trc, err);
-  /* Array of zeroes for imaginary part */
-  naxis[0] = 1+naxis[0]/2;
-  zeroArray = ObitFArrayCreate("zeroes", 2, naxis);  
-
-  /* Convolving xfer function to wtArray */
-  wtArray = ObitFeatherUtilCreateFFTArray (FFTfor);
-  ObitCArrayComplex (subXferFn, zeroArray, wtArray);
-  ObitCArray2DCenter (wtArray);        /* Swaparoonie to FFT order */
-  xferFn    = ObitFArrayUnref(xferFn); /* Cleanup */
-  subXferFn = ObitFArrayUnref(subXferFn); /* Cleanup */
-  zeroArray = ObitFArrayUnref(zeroArray);
-
-  /* Pad array for image */
-  naxis[0] = FFTfor->dim[0];  naxis[1] = FFTfor->dim[1]; 
-  padImage = ObitFArrayCreate("Pad Image", ndim, naxis);
-  FTArray  = ObitFeatherUtilCreateFFTArray (FFTfor);
 
   /* Open input image */
   iretCode = ObitImageOpen (inImage, OBIT_IO_ReadOnly, err);
@@ -349,56 +340,20 @@ void ObitConvUtilConvGauss (ObitImage *inImage, ofloat Gaumaj, ofloat Gaumin,
   ObitImageOpen (outImage, OBIT_IO_WriteOnly, err);
   if (err->error) goto cleanup;
 
-  /* Normalize rescale for FFT */
-  rescale /= (ofloat)(FFTfor->dim[0] * FFTfor->dim[1]);
-
   /* Loop over planes until hitting EOF */
   while (iretCode!= OBIT_IO_EOF) {
     iretCode = ObitImageRead (inImage, NULL, err);
     if (iretCode == OBIT_IO_EOF) break;
     if (err->error) goto cleanup;
 
-    /* Pad image */
-    ObitFeatherUtilPadArray (FFTfor, inImage->image, padImage);
-    
-    /* FFT Convolving function to FTArray */
-    ObitFArray2DCenter (padImage); /* Swaparoonie to FFT order */
-    ObitFFTR2C (FFTfor, padImage, FTArray);
-
-    /* Multiply by transfer function */
-    ObitCArrayMul (FTArray, wtArray, FTArray);
-
-    /* Back FFT */
-    ObitFFTC2R(FFTrev, FTArray, padImage);
-    ObitFArray2DCenter (padImage);/* Swaparoonie */
-
-    /* DEBUG 
-    ObitImageUtilArray2Image ("ConvolDebug1.fits",1,padImage, err);*/
-
-    /* Get window to extract */
-    cen[0] = FFTfor->dim[0]/2;  cen[1] = FFTfor->dim[1]/2; 
-    blc[0] = cen[0] - inImage->image->naxis[0] / 2; 
-    /*trc[0] = cen[0] - 1 + inImage->image->naxis[0] / 2;*/
-    trc[0] = cen[0] + inImage->image->naxis[0] / 2;
-    trc[0] -= (trc[0]-blc[0]+1) - inImage->image->naxis[0];
-    blc[1] = cen[1] - inImage->image->naxis[1] / 2; 
-    /*trc[1] = cen[1] - 1 + inImage->image->naxis[1] / 2;*/
-    trc[1] = cen[1] + inImage->image->naxis[1] / 2;
-    trc[1] -= (trc[1]-blc[1]+1) - inImage->image->naxis[1];
-    
-    /* Extract */
-    tmpArray = ObitFArraySubArr(padImage, blc, trc, err);
+    /* Convolve, rescale units */
+    tmpArray = ObitConvUtilConvGaussArray (inImage->image, cells, maprot, 
+					   Gaumaj, Gaumin, GauPA, rescale, err);
     if (err->error) goto cleanup;
 
-    /* rescale units */
-    ObitFArraySMul (tmpArray, rescale);
-
-    /* Blank output where input blanked */
+    /* blank output where input blanked */
     ObitFArrayBlank (tmpArray, inImage->image, tmpArray);
 
-    /* DEBUG
-    ObitImageUtilArray2Image ("ConvolDebug1.fits",1,tmpArray, err); */
-
     /* Write plane */
     ObitImageWrite(outImage, tmpArray->array, err);
     if (err->error) goto cleanup;
@@ -419,15 +374,85 @@ void ObitConvUtilConvGauss (ObitImage *inImage, ofloat Gaumaj, ofloat Gaumin,
   outImage->extBuffer = FALSE;
 
  cleanup:
-  wtArray   = ObitCArrayUnref(wtArray);
-  FTArray   = ObitCArrayUnref(FTArray);
-  padImage  = ObitFArrayUnref(padImage);
   tmpArray  = ObitFArrayUnref(tmpArray);
-  FFTfor    = ObitFFTUnref(FFTfor);
-  FFTrev    = ObitFFTUnref(FFTrev);
   if (err->error) Obit_traceback_msg (err, routine, outImage->name);
 } /* end ObitConvUtilConvGauss */
 
+/**
+ * Convolve a 2-D array with a Gaussian.
+ * The method is chosen by the size of the Gaussian and the array:
+ * \li Separable direct convolution if the Gaussian is circular or aligned
+ *     with the array axes and small (4 sigma within CONVDIRECTMAX pixels).
+ * \li Overlap-save convolution in CONVTILESIZE tiles if the array would
+ *     need a larger FFT and the Gaussian is small compared to a tile.
+ * \li Otherwise a single FFT of the zero padded array.
+ * FFT plans and Gaussian transfer functions are cached between calls
+ * (see ObitFArrayUtilGausFT).
+ * Blanked pixels are treated as zero; the output is not blanked.
+ * \param in        Input 2-D array
+ * \param cells     Cell spacing in x and y (asec)
+ * \param maprot    Map rotation (deg)
+ * \param Gaumaj    Major axis of Gaussian in image plane (arcsec)
+ * \param Gaumin    Minor axis of Gaussian in image plane (arcsec)
+ * \param GauPA     Position angle of Gaussian in image plane, from N thru E, (deg)
+ * \param rescale   Multiplication factor to scale output to correct units
+ * \param err       ObitErr for reporting errors.
+ * \return convolved array the size of in, should be Unrefed when done
+ */
+ObitFArray* ObitConvUtilConvGaussArray (ObitFArray *in, ofloat *cells, 
+					ofloat maprot, ofloat Gaumaj, 
+					ofloat Gaumin, ofloat GauPA, 
+					ofloat rescale, ObitErr *err)
+{
+  ObitFArray *out=NULL;
+  olong nx, ny, H, tileSize;
+  ofloat sigma[2], theta, cellMin;
+  gchar *routine = "ObitConvUtilConvGaussArray";
+
+  /* error checks */
+  if (err->error) return out;
+  g_assert (ObitFArrayIsA(in));
+  Obit_retval_if_fail((in->ndim>=2),  err, out,
+		      "%s: FArray %s NOT 2-D", routine, in->name);
+  nx = in->naxis[0]; ny = in->naxis[1];
+
+  /* Separable? sigma along x and y in pixels */
+  sigma[0] = sigma[1] = -1.0;
+  theta = fmodf (fabsf(GauPA+maprot), 180.0);
+  if (Gaumin>=0.999*Gaumaj) {  /* Circular */
+    sigma[0] = Gaumaj / (2.3548*fabsf(cells[0]));
+    sigma[1] = Gaumaj / (2.3548*fabsf(cells[1]));
+  } else if ((theta<0.01) || (theta>179.99)) { /* Major axis along y */
+    sigma[0] = Gaumin / (2.3548*fabsf(cells[0]));
+    sigma[1] = Gaumaj / (2.3548*fabsf(cells[1]));
+  } else if (fabsf(theta-90.0)<0.01) {         /* Major axis along x */
+    sigma[0] = Gaumaj / (2.3548*fabsf(cells[0]));
+    sigma[1] = Gaumin / (2.3548*fabsf(cells[1]));
+  }
+  if ((sigma[0]>=CONVDIRECTSIGMA) && (sigma[1]>=CONVDIRECTSIGMA) &&
+      (4.0*sigma[0]<=CONVDIRECTMAX) && (4.0*sigma[1]<=CONVDIRECTMAX)) {
+    out = ConvGaussDirect (in, sigma, rescale);
+    return out;
+  }
+
+  /* Small enough Gaussian for tiles in a large array? */
+  cellMin  = MIN (fabsf(cells[0]), fabsf(cells[1]));
+  H        = (olong)(0.999 + 5.0 * Gaumaj / (2.3548*cellMin));
+  tileSize = ObitFFTSuggestSize (CONVTILESIZE);
+  if (((ObitFFTSuggestSize(nx)>tileSize) || (ObitFFTSuggestSize(ny)>tileSize)) &&
+      (4*H<tileSize)) {
+    out = ConvGaussTiled (in, tileSize, H, cells, maprot, 
+			  Gaumaj, Gaumin, GauPA, rescale, err);
+    if (err->error) Obit_traceback_val (err, routine, in->name, out);
+    return out;
+  }
+
+  /* Whole array FFT */
+  out = ConvGaussFFT (in, cells, maprot, Gaumaj, Gaumin, GauPA, rescale, err);
+  if (err->error) Obit_traceback_val (err, routine, in->name, out);
+  return out;
+} /* end ObitConvUtilConvGaussArray */
+
 /**
  * Create an ObitFArray containing a unit area Gaussian in the center
  * \param inImage ObitImage giving the geometry of the output array
@@ -543,3 +568,225 @@ void ObitConvUtilDeconv (ofloat fmaj, ofloat fmin, ofloat fpa,
     }
   } 
 } /* end of routine ObitConvUtilDeconv */ 
+
+/*----------------------Private functions---------------------------*/
+/**
+ * Separable direct convolution with a Gaussian aligned with the axes.
+ * Blanks are treated as zeroes, zero beyond the edges.
+ * \param in       Input 2-D array
+ * \param sigma    Gaussian sigma along x and y in pixels
+ * \param rescale  Multiplication factor for the unit sum Gaussian
+ * \return convolved array
+ */
+static ObitFArray* ConvGaussDirect (ObitFArray *in, ofloat *sigma, 
+				    ofloat rescale)
+{
+  ObitFArray *out=NULL, *work=NULL;
+  olong i, j, k, nx, ny, hx, hy, lo, hi;
+  ofloat *kx=NULL, *ky=NULL, sum, val, *row, *orow;
+  ofloat fblank = ObitMagicF();
+
+  nx = in->naxis[0]; ny = in->naxis[1];
+  work = ObitFArrayCreate ("Conv work", 2, in->naxis);
+  out  = ObitFArrayCreate ("Convolved", 2, in->naxis);
+
+  /* Unit sum kernels, rescale folded into y */
+  hx = (olong)(4.0*sigma[0] + 0.5);
+  hy = (olong)(4.0*sigma[1] + 0.5);
+  kx = g_malloc ((2*hx+1)*sizeof(ofloat));
+  ky = g_malloc ((2*hy+1)*sizeof(ofloat));
+  sum = 0.0;
+  for (k=-hx; k<=hx; k++) {
+    kx[k+hx] = expf (-0.5*k*k/(sigma[0]*sigma[0]));
+    sum += kx[k+hx];
+  }
+  for (k=0; k<=2*hx; k++) kx[k] /= sum;
+  sum = 0.0;
+  for (k=-hy; k<=hy; k++) {
+    ky[k+hy] = expf (-0.5*k*k/(sigma[1]*sigma[1]));
+    sum += ky[k+hy];
+  }
+  for (k=0; k<=2*hy; k++) ky[k] *= rescale / sum;
+
+  /* Along rows */
+  for (j=0; j<ny; j++) {
+    row  = in->array   + j*nx;
+    orow = work->array + j*nx;
+    for (i=0; i<nx; i++) orow[i] = 0.0;
+    for (i=0; i<nx; i++) {
+      val = row[i];
+      if ((val==fblank) || (val==0.0)) continue;
+      lo = MAX (0, i-hx); hi = MIN (nx-1, i+hx);
+      for (k=lo; k<=hi; k++) orow[k] += val * kx[k-i+hx];
+    }
+  }
+
+  /* Along columns */
+  ObitFArrayFill (out, 0.0);
+  for (j=0; j<ny; j++) {
+    row = work->array + j*nx;
+    lo = MAX (0, j-hy); hi = MIN (ny-1, j+hy);
+    for (k=lo; k<=hi; k++) {
+      orow = out->array + k*nx;
+      val  = ky[k-j+hy];
+      for (i=0; i<nx; i++) orow[i] += val * row[i];
+    }
+  }
+
+  work = ObitFArrayUnref(work);
+  g_free(kx); g_free(ky);
+  return out;
+} /* end ConvGaussDirect */
+
+/**
+ * Overlap-save convolution with a Gaussian in square tiles.
+ * Each tile of tileSize pixels is filled from the input including a 
+ * border of H pixels, convolved with an FFT and the central part kept.
+ * \param in        Input 2-D array
+ * \param tileSize  Size of FFT tile
+ * \param H         Border width in pixels, the Gaussian must be 
+ *                  negligible beyond this.
+ * \param cells     Cell spacing in x and y (asec)
+ * \param maprot    Map rotation (deg)
+ * \param Gaumaj    Major axis of Gaussian in image plane (arcsec)
+ * \param Gaumin    Minor axis of Gaussian in image plane (arcsec)
+ * \param GauPA     Position angle of Gaussian (deg)
+ * \param rescale   Multiplication factor
+ * \param err       ObitErr for reporting errors.
+ * \return convolved array
+ */
+static ObitFArray* ConvGaussTiled (ObitFArray *in, olong tileSize, olong H,
+				   ofloat *cells, ofloat maprot, ofloat Gaumaj, 
+				   ofloat Gaumin, ofloat GauPA, ofloat rescale,
+				   ObitErr *err)
+{
+  ObitFArray *out=NULL, *tile=NULL;
+  ObitCArray *wtArray=NULL, *FTArray=NULL;
+  ObitFFT    *FFTfor=NULL, *FFTrev=NULL;
+  olong i, j, ix, iy, x0, y0, nx, ny, core, naxis[2];
+  ofloat val, scale, *row, fblank = ObitMagicF();
+
+  nx = in->naxis[0]; ny = in->naxis[1];
+  core = tileSize - 2*H;
+  out  = ObitFArrayCreate ("Convolved", 2, in->naxis);
+
+  /* FFTs, transfer function, work arrays */
+  FFTfor  = ObitFArrayUtilGetFFT (OBIT_FFT_Forward, tileSize, tileSize);
+  FFTrev  = ObitFArrayUtilGetFFT (OBIT_FFT_Reverse, tileSize, tileSize);
+  wtArray = ObitFArrayUtilGausFT (tileSize, tileSize, cells, maprot, 
+				  Gaumaj, Gaumin, GauPA);
+  naxis[0] = tileSize; naxis[1] = tileSize;
+  tile    = ObitFArrayCreate ("Conv tile", 2, naxis);
+  FTArray = ObitFeatherUtilCreateFFTArray (FFTfor);
+  scale   = rescale / ((ofloat)tileSize * (ofloat)tileSize);
+
+  /* Loop over tiles */
+  for (y0=0; y0<ny; y0+=core) {
+    for (x0=0; x0<nx; x0+=core) {
+      /* Fill tile including border */
+      for (j=0; j<tileSize; j++) {
+	iy  = y0 - H + j;
+	row = tile->array + j*tileSize;
+	for (i=0; i<tileSize; i++) {
+	  ix = x0 - H + i;
+	  if ((iy<0) || (iy>=ny) || (ix<0) || (ix>=nx)) val = 0.0;
+	  else val = in->array[iy*nx+ix];
+	  if (val==fblank) val = 0.0;
+	  row[i] = val;
+	}
+      }
+
+      /* Convolve */
+      ObitFArray2DCenter (tile); /* Swaparoonie to FFT order */
+      ObitFFTR2C (FFTfor, tile, FTArray);
+      ObitCArrayMul (FTArray, wtArray, FTArray);
+      ObitFFTC2R (FFTrev, FTArray, tile);
+      ObitFArray2DCenter (tile); /* Swaparoonie */
+
+      /* Keep center */
+      for (j=H; j<H+core; j++) {
+	iy = y0 + j - H;
+	if (iy>=ny) break;
+	row = tile->array + j*tileSize;
+	for (i=H; i<H+core; i++) {
+	  ix = x0 + i - H;
+	  if (ix>=nx) break;
+	  out->array[iy*nx+ix] = scale * row[i];
+	}
+      }
+    } /* end loop in x */
+  } /* end loop in y */
+
+  tile    = ObitFArrayUnref(tile);
+  wtArray = ObitCArrayUnref(wtArray);
+  FTArray = ObitCArrayUnref(FTArray);
+  FFTfor  = ObitFFTUnref(FFTfor);
+  FFTrev  = ObitFFTUnref(FFTrev);
+  return out;
+} /* end ConvGaussTiled */
+
+/**
+ * Convolution with a Gaussian using an FFT of the whole padded array.
+ * \param in        Input 2-D array
+ * \param cells     Cell spacing in x and y (asec)
+ * \param maprot    Map rotation (deg)
+ * \param Gaumaj    Major axis of Gaussian in image plane (arcsec)
+ * \param Gaumin    Minor axis of Gaussian in image plane (arcsec)
+ * \param GauPA     Position angle of Gaussian (deg)
+ * \param rescale   Multiplication factor
+ * \param err       ObitErr for reporting errors.
+ * \return convolved array
+ */
+static ObitFArray* ConvGaussFFT (ObitFArray *in, ofloat *cells, 
+				 ofloat maprot, ofloat Gaumaj, 
+				 ofloat Gaumin, ofloat GauPA, 
+				 ofloat rescale, ObitErr *err)
+{
+  ObitFArray *out=NULL, *padImage=NULL;
+  ObitCArray *wtArray=NULL, *FTArray=NULL;
+  ObitFFT    *FFTfor=NULL, *FFTrev=NULL;
+  olong nx, ny, naxis[2], blc[2], trc[2], cen[2];
+  gchar *routine = "ConvGaussFFT";
+
+  /* FFTs, transfer function, work arrays */
+  nx = ObitFFTSuggestSize (in->naxis[0]);
+  ny = ObitFFTSuggestSize (in->naxis[1]);
+  FFTfor  = ObitFArrayUtilGetFFT (OBIT_FFT_Forward, nx, ny);
+  FFTrev  = ObitFArrayUtilGetFFT (OBIT_FFT_Reverse, nx, ny);
+  wtArray = ObitFArrayUtilGausFT (nx, ny, cells, maprot, 
+				  Gaumaj, Gaumin, GauPA);
+  naxis[0] = nx; naxis[1] = ny;
+  padImage = ObitFArrayCreate("Pad Image", 2, naxis);
+  FTArray  = ObitFeatherUtilCreateFFTArray (FFTfor);
+
+  /* Pad image */
+  ObitFeatherUtilPadArray (FFTfor, in, padImage);
+    
+  /* FFT, multiply by transfer function, back */
+  ObitFArray2DCenter (padImage); /* Swaparoonie to FFT order */
+  ObitFFTR2C (FFTfor, padImage, FTArray);
+  ObitCArrayMul (FTArray, wtArray, FTArray);
+  ObitFFTC2R(FFTrev, FTArray, padImage);
+  ObitFArray2DCenter (padImage);/* Swaparoonie */
+
+  /* Get window to extract */
+  cen[0] = nx/2;  cen[1] = ny/2; 
+  blc[0] = cen[0] - in->naxis[0] / 2; 
+  trc[0] = cen[0] + in->naxis[0] / 2;
+  trc[0] -= (trc[0]-blc[0]+1) - in->naxis[0];
+  blc[1] = cen[1] - in->naxis[1] / 2; 
+  trc[1] = cen[1] + in->naxis[1] / 2;
+  trc[1] -= (trc[1]-blc[1]+1) - in->naxis[1];
+    
+  /* Extract, rescale */
+  out = ObitFArraySubArr(padImage, blc, trc, err);
+  if (!err->error) ObitFArraySMul (out, rescale / ((ofloat)nx * (ofloat)ny));
+
+  wtArray  = ObitCArrayUnref(wtArray);
+  FTArray  = ObitCArrayUnref(FTArray);
+  padImage = ObitFArrayUnref(padImage);
+  FFTfor   = ObitFFTUnref(FFTfor);
+  FFTrev   = ObitFFTUnref(FFTrev);
+  if (err->error) Obit_traceback_val (err, routine, in->name, out);
+  return out;
+} /* end ConvGaussFFT */
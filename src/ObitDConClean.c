@@ -57,6 +57,18 @@ static ObitGetClassFP ObitParentGetClass = ObitDConGetClass;
 static ObitDConCleanClassInfo myClassInfo = {FALSE};
 
 /*--------------- File Global Variables  ----------------*/
+/** 
+ * Direct restoration is used when the number of pixels touched by 
+ * the component footprints is less than this times the number of 
+ * pixels in the image.
+ */
+#ifndef RESTDIRECTFACT
+#define RESTDIRECTFACT 2.0
+#endif
+/** Truncation of restoring beam footprint (exponent, exp(-12)~6e-6) */
+#ifndef RESTDIRECTCLIP
+#define RESTDIRECTCLIP 12.0
+#endif
 
 
 /*---------------Private structures----------------*/
@@ -90,6 +102,30 @@ typedef struct {
   ofloat sum2;
 } StatsFuncArg;
 
+/* Direct restoration threaded function argument */
+typedef struct {
+  /* Output array to accumulate restored components */
+  ObitFArray *grid;
+  /* Component list, (x pixel, y pixel, flux) triplets, 0-rel, by row */
+  ofloat     *list;
+  /* Number of entries in list */
+  olong      npts;
+  /* Restoring beam stamp (2*hx+1) x (2*hy+1), peak 1 at center */
+  ofloat     *stamp;
+  /* Half width of stamp in x */
+  olong      hx;
+  /* Half width of stamp in y */
+  olong      hy;
+  /* First (1-rel) row in grid to process this thread */
+  olong      first;
+  /* Highest (1-rel) row in grid to process this thread  */
+  olong      last;
+  /* thread number, <0 -> no threading  */
+  olong      ithread;
+  /* Obit Thread object */
+  ObitThread  *thread;
+} RestoreFuncArg;
+
 /*---------------Private function prototypes----------------*/
 /** Private: Deallocate members. */
 void  ObitDConCleanInit (gpointer in);
@@ -107,6 +143,14 @@ void ReadBP (ObitDConClean* in, ObitErr *err);
 static void GaussTaper (ObitCArray* uvGrid,  ObitImageDesc *imDesc,
 			ofloat gparm[3]);
 
+/** Private: Restore sparse components directly in the image plane. */
+static gboolean RestoreDirect (ObitThread *thread, ObitFArray *grid, 
+			       olong ncomp, ObitImageDesc *imDesc, 
+			       ofloat gparm[3], ObitErr *err);
+
+/** Private: Threaded direct restoration */
+static gpointer ThreadRestoreDirect (gpointer arg);
+
 /** Private: Set Class function pointers. */
 static void ObitDConCleanClassInfoDefFn (gpointer inClass);
 
@@ -121,6 +165,14 @@ static olong MakeStatsFuncArgs (ObitThread *thread,
 /** Private: Delete Threaded Image statistics args */
 static void KillStatsFuncArgs (olong nargs, StatsFuncArg **ThreadArgs);
 
+/** Private: Are saved statistics for a field still valid? */
+static gboolean StatsCurrent (ObitDConClean *in, olong ifield, gboolean doBeam,
+			      ObitImage *image);
+
+/** Private: Remember state of a field for which statistics were made */
+static void StatsSave (ObitDConClean *in, olong ifield, gboolean doBeam,
+		       ObitImage *image);
+
 /** Private: Add Clean Windows from CLEANFile */
 static void  AddCleanFileWindow(ObitDConClean *in, gchar *Cfile, ObitErr *err);
 /*----------------------Public functions---------------------------*/
@@ -222,6 +274,9 @@ ObitDConClean* ObitDConCleanCopy  (ObitDConClean *in, ObitDConClean *out, ObitEr
   out->imgRMS      = ObitMemFree (out->imgRMS);
   out->imgPeakRMS  = ObitMemFree (out->imgPeakRMS);
   out->beamPeakRMS = ObitMemFree (out->beamPeakRMS);
+  out->statGen     = ObitMemFree (out->statGen);
+  out->statWinMod  = ObitMemFree (out->statWinMod);
+  out->beamStatGen = ObitMemFree (out->beamStatGen);
   out->currentFields = ObitMemFree (out->currentFields);
   if (out->BeamPatches) {
     for (i=0; i<in->mosaic->numberImages; i++) 
@@ -304,6 +359,9 @@ void ObitDConCleanClone  (ObitDConClean *in, ObitDConClean *out, ObitErr *err)
   out->imgRMS      = ObitMemFree (out->imgRMS);
   out->imgPeakRMS  = ObitMemFree (out->imgPeakRMS);
   out->beamPeakRMS = ObitMemFree (out->beamPeakRMS);
+  out->statGen     = ObitMemFree (out->statGen);
+  out->statWinMod  = ObitMemFree (out->statWinMod);
+  out->beamStatGen = ObitMemFree (out->beamStatGen);
   out->currentFields = ObitMemFree (out->currentFields);
   if (out->BeamPatches) {
     for (i=0; i<in->mosaic->numberImages; i++) 
@@ -925,6 +983,8 @@ gboolean ObitDConCleanPixelStats(ObitDConClean *in, ObitFArray **pixarray,
  * \li imgPeakRMS  Image Peak/RMS  (doBeam=FALSE)
  * \li beamPeakRMS Beam Peak/RMS  (doBeam = TRUE)
  *
+ * Fields whose image (or beam), window and plane are unchanged since 
+ * their statistics were last determined are not reread.
  * \param in    The object to deconvolve
  * \param field Which field? (1-rel) <=0 -> all;
  * \param doBeam If TRUE, do Beam statistics else Image
@@ -967,6 +1027,31 @@ void ObitDConCleanImageStats(ObitDConClean *in, olong field, gboolean doBeam,
     hi = in->nfield-1;
   }
 
+  /* Saved state of previous statistics */
+  if ((in->statGen==NULL) || (in->statWinMod==NULL) || (in->beamStatGen==NULL)) {
+    in->statGen     = ObitMemFree (in->statGen);
+    in->statWinMod  = ObitMemFree (in->statWinMod);
+    in->beamStatGen = ObitMemFree (in->beamStatGen);
+    in->statGen     = ObitMemAlloc0Name(in->nfield*sizeof(olong),"Clean stat gen");
+    in->statWinMod  = ObitMemAlloc0Name(in->nfield*sizeof(olong),"Clean stat window");
+    in->beamStatGen = ObitMemAlloc0Name(in->nfield*sizeof(olong),"Clean beam stat gen");
+    for (i=0; i<in->nfield; i++) {
+      in->statGen[i]     = -1;
+      in->beamStatGen[i] = -1;
+    }
+  }
+  /* New plane invalidates everything */
+  for (i=0; i<IM_MAXDIM-2; i++) {
+    if (in->statPlane[i]!=in->plane[i]) {
+      for (it=0; it<in->nfield; it++) {
+	in->statGen[it]     = -1;
+	in->beamStatGen[it] = -1;
+      }
+      for (it=0; it<IM_MAXDIM-2; it++) in->statPlane[it] = in->plane[it];
+      break;
+    }
+  }
+
   /* Initialize Threading */
   if (!doBeam) theWindow = in->window; /* Use image window */
   nThreads = MakeStatsFuncArgs (in->thread, theWindow, err, &threadArgs);
@@ -986,6 +1071,9 @@ void ObitDConCleanImageStats(ObitDConClean *in, olong field, gboolean doBeam,
     else
       image = in->mosaic->images[i];
 
+    /* Nothing changed since last time? */
+    if (StatsCurrent (in, i, doBeam, image)) continue;
+
     /* Get existing BLC, TRC */
     ObitInfoListGetTest (image->info, "BLC", &type, dim, oblc); 
     ObitInfoListGetTest (image->info, "TRC", &type, dim, otrc); 
@@ -1084,6 +1172,9 @@ void ObitDConCleanImageStats(ObitDConClean *in, olong field, gboolean doBeam,
     ObitImageClose (image, err);
     if (err->error) Obit_traceback_msg (err, routine, image->name);
 
+    /* Remember what these statistics describe */
+    StatsSave (in, i, doBeam, image);
+
     /* Free Image array and work references */
     /* No longer Referenced
     for (it=0; it<nTh; it++) 
@@ -1275,32 +1366,7 @@ void ObitDConCleanRestore(ObitDConClean *in, ObitErr *err)
     /* if (err->error) Obit_traceback_msg (err, routine, in->name);*/
     /* END DEBUG */
 
-   /* FFT to image plane */
-    ObitFArray2DCenter (grid); /* Swaparoonie to FFT order */
-    /* Make Output of FFT if needed */
-    ndim = 2;
-    naxis[0] = 1+grid->naxis[1]/2; naxis[1] = grid->naxis[0]; 
-    if (uvGrid) uvGrid = ObitCArrayRealloc(uvGrid, ndim, naxis);
-    else uvGrid = ObitCArrayCreate ("FFT output", ndim, naxis);
-    /* Create Forward FFT or reuse if OK */
-    ddim[0] = grid->naxis[1]; ddim[1] = grid->naxis[0];
-    if ((!forFFT) || (ddim[0]!=forFFT->dim[0]) || (ddim[1]!=forFFT->dim[1])) {
-      forFFT = ObitFFTUnref(forFFT);
-      forFFT = newObitFFT("FFT:FTImage", OBIT_FFT_Forward, 
-			  OBIT_FFT_HalfComplex, 2, ddim);
-    }
-    /* FFT */
-    ObitFFTR2C (forFFT, grid, uvGrid);
-    /* Put the center at the center */
-    ObitCArray2DCenter (uvGrid);
-    
-    /* DEBUG */
-    /*tempFArray = ObitCArrayMakeF(uvGrid);*/  /* Temp FArray */
-    /*ObitCArrayReal (uvGrid, tempFArray);*/   /* Get real part */
-    /*tempFArray = ObitFArrayUnref(tempFArray);*/   /* delete temporary */
-    /* END DEBUG */
-
-   /* Taper for Gaussian - Use restoring beam or Gaussians from table if any 
+   /* Gaussian - Use restoring beam or Gaussians from table if any 
       add rotation of image */
     if (gparm[0]<0.0) { /* restoring beam */
       gparm[0] = bmaj;
@@ -1311,28 +1377,59 @@ void ObitDConCleanRestore(ObitDConClean *in, ObitErr *err)
       gparm[1] = gparm[1];
       gparm[2] = gparm[2] + image->myDesc->crota[image->myDesc->jlocd];
     }
-    GaussTaper (uvGrid, imDesc, gparm);
-
-    /* DEBUG */
-    /*tempFArray = ObitCArrayMakeF(uvGrid); */  /* Temp FArray */
-    /*ObitCArrayReal (uvGrid, tempFArray); */   /* Get real part */
-    /*ObitImageUtilArray2Image ("DbuguvGridAfter.fits", 1, tempFArray, err); */
-    /*tempFArray = ObitFArrayUnref(tempFArray); */   /* delete temporary */
-    /* END DEBUG */
 
-   /* FFT back to image */
-    ObitCArray2DCenter (uvGrid); /* Swaparoonie to FFT order */
-    /* Create reverse FFT or reuse if OK */
-    ddim[0] = grid->naxis[1]; ddim[1] = grid->naxis[0];
-    if ((!revFFT) || (ddim[0]!=revFFT->dim[0]) || (ddim[1]!=revFFT->dim[1])) {
-      revFFT = ObitFFTUnref(revFFT);
-      revFFT = newObitFFT("FFT:FTuv", OBIT_FFT_Reverse, 
-			  OBIT_FFT_HalfComplex, 2, ddim);
-    }
-    /* FFT */
-    ObitFFTC2R (revFFT, uvGrid, grid);
-    /* Put the center at the center */
-    ObitFArray2DCenter (grid);
+    /* Few components?  Add footprints directly, else convolve by FFT */
+    if (!RestoreDirect (in->thread, grid, ncomp, imDesc, gparm, err)) {
+
+     /* FFT to image plane */
+      ObitFArray2DCenter (grid); /* Swaparoonie to FFT order */
+      /* Make Output of FFT if needed */
+      ndim = 2;
+      naxis[0] = 1+grid->naxis[1]/2; naxis[1] = grid->naxis[0]; 
+      if (uvGrid) uvGrid = ObitCArrayRealloc(uvGrid, ndim, naxis);
+      else uvGrid = ObitCArrayCreate ("FFT output", ndim, naxis);
+      /* Create Forward FFT or reuse if OK */
+      ddim[0] = grid->naxis[1]; ddim[1] = grid->naxis[0];
+      if ((!forFFT) || (ddim[0]!=forFFT->dim[0]) || (ddim[1]!=forFFT->dim[1])) {
+        forFFT = ObitFFTUnref(forFFT);
+        forFFT = newObitFFT("FFT:FTImage", OBIT_FFT_Forward, 
+			    OBIT_FFT_HalfComplex, 2, ddim);
+      }
+      /* FFT */
+      ObitFFTR2C (forFFT, grid, uvGrid);
+      /* Put the center at the center */
+      ObitCArray2DCenter (uvGrid);
+    
+      /* DEBUG */
+      /*tempFArray = ObitCArrayMakeF(uvGrid);*/  /* Temp FArray */
+      /*ObitCArrayReal (uvGrid, tempFArray);*/   /* Get real part */
+      /*tempFArray = ObitFArrayUnref(tempFArray);*/   /* delete temporary */
+      /* END DEBUG */
+
+      GaussTaper (uvGrid, imDesc, gparm);
+
+      /* DEBUG */
+      /*tempFArray = ObitCArrayMakeF(uvGrid); */  /* Temp FArray */
+      /*ObitCArrayReal (uvGrid, tempFArray); */   /* Get real part */
+      /*ObitImageUtilArray2Image ("DbuguvGridAfter.fits", 1, tempFArray, err); */
+      /*tempFArray = ObitFArrayUnref(tempFArray); */   /* delete temporary */
+      /* END DEBUG */
+
+     /* FFT back to image */
+      ObitCArray2DCenter (uvGrid); /* Swaparoonie to FFT order */
+      /* Create reverse FFT or reuse if OK */
+      ddim[0] = grid->naxis[1]; ddim[1] = grid->naxis[0];
+      if ((!revFFT) || (ddim[0]!=revFFT->dim[0]) || (ddim[1]!=revFFT->dim[1])) {
+        revFFT = ObitFFTUnref(revFFT);
+        revFFT = newObitFFT("FFT:FTuv", OBIT_FFT_Reverse, 
+			    OBIT_FFT_HalfComplex, 2, ddim);
+      }
+      /* FFT */
+      ObitFFTC2R (revFFT, uvGrid, grid);
+      /* Put the center at the center */
+      ObitFArray2DCenter (grid);
+    } /* end FFT restoration */
+    if (err->error) Obit_traceback_msg (err, routine, in->name);
 
     /* read residuals */
     retCode = ObitImageRead (image, image->image->array, err);
@@ -1407,6 +1504,8 @@ void ObitDConCleanFlatten(ObitDConClean *in, ObitErr *err)
  * Restore components removed from one field but also 
  * appearing in another.  Does brute force convolution.
  * Adopted from the AIPSish QOOP:QCLEAN.FOR(CLOVER)
+ * Each CC table is read once into a sky position index 
+ * (ObitTableCCUtilSkyIndex) which is queried for each pair of fields.
  * Presumes in->mosaic and image descriptors filled in.
  * \param in   The object to restore
  * \param err Obit error stack object.
@@ -1418,6 +1517,7 @@ void ObitDConCleanXRestore(ObitDConClean *in, ObitErr *err)
   ObitImageDesc *imDesc1=NULL, *imDesc2=NULL;
   ObitTable *tempTable=NULL;
   ObitTableCC *CCTable = NULL;
+  ObitTableCCUtilSkyIndex *skyIndex = NULL;
   ObitFArray *list = NULL, *tmpArray = NULL;
   ObitIOSize IOsize = OBIT_IO_byPlane;
   ObitIOCode retCode;
@@ -1445,6 +1545,22 @@ void ObitDConCleanXRestore(ObitDConClean *in, ObitErr *err)
     ObitErrLog(err);  /* Progress Report */
   }
 
+  /* Index components of all fields */
+  skyIndex = ObitTableCCUtilSkyIndexCreate (in->nfield);
+  for (jfield = 0; jfield<in->nfield; jfield++) {
+    ver = in->CCver;
+    tempTable = newObitImageTable (in->mosaic->images[jfield], 
+				   OBIT_IO_ReadWrite, tabType, &ver, err);
+    CCTable = ObitTableCCConvert(tempTable);
+    tempTable = ObitTableUnref(tempTable);
+    if (err->error) goto cleanup;
+    in->CCver = ver;  /* save if defaulted (0) */
+    ObitTableCCUtilSkyIndexAdd (skyIndex, jfield, CCTable, 
+				(in->mosaic->images[jfield])->myDesc, err);
+    CCTable = ObitTableCCUnref(CCTable);
+    if (err->error) goto cleanup;
+  }
+
   /* Double Loop over fields */
   for (ifield = 0; ifield<in->nfield; ifield++) {
     imDesc2 = (in->mosaic->images[ifield])->myDesc;
@@ -1460,27 +1576,16 @@ void ObitDConCleanXRestore(ObitDConClean *in, ObitErr *err)
       imDesc1 = (in->mosaic->images[jfield])->myDesc;
 
       /* Any overlap? */
-      if (ObitImageDescOverlap(imDesc1, imDesc2, err)) {
+      if (ObitTableCCUtilSkyIndexOverlap(skyIndex, jfield, imDesc2) &&
+	  ObitImageDescOverlap(imDesc1, imDesc2, err)) {
 
 	/* Get additional beam taper */
 	ObitInfoListGetTest(imDesc1->info, "BeamTapr", &itype, dim, &BeamTaper1);
 
-	/* Get CC table */
-	ver = in->CCver;
-	tempTable = newObitImageTable (in->mosaic->images[jfield], 
-				       OBIT_IO_ReadWrite, tabType, &ver, err);
-	CCTable = ObitTableCCConvert(tempTable);
-	tempTable = ObitTableUnref(tempTable);
-	if (err->error) Obit_traceback_msg (err, routine, in->name);
-	in->CCver = ver;  /* save if defaulted (0) */
-
 	/* Get list from jfield */
-	list = ObitTableCCUtilCrossList (CCTable, imDesc1, imDesc2, 
-					 gparm, &ncomp, err);
-	if (err->error) Obit_traceback_msg (err, routine, in->name);
-
-	/* Free CC table */
-	CCTable = ObitTableCCUnref(CCTable);
+	list = ObitTableCCUtilSkyIndexCrossList (skyIndex, jfield, imDesc2, 
+						 gparm, &ncomp, err);
+	if (err->error) goto cleanup;
 
 	if ((in->prtLv>2) && (ncomp>0)) {
 	  Obit_log_error(err, OBIT_InfoErr,"Restore %d components from %d to  %d",
@@ -1546,7 +1651,7 @@ void ObitDConCleanXRestore(ObitDConClean *in, ObitErr *err)
 	list = ObitFArrayUnref(list);
 
       } /* end if overlap */
-      if (err->error) Obit_traceback_msg (err, routine, in->name);
+      if (err->error) goto cleanup;
     }/* end inner loop over fields */
     
     /* Do we have something to add */
@@ -1569,11 +1674,11 @@ void ObitDConCleanXRestore(ObitDConClean *in, ObitErr *err)
       /* Open Image */
       retCode = ObitImageOpen (image, OBIT_IO_ReadWrite, err);
       if ((retCode != OBIT_IO_OK) || (err->error))
-	Obit_traceback_msg (err, routine, in->name);
+	goto cleanup;
       
       /* read image */
       retCode = ObitImageRead (image, image->image->array, err);
-      if (err->error) Obit_traceback_msg (err, routine, image->name);
+      if (err->error) goto cleanup;
 
       /* DEBUG Zero old 
       fprintf (stderr, "DEBUG: zero old pixels\n");
@@ -1585,19 +1690,19 @@ void ObitDConCleanXRestore(ObitDConClean *in, ObitErr *err)
       /* Close Image and reopen to reposition */
       retCode = ObitImageClose (image, err);
       if ((retCode != OBIT_IO_OK) || (err->error))
-	Obit_traceback_msg (err, routine, in->name);
+	goto cleanup;
       retCode = ObitImageOpen (image, OBIT_IO_ReadWrite, err);
       if ((retCode != OBIT_IO_OK) || (err->error))
-	Obit_traceback_msg (err, routine, in->name);
+	goto cleanup;
       
       /* rewrite image */
       retCode = ObitImageWrite (image, tmpArray->array, err);
-      if (err->error) Obit_traceback_msg (err, routine, image->name);
+      if (err->error) goto cleanup;
       
       /* Close Image */
       retCode = ObitImageClose (image, err);
       if ((retCode != OBIT_IO_OK) || (err->error))
-	Obit_traceback_msg (err, routine, in->name);
+	goto cleanup;
       
       /* Free image memory */
       image->image = ObitFArrayUnref(image->image);
@@ -1605,6 +1710,12 @@ void ObitDConCleanXRestore(ObitDConClean *in, ObitErr *err)
       
     } /* end add to existing image */
   } /* end outer loop over fields */
+
+ cleanup:
+  skyIndex = ObitTableCCUtilSkyIndexFree (skyIndex);
+  list     = ObitFArrayUnref(list);
+  tmpArray = ObitFArrayUnref(tmpArray);
+  if (err->error) Obit_traceback_msg (err, routine, in->name);
 } /* end ObitDConCleanXRestore */
 
 /**
@@ -1630,7 +1741,7 @@ gboolean ObitDConCleanAutoWindow(ObitDConClean *in, olong *fields, ObitFArray **
 {
   gboolean newWin = FALSE;
   ObitImage *image=NULL;
-  ObitFArray *usePixels;
+  ObitFArray *usePixels, **FieldPixels=NULL;
   ObitIOSize IOsize = OBIT_IO_byPlane;
   gint32 dim[MAXINFOELEMDIM] = {1,1,1,1,1};
   olong  i, j, field, best, blc[IM_MAXDIM], trc[IM_MAXDIM];
@@ -1652,6 +1763,8 @@ gboolean ObitDConCleanAutoWindow(ObitDConClean *in, olong *fields, ObitFArray **
   /* find best field */
   FieldPeak = g_malloc0(in->numCurrentField*sizeof(ofloat));
   for (field=0; field<in->numCurrentField; field++) FieldPeak[field]=0.0;
+  /* Pixels read in the first pass, by entry in fields */
+  FieldPixels = g_malloc0(in->numCurrentField*sizeof(ObitFArray*));
 
   best = 0;
   bestPeak = -1.0e20;
@@ -1676,8 +1789,10 @@ gboolean ObitDConCleanAutoWindow(ObitDConClean *in, olong *fields, ObitFArray **
       usePixels = image->image;  /* Pointer to image buffer */
       
     } else { /* Use array passed */
-      usePixels = ObitFArrayRef(pixarray[field]);
+      usePixels = pixarray[field];
     }
+    /* Keep for second pass */
+    FieldPixels[field] = ObitFArrayRef(usePixels);
     
     /* Allow negative for Stokes other than I */
     doAbs = fabs (image->myDesc->crval[image->myDesc->jlocs]-1.0) > 0.1;
@@ -1706,9 +1821,12 @@ gboolean ObitDConCleanAutoWindow(ObitDConClean *in, olong *fields, ObitFArray **
     if ((FieldPeak[j]<0.7*bestPeak) && (j!=best)) continue;
     field = fields[j];
 
-    /* Use passed pixel array or get image */
+    /* Use pixels from first pass if of this image, passed pixel array
+       or get image */
     image = in->mosaic->images[field-1];
-    if (pixarray==NULL) {
+    if (FieldPixels[j] && (field==(j+1))) {
+      usePixels = ObitFArrayRef(FieldPixels[j]);
+    } else if (pixarray==NULL) {
       
       /* Set input to full image, plane at a time */
       dim[0] = IM_MAXDIM;
@@ -1721,10 +1839,10 @@ gboolean ObitDConCleanAutoWindow(ObitDConClean *in, olong *fields, ObitFArray **
       ObitImageRead (image, image->image->array, err);
       ObitImageClose (image, err);
       if (err->error) Obit_traceback_val (err, routine, image->name, newWin);
-      usePixels = image->image;  /* Pointer to image buffer */
+      usePixels = ObitFArrayRef(image->image);  /* Pointer to image buffer */
       
     } else { /* Use array passed */
-      usePixels = ObitFArrayRef(pixarray[field]);
+      usePixels = ObitFArrayRef(pixarray[field-1]);
     }
     
     /* Allow negative for Stokes other than I */
@@ -1749,11 +1867,12 @@ gboolean ObitDConCleanAutoWindow(ObitDConClean *in, olong *fields, ObitFArray **
     }
 
     /* Free Image array? */
-    if (usePixels==image->image) 
-      image->image = ObitFArrayUnref(image->image);
-    else
-      usePixels = ObitFArrayUnref(usePixels);
+    if (pixarray==NULL) image->image = ObitFArrayUnref(image->image);
+    usePixels = ObitFArrayUnref(usePixels);
   } /* end loop over fields */
+  for (j=0; j<in->numCurrentField; j++)
+    FieldPixels[j] = ObitFArrayUnref(FieldPixels[j]);
+  g_free(FieldPixels);
   
   /* Determine max. cleanable pixel value not in a window */
   for (field=0; field<in->numCurrentField; field++) {
@@ -1922,6 +2041,7 @@ void ObitDConCleanInit  (gpointer inn)
 {
   ObitClassInfo *ParentClass;
   ObitDConClean *in = inn;
+  olong i;
 
   /* error checks */
   g_assert (in != NULL);
@@ -1944,6 +2064,10 @@ void ObitDConCleanInit  (gpointer inn)
   in->imgRMS      = NULL;
   in->imgPeakRMS  = NULL;
   in->beamPeakRMS = NULL;
+  in->statGen     = NULL;
+  in->statWinMod  = NULL;
+  in->beamStatGen = NULL;
+  for (i=0; i<IM_MAXDIM-2; i++) in->statPlane[i] = 0;
   in->CCver       = 0;
   in->bmaj        = 0.0;
   in->bmin        = 0.0;
@@ -1995,6 +2119,9 @@ void ObitDConCleanClear (gpointer inn)
   in->imgRMS       = ObitMemFree (in->imgRMS);
   in->imgPeakRMS   = ObitMemFree (in->imgPeakRMS);
   in->beamPeakRMS  = ObitMemFree (in->beamPeakRMS);
+  in->statGen      = ObitMemFree (in->statGen);
+  in->statWinMod   = ObitMemFree (in->statWinMod);
+  in->beamStatGen  = ObitMemFree (in->beamStatGen);
 
   /* unlink parent class members */
   ParentClass = (ObitClassInfo*)(myClassInfo.ParentClass);
@@ -2320,6 +2447,212 @@ static void GaussTaper (ObitCArray* uvGrid, ObitImageDesc *imDesc,
 
 } /* end GaussTaper */
 
+/**
+ * Restore components directly in the image plane if sparse.
+ * If the pixels covered by the truncated restoring beam footprints
+ * of the gridded components are few compared with the number of 
+ * pixels in the image, the gridded components are replaced by the 
+ * sum of their footprints, otherwise grid is left unchanged.
+ * As the gridded components lie on pixels, a single sampled beam 
+ * stamp is computed and added, scaled, at each occupied pixel.
+ * The peak of the beam is unity as in GaussTaper but there is no 
+ * wraparound at the image edges.
+ * The work is divided among threads by blocks of rows.
+ * \param thread  ObitThread object to be used 
+ * \param grid    [in] components as gridded by ObitTableCCUtilGrid
+ *                [out] restored components if TRUE returned
+ * \param ncomp   Number of components gridded
+ * \param imDesc  Image descriptor for grid
+ * \param gparm   Gaussian in units of degrees, bmaj, bmin, bpa
+ * \param err     Obit error stack object.
+ * \return TRUE if grid restored, FALSE -> unchanged, use FFT.
+ */
+static gboolean RestoreDirect (ObitThread *thread, ObitFArray *grid, 
+			       olong ncomp, ObitImageDesc *imDesc, 
+			       ofloat gparm[3], ObitErr *err)
+{
+  RestoreFuncArg **threadArgs=NULL;
+  ofloat cellx, celly, cr, sr, bmaj, bmin, aa, bb, cc, det, farg;
+  ofloat *list=NULL, *stamp=NULL, *array;
+  olong i, j, k, sx, hx, hy, nx, ny, npts, nTh, nThreads;
+  olong nrow, nrowPerThread, lorow, hirow;
+  odouble nfoot;
+  gboolean OK;
+  gchar *routine = "RestoreDirect";
+
+  /* Nothing gridded - grid is all zero */
+  if (ncomp<=0) return TRUE;
+
+  nx = grid->naxis[0];
+  ny = grid->naxis[1];
+
+  /* Beam must be resolved by the pixels */
+  bmaj  = gparm[0];
+  bmin  = gparm[1];
+  cellx = imDesc->cdelt[imDesc->jlocr];
+  celly = imDesc->cdelt[imDesc->jlocd];
+  if ((bmin<fabs(cellx)) || (bmin<fabs(celly))) return FALSE;
+
+  /* Gaussian parameters in units of cells */
+  cr = cos (gparm[2]*DG2RAD);
+  sr = sin (gparm[2]*DG2RAD);
+  aa = ((cr*cr)/(bmin*bmin) + (sr*sr)/(bmaj*bmaj)) * cellx*cellx*4.0*log(2.0);
+  bb = ((sr*sr)/(bmin*bmin) + (cr*cr)/(bmaj*bmaj)) * celly*celly*4.0*log(2.0);
+  cc = (1.0/(bmaj*bmaj) - 1.0/(bmin*bmin)) * sr*cr*cellx*celly*8.0*log(2.0);
+  det = aa*bb - 0.25*cc*cc;
+  if (det<=0.0) return FALSE;
+
+  /* Half widths of footprint truncated at RESTDIRECTCLIP */
+  hx = (olong)(sqrt(RESTDIRECTCLIP*bb/det) + 1.0);
+  hy = (olong)(sqrt(RESTDIRECTCLIP*aa/det) + 1.0);
+  hx = MIN (hx, nx);
+  hy = MIN (hy, ny);
+
+  /* Sparse enough? */
+  nfoot = ((odouble)ncomp) * (2*hx+1) * (2*hy+1);
+  if (nfoot > RESTDIRECTFACT*((odouble)nx)*((odouble)ny)) return FALSE;
+
+  /* Beam stamp */
+  sx = 2*hx+1;
+  stamp = g_malloc0(sx*(2*hy+1)*sizeof(ofloat));
+  for (j=-hy; j<=hy; j++) {
+    for (i=-hx; i<=hx; i++) {
+      farg = aa*i*i + bb*j*j + cc*i*j;
+      if (farg<RESTDIRECTCLIP) stamp[(j+hy)*sx+i+hx] = exp(-farg);
+    }
+  }
+
+  /* Extract occupied pixels by row and zero grid */
+  array = grid->array;
+  npts = 0;
+  for (k=0; k<nx*ny; k++) if (array[k]!=0.0) npts++;
+  list = g_malloc0((3*npts+1)*sizeof(ofloat));
+  npts = 0;
+  for (j=0; j<ny; j++) {
+    for (i=0; i<nx; i++) {
+      if (array[i]!=0.0) {
+	list[npts*3]   = (ofloat)i;
+	list[npts*3+1] = (ofloat)j;
+	list[npts*3+2] = array[i];
+	array[i] = 0.0;
+	npts++;
+      }
+    }
+    array += nx;
+  }
+
+  /* Divide up work by rows */
+  nThreads = MAX (1, ObitThreadNumProc(thread));
+  nrow = ny;
+  nrowPerThread = nrow/nThreads;
+  nTh = nThreads;
+  if (nrow<64) {nrowPerThread = nrow; nTh = 1;}
+  lorow = 1;
+  hirow = nrowPerThread;
+  hirow = MIN (hirow, nrow);
+
+  /* Set up thread arguments */
+  threadArgs = g_malloc0(nTh*sizeof(RestoreFuncArg*));
+  for (i=0; i<nTh; i++) {
+    if (i==(nTh-1)) hirow = nrow;  /* Make sure do all */
+    threadArgs[i] = g_malloc0(sizeof(RestoreFuncArg)); 
+    threadArgs[i]->grid    = grid;
+    threadArgs[i]->list    = list;
+    threadArgs[i]->npts    = npts;
+    threadArgs[i]->stamp   = stamp;
+    threadArgs[i]->hx      = hx;
+    threadArgs[i]->hy      = hy;
+    threadArgs[i]->first   = lorow;
+    threadArgs[i]->last    = hirow;
+    threadArgs[i]->thread  = thread;
+    if (nTh>1) threadArgs[i]->ithread = i;
+    else threadArgs[i]->ithread = -1;
+    /* Update which row */
+    lorow += nrowPerThread;
+    hirow += nrowPerThread;
+    hirow = MIN (hirow, nrow);
+  }
+
+  /* Do operation */
+  OK = ObitThreadIterator (thread, nTh, 
+			   (ObitThreadFunc)ThreadRestoreDirect,
+			   (gpointer**)threadArgs);
+
+  /* Cleanup */
+  for (i=0; i<nTh; i++) g_free(threadArgs[i]);
+  g_free(threadArgs);
+  g_free(list);
+  g_free(stamp);
+
+  /* Check for problems */
+  if (!OK) Obit_log_error(err, OBIT_Error,"%s: Problem in threading", routine);
+
+  return TRUE;
+} /* end RestoreDirect */
+
+/**
+ * Add scaled beam stamps for a block of rows of a grid.
+ * Only the footprints overlapping the rows of this thread are used.
+ * Callable as thread
+ * \param arg Pointer to RestoreFuncArg argument with elements:
+ * \li grid     ObitFArray to accumulate into
+ * \li list     Component (x,y,flux) triplets ordered by row
+ * \li npts     Number of components in list
+ * \li stamp    Beam stamp
+ * \li hx       Half width of stamp in x
+ * \li hy       Half width of stamp in y
+ * \li first    First (1-rel) row in grid to process this thread
+ * \li last     Highest (1-rel) row in grid to process this thread
+ * \li ithread  thread number, <0 -> no threading
+ * \li thread   thread Object
+ * \return NULL
+ */
+static gpointer ThreadRestoreDirect (gpointer args)
+{
+  /* Get arguments from structure */
+  RestoreFuncArg *largs = (RestoreFuncArg*)args;
+  ObitFArray *grid  = largs->grid;
+  ofloat     *list  = largs->list;
+  olong      npts   = largs->npts;
+  ofloat     *stamp = largs->stamp;
+  olong      hx     = largs->hx;
+  olong      hy     = largs->hy;
+  olong      loRow  = largs->first-1;
+  olong      hiRow  = largs->last-1;
+  /* local */
+  olong k, ix, iy, px, py, ixlo, ixhi, iylo, iyhi, off, nx, sx;
+  ofloat flux, *orow, *srow;
+
+  nx = grid->naxis[0];
+  sx = 2*hx+1;
+
+  /* Loop over components */
+  for (k=0; k<npts; k++) {
+    py = (olong)list[k*3+1];
+    if (py+hy<loRow) continue;   /* Not yet */
+    if (py-hy>hiRow) break;      /* List ordered by row - done */
+    px   = (olong)list[k*3];
+    flux = list[k*3+2];
+    iylo = MAX (loRow, py-hy);
+    iyhi = MIN (hiRow, py+hy);
+    ixlo = MAX (0, px-hx);
+    ixhi = MIN (nx-1, px+hx);
+    off  = hx - px;
+    /* Add rows of stamp */
+    for (iy=iylo; iy<=iyhi; iy++) {
+      orow = grid->array + iy*nx;
+      srow = stamp + (iy-py+hy)*sx;
+      for (ix=ixlo; ix<=ixhi; ix++) orow[ix] += flux * srow[ix+off];
+    }
+  } /* end loop over components */
+
+  /* Indicate completion */
+  if (largs->ithread>=0)
+    ObitThreadPoolDone (largs->thread, (gpointer)&largs->ithread);
+  
+  return NULL;
+} /* end ThreadRestoreDirect */
+
 /**
  * Get image statistics for portion of an image in a thread
  * Allows blanked images
@@ -2497,6 +2830,55 @@ static void KillStatsFuncArgs (olong nargs, StatsFuncArg **ThreadArgs)
   g_free(ThreadArgs); ThreadArgs=NULL;
 } /*  end KillStatsFuncArgs */
 
+/**
+ * Are the statistics saved for a field still valid?
+ * They are if the image file has not been opened for write through any
+ * ObitImage (see ObitImageGetWriteGen) and, for images, the field's
+ * window has not been modified since the statistics were determined.
+ * Files never written by this process, which another process may
+ * change, are not reused.
+ * \param in      The CLEAN object
+ * \param ifield  Field number (0-rel)
+ * \param doBeam  If TRUE beam statistics else image
+ * \param image   Image or beam for field ifield
+ * \return TRUE if saved statistics can be used
+ */
+static gboolean StatsCurrent (ObitDConClean *in, olong ifield, gboolean doBeam,
+			      ObitImage *image)
+{
+  olong writeGen, winMod = -1;
+
+  /* Only images written in this process are tracked */
+  writeGen = ObitImageGetWriteGen (image);
+  if (writeGen<0) return FALSE;
+  if (doBeam) return in->beamStatGen[ifield]==writeGen;
+
+  if (in->window) winMod = in->window->modCount[ifield];
+  return (in->statGen[ifield]==writeGen) && (in->statWinMod[ifield]==winMod);
+} /* end StatsCurrent */
+
+/**
+ * Save state of a field whose statistics were just determined
+ * \param in      The CLEAN object
+ * \param ifield  Field number (0-rel)
+ * \param doBeam  If TRUE beam statistics else image
+ * \param image   Image or beam for field ifield
+ */
+static void StatsSave (ObitDConClean *in, olong ifield, gboolean doBeam,
+		       ObitImage *image)
+{
+  olong writeGen;
+
+  writeGen = ObitImageGetWriteGen (image);
+  if (doBeam) {
+    in->beamStatGen[ifield] = writeGen;
+  } else {
+    in->statGen[ifield] = writeGen;
+    if (in->window) in->statWinMod[ifield] = in->window->modCount[ifield];
+    else            in->statWinMod[ifield] = -1;
+  }
+} /* end StatsSave */
+
 gboolean hmsra(olong h, olong m, ofloat s, odouble *ra)
 /* convert RA in hours min and seconds to degrees*/
 /* returns TRUE if in 0-24 hours else FALSE */
@@ -1670,8 +1670,9 @@ void ObitDConCleanPxListClear (gpointer inn)
   if (in->minFlux)   in->minFlux  =  ObitMemFree (in->minFlux);
   if (in->factor)    in->factor   =  ObitMemFree (in->factor);
   if (in->pixelSpectra) {
-    for (i=0; i<in->nSpecTerm; i++) g_free(in->pixelSpectra[i]);
-    g_free(in->pixelSpectra);
+    for (i=0; i<in->nSpecTerm; i++)
+      if (in->pixelSpectra[i]) in->pixelSpectra[i] = ObitMemFree (in->pixelSpectra[i]);
+    in->pixelSpectra = ObitMemFree (in->pixelSpectra);
   }
 
   /* unlink parent class members */
@@ -47,6 +47,10 @@ static ObitGetClassFP ObitParentGetClass = ObitGetClass;
  */
 static ObitDConCleanWindowClassInfo myClassInfo = {FALSE};
 
+/*--------------- File Global Variables  ----------------*/
+/** Serial number for window modifications, unique across objects */
+static olong modSerial = 0;
+
 
 /*---------------Private function prototypes----------------*/
 /** Private: Initialize newly instantiated object. */
@@ -172,6 +176,8 @@ ObitDConCleanWindow* ObitDConCleanWindowCopy  (ObitDConCleanWindow *in,
     out->naxis = ObitMemFree (out->naxis);
   if ((out->maxId) && (ObitMemValid (out->maxId)))
     out->maxId = ObitMemFree (out->maxId);
+  if ((out->modCount) && (ObitMemValid (out->modCount)))
+    out->modCount = ObitMemFree (out->modCount);
 
    /*  copy this class */
   out->nfield = in->nfield;
@@ -180,6 +186,7 @@ ObitDConCleanWindow* ObitDConCleanWindowCopy  (ObitDConCleanWindow *in,
   /* define arrays */
   out->naxis = ObitMemAlloc0Name (out->nfield*sizeof(olong*), "Clean Window Naxis");
   out->maxId = ObitMemAlloc0Name (out->nfield*sizeof(olong),  "Clean Window maxId");
+  out->modCount = ObitMemAlloc0Name (out->nfield*sizeof(olong),  "Clean Window modCount");
   out->Lists = ObitMemAlloc0Name (out->nfield*sizeof(GSList*), "Clean Window Lists");
   out->outWindow = ObitMemAlloc0Name (out->nfield*sizeof(gpointer), "Clean outer Window");
 
@@ -209,6 +216,7 @@ ObitDConCleanWindow* ObitDConCleanWindowCopy  (ObitDConCleanWindow *in,
       glist = glist->next;
     }
     out->maxId[i]    = maxId;
+    out->modCount[i] = ++modSerial;
  }
 
   return out;
@@ -262,6 +270,8 @@ void ObitDConCleanWindowClone (ObitDConCleanWindow *in,
     out->naxis = ObitMemFree (out->naxis);
   if ((out->maxId) && (ObitMemValid (out->maxId)))
     out->maxId = ObitMemFree (out->maxId);
+  if ((out->modCount) && (ObitMemValid (out->modCount)))
+    out->modCount = ObitMemFree (out->modCount);
 
    /*  copy this class */
   out->nfield = in->nfield;
@@ -270,6 +280,7 @@ void ObitDConCleanWindowClone (ObitDConCleanWindow *in,
  /* define arrays */
   out->naxis = ObitMemAlloc0Name (out->nfield*sizeof(olong*), "Clean Window Naxis");
   out->maxId = ObitMemAlloc0Name (out->nfield*sizeof(olong),  "Clean Window maxId");
+  out->modCount = ObitMemAlloc0Name (out->nfield*sizeof(olong),  "Clean Window modCount");
   out->Lists = ObitMemAlloc0Name (out->nfield*sizeof(GSList*), "Clean Window Lists");
   out->outWindow = ObitMemAlloc0Name (out->nfield*sizeof(gpointer), "Clean outer Window");
 
@@ -278,6 +289,7 @@ void ObitDConCleanWindowClone (ObitDConCleanWindow *in,
     out->naxis[i][0] = in->naxis[i][0];
     out->naxis[i][1] = in->naxis[i][1];
     out->maxId[i]    = in->maxId[i];
+    out->modCount[i] = ++modSerial;
     out->Lists[i]    = in->Lists[i];
     out->outWindow[i]= in->outWindow[i];
  }
@@ -317,6 +329,7 @@ ObitDConCleanWindow* ObitDConCleanWindowCreate (gchar* name,
   /* define arrays */
   out->naxis = ObitMemAlloc0Name (out->nfield*sizeof(olong*), "Clean Window Naxis");
   out->maxId = ObitMemAlloc0Name (out->nfield*sizeof(olong),  "Clean Window maxId");
+  out->modCount = ObitMemAlloc0Name (out->nfield*sizeof(olong),  "Clean Window modCount");
   out->Lists = ObitMemAlloc0Name (out->nfield*sizeof(GSList*), "Clean Window Lists");
   out->outWindow = ObitMemAlloc0Name (out->nfield*sizeof(gpointer), "Clean outer Window");
 
@@ -327,6 +340,7 @@ ObitDConCleanWindow* ObitDConCleanWindowCreate (gchar* name,
     out->Lists[i]     = NULL;
     out->outWindow[i] = NULL;
     out->maxId[i]     = 0;
+    out->modCount[i]  = ++modSerial;
   } /* end loop over fields */
 
   return out;
@@ -357,6 +371,7 @@ ObitDConCleanWindow*
   /* define arrays */
   out->naxis = ObitMemAlloc0Name (out->nfield*sizeof(olong*), "Clean Window Naxis");
   out->maxId = ObitMemAlloc0Name (out->nfield*sizeof(olong),  "Clean Window maxId");
+  out->modCount = ObitMemAlloc0Name (out->nfield*sizeof(olong),  "Clean Window modCount");
   out->Lists = ObitMemAlloc0Name (out->nfield*sizeof(GSList*), "Clean Window Lists");
   out->outWindow = ObitMemAlloc0Name (out->nfield*sizeof(gpointer), "Clean outer Window");
 
@@ -367,6 +382,7 @@ ObitDConCleanWindow*
   out->Lists[0]     = NULL;
   out->outWindow[0] = NULL;
   out->maxId[0]     = 0;
+  out->modCount[0]  = ++modSerial;
 
   return out;
 } /* end ObitDConCleanWindowCreate1 */
@@ -616,6 +632,7 @@ olong ObitDConCleanWindowAdd (ObitDConCleanWindow *in,
   elem =  newWindowListElem (in->maxId[field-1], type, window);
   out = elem->Id;  /* Id number to return */
   in->Lists[field-1] = g_slist_append (in->Lists[field-1], elem);
+  in->modCount[field-1] = ++modSerial;
 
   return out;
 } /* end  ObitDConCleanWindowAdd */
@@ -651,6 +668,7 @@ void ObitDConCleanWindowDel (ObitDConCleanWindow *in,
 
   /* Make sure window list defined - if not just return */
   if (in->Lists[field-1]==NULL) return;
+  in->modCount[field-1] = ++modSerial;
 
   /* Delete them all? */
   if (Id<0) {
@@ -697,6 +715,8 @@ void ObitDConCleanWindowUpdate (ObitDConCleanWindow *in,
                    routine, field, in->nfield, in->name);
       return;
   }
+  in->modCount[field-1] = ++modSerial;
+
   /* Is this the outer window? */
   if (Id==-1) { /* Yes outer window */
     elem = (WindowListElem*)in->outWindow[field-1];
@@ -851,6 +871,7 @@ void ObitDConCleanWindowOuter (ObitDConCleanWindow *in, olong field,
   /* Add it to object */
   freeWindowListElem ((WindowListElem*)in->outWindow[field-1]);
   in->outWindow[field-1] = (gpointer)newWindowListElem (1, type, window);
+  in->modCount[field-1] = ++modSerial;
 
 } /* end ObitDConCleanWindowOuter */
 
@@ -1745,6 +1766,7 @@ ObitDConCleanWindowReplaceField (ObitDConCleanWindow *in,  olong ifield,
     glist = glist->next;
   }
   out->maxId[ofield-1] = maxId;
+  out->modCount[ofield-1] = ++modSerial;
 
   return;
 } /* end ObitDConCleanWindowReplaceField */
@@ -1796,6 +1818,13 @@ ObitDConCleanWindowAddField (ObitDConCleanWindow *in,
   ltemp[newField-1] = 0;
   in->maxId = ObitMemFree(in->maxId);
   in->maxId = ltemp;
+
+  /* modCount */
+  ltemp = ObitMemAlloc0Name (newField*sizeof(olong),  "Clean Window modCount");
+  for (i=0; i<oldField; i++) ltemp[i] = in->modCount[i]; 
+  ltemp[newField-1] = ++modSerial;
+  in->modCount = ObitMemFree(in->modCount);
+  in->modCount = ltemp;
  
   /* Window Lists */
   tlist = ObitMemAlloc0Name (newField*sizeof(GSList*), "Clean Window Lists");
@@ -2025,6 +2054,7 @@ void ObitDConCleanWindowInit  (gpointer inn)
   /* define arrays */
   in->naxis     = NULL;
   in->maxId     = NULL;
+  in->modCount  = NULL;
   in->Lists     = NULL;
   in->outWindow = NULL;
   in->autoWindow= FALSE;
@@ -2068,6 +2098,8 @@ void ObitDConCleanWindowClear (gpointer inn)
     in->naxis = ObitMemFree (in->naxis);
   if ((in->maxId) && (ObitMemValid (in->maxId)))
     in->maxId = ObitMemFree (in->maxId);
+  if ((in->modCount) && (ObitMemValid (in->modCount)))
+    in->modCount = ObitMemFree (in->modCount);
       
   /* unlink parent class members */
   ParentClass = (ObitClassInfo*)(myClassInfo.ParentClass);
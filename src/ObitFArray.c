@@ -67,6 +67,7 @@ typedef ALIGN32_BEG union {
 #include "ObitFArray.h"
 #include "ObitMem.h"
 #include "ObitExp.h"
+#include <string.h>
 
 /*----------------Obit: Merx mollis mortibus nuper ------------------*/
 /**
@@ -97,6 +98,14 @@ static gsl_rng *GSLran_gen = NULL;
 #endif /* HAVE_GSL */
 
 /*--------------- File Global Variables  ----------------*/
+/** Number of elements per block in fused expressions */
+#define FAEXPRBLOCK 2048
+/** Number of cells in the fine histogram of ObitFArrayStats */
+#define FASTATNFINE 65536
+/** Half width of the fine histogram of ObitFArrayStats in raw RMS */
+#define FASTATRANGE 4.0
+/** Maximum number of cells in the outer histogram of ObitFArrayStats */
+#define FASTATNOUTER 1048576
 
 
 /*---------------Private structures----------------*/
@@ -124,6 +133,26 @@ typedef struct {
     olong        ithread;
 } FAFuncArg;
 
+/* Per thread accumulator for ObitFArrayStats */
+typedef struct {
+    /* Count of valid, blanked pixels */
+    ollong count, nBlank;
+    /* Sum of values, squares */
+    odouble sum, sum2;
+    /* Extrema */
+    ofloat min, max;
+    /* Fine histogram, number of cells, low edge, cells per unit */
+    olong nFine;
+    ofloat fineMin, fineFact;
+    olong *fine;
+    /* Values below, above the fine histogram */
+    ollong fineUnder, fineOver;
+    /* Outer histogram, number of cells, center of first cell, cells per unit */
+    olong nOuter;
+    ofloat outerMin, outerFact;
+    olong *outer;
+} FAStatAcc;
+
 /*---------------Private function prototypes----------------*/
 /** Private: Initialize newly instantiated object. */
 void  ObitFArrayInit(gpointer in);
@@ -149,6 +178,23 @@ static gpointer ThreadFARMSSum(gpointer arg);
 /** Private: Threaded Accumulate histogram elements */
 static gpointer ThreadFAHisto(gpointer arg);
 
+/** Private: Threaded moments for ObitFArrayStats */
+static gpointer ThreadFAStatSum(gpointer arg);
+
+/** Private: Threaded histograms for ObitFArrayStats */
+static gpointer ThreadFAStatHisto(gpointer arg);
+
+/** Private: Coarse histogram from fine histogram */
+static gboolean FAStatRebin(FAStatAcc *acc, ofloat amin, ofloat amax,
+                            olong numCell, ofloat *histo);
+
+/** Private: Coarse histogram from the data */
+static gboolean FAStatHistoPass(ObitFArray *in, ofloat amin, ofloat amax,
+                                olong numCell, ofloat *histo);
+
+/** Private: Quantile from histograms */
+static ofloat FAStatQuantile(FAStatAcc *acc, ofloat frac);
+
 /** Private: Threaded Convolve Gaussian */
 static gpointer ThreadFAConvGaus(gpointer arg);
 
@@ -182,6 +228,13 @@ static gpointer ThreadFAExtArr(gpointer arg);
 /** Private: Threaded ShiftAdd */
 static gpointer ThreadFAShAdd(gpointer arg);
 
+/** Private: Threaded fused expression */
+static gpointer ThreadFAExpr(gpointer arg);
+
+/** Private: Fused expression operation on a block */
+static void FAExprBlock(ObitFArrayExprOp op, olong n, ofloat *acc,
+                        const ofloat *x, const ofloat *s);
+
 /** Private: Make Threaded args */
 static olong MakeFAFuncArgs(ObitThread *thread, ObitFArray *in,
                             ObitFArray *in2, ObitFArray *out,
@@ -396,9 +449,21 @@ ObitFArray *ObitFArrayCreate(const gchar *name, olong ndim, const olong *naxis)
     }
 
     /* create array - add a bit extra, FFT seems to need it */
-    out->array = ObitMemAlloc0Name(size * sizeof(ofloat) +
-                                   out->naxis[0] * sizeof(ofloat),
-                                   "FArray array");
+    /* Large arrays are processed threaded in contiguous pieces - if threads
+       are pinned, zero them from the same threads to place the pages */
+    if ((size >= 1000000) && (ObitThreadGetAffinity(out->thread) > 0)) {
+        out->array = ObitMemAllocName(size * sizeof(ofloat) +
+                                      out->naxis[0] * sizeof(ofloat),
+                                      "FArray array");
+        ObitThreadFirstTouch(out->thread, ObitThreadNumProc(out->thread),
+                             out->array, size * sizeof(ofloat) +
+                             out->naxis[0] * sizeof(ofloat));
+    } else {
+        out->array = ObitMemAlloc0Name(size * sizeof(ofloat) +
+                                       out->naxis[0] * sizeof(ofloat),
+                                       "FArray array");
+    }
+
     out->arraySize = size;
 
     return out;
@@ -1099,33 +1164,75 @@ void ObitFArrayDeblank(ObitFArray *in, ofloat scalar)
 /**
  *  Determine RMS noise in array.
  *  Value is based on a histogram analysis and is determined from
- *  the width of the peak around the mode.
+ *  the width of the peak around the mode (see ObitFArrayStats).
  *  out =  RMS (in.)
  * \param in Input object with data
  * \return rms of element distribution (-1 on error)
  */
 ofloat ObitFArrayRMS(ObitFArray *in)
+{
+    ObitFArrayStat stat;
+
+    ObitFArrayStats(in, &stat);
+    return stat.RMS;
+} /* end  ObitFArrayRMS */
+
+/**
+ *  Determine robust statistics of the pixel distribution.
+ *  The array is read twice: a threaded pass gives the count, blank count,
+ *  extrema, mean and RMS about the mean, then a second threaded pass
+ *  accumulates per-thread histograms which are merged:
+ *  \li a fine histogram (FASTATNFINE cells) over mean +/- FASTATRANGE RMS
+ *  \li an outer histogram over the full range with one cell per 30 pixels
+ *      (at least 100, at most FASTATNOUTER).
+ *
+ *  The robust RMS follows the algorithm of ObitFArrayRMS, the histogram
+ *  around the peak being refined until the peak is adequately resolved,
+ *  but the refined histograms are formed from the fine histogram rather
+ *  than by further passes through the data.  Only if the refinement needs
+ *  more resolution or range than the fine histogram has is the array
+ *  read again.  The mode is the peak of the outer histogram
+ *  (as ObitFArrayMode), the quantiles are interpolated in the fine histogram
+ *  where possible, else in the outer histogram.
+ *  If fewer than 5 valid values, RMS is blanked and the mode zero.
+ * \param in    Input object with data
+ * \param stat  [out] statistics
+ */
+void ObitFArrayStats(ObitFArray *in, ObitFArrayStat *stat)
 {
     olong i, j, modeCell = 0, imHalf = 0, ipHalf = 0, numCell;
     olong i1, i2, ic, infcount;
     ofloat amax, amin, tmax, sum, sum2, x, count, mean, arg, cellFact = 1.0;
-    ofloat s, s2, half, *histo = NULL, *thist = NULL;
-    ofloat rawRMS, rawMean, fiddle, out = -1.0, fblank = ObitMagicF();
-    gboolean done = FALSE;
+    ofloat half, *histo = NULL, rawRMS, rawMean, fiddle, out;
+    ofloat fblank = ObitMagicF();
+    ofloat quantFrac[FASTATNQUANT] = {0.01, 0.05, 0.25, 0.5, 0.75, 0.95, 0.99};
+    gboolean done = FALSE, OK;
     olong nTh, nElem, loElem, hiElem, nElemPerThread, nThreads;
-    ollong icount, c;
-    gboolean OK;
+    odouble dsum, dsum2;
     FAFuncArg **threadArgs;
+    FAStatAcc *acc = NULL, *tot;
 
     /* error checks */
     g_assert(ObitFArrayIsA(in));
     g_assert(in->array != NULL);
+    g_assert(stat != NULL);
 
-    /* Initialize Threading for initial values */
-    nThreads =
-        MakeFAFuncArgs(in->thread, in, NULL, NULL,
-                       sizeof(ollong), sizeof(ofloat), sizeof(ofloat), 0, 0, 0, 0,
-                       &threadArgs);
+    /* Defaults */
+    stat->count  = 0;
+    stat->nBlank = 0;
+    stat->min    = fblank;
+    stat->max    = fblank;
+    stat->mean   = fblank;
+    stat->rawRMS = fblank;
+    stat->RMS    = fblank;
+    stat->mode   = 0.0;
+
+    for (i = 0; i < FASTATNQUANT; i++) stat->quantile[i] = fblank;
+
+    /* Initialize Threading */
+    nThreads = MakeFAFuncArgs(in->thread, in, NULL, NULL,
+                              0, 0, 0, 0, 0, 0, 0, &threadArgs);
+    acc = g_malloc0(nThreads * sizeof(FAStatAcc));
 
     /* Divide up work */
     nElem = in->arraySize;
@@ -1144,6 +1251,7 @@ ofloat ObitFArrayRMS(ObitFArray *in)
 
         threadArgs[i]->first   = loElem;
         threadArgs[i]->last    = hiElem;
+        threadArgs[i]->arg1    = (gpointer)&acc[i];
 
         if (nTh > 1) threadArgs[i]->ithread = i;
         else threadArgs[i]->ithread = -1;
@@ -1154,88 +1262,110 @@ ofloat ObitFArrayRMS(ObitFArray *in)
         hiElem = MIN(hiElem, nElem);
     }
 
-    /* Do operation */
+    /* First pass - moments, extrema */
     OK = ObitThreadIterator(in->thread, nTh,
-                            (ObitThreadFunc)ThreadFARMSSum,
+                            (ObitThreadFunc)ThreadFAStatSum,
                             (gpointer **)threadArgs);
 
-    /* Check for problems */
-    if (!OK) return fblank;
+    if (!OK) goto cleanup;
 
-    /* sum parts */
-    icount = 0;
-    sum = sum2 = 0.0;
+    /* Combine */
+    tot = &acc[0];
 
-    for (i = 0; i < nTh; i++) {
-        if (threadArgs[i]->value != fblank) {
-            c  = *(ollong *)(threadArgs[i]->arg1);
-            s  = *(ofloat *)(threadArgs[i]->arg2);
-            s2 = *(ofloat *)(threadArgs[i]->arg3);
-            icount += c;
-            sum    += s;
-            sum2   += s2;
-            /*fprintf (stderr,"%d %d %g %g %d %g %g \n",i,c,s,s2,count,sum,sum2); DEBUG*/
+    for (i = 1; i < nTh; i++) {
+        if (acc[i].count > 0) {
+            if (tot->count > 0) {
+                tot->min = MIN(tot->min, acc[i].min);
+                tot->max = MAX(tot->max, acc[i].max);
+            } else {
+                tot->min = acc[i].min;
+                tot->max = acc[i].max;
+            }
         }
-    }
 
-    /* cleanup */
-    KillFAFuncArgs(nThreads, threadArgs);
+        tot->count  += acc[i].count;
+        tot->nBlank += acc[i].nBlank;
+        tot->sum    += acc[i].sum;
+        tot->sum2   += acc[i].sum2;
+    }
 
-    /* Initial values */
-    count = (ofloat)icount;
+    stat->count  = tot->count;
+    stat->nBlank = tot->nBlank;
 
     /* Better have something */
-    if (count < 5) return fblank;
-
-    rawRMS = (sum2 / icount) - ((sum / icount) * (sum / icount));
+    if (tot->count < 5) goto cleanup;
 
-    if (rawRMS > 0.0) rawRMS = sqrt(rawRMS);
+    dsum  = tot->sum / tot->count;
+    dsum2 = (tot->sum2 / tot->count) - dsum * dsum;
+    rawMean = (ofloat)dsum;
+    rawRMS  = (dsum2 > 0.0) ? (ofloat)sqrt(dsum2) : 0.0;
+    stat->min    = tot->min;
+    stat->max    = tot->max;
+    stat->mean   = rawMean;
+    stat->rawRMS = rawRMS;
 
-    rawMean = sum / icount;
-    /*fprintf(stderr,"Initial count %g rawRMS %g rawMean %g\n",count, rawRMS, rawMean);*/
-    amin = rawMean - rawRMS;
-    amax = rawMean + rawRMS;
+    /* Constant image? */
+    if ((rawRMS <= 0.0) || (tot->max <= tot->min)) {
+        stat->RMS  = 0.0;
+        stat->mode = rawMean;
 
-    /* Make histogram size such that the average cell has at least 30 entries */
-    numCell = icount / 30;
-    numCell = MAX(100,  numCell);   /* but not too few */
-    numCell = MIN(1000, numCell);   /* or too many */
+        for (i = 0; i < FASTATNQUANT; i++) stat->quantile[i] = rawMean;
 
-    /* Initialize Threading for histogram */
-    nThreads =
-        MakeFAFuncArgs(in->thread, in, NULL, NULL,
-                       sizeof(ollong),  sizeof(ollong), numCell * sizeof(ofloat), sizeof(ofloat), sizeof(ofloat),
-                       sizeof(ollong), sizeof(ollong),
-                       &threadArgs);
+        goto cleanup;
+    }
 
-    /* Divide up work */
-    nElem = in->arraySize;
-    nElemPerThread = nElem / nThreads;
-    nTh = nThreads;
+    /* Second pass - histograms */
+    numCell = (olong)(tot->count / 30);
+    numCell = MAX(100, numCell);   /* but not too few */
+    numCell = MIN(FASTATNOUTER, numCell);  /* or too many */
 
-    if (nElem < 1000000) {nElemPerThread = nElem; nTh = 1;}
+    for (i = 0; i < nTh; i++) {
+        acc[i].nFine     = FASTATNFINE;
+        acc[i].fineMin   = rawMean - FASTATRANGE * rawRMS;
+        acc[i].fineFact  = FASTATNFINE / (2.0 * FASTATRANGE * rawRMS);
+        acc[i].fine      = g_malloc0(FASTATNFINE * sizeof(olong));
+        acc[i].nOuter    = numCell;
+        acc[i].outerMin  = tot->min;
+        acc[i].outerFact = numCell / (tot->max - tot->min + 1.0e-20);
+        acc[i].outer     = g_malloc0(numCell * sizeof(olong));
+    }
 
-    loElem = 1;
-    hiElem = nElemPerThread;
-    hiElem = MIN(hiElem, nElem);
+    OK = ObitThreadIterator(in->thread, nTh,
+                            (ObitThreadFunc)ThreadFAStatHisto,
+                            (gpointer **)threadArgs);
 
-    /* Set up thread arguments */
-    for (i = 0; i < nTh; i++) {
-        if (i == (nTh - 1)) hiElem = nElem; /* Make sure do all */
+    if (!OK) goto cleanup;
 
-        threadArgs[i]->first   = loElem;
-        threadArgs[i]->last    = hiElem;
-        memmove(threadArgs[i]->arg1, &numCell, sizeof(olong));
+    /* Merge histograms */
+    for (i = 1; i < nTh; i++) {
+        for (j = 0; j < FASTATNFINE; j++) tot->fine[j] += acc[i].fine[j];
 
-        if (nTh > 1) threadArgs[i]->ithread = i;
-        else threadArgs[i]->ithread = -1;
+        for (j = 0; j < numCell; j++) tot->outer[j] += acc[i].outer[j];
 
-        /* Update which Elem */
-        loElem += nElemPerThread;
-        hiElem += nElemPerThread;
-        hiElem = MIN(hiElem, nElem);
+        tot->fineUnder += acc[i].fineUnder;
+        tot->fineOver  += acc[i].fineOver;
     }
 
+    /* Mode from outer histogram, as ObitFArrayMode */
+    modeCell = 0;
+
+    for (i = 1; i < numCell; i++) if (tot->outer[i] > tot->outer[modeCell]) modeCell = i;
+
+    stat->mode = tot->min + modeCell / tot->outerFact;
+
+    /* Quantiles */
+    for (i = 0; i < FASTATNQUANT; i++)
+        stat->quantile[i] = FAStatQuantile(tot, quantFrac[i]);
+
+    /* Robust RMS - Make histogram size such that the average cell has
+       at least 30 entries */
+    numCell = tot->count / 30;
+    numCell = MAX(100,  numCell);   /* but not too few */
+    numCell = MIN(1000, numCell);   /* or too many */
+    histo = g_malloc0(numCell * sizeof(ofloat));
+    amin = rawMean - rawRMS;
+    amax = rawMean + rawRMS;
+
     /* Loop until a reasonable number of values in peak of histogram */
     infcount = 0;  /* Loop to check for endless loop */
     fiddle  = 1.0;  /* Factor to fiddle the half width */
@@ -1247,39 +1377,15 @@ ofloat ObitFArrayRMS(ObitFArray *in)
         fiddle *= 0.95;
 
         if (infcount > 20) {
-            KillFAFuncArgs(nThreads, threadArgs);
-            return rawRMS;
+            stat->RMS = rawRMS;
+            goto cleanup;
         }  /* bag it */
 
-        /* Set up thread arguments */
-        for (i = 0; i < nTh; i++) {
-            memmove(threadArgs[i]->arg4, &amax, sizeof(ofloat));
-            memmove(threadArgs[i]->arg5, &amin, sizeof(ofloat));
-        }
-
-        /* Do Form Histogram */
-        OK = ObitThreadIterator(in->thread, nTh,
-                                (ObitThreadFunc)ThreadFAHisto,
-                                (gpointer **)threadArgs);
-
-        /* Check for problems */
-        if (!OK) return fblank;
-
-        /* Accumulate counts - histogram */
-        icount = *(ollong *)(threadArgs[0])->arg2;
-        histo = (ofloat *)(threadArgs[0]->arg3);
-
-        for (i = 1; i < nTh; i++) {
-            \
-            c     = *(ollong *)(threadArgs[i])->arg2;
-            /*fprintf (stderr,"%d ncell %ld c %ld under %ld over %ld amax %g amin %g  \n",i, ncell, c, under, over, ttmax, ttmin);*/
-            count += c;
-            thist = (ofloat *)(threadArgs[i]->arg3);
-
-            for (j = 0; j < numCell; j++) histo[j] += thist[j];
+        /* Form histogram from fine one if possible, else from data */
+        if (!FAStatRebin(tot, amin, amax, numCell, histo)) {
+            if (!FAStatHistoPass(in, amin, amax, numCell, histo)) goto cleanup;
         }
 
-        /*fprintf (stderr,"DEBUG total count %ld  \n",icount);*/
         /* Find mode cell */
         cellFact =  numCell / (amax - amin + 1.0e-20);
         modeCell = -1;
@@ -1292,18 +1398,6 @@ ofloat ObitFArrayRMS(ObitFArray *in)
             }
         }
 
-        /*fprintf (stderr,"DEBUG modeCell %d  cellFact %g\n",modeCell, cellFact);*/
-        /*ttmax = histo[modeCell];
-          fprintf (stderr,"%5.3f, %5.3f, %5.3f, %5.3f, %5.3f, %5.3f, %5.3f, %5.3f, %5.3f, %5.3f, %5.3f \n",
-          histo[modeCell-5*2]/ttmax,histo[modeCell-4*2]/ttmax,histo[modeCell-3*2]/ttmax,histo[modeCell-2*2]/ttmax,histo[modeCell-1*2]/ttmax,
-          histo[modeCell]/ttmax,
-          histo[modeCell+1*2]/ttmax,histo[modeCell+2*2]/ttmax,histo[modeCell+3*2]/ttmax,histo[modeCell+4*2]/ttmax,histo[modeCell+5*2]/ttmax);
-
-          fprintf (stderr,"%8.4g, %8.4g, %8.4g, %8.4g, %8.4g, %8.4g, %8.4g, %8.4g, %8.4g, %8.4g, %8.4g \n",
-          histo[modeCell-5*2],histo[modeCell-4*2],histo[modeCell-3*2],histo[modeCell-2*2],histo[modeCell-1*2],
-          histo[modeCell],
-          histo[modeCell+1*2],histo[modeCell+2*2],histo[modeCell+3*2],histo[modeCell+4*2],histo[modeCell+5*2]);*/
-
         /* find half width of peak by finding number of cells positive
            and negative from the mode the distribution stays above tmax/2.
            If the data are quantized then some (many) cells may have zero
@@ -1313,19 +1407,14 @@ ofloat ObitFArrayRMS(ObitFArray *in)
 
         for (i = modeCell; i >= 1; i--) {
             if (histo[i] > 0.5 * tmax)  imHalf = i;
-
-            /*else if (histo[i]>0.2*tmax) break;*/
         }
 
         ipHalf = modeCell;
 
         for (i = modeCell; i < numCell - 1; i++) {
             if (histo[i] > 0.5 * tmax) ipHalf = i;
-
-            /*else if (histo[i]>0.2*tmax) break;*/
         }
 
-        /*fprintf (stderr,"imHalf %d ipHalf %d diff %d\n",imHalf, ipHalf, ipHalf-imHalf); DEBUG*/
         /* acceptability tests */
         /* ipHalf - imHalf must be greater than 25 and less than 50 */
         if ((ipHalf - imHalf) < 25) {
@@ -1333,7 +1422,6 @@ ofloat ObitFArrayRMS(ObitFArray *in)
             if ((ipHalf - imHalf) <= 0) { /* wild stab */
                 half = fiddle * 0.5 / cellFact; /* ~ halfwidth? 1/2 cell */
             } else { /* partly resolved */
-                /*half = (fiddle*0.5 * (ipHalf-imHalf)) / cellFact;*/ /* ~ halfwidth */
                 half = (fiddle * (ipHalf - imHalf)) / cellFact; /* ~ halfwidth */
             }
 
@@ -1342,7 +1430,6 @@ ofloat ObitFArrayRMS(ObitFArray *in)
             half *= numCell / 50.0;
             /* Don't go below rawRMS */
             half = MAX(half, fiddle * rawRMS);
-            /*fprintf (stderr,"DEBUG half %g fiddle %g rawRMS %g\n",half,fiddle,rawRMS);*/
             amax = mean + half;
             amin = mean - half;
             continue;  /* try it again */
@@ -1362,10 +1449,6 @@ ofloat ObitFArrayRMS(ObitFArray *in)
         break;
     } /* end loop getting acceptable histogram */
 
-    /* determine RMS */
-    out = (ipHalf - imHalf) / cellFact; /* FWHM */
-    out *= 2.35 / 2.0; /* to Sigma */
-
     /* get second moment around mode +/- 3 FWHM */
     i1 = modeCell - 3 * (modeCell - imHalf);
     i1 = MAX(0, i1);
@@ -1400,11 +1483,25 @@ ofloat ObitFArrayRMS(ObitFArray *in)
         out = fblank;
     }
 
+    stat->RMS = MIN(out, rawRMS);
+
     /* cleanup */
+cleanup:
+
+    for (i = 0; i < nThreads; i++) threadArgs[i]->arg1 = NULL;
+
     KillFAFuncArgs(nThreads, threadArgs);
 
-    return MIN(out, rawRMS);
-} /* end  ObitFArrayRMS */
+    for (i = 0; i < nThreads; i++) {
+        if (acc[i].fine)  g_free(acc[i].fine);
+
+        if (acc[i].outer) g_free(acc[i].outer);
+    }
+
+    g_free(acc);
+
+    if (histo) g_free(histo);
+} /* end  ObitFArrayStats */
 
 /**
  *  Determine RMS noise in array from average squared - average value
@@ -1599,6 +1696,7 @@ ofloat ObitFArrayRMSQuant(ObitFArray *in)
     olong i1, i2, ic, it;
     ofloat amin, tmax, sum, sum2, x, count, mean, arg, cellFact = 1.0;
     ofloat *histo = NULL;
+    ObitFArrayStat stat;
 #if HAVE_AVX512==1
     CV16SF v, vb, vflag, vmin, vfac;
     IV16SF vcell;
@@ -1619,15 +1717,16 @@ ofloat ObitFArrayRMSQuant(ObitFArray *in)
     /* Get quantization info */
     ObitFArrayQuant(in, &quant, &zero);
 
-    /* Get Raw (unquantized ) RMS */
-    rawRMS = ObitFArrayRMS(in);
+    /* Get Raw (unquantized ) RMS and mode */
+    ObitFArrayStats(in, &stat);
+    rawRMS = stat.RMS;
 
     /* If more than 100 levels in Raw RMS assume close enough to continious
        distribution */
     if ((rawRMS / MAX(1.0e-20, quant)) > 100.0) return rawRMS;
 
-    /* Find Mode */
-    mode = ObitFArrayMode(in);
+    /* Mode */
+    mode = stat.mode;
 
     /* Center the distribution of the quantization level closest to the mode */
     it = (mode - zero) / MAX(1.0e-20, quant);
@@ -1948,142 +2047,17 @@ void ObitFArrayQuant(ObitFArray *in, ofloat *quant, ofloat *zero)
 /**
  *  Determine Mode of pixel value distribution in array.
  *  Value is based on a histogram analysis and is determined from
- *  the peak in the distribution..
+ *  the peak in the distribution (see ObitFArrayStats).
  *  out =  Mode (in.)
  * \param in Input object with data
  * \return mode of distribution
  */
 ofloat ObitFArrayMode(ObitFArray *in)
 {
-    olong i, ilast, icell, modeCell, numCell, count, pos[MAXFARRAYDIM];
-    ofloat amax, amin, tmax, cellFact, *histo;
-    ofloat out = 0.0, fblank = ObitMagicF();
-#if HAVE_AVX512==1
-    CV16SF v, vb, vflag, vmin, vfac;
-    IV16SF vcell;
-    MASK16 msk;
-    ofloat tmp;
-    olong j;
-#elif HAVE_AVX==1
-    CV8SF v, vb, vm, vflag, vmin, vfac;
-    IV8SF vcell;
-    ofloat tmp;
-    olong j;
-#endif
-
-    /* error checks */
-    g_assert(ObitFArrayIsA(in));
-    g_assert(in->array != NULL);
-
-    /* get max/min */
-    amax = ObitFArrayMax(in, pos);
-    amin = ObitFArrayMin(in, pos);
-
-    /* How many valid values? */
-    count = 0;
-
-    for (i = 0; i < in->arraySize; i++) if (in->array[i] != fblank) count++;
-
-    if (count < 5) return out; /* better have some */
-
-    /* Make histogram size such that the average cell has 30 entries */
-    numCell = count / 30;
-    numCell = MAX(100, numCell);   /* but not too few */
-    histo = ObitMemAllocName(numCell * sizeof(ofloat), "FArray histo");
-
-    /* form histogram */
-    cellFact =  numCell / (amax - amin + 1.0e-20);
-
-    for (i = 0; i < numCell; i++) histo[i] = 0.0;
-
-#if HAVE_AVX512==1  /* 16 Vector */
-    vb.v   = _mm512_set1_ps(fblank);  /* vector of blanks */
-    tmp = -cellFact * amin;
-    vflag.v  = _mm512_set1_ps(tmp);  /* flagged values */
-    tmp = amin;
-    vmin.v  = _mm512_set1_ps(tmp);  /* amin */
-    tmp = cellFact;
-    vfac.v = _mm512_set1_ps(tmp);  /* fact */
-
-    /* Do blocks of 16 as vector */
-    for (i = 0; i < in->arraySize - 16; i += 16) {
-        v.v    = _mm512_loadu_ps(&in->array[i]);        /* Data */
-        msk    = _mm512_cmp_ps_mask(v.v, vb.v, _CMP_EQ_OQ);  /* find blanks */
-        v.v    = _mm512_mask_blend_ps(msk, v.v, vflag.v);   /* replace blanks */
-        v.v    = _mm512_sub_ps(v.v, vmin.v);       /* -amin */
-        v.v    = _mm512_mul_ps(v.v, vfac.v);       /* * fact */
-        v.v    = _mm512_roundscale_ps(v.v, 32);    /* round */
-        vcell.v = _mm512_cvtps_epi32(v.v);
-
-        for (j = 0; j < 16; j++) {
-            if (vcell.i[j] < 0.0) continue;
-
-            icell = vcell.i[j];
-            icell = MIN(numCell - 1, MAX(0, icell));
-            histo[icell]++;
-        }
-    }
-
-    ilast = i;  /* How far did I get? */
-#elif HAVE_AVX==1  /* Vector */
-    vb.v   = _mm256_broadcast_ss(&fblank);  /* vector of blanks */
-    tmp = -cellFact * amin;
-    vflag.v  = _mm256_broadcast_ss(&tmp);  /* flagged values */
-    tmp = amin;
-    vmin.v  = _mm256_broadcast_ss(&tmp);  /* amin */
-    tmp = cellFact;
-    vfac.v = _mm256_broadcast_ss(&tmp);  /* fact */
-
-    /* Do blocks of 8 as vector */
-    for (i = 0; i < in->arraySize - 8; i += 8) {
-        v.v    = _mm256_loadu_ps(&in->array[i]);         /* Data */
-        vm.v   = _mm256_cmp_ps(v.v, vb.v, _CMP_EQ_OQ);  /* find blanks */
-        v.v    = _mm256_blendv_ps(v.v, vflag.v, vm.v);  /* replace blanks */
-        v.v    = _mm256_sub_ps(v.v, vmin.v);       /* -amin */
-        v.v    = _mm256_mul_ps(v.v, vfac.v);       /* * fact */
-        v.v    = _mm256_round_ps(v.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); /* round */
-        vcell.v = _mm256_cvtps_epi32(v.v);
-
-        for (j = 0; j < 8; j++) {
-            if (vcell.i[j] < 0.0) continue;
-
-            icell = vcell.i[j];
-            icell = MIN(numCell - 1, MAX(0, icell));
-            histo[icell]++;
-        }
-    }
-
-    ilast = i;  /* How far did I get? */
-#else /* Scalar and rest */
-    ilast = 0;
-#endif
-
-    for (i = ilast; i < in->arraySize; i++) {
-        if (in->array[i] != fblank) {
-            icell = 0.5 + cellFact * (in->array[i] - amin);
-            icell = MIN(numCell - 1, MAX(0, icell));
-            histo[icell]++;
-        }
-    }
-
-    /* Find mode cell */
-    modeCell = -1;
-    tmax = -1.0e20;
+    ObitFArrayStat stat;
 
-    for (i = 0; i < numCell; i++) {
-        if (histo[i] > tmax) {
-            tmax = histo[i];
-            modeCell = i;
-        }
-    }
-
-    /* convert from cell to value */
-    out = amin + modeCell / cellFact;
-
-    /* cleanup */
-    ObitMemFree(histo);
-
-    return out;
+    ObitFArrayStats(in, &stat);
+    return stat.mode;
 } /* end  ObitFArrayMode */
 
 /**
@@ -4329,32 +4303,194 @@ void ObitFArrayRandomFill(ObitFArray *in, ofloat mean, ofloat sigma)
 } /* end  ObitFArrayRandomFill */
 
 /**
- * Initialize global ClassInfo Structure.
+ * Start a fused elementwise expression.
+ * Operations are added with ObitFArrayExprArr and ObitFArrayExprScalar
+ * and evaluated together by ObitFArrayExprRun in a single pass, e.g.
+ * out = clip(in*s + in2) is
+ * \code
+ *   expr = ObitFArrayExprCreate (in);
+ *   ObitFArrayExprScalar (expr, OBIT_FAExpr_SMul, s, 0.0, 0.0);
+ *   ObitFArrayExprArr    (expr, OBIT_FAExpr_Add, in2);
+ *   ObitFArrayExprScalar (expr, OBIT_FAExpr_Clip, minVal, maxVal, newVal);
+ *   ObitFArrayExprRun    (expr, out);
+ *   expr = ObitFArrayExprFree (expr);
+ * \endcode
+ * \param in  Array giving the initial value of the expression
+ * \return new expression, delete with ObitFArrayExprFree
  */
-void ObitFArrayClassInit(void)
+ObitFArrayExpr* ObitFArrayExprCreate(ObitFArray *in)
 {
-    if (myClassInfo.initialized) return;  /* only once */
-
-    /* Set name and parent for this class */
-    myClassInfo.ClassName   = g_strdup(myClassName);
-    myClassInfo.ParentClass = ObitParentGetClass();
-
-    /* Set function pointers */
-    ObitFArrayClassInfoDefFn((gpointer)&myClassInfo);
+    ObitFArrayExpr *expr;
 
-    myClassInfo.initialized = TRUE; /* Now initialized */
+    /* error checks */
+    g_assert(ObitIsA(in, &myClassInfo));
+    g_assert(in->array != NULL);
 
-} /* end ObitFArrayClassInit */
+    expr = g_malloc0(sizeof(ObitFArrayExpr));
+    expr->in    = ObitFArrayRef(in);
+    expr->nstep = 0;
+    return expr;
+} /* end ObitFArrayExprCreate */
 
 /**
- * Initialize global ClassInfo Function pointers.
+ * Delete fused expression, unreferencing arrays
+ * \param expr  Expression to delete
+ * \return NULL pointer
  */
-static void ObitFArrayClassInfoDefFn(gpointer inClass)
+ObitFArrayExpr* ObitFArrayExprFree(ObitFArrayExpr *expr)
 {
-    ObitFArrayClassInfo *theClass = (ObitFArrayClassInfo *)inClass;
-    ObitClassInfo *ParentClass = (ObitClassInfo *)myClassInfo.ParentClass;
+    olong i;
 
-    if (theClass->initialized) return;  /* only once */
+    if (expr == NULL) return NULL;
+
+    expr->in = ObitFArrayUnref(expr->in);
+
+    for (i = 0; i < expr->nstep; i++)
+        if (expr->arr[i]) expr->arr[i] = ObitFArrayUnref(expr->arr[i]);
+
+    g_free(expr);
+    return NULL;
+} /* end ObitFArrayExprFree */
+
+/**
+ * Add an operation with an array operand to a fused expression.
+ * Nothing is computed until ObitFArrayExprRun.
+ * \param expr  Expression
+ * \param op    Operation, OBIT_FAExpr_Add ... OBIT_FAExpr_MinArr
+ * \param arr   Array operand, same geometry as the expression input
+ */
+void ObitFArrayExprArr(ObitFArrayExpr *expr, ObitFArrayExprOp op,
+                       ObitFArray *arr)
+{
+    /* error checks */
+    g_assert(expr != NULL);
+    g_assert(ObitIsA(arr, &myClassInfo));
+    g_assert(ObitFArrayIsCompatable(expr->in, arr));
+    g_assert(op <= OBIT_FAExpr_MinArr);
+    g_assert(expr->nstep < MAXFAEXPRSTEP);
+
+    expr->op[expr->nstep]   = op;
+    expr->arr[expr->nstep]  = ObitFArrayRef(arr);
+    expr->s[expr->nstep][0] = expr->s[expr->nstep][1] = expr->s[expr->nstep][2] = 0.0;
+    expr->nstep++;
+} /* end ObitFArrayExprArr */
+
+/**
+ * Add an operation with scalar operands to a fused expression.
+ * Nothing is computed until ObitFArrayExprRun.
+ * \param expr  Expression
+ * \param op    Operation, OBIT_FAExpr_SAdd ... OBIT_FAExpr_Abs
+ * \param s1    First scalar operand (see ObitFArrayExprOp)
+ * \param s2    Second scalar operand
+ * \param s3    Third scalar operand
+ */
+void ObitFArrayExprScalar(ObitFArrayExpr *expr, ObitFArrayExprOp op,
+                          ofloat s1, ofloat s2, ofloat s3)
+{
+    /* error checks */
+    g_assert(expr != NULL);
+    g_assert(op >= OBIT_FAExpr_SAdd);
+    g_assert(expr->nstep < MAXFAEXPRSTEP);
+
+    expr->op[expr->nstep]   = op;
+    expr->arr[expr->nstep]  = NULL;
+    expr->s[expr->nstep][0] = s1;
+    expr->s[expr->nstep][1] = s2;
+    expr->s[expr->nstep][2] = s3;
+    expr->nstep++;
+} /* end ObitFArrayExprScalar */
+
+/**
+ * Evaluate a fused expression.
+ * The array is divided among threads and each thread takes blocks of
+ * FAEXPRBLOCK elements through all operations before writing them,
+ * so each array is read (and out written) only once.
+ * Results are the same as the sequence of the corresponding
+ * ObitFArray functions.
+ * \param expr  Expression
+ * \param out   Output array, may be the input or any operand array.
+ */
+void ObitFArrayExprRun(ObitFArrayExpr *expr, ObitFArray *out)
+{
+    olong i;
+    olong nTh, nElem, loElem, hiElem, nElemPerThread, nThreads;
+    FAFuncArg **threadArgs;
+
+    /* error checks */
+    g_assert(expr != NULL);
+    g_assert(ObitIsA(out, &myClassInfo));
+    g_assert(ObitFArrayIsCompatable(expr->in, out));
+
+    /* Initialize Threading */
+    nThreads = MakeFAFuncArgs(expr->in->thread, expr->in, NULL, out,
+                              0, 0, 0, 0, 0, 0, 0, &threadArgs);
+
+    /* Divide up work */
+    nElem = expr->in->arraySize;
+    nElemPerThread = nElem / nThreads;
+    nTh = nThreads;
+
+    if (nElem < 1000000) {nElemPerThread = nElem; nTh = 1;}
+
+    loElem = 1;
+    hiElem = nElemPerThread;
+    hiElem = MIN(hiElem, nElem);
+
+    /* Set up thread arguments */
+    for (i = 0; i < nTh; i++) {
+        if (i == (nTh - 1)) hiElem = nElem; /* Make sure do all */
+
+        threadArgs[i]->first   = loElem;
+        threadArgs[i]->last    = hiElem;
+        threadArgs[i]->arg1    = (gpointer)expr;
+
+        if (nTh > 1) threadArgs[i]->ithread = i;
+        else threadArgs[i]->ithread = -1;
+
+        /* Update which Elem */
+        loElem += nElemPerThread;
+        hiElem += nElemPerThread;
+        hiElem = MIN(hiElem, nElem);
+    }
+
+    /* Do operation */
+    ObitThreadIterator(expr->in->thread, nTh,
+                       (ObitThreadFunc)ThreadFAExpr,
+                       (gpointer **)threadArgs);
+
+    /* Free local objects - expression not owned by args */
+    for (i = 0; i < nTh; i++) threadArgs[i]->arg1 = NULL;
+
+    KillFAFuncArgs(nThreads, threadArgs);
+} /* end ObitFArrayExprRun */
+
+/**
+ * Initialize global ClassInfo Structure.
+ */
+void ObitFArrayClassInit(void)
+{
+    if (myClassInfo.initialized) return;  /* only once */
+
+    /* Set name and parent for this class */
+    myClassInfo.ClassName   = g_strdup(myClassName);
+    myClassInfo.ParentClass = ObitParentGetClass();
+
+    /* Set function pointers */
+    ObitFArrayClassInfoDefFn((gpointer)&myClassInfo);
+
+    myClassInfo.initialized = TRUE; /* Now initialized */
+
+} /* end ObitFArrayClassInit */
+
+/**
+ * Initialize global ClassInfo Function pointers.
+ */
+static void ObitFArrayClassInfoDefFn(gpointer inClass)
+{
+    ObitFArrayClassInfo *theClass = (ObitFArrayClassInfo *)inClass;
+    ObitClassInfo *ParentClass = (ObitClassInfo *)myClassInfo.ParentClass;
+
+    if (theClass->initialized) return;  /* only once */
 
     /* Check type of inClass */
     g_assert(ObitInfoIsA(inClass, (ObitClassInfo *)&myClassInfo));
@@ -4416,6 +4552,7 @@ static void ObitFArrayClassInfoDefFn(gpointer inClass)
     theClass->ObitFArrayRawRMS = (ObitFArrayRawRMSFP)ObitFArrayRawRMS;
     theClass->ObitFArrayRMS0   = (ObitFArrayRMS0FP)ObitFArrayRMS0;
     theClass->ObitFArrayRMSQuant = (ObitFArrayRMSQuantFP)ObitFArrayRMSQuant;
+    theClass->ObitFArrayStats = (ObitFArrayStatsFP)ObitFArrayStats;
     theClass->ObitFArrayQuant  = (ObitFArrayQuantFP)ObitFArrayQuant;
     theClass->ObitFArrayMulColRow =
         (ObitFArrayMulColRowFP)ObitFArrayMulColRow;
@@ -4446,6 +4583,16 @@ static void ObitFArrayClassInfoDefFn(gpointer inClass)
         (ObitFArrayRandomFP)ObitFArrayRandom;
     theClass->ObitFArrayRandomFill =
         (ObitFArrayRandomFillFP)ObitFArrayRandomFill;
+    theClass->ObitFArrayExprCreate =
+        (ObitFArrayExprCreateFP)ObitFArrayExprCreate;
+    theClass->ObitFArrayExprFree =
+        (ObitFArrayExprFreeFP)ObitFArrayExprFree;
+    theClass->ObitFArrayExprArr =
+        (ObitFArrayExprArrFP)ObitFArrayExprArr;
+    theClass->ObitFArrayExprScalar =
+        (ObitFArrayExprScalarFP)ObitFArrayExprScalar;
+    theClass->ObitFArrayExprRun =
+        (ObitFArrayExprRunFP)ObitFArrayExprRun;
 
 } /* end ObitFArrayClassDefFn */
 
@@ -5718,6 +5865,320 @@ finish:
     return NULL;
 } /*  end ThreadFAHisto */
 
+/**
+ * Accumulate moments and extrema for ObitFArrayStats
+ * Magic value blanking supported.
+ * Callable as thread
+ * \param arg Pointer to FAFuncArg argument with elements:
+ * \li in       ObitFArray to work on
+ * \li first    First element (1-rel) number
+ * \li last     Highest element (1-rel) number
+ * \li arg1     (FAStatAcc*) accumulator for this thread
+ * \li ithread  thread number, <0 -> no threading
+ * \return NULL
+ */
+static gpointer ThreadFAStatSum(gpointer arg)
+{
+    /* Get arguments from structure */
+    FAFuncArg *largs = (FAFuncArg *)arg;
+    ObitFArray *in        = largs->in;
+    olong      loElem     = largs->first - 1;
+    olong      hiElem     = largs->last;
+    FAStatAcc  *acc       = (FAStatAcc *)largs->arg1;
+
+    /* local */
+    olong i;
+    ollong count = 0, nBlank = 0;
+    odouble sum = 0.0, sum2 = 0.0;
+    ofloat val, amin = 0.0, amax = 0.0, fblank = ObitMagicF();
+
+    if (hiElem < loElem) goto finish;
+
+    for (i = loElem; i < hiElem; i++) {
+        val = in->array[i];
+
+        if (val == fblank) {
+            nBlank++;
+            continue;
+        }
+
+        if (count == 0) {amin = amax = val;}
+
+        amin = MIN(amin, val);
+        amax = MAX(amax, val);
+        sum  += val;
+        sum2 += val * (odouble)val;
+        count++;
+    }
+
+    /* Save */
+    acc->count  = count;
+    acc->nBlank = nBlank;
+    acc->sum    = sum;
+    acc->sum2   = sum2;
+    acc->min    = amin;
+    acc->max    = amax;
+
+    /* Indicate completion */
+finish:
+
+    if (largs->ithread >= 0)
+        ObitThreadPoolDone(largs->thread, (gpointer)&largs->ithread);
+
+    return NULL;
+} /*  end ThreadFAStatSum */
+
+/**
+ * Accumulate fine and outer histograms for ObitFArrayStats
+ * Fine cell j covers [fineMin+j/fineFact, fineMin+(j+1)/fineFact),
+ * outer cell j is centered on outerMin+j/outerFact with out of range
+ * values going to the end cells, as in ObitFArrayMode.
+ * Magic value blanking supported.
+ * Callable as thread
+ * \param arg Pointer to FAFuncArg argument with elements:
+ * \li in       ObitFArray to work on
+ * \li first    First element (1-rel) number
+ * \li last     Highest element (1-rel) number
+ * \li arg1     (FAStatAcc*) accumulator for this thread, histograms
+ *              allocated and zeroed.
+ * \li ithread  thread number, <0 -> no threading
+ * \return NULL
+ */
+static gpointer ThreadFAStatHisto(gpointer arg)
+{
+    /* Get arguments from structure */
+    FAFuncArg *largs = (FAFuncArg *)arg;
+    ObitFArray *in        = largs->in;
+    olong      loElem     = largs->first - 1;
+    olong      hiElem     = largs->last;
+    FAStatAcc  *acc       = (FAStatAcc *)largs->arg1;
+
+    /* local */
+    olong i, icell, nFine = acc->nFine, nOuter = acc->nOuter;
+    olong *fine = acc->fine, *outer = acc->outer;
+    ollong under = 0, over = 0;
+    ofloat val, x, fblank = ObitMagicF();
+    ofloat fineMin = acc->fineMin, fineFact = acc->fineFact;
+    ofloat outerMin = acc->outerMin, outerFact = acc->outerFact;
+
+    if (hiElem < loElem) goto finish;
+
+    for (i = loElem; i < hiElem; i++) {
+        val = in->array[i];
+
+        if (val == fblank) continue;
+
+        /* Fine */
+        x = (val - fineMin) * fineFact;
+
+        if (x < 0.0) under++;
+        else if (x >= nFine) over++;
+        else fine[(olong)x]++;
+
+        /* Outer */
+        icell = (olong)(0.5 + outerFact * (val - outerMin));
+        icell = MIN(nOuter - 1, MAX(0, icell));
+        outer[icell]++;
+    }
+
+    /* Save */
+    acc->fineUnder = under;
+    acc->fineOver  = over;
+
+    /* Indicate completion */
+finish:
+
+    if (largs->ithread >= 0)
+        ObitThreadPoolDone(largs->thread, (gpointer)&largs->ithread);
+
+    return NULL;
+} /*  end ThreadFAStatHisto */
+
+/**
+ * Form a histogram in the binning of ThreadFAHisto from the fine histogram
+ * of an FAStatAcc; the counts of each fine cell are shared among the
+ * coarse cells in proportion to the overlap.
+ * Only possible if the fine cells are at most half the coarse cell width
+ * and the coarse histogram lies inside the fine one.
+ * \param acc      Merged accumulator
+ * \param amin     Center of first coarse cell
+ * \param amax     Max value as given to ThreadFAHisto
+ * \param numCell  Number of coarse cells
+ * \param histo    [out] coarse histogram
+ * \return TRUE if formed, FALSE if the data must be read again.
+ */
+static gboolean FAStatRebin(FAStatAcc *acc, ofloat amin, ofloat amax,
+                            olong numCell, ofloat *histo)
+{
+    olong j, k, jlo, jhi;
+    odouble cellFact, lo, hi, fWidth, a, b, c0, ca, cb;
+
+    cellFact = numCell / (amax - amin + 1.0e-20);
+    fWidth   = 1.0 / acc->fineFact;
+
+    if (fWidth > 0.5 / cellFact) return FALSE;
+
+    /* Coarse histogram range */
+    lo = amin - 0.5 / cellFact;
+    hi = amin + (numCell - 0.5) / cellFact;
+
+    if ((lo < acc->fineMin) || (hi > (acc->fineMin + acc->nFine * fWidth)))
+        return FALSE;
+
+    for (k = 0; k < numCell; k++) histo[k] = 0.0;
+
+    jlo = (olong)((lo - acc->fineMin) * acc->fineFact);
+    jhi = (olong)((hi - acc->fineMin) * acc->fineFact);
+    jlo = MAX(0, jlo);
+    jhi = MIN(acc->nFine - 1, jhi);
+
+    for (j = jlo; j <= jhi; j++) {
+        if (acc->fine[j] == 0) continue;
+
+        /* Fine cell in units of coarse cells, cell k covers [k, k+1) */
+        a  = (acc->fineMin + j * fWidth - lo) * cellFact;
+        b  = a + fWidth * cellFact;
+        ca = floor(a);
+        cb = floor(b);
+        k  = (olong)ca;
+
+        if (ca == cb) {  /* entirely in one cell */
+            if ((k >= 0) && (k < numCell)) histo[k] += acc->fine[j];
+        } else {         /* split across a boundary */
+            c0 = acc->fine[j] * (cb - a) / (b - a);
+
+            if ((k >= 0) && (k < numCell)) histo[k] += c0;
+
+            if ((k + 1 >= 0) && (k + 1 < numCell)) histo[k + 1] += acc->fine[j] - c0;
+        }
+    }
+
+    return TRUE;
+} /* end FAStatRebin */
+
+/**
+ * Form a histogram by a threaded pass through the data using ThreadFAHisto.
+ * \param in       Array to histogram
+ * \param amin     Center of first cell
+ * \param amax     Max value
+ * \param numCell  Number of cells
+ * \param histo    [out] histogram
+ * \return TRUE if OK
+ */
+static gboolean FAStatHistoPass(ObitFArray *in, ofloat amin, ofloat amax,
+                                olong numCell, ofloat *histo)
+{
+    olong i, j, nTh, nElem, loElem, hiElem, nElemPerThread, nThreads;
+    ofloat *thist;
+    gboolean OK;
+    FAFuncArg **threadArgs;
+
+    /* Initialize Threading for histogram */
+    nThreads =
+        MakeFAFuncArgs(in->thread, in, NULL, NULL,
+                       sizeof(ollong),  sizeof(ollong), numCell * sizeof(ofloat), sizeof(ofloat), sizeof(ofloat),
+                       sizeof(ollong), sizeof(ollong),
+                       &threadArgs);
+
+    /* Divide up work */
+    nElem = in->arraySize;
+    nElemPerThread = nElem / nThreads;
+    nTh = nThreads;
+
+    if (nElem < 1000000) {nElemPerThread = nElem; nTh = 1;}
+
+    loElem = 1;
+    hiElem = nElemPerThread;
+    hiElem = MIN(hiElem, nElem);
+
+    /* Set up thread arguments */
+    for (i = 0; i < nTh; i++) {
+        if (i == (nTh - 1)) hiElem = nElem; /* Make sure do all */
+
+        threadArgs[i]->first   = loElem;
+        threadArgs[i]->last    = hiElem;
+        memmove(threadArgs[i]->arg1, &numCell, sizeof(olong));
+        memmove(threadArgs[i]->arg4, &amax, sizeof(ofloat));
+        memmove(threadArgs[i]->arg5, &amin, sizeof(ofloat));
+
+        if (nTh > 1) threadArgs[i]->ithread = i;
+        else threadArgs[i]->ithread = -1;
+
+        /* Update which Elem */
+        loElem += nElemPerThread;
+        hiElem += nElemPerThread;
+        hiElem = MIN(hiElem, nElem);
+    }
+
+    /* Do Form Histogram */
+    OK = ObitThreadIterator(in->thread, nTh,
+                            (ObitThreadFunc)ThreadFAHisto,
+                            (gpointer **)threadArgs);
+
+    /* Accumulate histogram */
+    if (OK) {
+        for (j = 0; j < numCell; j++) histo[j] = 0.0;
+
+        for (i = 0; i < nTh; i++) {
+            thist = (ofloat *)(threadArgs[i]->arg3);
+
+            for (j = 0; j < numCell; j++) histo[j] += thist[j];
+        }
+    }
+
+    /* cleanup */
+    KillFAFuncArgs(nThreads, threadArgs);
+
+    return OK;
+} /* end FAStatHistoPass */
+
+/**
+ * Interpolate a quantile in the merged histograms of an FAStatAcc.
+ * The fine histogram is used if the requested rank falls inside it,
+ * else the outer histogram.
+ * \param acc   Merged accumulator
+ * \param frac  Fraction of the distribution below the value [0,1]
+ * \return value
+ */
+static ofloat FAStatQuantile(FAStatAcc *acc, ofloat frac)
+{
+    olong j;
+    odouble rank, cum, lo;
+    ofloat out;
+
+    rank = frac * (odouble)acc->count;
+
+    /* Fine histogram? */
+    if ((rank > acc->fineUnder) && (rank < (acc->count - acc->fineOver))) {
+        cum = (odouble)acc->fineUnder;
+
+        for (j = 0; j < acc->nFine; j++) {
+            if ((acc->fine[j] > 0) && ((cum + acc->fine[j]) >= rank)) {
+                lo = acc->fineMin + j / (odouble)acc->fineFact;
+                return (ofloat)(lo + ((rank - cum) / acc->fine[j]) / acc->fineFact);
+            }
+
+            cum += acc->fine[j];
+        }
+    }
+
+    /* Outer histogram */
+    cum = 0.0;
+    out = acc->max;
+
+    for (j = 0; j < acc->nOuter; j++) {
+        if ((acc->outer[j] > 0) && ((cum + acc->outer[j]) >= rank)) {
+            lo  = acc->outerMin + (j - 0.5) / (odouble)acc->outerFact;
+            out = (ofloat)(lo + ((rank - cum) / acc->outer[j]) / acc->outerFact);
+            break;
+        }
+
+        cum += acc->outer[j];
+    }
+
+    return MIN(acc->max, MAX(acc->min, out));
+} /* end FAStatQuantile */
+
 /**
  * Thread convolve a list of points,
  * Magic value blanking supported.
@@ -5813,6 +6274,192 @@ finish:
 
 } /*  end ThreadFAConvGaus */
 
+/**
+ * Evaluate fused expression on a range of elements.
+ * Blocks of FAEXPRBLOCK elements are copied to a local buffer, taken
+ * through all operations and then written to the output.
+ * Magic value blanking supported.
+ * Callable as thread
+ * \param arg Pointer to FAFuncArg argument with elements:
+ * \li in       ObitFArray with initial values
+ * \li out      Output ObitFArray
+ * \li first    First element (1-rel) number
+ * \li last     Highest element (1-rel) number
+ * \li arg1     ObitFArrayExpr to evaluate
+ * \li ithread  thread number, <0 -> no threading
+ * \return NULL
+ */
+static gpointer ThreadFAExpr(gpointer arg)
+{
+    /* Get arguments from structure */
+    FAFuncArg *largs = (FAFuncArg *)arg;
+    ObitFArray *in        = largs->in;
+    ObitFArray *out       = largs->out;
+    ObitFArrayExpr *expr  = (ObitFArrayExpr *)largs->arg1;
+    olong      loElem     = largs->first - 1;
+    olong      hiElem     = largs->last;
+
+    /* local */
+    olong   i, n, istep;
+    ofloat  acc[FAEXPRBLOCK];
+
+    if (hiElem < loElem) goto finish;
+
+    /* Loop over blocks */
+    for (i = loElem; i < hiElem; i += FAEXPRBLOCK) {
+        n = MIN(FAEXPRBLOCK, hiElem - i);
+        memcpy(acc, &in->array[i], n * sizeof(ofloat));
+
+        for (istep = 0; istep < expr->nstep; istep++) {
+            if (expr->arr[istep])
+                FAExprBlock(expr->op[istep], n, acc,
+                            &expr->arr[istep]->array[i], expr->s[istep]);
+            else
+                FAExprBlock(expr->op[istep], n, acc, NULL, expr->s[istep]);
+        }
+
+        memcpy(&out->array[i], acc, n * sizeof(ofloat));
+    } /* end loop over blocks */
+
+    /* Indicate completion */
+finish:
+
+    if (largs->ithread >= 0)
+        ObitThreadPoolDone(largs->thread, (gpointer)&largs->ithread);
+
+    return NULL;
+} /* end ThreadFAExpr */
+
+/**
+ * Apply one fused expression operation to a block.
+ * Loops are branch free so the compiler can vectorize them; the most
+ * common operations have explicit AVX versions.
+ * \param op   Operation
+ * \param n    Number of elements
+ * \param acc  [in/out] Running values
+ * \param x    Array operand for this block, NULL if none
+ * \param s    Scalar operands
+ */
+static void FAExprBlock(ObitFArrayExprOp op, olong n, ofloat *acc,
+                        const ofloat *x, const ofloat *s)
+{
+    olong i, ilast = 0;
+    ofloat fblank = ObitMagicF();
+    ofloat a, b, s1 = s[0], s2 = s[1], s3 = s[2];
+    gboolean ba, bb;
+#if HAVE_AVX==1
+    CV8SF va, vx, vb, vm, vs;
+#endif
+
+#if HAVE_AVX==1  /* Vector */
+    vb.v = _mm256_broadcast_ss(&fblank);  /* vector of blanks */
+    vs.v = _mm256_broadcast_ss(&s1);      /* vector of scalar */
+
+    switch (op) {
+    case OBIT_FAExpr_Add:
+    case OBIT_FAExpr_Sub:
+    case OBIT_FAExpr_Mul:
+        for (i = 0; i < n - 8; i += 8) {
+            va.v = _mm256_loadu_ps(&acc[i]);
+            vx.v = _mm256_loadu_ps(&x[i]);
+            vm.v = _mm256_or_ps(_mm256_cmp_ps(va.v, vb.v, _CMP_EQ_OQ),
+                                _mm256_cmp_ps(vx.v, vb.v, _CMP_EQ_OQ)); /* find blanks */
+            if (op == OBIT_FAExpr_Add)      va.v = _mm256_add_ps(va.v, vx.v);
+            else if (op == OBIT_FAExpr_Sub) va.v = _mm256_sub_ps(va.v, vx.v);
+            else                            va.v = _mm256_mul_ps(va.v, vx.v);
+            va.v = _mm256_blendv_ps(va.v, vb.v, vm.v);   /* reblank */
+            _mm256_storeu_ps(&acc[i], va.v);
+        }
+        ilast = i;  /* How far did I get? */
+        break;
+    case OBIT_FAExpr_SAdd:
+    case OBIT_FAExpr_SMul:
+        for (i = 0; i < n - 8; i += 8) {
+            va.v = _mm256_loadu_ps(&acc[i]);
+            vm.v = _mm256_cmp_ps(va.v, vb.v, _CMP_EQ_OQ); /* find blanks */
+            if (op == OBIT_FAExpr_SAdd) va.v = _mm256_add_ps(va.v, vs.v);
+            else                        va.v = _mm256_mul_ps(va.v, vs.v);
+            va.v = _mm256_blendv_ps(va.v, vb.v, vm.v);   /* reblank */
+            _mm256_storeu_ps(&acc[i], va.v);
+        }
+        ilast = i;  /* How far did I get? */
+        break;
+    default:
+        ilast = 0;  /* Do all */
+        break;
+    } /* end switch */
+#endif
+
+    /* Scalar (or rest) */
+    switch (op) {
+    case OBIT_FAExpr_Add:
+        for (i = ilast; i < n; i++)
+            acc[i] = ((acc[i] != fblank) && (x[i] != fblank)) ? acc[i] + x[i] : fblank;
+        break;
+    case OBIT_FAExpr_Sub:
+        for (i = ilast; i < n; i++)
+            acc[i] = ((acc[i] != fblank) && (x[i] != fblank)) ? acc[i] - x[i] : fblank;
+        break;
+    case OBIT_FAExpr_Mul:
+        for (i = ilast; i < n; i++)
+            acc[i] = ((acc[i] != fblank) && (x[i] != fblank)) ? acc[i] * x[i] : fblank;
+        break;
+    case OBIT_FAExpr_Div:
+        for (i = ilast; i < n; i++)
+            acc[i] = ((acc[i] != fblank) && (x[i] != fblank) && (x[i] != 0.0)) ?
+                     acc[i] / x[i] : fblank;
+        break;
+    case OBIT_FAExpr_Blank:
+        for (i = ilast; i < n; i++)
+            acc[i] = (x[i] != fblank) ? acc[i] : fblank;
+        break;
+    case OBIT_FAExpr_SumArr:
+    case OBIT_FAExpr_MaxArr:
+    case OBIT_FAExpr_MinArr:
+        for (i = ilast; i < n; i++) {
+            a = acc[i]; b = x[i];
+            ba = (a == fblank); bb = (b == fblank);
+            if (ba) acc[i] = b;            /* b or blank */
+            else if (!bb) {
+                if (op == OBIT_FAExpr_SumArr)      acc[i] = a + b;
+                else if (op == OBIT_FAExpr_MaxArr) acc[i] = MAX(a, b);
+                else                               acc[i] = MIN(a, b);
+            }
+        }
+        break;
+    case OBIT_FAExpr_SAdd:
+        for (i = ilast; i < n; i++)
+            acc[i] = (acc[i] != fblank) ? acc[i] + s1 : fblank;
+        break;
+    case OBIT_FAExpr_SMul:
+        for (i = ilast; i < n; i++)
+            acc[i] = (acc[i] != fblank) ? acc[i] * s1 : fblank;
+        break;
+    case OBIT_FAExpr_Clip:
+        for (i = ilast; i < n; i++)
+            acc[i] = ((acc[i] != fblank) && ((acc[i] < s1) || (acc[i] > s2))) ? s3 : acc[i];
+        break;
+    case OBIT_FAExpr_InClip:
+        for (i = ilast; i < n; i++)
+            acc[i] = ((acc[i] != fblank) && (acc[i] >= s1) && (acc[i] <= s2)) ? s3 : acc[i];
+        break;
+    case OBIT_FAExpr_Deblank:
+        for (i = ilast; i < n; i++)
+            acc[i] = (acc[i] != fblank) ? acc[i] : s1;
+        break;
+    case OBIT_FAExpr_Neg:
+        for (i = ilast; i < n; i++)
+            acc[i] = (acc[i] != fblank) ? -acc[i] : fblank;
+        break;
+    case OBIT_FAExpr_Abs:
+        for (i = ilast; i < n; i++)
+            acc[i] = (acc[i] != fblank) ? fabs(acc[i]) : fblank;
+        break;
+    default:
+        g_assert_not_reached(); /* unknown, barf */
+    } /* end switch */
+} /* end FAExprBlock */
+
 /**
  * Make arguments for a Threaded ThreadFAFunc?
  * \param thread     ObitThread object to be used
@@ -41,7 +41,68 @@
  * ObitFArray utility function definitions.
  */
 
+/*--------------- File Global Variables  ----------------*/
+/** Number of cached FFT objects */
+#define MAXCONVFFTCACHE 4
+/** Number of cached kernel transforms */
+#define MAXCONVCACHE 8
+/** Maximum bytes of cached kernel transforms and kernel copies */
+#define MAXCONVCACHEBYTES (256*1024*1024)
+/** Number of elements in kernel cache key */
+#define CONVCACHEKEY 9
+
+/** Cached FFT object, plans and workspace only, no data */
+typedef struct {
+  /* FFT object, NULL if unused */
+  ObitFFT *FFT;
+  /* Direction */
+  ObitFFTdir dir;
+  /* Dimensions */
+  olong nx, ny;
+  /* Last use counter */
+  olong lastUse;
+} ConvFFTCacheEntry;
+
+/** Cached kernel transform */
+typedef struct {
+  /* Transformed kernel, NULL if unused */
+  ObitCArray *FT;
+  /* Key: type, size, kernel checksums or parameters */
+  odouble key[CONVCACHEKEY];
+  /* Copy of kernel values compared on a key match, NULL if key is exact */
+  ofloat *kernel;
+  /* Number of kernel values */
+  olong kernelSize;
+  /* Bytes of FT and kernel copy */
+  ollong bytes;
+  /* Last use counter */
+  olong lastUse;
+} ConvCacheEntry;
+
+/** FFT cache */
+static ConvFFTCacheEntry fftCache[MAXCONVFFTCACHE];
+/** Kernel transform cache */
+static ConvCacheEntry convCache[MAXCONVCACHE];
+/** Use counter for cache replacement */
+static olong convCacheUse = 0;
+/** Bytes in kernel transform cache */
+static ollong convCacheBytes = 0;
+/** Lock for caches */
+static GMutex convCacheLock;
+
 /*---------------Private function prototypes----------------*/
+/** Private: Look up cached kernel transform */
+static ObitCArray* ConvCacheLookup (odouble *key, ObitFArray *kernel);
+
+/** Private: Save kernel transform in cache */
+static void ConvCacheSave (odouble *key, ObitFArray *kernel, ObitCArray *FT);
+
+/** Private: Release cache entry */
+static void ConvCacheDrop (ConvCacheEntry *entry);
+
+/** Private: Transform of 2-D array, zero padded and centered */
+static ObitCArray* KernelTransform (ObitFArray *kernel, olong nx, olong ny);
+
 /** Private: Fit 2-D circular Gaussian */
 static ofloat FitCGauss (olong Count, ofloat *pixX, ofloat *pixY, ofloat *val, 
 			 ofloat *peak, ofloat *center, ofloat *sigma, 
@@ -336,6 +397,8 @@ ofloat ObitFArrayUtilFit1DGauss2 (ObitFArray *in, olong ngauss, ofloat *FWHM, of
 /**
  * Convolves two 2-D Arrays using FFTs
  * Arrays must have the same geometry and NOT contain magic value blanking
+ * Neither transform is cached; use ObitFArrayUtilKernelFT for a kernel
+ * applied repeatedly.
  * \param in1  First input array
  * \param in2  Second input array
  * \param err  Error stack, returns if not empty.
@@ -347,7 +410,7 @@ ObitFArray* ObitFArrayUtilConvolve (ObitFArray *in1, ObitFArray *in2,
   ObitFArray *out=NULL;
   ObitCArray *uv1 = NULL, *uv2 = NULL;
   ObitFFT *forFFT = NULL, *revFFT = NULL;
-  olong  ddim[2];
+  ObitCArrayExpr *expr = NULL;
   olong ndim, naxis[2];
   ofloat scale;
   gchar *routine = "ObitFArrayUtilConvolve";
@@ -371,36 +434,32 @@ ObitFArray* ObitFArrayUtilConvolve (ObitFArray *in1, ObitFArray *in2,
 		      "%s: FArray %s dim 2NOT proper size for FFT", 
 		      routine, in1->name);
 
-  /* Make UV plane arrays */
+  /* Make UV plane array */
   ndim = 2;
   naxis[0] = 1+in1->naxis[0]/2; naxis[1] = in1->naxis[1]; 
   uv1 = ObitCArrayCreate ("Convolve work 1", ndim, naxis);
-  uv2 = ObitCArrayCreate ("Convolve work 2", ndim, naxis);
 
-  /* Make FFTs */
-  ddim[0] = in1->naxis[0]; ddim[1] = in1->naxis[1];
-  forFFT = newObitFFT("FTImage", OBIT_FFT_Forward, 
-		      OBIT_FFT_HalfComplex, 2, ddim);
-  revFFT = newObitFFT("FTuv", OBIT_FFT_Reverse, 
-		      OBIT_FFT_HalfComplex, 2, ddim);
+  /* Get FFTs, transform of in2 */
+  forFFT = ObitFArrayUtilGetFFT (OBIT_FFT_Forward, in1->naxis[0], in1->naxis[1]);
+  revFFT = ObitFArrayUtilGetFFT (OBIT_FFT_Reverse, in1->naxis[0], in1->naxis[1]);
+  uv2    = KernelTransform (in2, in1->naxis[0], in1->naxis[1]);
 
   /* FFT to uv plane */
   ObitFArray2DCenter (in1); /* Swaparoonie to FFT order */
   ObitFFTR2C (forFFT, in1, uv1);
-  ObitFArray2DCenter (in2);
-  ObitFFTR2C (forFFT, in2, uv2);
 
   /* return input to original order */
   ObitFArray2DCenter (in1);
-  ObitFArray2DCenter (in2);
 
   /* Scale */
   scale = 1.0 / ((ofloat)in1->naxis[0] * (ofloat)in1->naxis[1]);
-  ObitCArraySMul (uv1, scale);
-  /*ObitCArraySMul (uv2, scale); only 1?*/
 
-  /* Multiply */
-  ObitCArrayMul(uv1, uv2, uv1);
+  /* Scale and multiply */
+  expr = ObitCArrayExprCreate (uv1);
+  ObitCArrayExprScalar (expr, OBIT_CAExpr_SMul, scale, 0.0);
+  ObitCArrayExprCArr (expr, OBIT_CAExpr_Mul, uv2);
+  ObitCArrayExprRun (expr, uv1);
+  expr = ObitCArrayExprFree (expr);
 
   /* Some Cleanup */
   forFFT = ObitFFTUnref(forFFT);
@@ -430,6 +489,8 @@ ObitFArray* ObitFArrayUtilConvolve (ObitFArray *in1, ObitFArray *in2,
 /**
  * Correlate two 2-D Arrays using FFTs
  * Arrays must have the same geometry and NOT contain magic value blanking
+ * Neither transform is cached; use ObitFArrayUtilKernelFT for a kernel
+ * applied repeatedly.
  * \param in1  First input array
  * \param in2  Second input array
  * \param err  Error stack, returns if not empty.
@@ -441,7 +502,7 @@ ObitFArray* ObitFArrayUtilCorrel (ObitFArray *in1, ObitFArray *in2,
   ObitFArray *out=NULL;
   ObitCArray *uv1 = NULL, *uv2 = NULL;
   ObitFFT *forFFT = NULL, *revFFT = NULL;
-  olong  ddim[2];
+  ObitCArrayExpr *expr = NULL;
   olong ndim, naxis[2];
   ofloat scale;
   gchar *routine = "ObitFArrayUtilCorrel";
@@ -465,39 +526,32 @@ ObitFArray* ObitFArrayUtilCorrel (ObitFArray *in1, ObitFArray *in2,
 		      "%s: FArray %s dim 2NOT proper size for FFT", 
 		      routine, in1->name);
 
-  /* Make UV plane arrays */
+  /* Make UV plane array */
   ndim = 2;
   naxis[0] = 1+in1->naxis[0]/2; naxis[1] = in1->naxis[1]; 
   uv1 = ObitCArrayCreate ("Correl work 1", ndim, naxis);
-  uv2 = ObitCArrayCreate ("Correl work 2", ndim, naxis);
 
-  /* Make FFTs */
-  ddim[0] = in1->naxis[0]; ddim[1] = in1->naxis[1];
-  forFFT = newObitFFT("FTImage", OBIT_FFT_Forward, 
-		      OBIT_FFT_HalfComplex, 2, ddim);
-  revFFT = newObitFFT("FTuv", OBIT_FFT_Reverse, 
-		      OBIT_FFT_HalfComplex, 2, ddim);
+  /* Get FFTs, transform of in2 */
+  forFFT = ObitFArrayUtilGetFFT (OBIT_FFT_Forward, in1->naxis[0], in1->naxis[1]);
+  revFFT = ObitFArrayUtilGetFFT (OBIT_FFT_Reverse, in1->naxis[0], in1->naxis[1]);
+  uv2    = KernelTransform (in2, in1->naxis[0], in1->naxis[1]);
 
   /* FFT to uv plane */
   ObitFArray2DCenter (in1); /* Swaparoonie to FFT order */
   ObitFFTR2C (forFFT, in1, uv1);
-  ObitFArray2DCenter (in2);
-  ObitFFTR2C (forFFT, in2, uv2);
 
   /* return input to original order */
   ObitFArray2DCenter (in1);
-  ObitFArray2DCenter (in2);
 
   /* Scale */
   scale = 1.0 / ((ofloat)in1->naxis[0] * (ofloat)in1->naxis[1]);
-  ObitCArraySMul (uv1, scale);
-  /*ObitCArraySMul (uv2, scale); only 1?*/
-
-  /* conjugate uv2 */
-  ObitCArrayConjg(uv2);
 
-  /* Multiply */
-  ObitCArrayMul(uv1, uv2, uv1);
+  /* Scale and multiply by conjugate of uv2 */
+  expr = ObitCArrayExprCreate (uv1);
+  ObitCArrayExprScalar (expr, OBIT_CAExpr_SMul, scale, 0.0);
+  ObitCArrayExprCArr (expr, OBIT_CAExpr_MulConjg, uv2);
+  ObitCArrayExprRun (expr, uv1);
+  expr = ObitCArrayExprFree (expr);
 
   /* Some Cleanup */
   forFFT = ObitFFTUnref(forFFT);
@@ -575,7 +629,308 @@ ObitFArray* ObitFArrayUtilUVGaus (olong *naxis, ofloat *cells, ofloat maprot,
   return outFA;
 } /* end ObitFArrayUtilUVGaus */
 
+/**
+ * Return a reference to a 2-D half complex FFT object of a given size.
+ * FFT objects are kept in a small cache so that repeated convolutions
+ * of the same size do not need to create new plans.
+ * \param dir  OBIT_FFT_Forward (real to complex) or
+ *             OBIT_FFT_Reverse (complex to real)
+ * \param nx   Size of first axis
+ * \param ny   Size of second axis
+ * \return FFT object, should be ObitFFTUnrefed when done
+ */
+ObitFFT* ObitFArrayUtilGetFFT (ObitFFTdir dir, olong nx, olong ny)
+{
+  ObitFFT *out=NULL;
+  olong i, iold, dim[2];
+
+  g_mutex_lock (&convCacheLock);
+  convCacheUse++;
+
+  /* Look for it */
+  for (i=0; i<MAXCONVFFTCACHE; i++) {
+    if ((fftCache[i].FFT!=NULL) && (fftCache[i].dir==dir) && 
+	(fftCache[i].nx==nx) && (fftCache[i].ny==ny)) {
+      fftCache[i].lastUse = convCacheUse;
+      out = ObitFFTRef(fftCache[i].FFT);
+      g_mutex_unlock (&convCacheLock);
+      return out;
+    }
+  }
+
+  /* Create, replace the least recently used entry */
+  dim[0] = nx; dim[1] = ny;
+  out = newObitFFT ("Conv FFT", dir, OBIT_FFT_HalfComplex, 2, dim);
+  iold = 0;
+  for (i=1; i<MAXCONVFFTCACHE; i++) 
+    if (fftCache[i].lastUse<fftCache[iold].lastUse) iold = i;
+  fftCache[iold].FFT     = ObitFFTUnref(fftCache[iold].FFT);
+  fftCache[iold].FFT     = ObitFFTRef(out);
+  fftCache[iold].dir     = dir;
+  fftCache[iold].nx      = nx;
+  fftCache[iold].ny      = ny;
+  fftCache[iold].lastUse = convCacheUse;
+  g_mutex_unlock (&convCacheLock);
+
+  return out;
+} /* end ObitFArrayUtilGetFFT */
+
+/**
+ * Return the half plane transform of a convolving kernel.
+ * The kernel is zero padded to nx x ny with its center (naxis/2) at the
+ * center of the padded array, blanks replaced by zero, and transformed 
+ * in FFT order as done by ObitFeatherUtilPadArray and ObitFFTR2C.
+ * Transforms are cached with a copy of the kernel, found by size and a
+ * checksum and accepted only if the kernel values are identical, so that
+ * repeated convolutions with the same kernel only transform it once;
+ * the returned array MUST NOT be modified.
+ * The cache is limited to MAXCONVCACHEBYTES so only kernels applied
+ * repeatedly should be passed.
+ * \param kernel  2-D convolving function
+ * \param nx      Size of first axis of the padded array (>=kernel)
+ * \param ny      Size of second axis of the padded array (>=kernel)
+ * \return half plane CArray, should be ObitCArrayUnrefed when done
+ */
+ObitCArray* ObitFArrayUtilKernelFT (ObitFArray *kernel, olong nx, olong ny)
+{
+  ObitCArray *out=NULL;
+  olong i;
+  odouble key[CONVCACHEKEY];
+  ofloat fblank = ObitMagicF();
+
+  /* error checks */
+  g_assert (ObitFArrayIsA(kernel));
+  g_assert (kernel->ndim>=2);
+
+  /* Key - type, size and checksums of values */
+  for (i=0; i<CONVCACHEKEY; i++) key[i] = 0.0;
+  key[0] = 1.0;
+  key[1] = nx; key[2] = ny;
+  key[3] = kernel->naxis[0]; key[4] = kernel->naxis[1];
+  for (i=0; i<kernel->arraySize; i++) {
+    if (kernel->array[i]==fblank) continue;
+    key[5] += kernel->array[i];
+    key[6] += kernel->array[i] * (1.0 + (i%97)*1.0e-2);
+    key[7] += kernel->array[i] * kernel->array[i];
+  }
+
+  out = ConvCacheLookup (key, kernel);
+  if (out) return out;
+
+  out = KernelTransform (kernel, nx, ny);
+  ConvCacheSave (key, kernel, out);
+  return out;
+} /* end ObitFArrayUtilKernelFT */
+
+/**
+ * Return the half plane transform of a Gaussian convolving function,
+ * value 1 at the origin, in FFT order for an nx x ny image.
+ * Cached as ObitFArrayUtilKernelFT; the returned array MUST NOT be modified.
+ * \param nx      Size of first axis of the image
+ * \param ny      Size of second axis of the image
+ * \param cells   Cell spacing in x and y in units of maj,min (asec)
+ * \param maprot  Map rotation (deg)
+ * \param Gaumaj  Major axis of Gaussian in image plane (same units as cells)
+ * \param Gaumin  Minor axis of Gaussian in image plane (same units as cells)
+ * \param GauPA   Position angle of Gaussian in image plane, from N thru E, (deg)
+ * \return half plane CArray, should be ObitCArrayUnrefed when done
+ */
+ObitCArray* ObitFArrayUtilGausFT (olong nx, olong ny, ofloat *cells, 
+				  ofloat maprot, ofloat Gaumaj, ofloat Gaumin, 
+				  ofloat GauPA)
+{
+  ObitCArray *out=NULL;
+  ObitFArray *xferFn=NULL, *subXferFn=NULL, *zeroArray=NULL;
+  olong i, naxis[2], blc[2], trc[2];
+  odouble key[CONVCACHEKEY];
+  ObitErr *err=NULL;
+
+  /* Key - type, size and parameters */
+  for (i=0; i<CONVCACHEKEY; i++) key[i] = 0.0;
+  key[0] = 2.0;
+  key[1] = nx; key[2] = ny;
+  key[3] = cells[0]; key[4] = cells[1]; key[5] = maprot;
+  key[6] = Gaumaj; key[7] = Gaumin; key[8] = GauPA;
+
+  out = ConvCacheLookup (key, NULL);
+  if (out) return out;
+
+  /* Get Gaussian for real part */
+  naxis[0] = nx; naxis[1] = ny;
+  xferFn = ObitFArrayUtilUVGaus(naxis, cells, maprot, Gaumaj, Gaumin, GauPA);
+  /* Only need half in u */
+  err = newObitErr();
+  blc[0] = (naxis[0]/2)-1; blc[1] = 0;
+  trc[0] = naxis[0]-1;     trc[1] = naxis[1]-1;
+  subXferFn = ObitFArraySubArr (xferFn, blc, trc, err);
+  err = ObitErrUnref(err);
+  /* Array of zeroes for imaginary part */
+  naxis[0] = 1+naxis[0]/2;
+  zeroArray = ObitFArrayCreate("zeroes", 2, naxis);  
+  ObitFArrayFill(zeroArray, 0.0);
+
+  out = ObitCArrayCreate ("Gaussian FT", 2, naxis);
+  ObitCArrayComplex (subXferFn, zeroArray, out);
+  ObitCArray2DCenter (out);        /* Swaparoonie to FFT order */
+  xferFn    = ObitFArrayUnref(xferFn);
+  subXferFn = ObitFArrayUnref(subXferFn);
+  zeroArray = ObitFArrayUnref(zeroArray);
+
+  ConvCacheSave (key, NULL, out);
+  return out;
+} /* end ObitFArrayUtilGausFT */
+
+/**
+ * Release all cached FFT objects and kernel transforms.
+ */
+void ObitFArrayUtilConvCacheClear (void)
+{
+  olong i;
+
+  g_mutex_lock (&convCacheLock);
+  for (i=0; i<MAXCONVFFTCACHE; i++) {
+    fftCache[i].FFT     = ObitFFTUnref(fftCache[i].FFT);
+    fftCache[i].lastUse = 0;
+  }
+  for (i=0; i<MAXCONVCACHE; i++) {
+    ConvCacheDrop (&convCache[i]);
+    convCache[i].lastUse = 0;
+  }
+  g_mutex_unlock (&convCacheLock);
+} /* end ObitFArrayUtilConvCacheClear */
+
 /*---------------Private functions--------------------------*/
+/**
+ * Look up a cached kernel transform
+ * \param key     Cache key
+ * \param kernel  Kernel whose values must match those saved,
+ *                NULL if the key is exact
+ * \return reference to transform or NULL if not found
+ */
+static ObitCArray* ConvCacheLookup (odouble *key, ObitFArray *kernel)
+{
+  ObitCArray *out=NULL;
+  olong i, j;
+
+  g_mutex_lock (&convCacheLock);
+  convCacheUse++;
+  for (i=0; i<MAXCONVCACHE; i++) {
+    if (convCache[i].FT==NULL) continue;
+    for (j=0; j<CONVCACHEKEY; j++) if (convCache[i].key[j]!=key[j]) break;
+    if (j<CONVCACHEKEY) continue;
+    /* Checksums can collide - compare values */
+    if (kernel) {
+      if ((convCache[i].kernel==NULL) ||
+	  (convCache[i].kernelSize!=kernel->arraySize)) continue;
+      if (memcmp (convCache[i].kernel, kernel->array,
+		  kernel->arraySize*sizeof(ofloat))) continue;
+    } else if (convCache[i].kernel) continue;
+    convCache[i].lastUse = convCacheUse;
+    out = ObitCArrayRef(convCache[i].FT);
+    break;
+  }
+  g_mutex_unlock (&convCacheLock);
+
+  return out;
+} /* end ConvCacheLookup */
+
+/**
+ * Save a kernel transform in the cache replacing least recently
+ * used entries as needed to stay within MAXCONVCACHEBYTES.
+ * Transforms too large to fit are not saved.
+ * \param key     Cache key
+ * \param kernel  Kernel to copy for comparison, NULL if the key is exact
+ * \param FT      Transform, a reference is kept
+ */
+static void ConvCacheSave (odouble *key, ObitFArray *kernel, ObitCArray *FT)
+{
+  olong i, iold, ifree;
+  ollong bytes;
+
+  bytes = (ollong)FT->arraySize*2*sizeof(ofloat);
+  if (kernel) bytes += (ollong)kernel->arraySize*sizeof(ofloat);
+  if (bytes>MAXCONVCACHEBYTES) return;
+
+  g_mutex_lock (&convCacheLock);
+  /* Free least recently used until there is a free entry and room */
+  while (1) {
+    ifree = iold = -1;
+    for (i=0; i<MAXCONVCACHE; i++) {
+      if (convCache[i].FT==NULL) {
+	if (ifree<0) ifree = i;
+      } else if ((iold<0) || (convCache[i].lastUse<convCache[iold].lastUse))
+	iold = i;
+    }
+    if ((ifree>=0) && ((convCacheBytes+bytes)<=MAXCONVCACHEBYTES)) break;
+    ConvCacheDrop (&convCache[iold]);
+  }
+  iold = ifree;
+  convCache[iold].FT = ObitCArrayRef(FT);
+  if (kernel) {
+    convCache[iold].kernelSize = kernel->arraySize;
+    convCache[iold].kernel     = g_malloc(kernel->arraySize*sizeof(ofloat));
+    memcpy (convCache[iold].kernel, kernel->array,
+	    kernel->arraySize*sizeof(ofloat));
+  }
+  for (i=0; i<CONVCACHEKEY; i++) convCache[iold].key[i] = key[i];
+  convCache[iold].bytes   = bytes;
+  convCache[iold].lastUse = ++convCacheUse;
+  convCacheBytes += bytes;
+  g_mutex_unlock (&convCacheLock);
+} /* end ConvCacheSave */
+
+/**
+ * Release the transform and kernel copy of a cache entry.
+ * Must be called with convCacheLock held.
+ * \param entry  Cache entry
+ */
+static void ConvCacheDrop (ConvCacheEntry *entry)
+{
+  entry->FT = ObitCArrayUnref(entry->FT);
+  if (entry->kernel) g_free(entry->kernel);
+  entry->kernel     = NULL;
+  entry->kernelSize = 0;
+  convCacheBytes   -= entry->bytes;
+  entry->bytes      = 0;
+} /* end ConvCacheDrop */
+
+/**
+ * Transform a 2-D array zero padded to nx x ny with its center
+ * (naxis/2) at the center of the padded array, blanks replaced by zero,
+ * in FFT order as done by ObitFeatherUtilPadArray and ObitFFTR2C.
+ * \param kernel  2-D array
+ * \param nx      Size of first axis of the padded array (>=kernel)
+ * \param ny      Size of second axis of the padded array (>=kernel)
+ * \return half plane CArray, should be ObitCArrayUnrefed when done
+ */
+static ObitCArray* KernelTransform (ObitFArray *kernel, olong nx, olong ny)
+{
+  ObitCArray *out=NULL;
+  ObitFArray *pad=NULL;
+  ObitFFT    *FFT=NULL;
+  olong naxis[2], pos1[2], pos2[2];
+
+  /* Pad */
+  naxis[0] = nx; naxis[1] = ny;
+  pad = ObitFArrayCreate("Pad kernel", 2, naxis);
+  ObitFArrayFill(pad, 0.0);
+  pos1[0] = nx/2;               pos1[1] = ny/2;
+  pos2[0] = kernel->naxis[0]/2; pos2[1] = kernel->naxis[1]/2;
+  ObitFArrayShiftAdd (pad, pos1, kernel, pos2, 1.0, pad);
+  ObitFArrayDeblank(pad, 0.0);
+
+  /* Transform */
+  FFT = ObitFArrayUtilGetFFT (OBIT_FFT_Forward, nx, ny);
+  naxis[0] = 1 + nx/2; naxis[1] = ny;
+  out = ObitCArrayCreate ("Kernel FT", 2, naxis);
+  ObitFArray2DCenter (pad); /* Swaparoonie to FFT order */
+  ObitFFTR2C (FFT, pad, out);
+  FFT = ObitFFTUnref(FFT);
+  pad = ObitFArrayUnref(pad);
+
+  return out;
+} /* end KernelTransform */
+
 
 /* Structure for least squares fitting */
 struct fitData {
@@ -42,6 +42,25 @@ static gchar *myClassName = "ObitFFT";
 /** Function to obtain parent ClassInfo - Obit */
 static ObitGetClassFP ObitParentGetClass = ObitGetClass;
 
+/*---------------Private structures----------------*/
+/* Threaded function argument for sets of planes */
+typedef struct {
+  /* ObitThread to use */
+  ObitThread *thread;
+  /* FFT object */
+  ObitFFT    *in;
+  /* Input planes */
+  ObitCArray **inArrays;
+  /* Output planes */
+  ObitFArray **outArrays;
+  /* First (1-rel) plane to transform */
+  olong      first;
+  /* Highest (1-rel) plane to transform */
+  olong      last;
+  /* thread number  */
+  olong      ithread;
+} FFTFuncArg;
+
 /*--------------- File Global Variables  ----------------*/
 /**
  * ClassInfo structure ObitFFTClassInfo.
@@ -49,6 +68,16 @@ static ObitGetClassFP ObitParentGetClass = ObitGetClass;
  */
 static ObitFFTClassInfo myClassInfo = {FALSE};
 
+/** Planes with fewer pixels than this are done in parallel in batches */
+#define FFTINTRAMINPIX 262144
+
+/** Pruned transforms are only used if fewer than this fraction of the 
+    grid columns are used or the output is trimmed */
+#define FFTPRUNEMAXFRAC 0.75
+
+/** Number of threads requested for FFTW plans by ObitFFTNThreads */
+static olong FFTnThreads = 1;
+
 /*---------------Private function prototypes----------------*/
 /** Private: Initialize newly instantiated object. */
 void  ObitFFTInit  (gpointer in);
@@ -59,6 +88,24 @@ void  ObitFFTClear (gpointer in);
 /** Private: Set Class function pointers. */
 static void ObitFFTClassInfoDefFn (gpointer inClass);
 
+/** Private: Threading policy for a set of planes */
+static olong FFTPlaneThreads (ObitFFT *in, olong nPlane, gboolean *inter);
+
+/** Private: Number of floats in an input and output plane */
+static void FFTPlaneSize (ObitFFT *in, olong *nIn, olong *nOut);
+
+/** Private: Transform contiguous planes */
+static void FFTBatch (ObitFFT *in, olong nPlane, ofloat *idata, ofloat *odata);
+
+/** Private: Zero output outside of pruned region */
+static void FFTPruneTrim (ofloat *odata, olong nx, olong ny, 
+			  olong nKeepX, olong nKeepY);
+
+#if HAVE_FFTW3==1
+/** Private: Threaded transform of separate planes */
+static gpointer ThreadFFTC2RPlanes (gpointer arg);
+#endif /* HAVE_FFTW3 */
+
 /*----------------------Public functions---------------------------*/
 /**
  * Constructor.
@@ -168,8 +215,9 @@ olong ObitFFTSuggestSize (olong length)
  */
 void ObitFFTNThreads (olong nThreads)
 {
+  FFTnThreads = MAX (1,nThreads);
 #if HAVE_FFTW3THREADS==1
-  fftwf_plan_with_nthreads((int)MAX (1,nThreads));
+  fftwf_plan_with_nthreads((int)FFTnThreads);
 #endif /* HAVE_FFTW3THREADS */
 } /* end ObitFFTNThreads */
 
@@ -632,6 +680,347 @@ void ObitFFTC2C (ObitFFT *in, ObitCArray *inArray, ObitCArray *outArray)
   ObitThreadUnlock(in->thread);
  } /* end ObitFFTC2C */
 
+/**
+ * Do real to half complex transforms of a batch of planes.
+ * Must have been created with dir = OBIT_FFT_Forward and
+ * type = OBIT_FFT_HalfComplex, each plane has the geometry of the 
+ * constructor call and the planes are contiguous in the arrays
+ * (e.g. successive planes of a cube).
+ * \param in       Object with FFT structures.
+ * \param nPlane   Number of planes to transform
+ * \param inArray  Array of planes to be transformed (undisturbed on output).
+ * \param outArray Output array
+ */
+void ObitFFTR2CBatch (ObitFFT *in, olong nPlane, ObitFArray *inArray, 
+		      ObitCArray *outArray)
+{
+  olong nIn, nOut;
+
+  /* error checks */
+  g_assert (ObitFFTIsA(in));
+  g_assert (ObitFArrayIsA(inArray));
+  g_assert (ObitCArrayIsA(outArray));
+  g_assert (in->type == OBIT_FFT_HalfComplex);
+  g_assert (in->dir  == OBIT_FFT_Forward);
+  g_assert (in->dim[0] == inArray->naxis[0]);
+  g_assert (in->dim[0] == 2*(outArray->naxis[0]-1));
+  FFTPlaneSize (in, &nIn, &nOut);
+  g_assert (nPlane*nIn  <= inArray->arraySize);
+  g_assert (nPlane*nOut <= 2*outArray->arraySize);
+  if (nPlane<=0) return;
+
+  /* Lock ObitObjects aginst other threads */
+  ObitThreadLock(in->thread);
+  ObitThreadLock(inArray->thread);
+  ObitThreadLock(outArray->thread);
+
+  FFTBatch (in, nPlane, inArray->array, outArray->array);
+
+  /* Unlock ObitObjects */
+  ObitThreadUnlock(outArray->thread);
+  ObitThreadUnlock(inArray->thread);
+  ObitThreadUnlock(in->thread);
+} /* end ObitFFTR2CBatch */
+
+/**
+ * Do half complex to real transforms of a batch of planes.
+ * Must have been created with dir = OBIT_FFT_Reverse and
+ * type = OBIT_FFT_HalfComplex, each plane has the geometry of the 
+ * constructor call and the planes are contiguous in the arrays
+ * (e.g. successive planes of a cube).
+ * Note: FFT returned is not normalized.
+ * \param in       Object with FFT structures.
+ * \param nPlane   Number of planes to transform
+ * \param inArray  Array of planes to be transformed (disturbed on output).
+ * \param outArray Output array
+ */
+void ObitFFTC2RBatch (ObitFFT *in, olong nPlane, ObitCArray *inArray, 
+		      ObitFArray *outArray)
+{
+  olong nIn, nOut;
+
+  /* error checks */
+  g_assert (ObitFFTIsA(in));
+  g_assert (ObitCArrayIsA(inArray));
+  g_assert (ObitFArrayIsA(outArray));
+  g_assert (in->type == OBIT_FFT_HalfComplex);
+  g_assert (in->dir  == OBIT_FFT_Reverse);
+  g_assert (in->dim[0] == 2*(inArray->naxis[0]-1));
+  g_assert (in->dim[0] == outArray->naxis[0]);
+  FFTPlaneSize (in, &nIn, &nOut);
+  g_assert (nPlane*nIn  <= 2*inArray->arraySize);
+  g_assert (nPlane*nOut <= outArray->arraySize);
+  if (nPlane<=0) return;
+
+  /* Lock ObitObjects aginst other threads */
+  ObitThreadLock(in->thread);
+  ObitThreadLock(inArray->thread);
+  ObitThreadLock(outArray->thread);
+
+  FFTBatch (in, nPlane, inArray->array, outArray->array);
+
+  /* Unlock ObitObjects */
+  ObitThreadUnlock(outArray->thread);
+  ObitThreadUnlock(inArray->thread);
+  ObitThreadUnlock(in->thread);
+} /* end ObitFFTC2RBatch */
+
+/**
+ * Do full complex to complex transforms of a batch of planes.
+ * Must have been created with type = OBIT_FFT_FullComplex, each plane 
+ * has the geometry of the constructor call and the planes are 
+ * contiguous in the arrays (e.g. successive planes of a cube).
+ * Transform is in the direction specified in constructor call.
+ * \param in       Object with FFT structures.
+ * \param nPlane   Number of planes to transform
+ * \param inArray  Array of planes to be transformed (disturbed on output).
+ * \param outArray Output array
+ */
+void ObitFFTC2CBatch (ObitFFT *in, olong nPlane, ObitCArray *inArray, 
+		      ObitCArray *outArray)
+{
+  olong nIn, nOut;
+
+  /* error checks */
+  g_assert (ObitFFTIsA(in));
+  g_assert (ObitCArrayIsA(inArray));
+  g_assert (ObitCArrayIsA(outArray));
+  g_assert (in->type == OBIT_FFT_FullComplex);
+  g_assert (in->dim[0] == inArray->naxis[0]);
+  g_assert (in->dim[0] == outArray->naxis[0]);
+  FFTPlaneSize (in, &nIn, &nOut);
+  g_assert (nPlane*nIn  <= 2*inArray->arraySize);
+  g_assert (nPlane*nOut <= 2*outArray->arraySize);
+  if (nPlane<=0) return;
+
+  /* Lock ObitObjects aginst other threads */
+  ObitThreadLock(in->thread);
+  ObitThreadLock(inArray->thread);
+  ObitThreadLock(outArray->thread);
+
+  FFTBatch (in, nPlane, inArray->array, outArray->array);
+
+  /* Unlock ObitObjects */
+  ObitThreadUnlock(outArray->thread);
+  ObitThreadUnlock(inArray->thread);
+  ObitThreadUnlock(in->thread);
+} /* end ObitFFTC2CBatch */
+
+/**
+ * Do half complex to real transforms of a set of planes in separate arrays.
+ * Must have been created with dir = OBIT_FFT_Reverse and
+ * type = OBIT_FFT_HalfComplex and each plane have the geometry of the 
+ * constructor call.
+ * Small planes are transformed in parallel using ObitThreads and a single 
+ * threaded plan, large ones sequentially with any FFTW threading.
+ * Note: FFT returned is not normalized.
+ * \param in        Object with FFT structures.
+ * \param nPlane    Number of planes to transform
+ * \param inArrays  Arrays to be transformed (disturbed on output).
+ * \param outArrays Output arrays
+ */
+void ObitFFTC2RPlanes (ObitFFT *in, olong nPlane, ObitCArray **inArrays, 
+		       ObitFArray **outArrays)
+{
+  olong j;
+#if HAVE_FFTW3==1
+  olong i, nTh, nPerTh, lo;
+  gboolean inter;
+  FFTFuncArg **threadArgs;
+  olong dim[7];
+  int fftwdim[10];
+  float inArr[50], outArr[50];  /* Dummy arrays */
+#endif /* HAVE_FFTW3 */
+
+  /* error checks */
+  g_assert (ObitFFTIsA(in));
+  g_assert (in->type == OBIT_FFT_HalfComplex);
+  g_assert (in->dir  == OBIT_FFT_Reverse);
+  for (j=0; j<nPlane; j++) {
+    g_assert (ObitCArrayIsA(inArrays[j]));
+    g_assert (ObitFArrayIsA(outArrays[j]));
+    g_assert (in->dim[0] == outArrays[j]->naxis[0]);
+    g_assert (2*(inArrays[j]->naxis[0]-1) == outArrays[j]->naxis[0]); 
+    if (in->rank>1) g_assert (in->dim[1] == outArrays[j]->naxis[1]);
+  }
+  if (nPlane<=0) return;
+
+#if HAVE_FFTW3==1
+  /* Parallel over planes? */
+  nTh = FFTPlaneThreads (in, nPlane, &inter);
+  if (!inter) nTh = 1;
+
+  if (nTh>1) {
+    /* Single threaded plan for use in ObitThreads */
+    if (in->PPlan==NULL) {
+      for (i=0; i<in->rank; i++) dim[in->rank-i-1] = in->dim[i];
+      for (i=0; i<in->rank; i++) fftwdim[i] = (int)dim[i];
+#if HAVE_FFTW3THREADS==1
+      fftwf_plan_with_nthreads(1);
+#endif /* HAVE_FFTW3THREADS */
+      in->PPlan = fftwf_plan_dft_c2r((int)in->rank, fftwdim,
+				     (fftwf_complex*)inArr, (float*)outArr, 
+				     FFTW_ESTIMATE);
+#if HAVE_FFTW3THREADS==1
+      fftwf_plan_with_nthreads((int)FFTnThreads);
+#endif /* HAVE_FFTW3THREADS */
+    }
+
+    /* Divide planes among threads */
+    threadArgs = g_malloc0(nTh*sizeof(FFTFuncArg*));
+    nPerTh = nPlane / nTh;
+    lo = 1;
+    for (i=0; i<nTh; i++) {
+      threadArgs[i] = g_malloc0(sizeof(FFTFuncArg));
+      threadArgs[i]->thread    = in->thread;
+      threadArgs[i]->in        = in;
+      threadArgs[i]->inArrays  = inArrays;
+      threadArgs[i]->outArrays = outArrays;
+      threadArgs[i]->first     = lo;
+      threadArgs[i]->last      = lo + nPerTh - 1 + ((i<(nPlane%nTh)) ? 1 : 0);
+      threadArgs[i]->ithread   = i;
+      lo = threadArgs[i]->last + 1;
+    }
+
+    /* Do operation */
+    ObitThreadIterator (in->thread, nTh, 
+			(ObitThreadFunc)ThreadFFTC2RPlanes,
+			(gpointer**)threadArgs);
+
+    /* Free local objects */
+    for (i=0; i<nTh; i++) g_free(threadArgs[i]);
+    g_free(threadArgs);
+    return;
+  } /* end parallel over planes */
+#endif /* HAVE_FFTW3 */
+
+  /* One at a time */
+  for (j=0; j<nPlane; j++) ObitFFTC2R (in, inArrays[j], outArrays[j]);
+} /* end ObitFFTC2RPlanes */
+
+/**
+ * Do a pruned 2D half complex to real transform.
+ * Only the first nUsed (complex) elements of each row of inArray may be 
+ * nonzero (e.g. a uv grid with nothing past the longest baseline) and 
+ * only output pixels within nKeepX columns and nKeepY rows of the origin 
+ * are wanted; the rest of outArray is zeroed.
+ * Distances are in FFT order, pixel i on an axis of length n is 
+ * MIN(i, n-i) from the origin.
+ * With FFTW3 this is done as complex transforms of the first nUsed columns
+ * followed by half complex to real transforms of only the rows kept, 
+ * otherwise a full transform is done and the output trimmed.
+ * If nothing is to be trimmed and more than FFTPRUNEMAXFRAC of the 
+ * columns are used the ordinary 2D transform (#ObitFFTC2R) is faster 
+ * and is used instead.
+ * Must have been created with dir = OBIT_FFT_Reverse,
+ * type = OBIT_FFT_HalfComplex and rank = 2.
+ * Note: FFT returned is not normalized.
+ * \param in       Object with FFT structures.
+ * \param inArray  Array to be transformed (disturbed on output).
+ * \param nUsed    Number of leading complex elements in each row of 
+ *                 inArray which may be nonzero, <=0 => all
+ * \param nKeepX   Half width in columns of the output wanted, <=0 => all
+ * \param nKeepY   Half width in rows of the output wanted, <=0 => all
+ * \param outArray Output array
+ */
+void ObitFFTC2RPruned (ObitFFT *in, ObitCArray *inArray, olong nUsed,
+		       olong nKeepX, olong nKeepY, ObitFArray *outArray)
+{
+  olong nx, ny, nu;
+#if HAVE_FFTW3==1
+  olong nRow;
+  int n[1];
+  unsigned flags;
+  ofloat *idata, *odata;
+#endif /* HAVE_FFTW3 */
+
+  /* error checks */
+  g_assert (ObitFFTIsA(in));
+  g_assert (ObitCArrayIsA(inArray));
+  g_assert (ObitFArrayIsA(outArray));
+  g_assert (in->type == OBIT_FFT_HalfComplex);
+  g_assert (in->dir  == OBIT_FFT_Reverse);
+  g_assert (in->rank == 2);
+  g_assert (in->dim[0] == outArray->naxis[0]);
+  g_assert (in->dim[1] == outArray->naxis[1]);
+  g_assert (2*(inArray->naxis[0]-1) == outArray->naxis[0]); 
+  g_assert (inArray->naxis[1] == outArray->naxis[1]);
+
+  nx = in->dim[0];
+  ny = in->dim[1];
+  nu = nx/2 + 1;
+  if ((nUsed<=0)  || (nUsed>nu))     nUsed  = nu;
+  if ((nKeepX<=0) || (nKeepX>=nx/2)) nKeepX = nx/2;
+  if ((nKeepY<=0) || (nKeepY>=ny/2)) nKeepY = ny/2;
+
+  /* Not worth pruning? */
+  if ((nKeepX==nx/2) && (nKeepY==ny/2) && (nUsed>FFTPRUNEMAXFRAC*nu)) {
+    ObitFFTC2R (in, inArray, outArray);
+    return;
+  }
+
+#if HAVE_FFTW3==1
+  /* Rows done from each end of the output */
+  nRow = nKeepY + 1;
+  if (2*nRow>=ny) nRow = ny;
+
+  /* Lock ObitObjects aginst other threads */
+  ObitThreadLock(in->thread);
+  ObitThreadLock(inArray->thread);
+  ObitThreadLock(outArray->thread);
+
+  idata = inArray->array;
+  odata = outArray->array;
+  /* Plans are reused on other arrays and row offsets */
+  flags = FFTW_ESTIMATE | FFTW_UNALIGNED; /* Doesn't touch the data */
+
+  /* Columns - in place complex transforms of those used */
+  if ((in->VPlan==NULL) || (in->nVPlan!=nUsed)) {
+    if (in->VPlan) fftwf_destroy_plan(in->VPlan);
+    n[0] = (int)ny;
+    in->VPlan = fftwf_plan_many_dft (1, n, (int)nUsed,
+				     (fftwf_complex*)idata, NULL, (int)nu, 1,
+				     (fftwf_complex*)idata, NULL, (int)nu, 1,
+				     FFTW_BACKWARD, flags);
+    in->nVPlan = nUsed;
+  }
+
+  /* Rows - half complex to real for a block at each end */
+  if ((in->UPlan==NULL) || (in->nUPlan!=nRow)) {
+    if (in->UPlan) fftwf_destroy_plan(in->UPlan);
+    n[0] = (int)nx;
+    in->UPlan = fftwf_plan_many_dft_c2r (1, n, (int)nRow,
+					 (fftwf_complex*)idata, NULL, 1, (int)nu,
+					 (float*)odata, NULL, 1, (int)nx,
+					 flags);
+    in->nUPlan = nRow;
+  }
+  g_assert (in->VPlan!=NULL);
+  g_assert (in->UPlan!=NULL);
+
+  /* do transforms */
+  fftwf_execute_dft (in->VPlan, (fftwf_complex*)idata, (fftwf_complex*)idata);
+  fftwf_execute_dft_c2r (in->UPlan, (fftwf_complex*)idata, (float*)odata);
+  if (nRow<ny)
+    fftwf_execute_dft_c2r (in->UPlan, (fftwf_complex*)(idata+2*nu*(ny-nRow)), 
+			   (float*)(odata+nx*(ny-nRow)));
+
+  /* Zero what wasn't wanted or wasn't done */
+  FFTPruneTrim (odata, nx, ny, nKeepX, nKeepY);
+
+  /* Unlock ObitObjects */
+  ObitThreadUnlock(outArray->thread);
+  ObitThreadUnlock(inArray->thread);
+  ObitThreadUnlock(in->thread);
+
+#else  /* Not FFTW3 - full transform then trim */
+  ObitFFTC2R (in, inArray, outArray);
+  ObitThreadLock(outArray->thread);
+  FFTPruneTrim (outArray->array, nx, ny, nKeepX, nKeepY);
+  ObitThreadUnlock(outArray->thread);
+#endif /* HAVE_FFTW3 */
+} /* end ObitFFTC2RPruned */
+
 /**
  * Initialize global ClassInfo Structure.
  */
@@ -687,6 +1076,11 @@ static void ObitFFTClassInfoDefFn (gpointer inClass)
   theClass->ObitFFTR2C  = (ObitFFTR2CFP)ObitFFTR2C;
   theClass->ObitFFTC2R  = (ObitFFTC2RFP)ObitFFTC2R;
   theClass->ObitFFTC2C  = (ObitFFTC2CFP)ObitFFTC2C;
+  theClass->ObitFFTR2CBatch  = (ObitFFTR2CBatchFP)ObitFFTR2CBatch;
+  theClass->ObitFFTC2RBatch  = (ObitFFTC2RBatchFP)ObitFFTC2RBatch;
+  theClass->ObitFFTC2CBatch  = (ObitFFTC2CBatchFP)ObitFFTC2CBatch;
+  theClass->ObitFFTC2RPlanes = (ObitFFTC2RPlanesFP)ObitFFTC2RPlanes;
+  theClass->ObitFFTC2RPruned = (ObitFFTC2RPrunedFP)ObitFFTC2RPruned;
 
 } /* end ObitFFTClassDefFn */
 
@@ -730,6 +1124,14 @@ void ObitFFTInit  (gpointer inn)
 #if HAVE_FFTW3==1 /* FFTW 3 version */
   in->CPlan        = NULL;
   in->RPlan        = NULL;
+  in->BPlan        = NULL;
+  in->nBPlan       = 0;
+  in->nBThread     = 0;
+  in->PPlan        = NULL;
+  in->VPlan        = NULL;
+  in->nVPlan       = 0;
+  in->UPlan        = NULL;
+  in->nUPlan       = 0;
 
 #elif HAVE_FFTW==1  /* FFTW 2 version */
   in->CPlan        = NULL;
@@ -904,6 +1306,10 @@ void ObitFFTClear (gpointer inn)
 #if HAVE_FFTW3==1  /* FFTW 3 version */
   if (in->CPlan) {fftwf_destroy_plan(in->CPlan); in->CPlan = NULL;}
   if (in->RPlan) {fftwf_destroy_plan(in->RPlan); in->RPlan = NULL;}
+  if (in->BPlan) {fftwf_destroy_plan(in->BPlan); in->BPlan = NULL;}
+  if (in->PPlan) {fftwf_destroy_plan(in->PPlan); in->PPlan = NULL;}
+  if (in->VPlan) {fftwf_destroy_plan(in->VPlan); in->VPlan = NULL;}
+  if (in->UPlan) {fftwf_destroy_plan(in->UPlan); in->UPlan = NULL;}
 
 #elif HAVE_FFTW==1  /* FFTW 2 version */
   if (in->CPlan)  {fftwnd_destroy_plan(in->CPlan); in->CPlan = NULL;}
@@ -933,3 +1339,216 @@ void ObitFFTClear (gpointer inn)
   
 } /* end ObitFFTClear */
 
+/**
+ * Decide how to spread transforms of a set of planes over threads.
+ * Planes smaller than FFTINTRAMINPIX pixels are done in parallel, one per
+ * thread, larger planes one at a time with up to 2 threads per 1K pixels
+ * on the first axis inside each transform.
+ * Threads inside FFTW plans are limited by ObitFFTNThreads.
+ * \param in      FFT object
+ * \param nPlane  Number of planes
+ * \param inter   [out] TRUE if parallel over planes
+ * \return number of threads to use
+ */
+static olong FFTPlaneThreads (ObitFFT *in, olong nPlane, gboolean *inter)
+{
+  olong i, nProc, npix;
+
+  nProc = MAX (1, ObitThreadNumProc(in->thread));
+  npix = 1;
+  for (i=0; i<in->rank; i++) npix *= in->dim[i];
+
+  *inter = (nPlane>1) && (npix<FFTINTRAMINPIX);
+  if (*inter) return MIN (nProc, nPlane);
+  return MIN (MIN (nProc, FFTnThreads), MAX (1, 2*in->dim[0]/1024));
+} /* end FFTPlaneThreads */
+
+/**
+ * Number of floats in each input and output plane of a transform
+ * \param in    FFT object
+ * \param nIn   [out] Number of floats per input plane
+ * \param nOut  [out] Number of floats per output plane
+ */
+static void FFTPlaneSize (ObitFFT *in, olong *nIn, olong *nOut)
+{
+  olong i, nReal, nCmplx;
+
+  /* Real and complex sizes */
+  nReal = in->dim[0]; nCmplx = 2*(in->dim[0]/2+1);
+  if (in->type==OBIT_FFT_FullComplex) {nReal = 2*in->dim[0]; nCmplx = nReal;}
+  for (i=1; i<in->rank; i++) {nReal *= in->dim[i]; nCmplx *= in->dim[i];}
+
+  if ((in->type==OBIT_FFT_HalfComplex) && (in->dir==OBIT_FFT_Forward)) {
+    *nIn = nReal;  *nOut = nCmplx;  /* R2C */
+  } else {
+    *nIn = nCmplx; *nOut = nReal;   /* C2R, C2C */
+  }
+} /* end FFTPlaneSize */
+
+/**
+ * Transform nPlane contiguous planes of the type, direction and geometry
+ * of in.  With FFTW3 a "many" plan is made (and kept for the next batch 
+ * of the same size) with the number of threads given by FFTPlaneThreads,
+ * at most that set by ObitFFTNThreads; otherwise the planes are done
+ * one at a time.
+ * \param in      FFT object
+ * \param nPlane  Number of planes
+ * \param idata   First input plane
+ * \param odata   First output plane
+ */
+static void FFTBatch (ObitFFT *in, olong nPlane, ofloat *idata, ofloat *odata)
+{
+  olong i, nIn, nOut;
+#if HAVE_FFTW3==1
+  olong nTh;
+  gboolean inter;
+  int fftwdim[10], dir;
+  unsigned flags;
+#else
+  olong j, naxis[7];
+  ObitCArray *cplane=NULL, *cplane2=NULL;
+  ObitFArray *fplane=NULL;
+#endif /* HAVE_FFTW3 */
+
+  FFTPlaneSize (in, &nIn, &nOut);
+
+#if HAVE_FFTW3==1
+  /* FFTW threads, within ObitFFTNThreads limit */
+  nTh = MIN (FFTPlaneThreads (in, nPlane, &inter), FFTnThreads);
+
+  /* Need new plan? */
+  if ((in->BPlan==NULL) || (in->nBPlan!=nPlane) || (in->nBThread!=nTh)) {
+    if (in->BPlan) fftwf_destroy_plan(in->BPlan);
+    /* FFTW uses row major order */
+    for (i=0; i<in->rank; i++) fftwdim[in->rank-i-1] = (int)in->dim[i];
+    flags = FFTW_ESTIMATE; /* Doesn't touch the data */
+#if HAVE_FFTW3THREADS==1
+    fftwf_plan_with_nthreads((int)nTh);
+#endif /* HAVE_FFTW3THREADS */
+    if (in->type==OBIT_FFT_FullComplex) {
+      if (in->dir==OBIT_FFT_Forward) dir = FFTW_FORWARD;
+      else dir = FFTW_BACKWARD;
+      in->BPlan = fftwf_plan_many_dft ((int)in->rank, fftwdim, (int)nPlane,
+				       (fftwf_complex*)idata, NULL, 1, (int)nIn/2,
+				       (fftwf_complex*)odata, NULL, 1, (int)nOut/2,
+				       dir, flags);
+    } else if (in->dir==OBIT_FFT_Forward) { /* R2C */
+      in->BPlan = fftwf_plan_many_dft_r2c ((int)in->rank, fftwdim, (int)nPlane,
+					   (float*)idata, NULL, 1, (int)nIn,
+					   (fftwf_complex*)odata, NULL, 1, (int)nOut/2,
+					   flags);
+    } else { /* C2R */
+      in->BPlan = fftwf_plan_many_dft_c2r ((int)in->rank, fftwdim, (int)nPlane,
+					   (fftwf_complex*)idata, NULL, 1, (int)nIn/2,
+					   (float*)odata, NULL, 1, (int)nOut,
+					   flags);
+    }
+#if HAVE_FFTW3THREADS==1
+    fftwf_plan_with_nthreads((int)FFTnThreads);
+#endif /* HAVE_FFTW3THREADS */
+    in->nBPlan   = nPlane;
+    in->nBThread = nTh;
+  } /* end make plan */
+  g_assert (in->BPlan!=NULL);
+
+  /* Do transforms */
+  if (in->type==OBIT_FFT_FullComplex) 
+    fftwf_execute_dft (in->BPlan, (fftwf_complex*)idata, (fftwf_complex*)odata);
+  else if (in->dir==OBIT_FFT_Forward)
+    fftwf_execute_dft_r2c (in->BPlan, (float*)idata, (fftwf_complex*)odata);
+  else
+    fftwf_execute_dft_c2r (in->BPlan, (fftwf_complex*)idata, (float*)odata);
+
+#else  /* Not FFTW3 - one plane at a time through work arrays */
+  for (i=0; i<in->rank; i++) naxis[i] = in->dim[i];
+  if (in->type==OBIT_FFT_FullComplex) {
+    cplane  = ObitCArrayCreate ("FFT plane", in->rank, naxis);
+    cplane2 = ObitCArrayCreate ("FFT plane", in->rank, naxis);
+  } else {
+    fplane = ObitFArrayCreate ("FFT plane", in->rank, naxis);
+    naxis[0] = in->dim[0]/2 + 1;
+    cplane = ObitCArrayCreate ("FFT plane", in->rank, naxis);
+  }
+  for (j=0; j<nPlane; j++) {
+    if (in->type==OBIT_FFT_FullComplex) {
+      memcpy (cplane->array, idata, nIn*sizeof(ofloat));
+      ObitFFTC2C (in, cplane, cplane2);
+      memcpy (odata, cplane2->array, nOut*sizeof(ofloat));
+    } else if (in->dir==OBIT_FFT_Forward) {
+      memcpy (fplane->array, idata, nIn*sizeof(ofloat));
+      ObitFFTR2C (in, fplane, cplane);
+      memcpy (odata, cplane->array, nOut*sizeof(ofloat));
+    } else {
+      memcpy (cplane->array, idata, nIn*sizeof(ofloat));
+      ObitFFTC2R (in, cplane, fplane);
+      memcpy (odata, fplane->array, nOut*sizeof(ofloat));
+    }
+    idata += nIn;
+    odata += nOut;
+  } /* end loop over planes */
+  cplane  = ObitCArrayUnref(cplane);
+  cplane2 = ObitCArrayUnref(cplane2);
+  fplane  = ObitFArrayUnref(fplane);
+#endif /* HAVE_FFTW3 */
+} /* end FFTBatch */
+
+/**
+ * Zero the part of a 2D output plane (in FFT order) outside of the region
+ * within nKeepX columns and nKeepY rows of the origin.
+ * \param odata  Output plane
+ * \param nx     Number of columns
+ * \param ny     Number of rows
+ * \param nKeepX Half width in columns of the region kept
+ * \param nKeepY Half width in rows of the region kept
+ */
+static void FFTPruneTrim (ofloat *odata, olong nx, olong ny, 
+			  olong nKeepX, olong nKeepY)
+{
+  olong iy, dy;
+  ofloat *row;
+
+  for (iy=0; iy<ny; iy++) {
+    row = odata + iy*nx;
+    dy = MIN (iy, ny-iy);
+    if (dy>nKeepY) 
+      memset (row, 0, nx*sizeof(ofloat));
+    else if ((nKeepX+1)<(nx-nKeepX)) 
+      memset (&row[nKeepX+1], 0, (nx-2*nKeepX-1)*sizeof(ofloat));
+  }
+} /* end FFTPruneTrim */
+
+#if HAVE_FFTW3==1
+/**
+ * Half complex to real transforms of a range of separate planes
+ * using the single threaded plan.
+ * Callable as thread
+ * \param arg Pointer to FFTFuncArg argument with elements:
+ * \li in        ObitFFT with PPlan
+ * \li inArrays  Input planes
+ * \li outArrays Output planes
+ * \li first     First (1-rel) plane
+ * \li last      Highest (1-rel) plane
+ * \li ithread   thread number, <0 -> no threading
+ * \return NULL
+ */
+static gpointer ThreadFFTC2RPlanes (gpointer arg)
+{
+  /* Get arguments from structure */
+  FFTFuncArg *largs = (FFTFuncArg*)arg;
+  ObitFFT    *in    = largs->in;
+  olong      lo     = largs->first-1;
+  olong      hi     = largs->last;
+  olong j;
+
+  for (j=lo; j<hi; j++) 
+    fftwf_execute_dft_c2r (in->PPlan, (fftwf_complex*)largs->inArrays[j]->array, 
+			   (float*)largs->outArrays[j]->array);
+
+  /* Indicate completion */
+  if (largs->ithread>=0)
+    ObitThreadPoolDone (largs->thread, (gpointer)&largs->ithread);
+  
+  return NULL;
+} /* end ThreadFFTC2RPlanes */
+#endif /* HAVE_FFTW3 */
+
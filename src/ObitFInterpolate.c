@@ -540,6 +540,85 @@ ofloat ObitFInterpolatePixel (ObitFInterpolate *in, ofloat *pixel, ObitErr *err)
   return value;
 } /* end ObitFInterpolatePixel */
 
+/**
+ * Interpolate values at a row of pixels in the first plane of an array.
+ * Gives the same values as ObitFInterpolatePixel on each pixel but the 
+ * per call checks are hoisted out of the loop and the separable kernal
+ * is applied as a short contiguous dot product per kernal row.
+ * Intended for filling a row of an output image at once.
+ * \param in    The object to interpolate
+ * \param n     Number of pixels
+ * \param xPix  "X" pixel locations (1-rel)
+ * \param yPix  "Y" pixel locations (1-rel)
+ * \param out   [out] Interpolated values, magic blanked if invalid
+ */
+void ObitFInterpolateRow (ObitFInterpolate *in, olong n, ofloat *xPix, ofloat *yPix,
+			  ofloat *out)
+{
+  ofloat fblank =  ObitMagicF();
+  ofloat sum, sumwt, rsum, rwt, xmax, ymax;
+  ofloat *xKernal, *yKernal, *data, *drow;
+  olong i, j, k, iwid, nx, ixpix, iypix;
+  ollong indx;
+
+  /* Local versions of things */
+  xKernal = in->xKernal;
+  yKernal = in->yKernal;
+  data    = in->array;
+  nx      = in->nx;
+  iwid    = 1 + 2 * in->hwidth;
+  xmax    = (ofloat)in->nx;
+  ymax    = (ofloat)in->ny;
+
+  for (k=0; k<n; k++) {
+    /* Must be inside array */
+    if ((xPix[k]<1.0) || (xPix[k]>xmax) || (yPix[k]<1.0) || (yPix[k]>ymax)) {
+      out[k] = fblank;
+      continue;
+    }
+
+    /* If exactly (within 0.01 pixel) on a pixel no need to interpolate */
+    ixpix = (olong)(xPix[k]+0.5);
+    iypix = (olong)(yPix[k]+0.5);
+    if ((fabs(xPix[k]-ixpix)<0.01) && (fabs(yPix[k]-iypix)<0.01)) {
+      indx = (ixpix-1) + ((ollong)(iypix-1))*nx;
+      out[k] = data[indx];
+      continue;
+    }
+
+    /* Update convolving x, y kernals as needed */
+    if (xPix[k] != in->xPixel) {
+      in->xPixel = xPix[k];
+      SetConvKernal (in->xPixel, in->nx, in->hwidth, in->denom, &in->xStart, in->xKernal);
+    }
+    if (yPix[k] != in->yPixel) {
+      in->yPixel = yPix[k];
+      SetConvKernal (in->yPixel, in->ny, in->hwidth, in->denom, &in->yStart, in->yKernal);
+    }
+
+    /* Sum rows of data times "X" kernal then weight by "Y" kernal */
+    sum   = 0.0;
+    sumwt = 0.0;
+    for (j=0; j<iwid; j++) {
+      drow = data + in->xStart + ((ollong)(in->yStart + j)) * nx;
+      rsum = 0.0;
+      rwt  = 0.0;
+      for (i=0; i<iwid; i++) {
+	if (drow[i] != fblank) {
+	  rsum += drow[i] * xKernal[i];
+	  rwt  += xKernal[i];
+	}
+      }
+      sum   += rsum * yKernal[j];
+      sumwt += rwt  * yKernal[j];
+    }
+
+    /* normalize sum if not excessive blanking */
+    if (sumwt > 0.90) out[k] = sum / sumwt;
+    else              out[k] = fblank;
+  } /* end loop over pixels */
+} /* end ObitFInterpolateRow */
+
 /**
  * Interpolate value at requested pixel in 1-D array.
  * \param in    The object to interpolate
@@ -433,6 +433,7 @@ void ObitFeatherUtilAccumImage (ObitFFT *FFTfor, ObitImage *inImage,
 				ObitCArray *workArray, ObitErr *err)
 {
   ofloat beamMaj, beamMin, *cdelt, factor;
+  ObitCArrayExpr *expr=NULL;
   gchar *routine = "ObitFeatherUtilAccumImage";
 
   /* Checks */
@@ -461,9 +462,6 @@ void ObitFeatherUtilAccumImage (ObitFFT *FFTfor, ObitImage *inImage,
 
   inImage->image = ObitFArrayUnref(inImage->image); /* release array */
 
-  /* Multiply by weights */
-  ObitCArrayFMul(workArray, wtArray, workArray);
-
   /* Scale by inverse of beam area to get units the same */
   /* Get image info from descriptor */
   /* Python version multiplies beam? by 3600.0 */
@@ -471,10 +469,14 @@ void ObitFeatherUtilAccumImage (ObitFFT *FFTfor, ObitImage *inImage,
   beamMin = inImage->myDesc->beamMin;
   cdelt   = &inImage->myDesc->cdelt[0];
   factor = (fabs(cdelt[1])/beamMaj) * (fabs(cdelt[1])/beamMin);
-  ObitCArraySMul(workArray, factor);
 
-  /* Accumulate */
-  ObitCArrayAdd(accArray, workArray, accArray);
+  /* Multiply by weights, scale and accumulate in one pass */
+  expr = ObitCArrayExprCreate (workArray);
+  ObitCArrayExprFArr (expr, OBIT_CAExpr_FMul, wtArray);
+  ObitCArrayExprScalar (expr, OBIT_CAExpr_SMul, factor, 0.0);
+  ObitCArrayExprCArr (expr, OBIT_CAExpr_Add, accArray);
+  ObitCArrayExprRun (expr, accArray);
+  expr = ObitCArrayExprFree (expr);
 
 } /* end ObitFeatherUtilAccumImage */
 
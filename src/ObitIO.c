@@ -52,6 +52,28 @@ static ObitGetClassFP ObitParentGetClass = ObitGetClass;
  */
 static ObitIOClassInfo myClassInfo = {FALSE};
 
+/**
+ * I/O buffer in pool
+ */
+typedef struct {
+  /** Buffer */
+  ofloat *data;
+  /** Size in floats */
+  ollong size;
+} ObitIOPoolBuf;
+
+/** Lock for buffer pool */
+static GMutex poolLock;
+
+/** Buffers in use, ObitIOPoolBuf keyed by data */
+static GHashTable *poolOut = NULL;
+
+/** Free buffers, most recently released first */
+static GSList *poolFree = NULL;
+
+/** Total size (floats) of free buffers, held against the ObitMem cache limit */
+static ollong poolFreeSize = 0;
+
 /*---------------Private function prototypes----------------*/
 /** Private: Initialize newly instantiated object. */
 void  ObitIOInit  (gpointer in);
@@ -62,6 +84,12 @@ void  ObitIOClear (gpointer in);
 /** Private: Set Class function pointers. */
 static void ObitIOClassInfoDefFn (gpointer inClass);
 
+/** Private: Remove excess buffers from pool */
+static GSList* ObitIOPoolExcess (ollong maxSize);
+
+/** Private: Deallocate buffers removed from pool */
+static void ObitIOPoolDrop (GSList *drop);
+
 /*----------------------Public functions---------------------------*/
 /**
  * Basic Constructor.
@@ -770,17 +798,172 @@ void ObitIOCreateBuffer (ofloat **data, ollong *size, ObitIO *in,
 
 /**
  * Destroy buffer
+ * Buffers obtained from ObitIOGetBuffer are returned to the pool for
+ * reuse by later opens, others are deallocated.
+ * Free buffers in the pool count against the ObitMem cache limit
+ * (ObitMemSetCache) shared with freed large ObitMem blocks; the least
+ * recently released buffers are deallocated to make room.
  * \param buffer Pointer to buffer to destroy.
  */
 void ObitIOFreeBuffer (ofloat *buffer)
 {
+  ObitIOPoolBuf *buf=NULL;
+  GSList *drop=NULL;
+  gboolean held;
+
   /* error checks */
   if (buffer==NULL) return;
 
-  ObitMemFree (buffer);
+  g_mutex_lock (&poolLock);
+  if (poolOut) buf = g_hash_table_lookup (poolOut, buffer);
+  if (buf) g_hash_table_remove (poolOut, buffer);
+  g_mutex_unlock (&poolLock);
+
+  /* Not from pool */
+  if (buf==NULL) {
+    ObitMemFree (buffer);
+    return;
+  }
+
+  /* Keep if it fits in the cache limit, dropping older buffers if needed */
+  held = ObitMemCacheHold (buf->size*sizeof(ofloat));
+  while (!held) {
+    g_mutex_lock (&poolLock);
+    if (poolFree) drop = ObitIOPoolExcess (poolFreeSize-1); /* oldest */
+    g_mutex_unlock (&poolLock);
+    if (drop==NULL) break;
+    ObitIOPoolDrop (drop);
+    drop = NULL;
+    held = ObitMemCacheHold (buf->size*sizeof(ofloat));
+  }
+
+  if (held) {
+    g_mutex_lock (&poolLock);
+    poolFree = g_slist_prepend (poolFree, buf);
+    poolFreeSize += buf->size;
+    g_mutex_unlock (&poolLock);
+  } else {  /* Too big */
+    ObitMemFree (buf->data);
+    g_free(buf);
+  }
 
 } /* end ObitIOFreeBuffer */
 
+/**
+ * Get I/O buffer of at least a given size from the pool.
+ * The smallest free buffer in the pool large enough and not more 
+ * than twice the size is used, else a new one allocated.
+ * Buffers are returned to the pool by ObitIOFreeBuffer.
+ * Used by the ObitIOCreateBuffer implementations in place of
+ * ObitMemRealloc/ObitMemAlloc0Name: an existing buffer keeps its 
+ * contents and a new one is zero filled.  A buffer reused from the 
+ * pool is only zeroed if requested; reads overwrite it.
+ * \param data  Current buffer, if any; kept if large enough
+ *              else reallocated, contents are preserved.
+ * \param size  Minimum size in floats
+ * \param name  Name for memory allocation
+ * \param zero  If TRUE zero fill a buffer reused from the pool,
+ *              needed for write access where a writer may leave 
+ *              parts of the buffer unfilled.
+ * \return buffer
+ */
+ofloat* ObitIOGetBuffer (ofloat *data, ollong size, const gchar *name,
+			 gboolean zero)
+{
+  ObitIOPoolBuf *buf=NULL, *best=NULL;
+  GSList *tmp;
+
+  if (size<=0) size = 1;
+
+  g_mutex_lock (&poolLock);
+  if (poolOut==NULL) poolOut = g_hash_table_new (NULL, NULL);
+
+  /* Existing buffer - keep if big enough, else reallocate as before */
+  if (data) {
+    buf = g_hash_table_lookup (poolOut, data);
+    if (buf && (buf->size>=size)) {
+      g_mutex_unlock (&poolLock);
+      return buf->data;
+    }
+    if (buf) g_hash_table_remove (poolOut, data);
+    g_mutex_unlock (&poolLock);
+
+    if (buf==NULL) buf = g_malloc0(sizeof(ObitIOPoolBuf));
+    buf->size = size;
+    buf->data = ObitMemRealloc (data, size*sizeof(ofloat));
+    g_mutex_lock (&poolLock);
+    g_hash_table_insert (poolOut, buf->data, buf);
+    g_mutex_unlock (&poolLock);
+    return buf->data;
+  }
+
+  /* Look for best fit in pool */
+  for (tmp=poolFree; tmp!=NULL; tmp=g_slist_next(tmp)) {
+    buf = (ObitIOPoolBuf*)tmp->data;
+    if ((buf->size<size) || (buf->size>2*size)) continue;
+    if ((best==NULL) || (buf->size<best->size)) best = buf;
+    if (best->size==size) break;  /* Can't do better */
+  }
+  if (best) {
+    poolFree = g_slist_remove (poolFree, best);
+    poolFreeSize -= best->size;
+    g_hash_table_insert (poolOut, best->data, best);
+  }
+  g_mutex_unlock (&poolLock);
+
+  /* Reuse, no longer held idle; zero fill only if asked */
+  if (best) {
+    ObitMemCacheRelease (best->size*sizeof(ofloat));
+    if (zero) memset (best->data, 0, size*sizeof(ofloat));
+    return best->data;
+  }
+
+  /* Need new one */
+  best = g_malloc0(sizeof(ObitIOPoolBuf));
+  best->size = size;
+  best->data = ObitMemAlloc0Name(size*sizeof(ofloat), name);
+  g_mutex_lock (&poolLock);
+  g_hash_table_insert (poolOut, best->data, best);
+  g_mutex_unlock (&poolLock);
+
+  return best->data;
+} /* end ObitIOGetBuffer */
+
+/**
+ * Set maximum total size of free memory kept for reuse.
+ * This is the ObitMem cache limit (ObitMemSetCache), shared by the
+ * pool and freed large ObitMem blocks; pooled buffers beyond it are
+ * deallocated.
+ * \param maxMByte  Maximum size in MByte, 0 => no pooling
+ */
+void ObitIOSetBufferPool (olong maxMByte)
+{
+  GSList *drop=NULL;
+
+  ObitMemSetCache (maxMByte);
+
+  g_mutex_lock (&poolLock);
+  drop = ObitIOPoolExcess (MAX (0, maxMByte) * (ollong)(1024*1024/sizeof(ofloat)));
+  g_mutex_unlock (&poolLock);
+
+  ObitIOPoolDrop (drop);
+} /* end ObitIOSetBufferPool */
+
+/**
+ * Deallocate all free buffers held in the pool.
+ * Buffers currently in use are unaffected.
+ */
+void ObitIOTrimBufferPool (void)
+{
+  GSList *drop=NULL;
+
+  g_mutex_lock (&poolLock);
+  drop = ObitIOPoolExcess (0);
+  g_mutex_unlock (&poolLock);
+
+  ObitIOPoolDrop (drop);
+} /* end ObitIOTrimBufferPool */
+
 /**
  * Return a ObitTable Object to a specified table associated with
  * the input ObitIO.  
@@ -1152,4 +1335,43 @@ void ObitIOClear (gpointer inn)
 
 } /* end ObitIOClear */
 
+/**
+ * Remove least recently released buffers from the pool until the total
+ * size is within a limit.  Must be called with poolLock held.
+ * \param maxSize  Maximum total size (floats) to keep
+ * \return list of ObitIOPoolBuf removed, to be deallocated by caller
+ */
+static GSList* ObitIOPoolExcess (ollong maxSize)
+{
+  ObitIOPoolBuf *buf;
+  GSList *drop=NULL, *last;
+
+  while (poolFree && (poolFreeSize>maxSize)) {
+    last = g_slist_last (poolFree);
+    buf  = (ObitIOPoolBuf*)last->data;
+    poolFree = g_slist_delete_link (poolFree, last);
+    poolFreeSize -= buf->size;
+    drop = g_slist_prepend (drop, buf);
+  }
+  return drop;
+} /* end ObitIOPoolExcess */
 
+/**
+ * Deallocate buffers removed from the pool by ObitIOPoolExcess and
+ * return their hold on the ObitMem cache limit.
+ * Must be called without poolLock held.
+ * \param drop  list of ObitIOPoolBuf, freed
+ */
+static void ObitIOPoolDrop (GSList *drop)
+{
+  ObitIOPoolBuf *buf;
+  GSList *tmp;
+
+  for (tmp=drop; tmp!=NULL; tmp=g_slist_next(tmp)) {
+    buf = (ObitIOPoolBuf*)tmp->data;
+    ObitMemCacheRelease (buf->size*sizeof(ofloat));
+    ObitMemFree (buf->data);
+    g_free(buf);
+  }
+  g_slist_free (drop);
+} /* end ObitIOPoolDrop */
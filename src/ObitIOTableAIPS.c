@@ -1385,9 +1385,9 @@ ObitIOTableAIPSCreateBuffer (ofloat **data, olong *size,
   /* get size */
   *size = ObitTableSelBufferSize(in->myDesc, in->mySel);
 
-  /* (re)allocate */
-  if (*data) *data = ObitMemRealloc (*data, (*size)*sizeof(ofloat));
-  else *data = ObitMemAlloc0Name((*size)*sizeof(ofloat), "TableBuffer");
+  /* (re)allocate from pool, reused buffers only zeroed for write */
+  *data = ObitIOGetBuffer (*data, *size, "TableBuffer",
+			   ((in->access!=OBIT_IO_ReadOnly) && (in->access!=OBIT_IO_ReadCal)));
 
 } /* end ObitIOTableAIPSCreateBuffer */
 
@@ -64,14 +64,24 @@ static gboolean ObitIOUVAIPSNext (ObitIOUVAIPS *in, ObitErr *err);
 
 /** Private: Compress visibilities. */
 static void 
-ObitIOUVAIPSCompress (olong ncorr, const ofloat *visin, ofloat *wtscl, 
-		      ofloat *visout);
+ObitIOUVAIPSCompress (olong ncorr, olong ncomp, const ofloat *visin, 
+		      ofloat *wtscl, ofloat *visout);
 
 /** Private: Uncompress visibilities. */
 static void 
-ObitIOUVAIPSUncompress (olong ncorr, const ofloat *visin, 
+ObitIOUVAIPSUncompress (olong ncorr, olong ncomp, const ofloat *visin, 
 			const ofloat *wtscl, ofloat *visout);
 
+/** Private: Compress visibilities keeping weights. */
+static void 
+ObitIOUVAIPSCompressWt (olong ncorr, const ofloat *visin, ofloat *wtscl, 
+			ofloat *visout);
+
+/** Private: Uncompress visibilities with weights. */
+static void 
+ObitIOUVAIPSUncompressWt (olong ncorr, const ofloat *visin, 
+			  const ofloat *wtscl, ofloat *visout);
+
 /** Private: Set Class function pointers. */
 static void ObitIOUVAIPSClassInfoDefFn (gpointer inClass);
 
@@ -629,7 +639,7 @@ ObitIOCode ObitIOUVAIPSRead (ObitIOUVAIPS *in, ofloat *data,
       
       /* uncompress data */
       wtscl = &IOBuff[ip+desc->ilocws]; /* weight and scale array */
-      ObitIOUVAIPSUncompress (desc->ncorr, &IOBuff[ip+desc->nrparm], 
+      ObitIOUVAIPSUncompress (desc->ncorr, desc->inaxes[0], &IOBuff[ip+desc->nrparm], 
 			      wtscl, &data[op+sel->nrparmUC]);
       ip += desc->lrec;   /* index in i/O array */
       op += sel->lrecUC;  /* index in output array */
@@ -756,7 +766,7 @@ ObitIOCode ObitIOUVAIPSReadSelect (ObitIOUVAIPS *in, ofloat *data,
       
       /* uncompress data */
       wtscl = &IOBuff[ip+desc->ilocws]; /* weight and scale array */
-      ObitIOUVAIPSUncompress (desc->ncorr, &IOBuff[ip+desc->nrparm], 
+      ObitIOUVAIPSUncompress (desc->ncorr, desc->inaxes[0], &IOBuff[ip+desc->nrparm], 
 			      wtscl, &in->decompVis[sel->nrparmUC]);
       workVis = in->decompVis; /* working visibility pointer */
 
@@ -882,7 +892,7 @@ ObitIOUVAIPSReadMulti (olong nBuff, ObitIOUVAIPS **in, ofloat **data,
       
       /* uncompress data */
       wtscl = &IOBuff[ip+desc->ilocws]; /* weight and scale array */
-      ObitIOUVAIPSUncompress (desc->ncorr, &IOBuff[ip+desc->nrparm], 
+      ObitIOUVAIPSUncompress (desc->ncorr, desc->inaxes[0], &IOBuff[ip+desc->nrparm], 
 			      wtscl, &data[0][op+sel->nrparmUC]);
       ip += desc->lrec;   /* index in i/O array */
       op += sel->lrecUC;  /* index in output array */
@@ -1081,7 +1091,7 @@ ObitIOUVAIPSReadMultiSelect (olong nBuff, ObitIOUVAIPS **in, ofloat **data,
 	
 	/* uncompress data */
 	wtscl = &IOBuff[ip+desc->ilocws]; /* weight and scale array */
-	ObitIOUVAIPSUncompress (desc->ncorr, &IOBuff[ip+desc->nrparm], 
+	ObitIOUVAIPSUncompress (desc->ncorr, desc->inaxes[0], &IOBuff[ip+desc->nrparm], 
 				wtscl, &in[0]->decompVis[sel->nrparmUC]);
 	workVis = in[0]->decompVis; /* working visibility pointer */
 	
@@ -1197,7 +1207,7 @@ ObitIOUVAIPSReReadMultiSelect (olong nBuff, ObitIOUVAIPS **in, ofloat **data,
 	  
 	  /* uncompress data */
 	  wtscl = &IOBuff[ip+desc->ilocws]; /* weight and scale array */
-	  ObitIOUVAIPSUncompress (desc->ncorr, &IOBuff[ip+desc->nrparm], 
+	  ObitIOUVAIPSUncompress (desc->ncorr, desc->inaxes[0], &IOBuff[ip+desc->nrparm], 
 				  wtscl, &in[0]->decompVis[sel->nrparmUC]);
 	  workVis = in[0]->decompVis; /* working visibility pointer */
 	  
@@ -1310,7 +1320,7 @@ ObitIOCode ObitIOUVAIPSWrite (ObitIOUVAIPS *in, ofloat *data,
       
       /* compress data */
       wtscl = &IOBuff[ip+desc->ilocws]; /* weight and scale array */
-      ObitIOUVAIPSCompress (desc->ncorr, &data[op+sel->nrparmUC], 
+      ObitIOUVAIPSCompress (desc->ncorr, desc->inaxes[0], &data[op+sel->nrparmUC], 
 			    wtscl, &IOBuff[ip+desc->nrparm]);
       ip += desc->lrec;   /* index in i/O array (compressed) */
       op += sel->lrecUC;  /* index in input array */
@@ -1725,10 +1735,10 @@ ObitIOUVAIPSCreateBuffer (ofloat **data, ollong *size,
   /* Add a bit for saftey 
   *size += 128;*/
 
-  /* (re)allocate */
+  /* (re)allocate from pool, reused buffers only zeroed for write */
   name =  g_strconcat ("UVBuffer:", in->name, NULL);
-  if (*data) *data = ObitMemRealloc (*data, (*size)*sizeof(ofloat));
-  else *data = ObitMemAlloc0Name((*size)*sizeof(ofloat), name);
+  *data = ObitIOGetBuffer (*data, *size, name,
+			   ((in->access!=OBIT_IO_ReadOnly) && (in->access!=OBIT_IO_ReadCal)));
   g_free(name);
 
 } /* end ObitIOUVAIPSCreateBuffer */
@@ -2244,13 +2254,15 @@ static gboolean ObitIOUVAIPSNext (ObitIOUVAIPS *in, ObitErr *err)
  * random parameters and the real and imaginary parts as scaled shorts.
  * If the first short of a pair is -32767 the value is considered invalid.
  * \param  ncorr  Number of weighted complex numbers
+ * \param  ncomp  Number of values per correlation in the compressed form,
+ *                3 => real, imaginary, weight (see ObitIOUVAIPSCompressWt)
  * \param  visin  Expanded visibility array
  * \param  wtscl  (out) Weight and Scale needed to uncompress.
  * \param  visout (out) Compressed visibility array.
  */
 static void 
-ObitIOUVAIPSCompress (olong ncorr, const ofloat *visin, ofloat *wtscl, 
-		      ofloat *visout)
+ObitIOUVAIPSCompress (olong ncorr, olong ncomp, const ofloat *visin, 
+		      ofloat *wtscl, ofloat *visout)
 {
   olong i;
   ofloat maxwt, maxvis, scl;
@@ -2262,6 +2274,12 @@ ObitIOUVAIPSCompress (olong ncorr, const ofloat *visin, ofloat *wtscl,
   g_assert (wtscl != NULL);
   g_assert (visout != NULL);
 
+  /* Keeping weights? */
+  if (ncomp==3) {
+    ObitIOUVAIPSCompressWt (ncorr, visin, wtscl, visout);
+    return;
+  }
+
   /* find maximum weight and visibility component */
   maxwt = maxvis = 0.0;
   for (i=0; i<ncorr; i++) {
@@ -2303,12 +2321,14 @@ ObitIOUVAIPSCompress (olong ncorr, const ofloat *visin, ofloat *wtscl,
  * random parameters and the real and imaginary parts as scaled shorts.
  * If the first short of a pair is -32767 the value is considered invalid.
  * \param  ncorr  Number of weighted complex numbers
+ * \param  ncomp  Number of values per correlation in the compressed form,
+ *                3 => real, imaginary, weight (see ObitIOUVAIPSCompressWt)
  * \param  visin  Compressed visibility array.
  * \param  wtscl  Weight and Scale needed to uncompress.
  * \param  visout (out) Expanded visibility array.
  */
 static void 
-ObitIOUVAIPSUncompress (olong ncorr, const ofloat *visin, 
+ObitIOUVAIPSUncompress (olong ncorr, olong ncomp, const ofloat *visin, 
 			const ofloat *wtscl, ofloat *visout)
 {
   olong i;
@@ -2321,6 +2341,12 @@ ObitIOUVAIPSUncompress (olong ncorr, const ofloat *visin,
   g_assert (wtscl != NULL);
   g_assert (visout != NULL);
 
+  /* With weights? */
+  if (ncomp==3) {
+    ObitIOUVAIPSUncompressWt (ncorr, visin, wtscl, visout);
+    return;
+  }
+
   /* weighting and scaling */
   wt  = wtscl[0];
   scl = wtscl[1];
@@ -2340,6 +2366,89 @@ ObitIOUVAIPSUncompress (olong ncorr, const ofloat *visin,
   }
 } /* end ObitIOUVAIPSUncompress */
 
+/**
+ * Compresses UV into scaled shorts keeping a weight per correlation.
+ * The real, imaginary and weight of each correlation are stored as 
+ * shorts scaled by the largest valid component and largest weight 
+ * magnitude, these scalings are stored as the WEIGHT and VISSCALE 
+ * random parameters.
+ * Flagged (weight<=0) correlations keep the sign of their weight 
+ * and have zero amplitude.
+ * \param  ncorr  Number of weighted complex numbers
+ * \param  visin  Expanded visibility array
+ * \param  wtscl  (out) Weight scale and visibility scale.
+ * \param  visout (out) Compressed visibility array, 3*ncorr shorts.
+ */
+static void 
+ObitIOUVAIPSCompressWt (olong ncorr, const ofloat *visin, ofloat *wtscl, 
+			ofloat *visout)
+{
+  olong i;
+  ofloat maxwt, maxvis, scl, wscl, val;
+  gshort *packed = (gshort*)visout;
+
+  /* find maximum weight and visibility component */
+  maxwt = maxvis = 0.0;
+  for (i=0; i<ncorr; i++) {
+    if (visin[i*3+2] > 0.0) { /* Valid? */
+      maxvis = MAX (maxvis, fabs(visin[i*3]));
+      maxvis = MAX (maxvis, fabs(visin[i*3+1]));
+    }
+    maxwt  = MAX (maxwt, fabs(visin[i*3+2]));
+  }
+
+  /* output weighting and scaling */
+  wtscl[0] = maxwt / 32760.;
+  wtscl[1] = maxvis / 32760.;
+  scl = wscl = 0.0;
+  if (wtscl[0] > 1.0e-20) wscl = 1.0 / wtscl[0];
+  if (wtscl[1] > 1.0e-20) scl  = 1.0 / wtscl[1];
+
+  /* loop over visibilities packing them in. */
+  for (i=0; i<ncorr; i++) { 
+    if (visin[i*3+2] > 0.0) { /* OK - round values */
+      val = scl*visin[i*3];
+      packed[i*3]   = (gshort)(val + ((val>0.0) ? 0.5 : -0.5));
+      val = scl*visin[i*3+1];
+      packed[i*3+1] = (gshort)(val + ((val>0.0) ? 0.5 : -0.5));
+      val = wscl*visin[i*3+2];
+      packed[i*3+2] = (gshort)MAX (1, val + 0.5);
+    } else { /* flagged - keep sign of weight */
+      packed[i*3]   = 0;
+      packed[i*3+1] = 0;
+      val = wscl*visin[i*3+2];
+      packed[i*3+2] = (gshort)MIN (0, val - 0.5);
+      if ((visin[i*3+2]<0.0) && (packed[i*3+2]==0)) packed[i*3+2] = -1;
+    }
+  }
+} /* end ObitIOUVAIPSCompressWt */
+
+/**
+ * Uncompresses UV from scaled shorts with a weight per correlation.
+ * \param  ncorr  Number of weighted complex numbers
+ * \param  visin  Compressed visibility array, 3*ncorr shorts.
+ * \param  wtscl  Weight scale and visibility scale.
+ * \param  visout (out) Expanded visibility array.
+ */
+static void 
+ObitIOUVAIPSUncompressWt (olong ncorr, const ofloat *visin, 
+			  const ofloat *wtscl, ofloat *visout)
+{
+  olong i;
+  ofloat wscl, scl;
+  gshort *packed = (gshort*)visin;
+
+  wscl = wtscl[0];
+  scl  = wtscl[1];
+
+  /* loop over visibilities */
+  for (i=0; i<ncorr; i++) { 
+    visout[i*3]   = scl  * packed[i*3];
+    visout[i*3+1] = scl  * packed[i*3+1];
+    visout[i*3+2] = wscl * packed[i*3+2];
+  }
+} /* end ObitIOUVAIPSUncompressWt */
+
 /**
  * Check validity of object
  * \param in  ObitIO for test
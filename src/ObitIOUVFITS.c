@@ -80,14 +80,24 @@ static gboolean ObitIOUVFITSNext (ObitIOUVFITS *in, ObitErr *err);
 
 /** Private: Compress visibilities. */
 static void 
-ObitIOUVFITSCompress (olong ncorr, const ofloat *visin, ofloat *wtscl, 
-		      ofloat *visout);
+ObitIOUVFITSCompress (olong ncorr, olong ncomp, const ofloat *visin, 
+		      ofloat *wtscl, ofloat *visout);
 
 /** Private: Uncompress visibilities. */
 static void 
-ObitIOUVFITSUncompress (olong ncorr, const ofloat *visin, 
+ObitIOUVFITSUncompress (olong ncorr, olong ncomp, const ofloat *visin, 
 			const ofloat *wtscl, ofloat *visout);
 
+/** Private: Compress visibilities keeping weights. */
+static void 
+ObitIOUVFITSCompressWt (olong ncorr, const ofloat *visin, ofloat *wtscl, 
+			ofloat *visout);
+
+/** Private: Uncompress visibilities with weights. */
+static void 
+ObitIOUVFITSUncompressWt (olong ncorr, const ofloat *visin, 
+			  const ofloat *wtscl, ofloat *visout);
+
 /** Private: Copy Floats with byte swap to FITS order */
 static void ObitIOUVFITSfH2F (olong n, ofloat *in, ofloat *out);
 
@@ -697,10 +707,10 @@ ObitIOCode ObitIOUVFITSRead (ObitIOUVFITS *in, ofloat *data,
 
       /* uncompress/byte swap data */
       ObitIOUVFITSfF2H (2, &IOBuff[ip+desc->ilocws], wtscl);
-      ObitIOUVFITSsF2H (2*desc->ncorr, 
+      ObitIOUVFITSsF2H (((desc->inaxes[0]==3) ? 3 : 2)*desc->ncorr, 
 			(gshort*)&IOBuff[ip+desc->nrparm],
 			(gshort*)&IOBuff[ip+desc->nrparm]);
-      ObitIOUVFITSUncompress (desc->ncorr, &IOBuff[ip+desc->nrparm], 
+      ObitIOUVFITSUncompress (desc->ncorr, desc->inaxes[0], &IOBuff[ip+desc->nrparm], 
 			      wtscl, &data[op+sel->nrparmUC]);
       ip += desc->lrec;   /* index in i/O array */
       op += sel->lrecUC;  /* index in output array */
@@ -843,7 +853,7 @@ ObitIOCode ObitIOUVFITSReadSelect (ObitIOUVFITS *in, ofloat *data,
       ObitIOUVFITSfF2H (desc->nrparm, &IOBuff[ip], &IOBuff[ip]);
       /* Visibility array */
       if (compressed ) {
-	ObitIOUVFITSsF2H (2*desc->ncorr, 
+	ObitIOUVFITSsF2H (((desc->inaxes[0]==3) ? 3 : 2)*desc->ncorr, 
 			  (gshort*)&IOBuff[ip+desc->nrparm],
 			  (gshort*)&IOBuff[ip+desc->nrparm]);
       } else { /* uncompressed */
@@ -858,7 +868,7 @@ ObitIOCode ObitIOUVFITSReadSelect (ObitIOUVFITS *in, ofloat *data,
       
       /* uncompress data */
       wtscl = &IOBuff[ip+desc->ilocws]; /* weight and scale array */
-      ObitIOUVFITSUncompress (desc->ncorr, &IOBuff[ip+desc->nrparm], 
+      ObitIOUVFITSUncompress (desc->ncorr, desc->inaxes[0], &IOBuff[ip+desc->nrparm], 
 			      wtscl, &in->decompVis[sel->nrparmUC]);
       workVis = in->decompVis; /* working visibility pointer */
 
@@ -983,10 +993,10 @@ ObitIOCode ObitIOUVFITSReadMulti (olong nBuff, ObitIOUVFITS **in, ofloat **data,
       
       /* uncompress/byte swap data */
       ObitIOUVFITSfF2H (2, &IOBuff[ip+desc->ilocws], wtscl);
-      ObitIOUVFITSsF2H (2*desc->ncorr, 
+      ObitIOUVFITSsF2H (((desc->inaxes[0]==3) ? 3 : 2)*desc->ncorr, 
 			(gshort*)&IOBuff[ip+desc->nrparm],
 			(gshort*)&IOBuff[ip+desc->nrparm]);
-      ObitIOUVFITSUncompress (desc->ncorr, &IOBuff[ip+desc->nrparm], 
+      ObitIOUVFITSUncompress (desc->ncorr, desc->inaxes[0], &IOBuff[ip+desc->nrparm], 
 			      wtscl, &data[0][op+sel->nrparmUC]);
       ip += desc->lrec;   /* index in i/O array */
       op += sel->lrecUC;  /* index in output array */
@@ -1198,7 +1208,7 @@ ObitIOCode ObitIOUVFITSReadMultiSelect (olong nBuff, ObitIOUVFITS **in, ofloat *
       ObitIOUVFITSfF2H (desc->nrparm, &IOBuff[ip], &IOBuff[ip]);
       /* Visibility array */
       if (compressed ) {
-	ObitIOUVFITSsF2H (2*desc->ncorr, 
+	ObitIOUVFITSsF2H (((desc->inaxes[0]==3) ? 3 : 2)*desc->ncorr, 
 			  (gshort*)&IOBuff[ip+desc->nrparm],
 			  (gshort*)&IOBuff[ip+desc->nrparm]);
       } else { /* uncompressed */
@@ -1216,7 +1226,7 @@ ObitIOCode ObitIOUVFITSReadMultiSelect (olong nBuff, ObitIOUVFITS **in, ofloat *
 	
 	/* uncompress data */
 	wtscl = &IOBuff[ip+desc->ilocws]; /* weight and scale array */
-	ObitIOUVFITSUncompress (desc->ncorr, &IOBuff[ip+desc->nrparm], 
+	ObitIOUVFITSUncompress (desc->ncorr, desc->inaxes[0], &IOBuff[ip+desc->nrparm], 
 				wtscl, &in[0]->decompVis[sel->nrparmUC]);
 	workVis = in[0]->decompVis; /* working visibility pointer */
 	
@@ -1330,7 +1340,7 @@ ObitIOCode ObitIOUVFITSReReadMultiSelect (olong nBuff, ObitIOUVFITS **in, ofloat
 	  
 	  /* uncompress data */
 	  wtscl = &IOBuff[ip+desc->ilocws]; /* weight and scale array */
-	  ObitIOUVFITSUncompress (desc->ncorr, &IOBuff[ip+desc->nrparm], 
+	  ObitIOUVFITSUncompress (desc->ncorr, desc->inaxes[0], &IOBuff[ip+desc->nrparm], 
 				  wtscl, &in[0]->decompVis[sel->nrparmUC]);
 	  workVis = in[0]->decompVis; /* working visibility pointer */
 	  
@@ -1438,7 +1448,7 @@ ObitIOCode ObitIOUVFITSWrite (ObitIOUVFITS *in, ofloat *data,
      
       /* compress/byteswap data */
       wtscl = &IOBuff[ip+desc->ilocws]; /* weight and scale array */
-      ObitIOUVFITSCompress (desc->ncorr, &data[op+sel->nrparmUC], 
+      ObitIOUVFITSCompress (desc->ncorr, desc->inaxes[0], &data[op+sel->nrparmUC], 
 			    wtscl, &IOBuff[ip+desc->nrparm]);
       /* Byteswap Random parameters */
       ObitIOUVFITSfH2F (desc->nrparm, &IOBuff[ip], &IOBuff[ip]);
@@ -1611,9 +1621,11 @@ ObitIOCode ObitIOUVFITSReadDescriptor (ObitIOUVFITS *in, ObitErr *err)
   }
   
   /* visibility data must be either TFLOAT with first axis dimensioned 3
-     or TSHORT with first axis dimensioned 2. */
+     or TSHORT with first axis dimensioned 2 or 3 (with weights). */
   if (!(((typechar[0]=='E') && (desc->inaxes[0]==3)) ||
-      ((typechar[0]=='I') && (desc->inaxes[0]==2)))) {
+	((typechar[0]=='I') && (desc->inaxes[0]==2)) ||
+	((typechar[0]=='I') && (desc->inaxes[0]==3) && 
+	 (!strncmp (desc->ptype[desc->nrparm-1], "VISSCALE", 8))))) {
     retCode = OBIT_IO_SpecErr;
     Obit_log_error(err, OBIT_Error, 
 		   "Illegal visibility type/dimension %c %d ",
@@ -1873,8 +1885,9 @@ ObitIOUVFITSWriteDescriptor (ObitIOUVFITS *in, ObitErr *err)
     strncpy (&tttype[tfield-1][0], VISIBILITIES, 13);
     ttype[tfield-1] = &tttype[tfield-1][0];
     /* how many data values? */
-    if (sel->Compress) { /* Compressed */
-      ndata = 2 * desc->ncorr;
+    if (sel->Compress) { /* Compressed, with weights if 3 per correlation */
+      if (desc->inaxes[0]==3) ndata = 3 * desc->ncorr;
+      else                    ndata = 2 * desc->ncorr;
       dtype = 'I';
     } else { /* uncompressed */
       ndata = 3 * desc->ncorr;
@@ -1902,7 +1915,7 @@ ObitIOUVFITSWriteDescriptor (ObitIOUVFITS *in, ObitErr *err)
     viscol = (int)(desc->nrparm+1);
     /* set dimensionality array */
     for (i=0; i<desc->naxis; i++) naxes[i] = (long)desc->inaxes[i];
-    if (sel->Compress) naxes[0] = 2;
+    if (sel->Compress && (desc->inaxes[0]!=3)) naxes[0] = 2;
     else naxes[0] = 3;
     fits_write_tdim (in->myFptr, viscol, (long)desc->naxis, naxes, &status);
     if (status!=0) {
@@ -2173,9 +2186,9 @@ ObitIOUVFITSCreateBuffer (ofloat **data, ollong *size,
   tsize2 = ((ObitUVDesc*)in->myDesc)->lrec * ((ObitUVSel*)in->mySel)->nVisPIO;
   *size = MAX (tsize1, tsize2);
 
-  /* (re)allocate */
-  if (*data) *data = ObitMemRealloc (*data, (*size)*sizeof(ofloat));
-  else *data = ObitMemAlloc0Name((*size)*sizeof(ofloat), "UVBuffer");
+  /* (re)allocate from pool, reused buffers only zeroed for write */
+  *data = ObitIOGetBuffer (*data, *size, "UVBuffer",
+			   ((in->access!=OBIT_IO_ReadOnly) && (in->access!=OBIT_IO_ReadCal)));
 
 } /* end ObitIOUVFITSCreateBuffer */
 
@@ -2632,13 +2645,15 @@ static gboolean ObitIOUVFITSNext (ObitIOUVFITS *in, ObitErr *err)
  * Input data assumed inhost order and will be swapped to FITS order 
  * (bigendian) if different.
  * \param  ncorr  Number of weighted complex numbers
+ * \param  ncomp  Number of values per correlation in the compressed form,
+ *                3 => real, imaginary, weight (see ObitIOUVFITSCompressWt)
  * \param  visin  Expanded visibility array
  * \param  wtscl  (out) Weight and Scale needed to uncompress.
  * \param  visout (out) Compressed visibility array.
  */
 static void 
-ObitIOUVFITSCompress (olong ncorr, const ofloat *visin, ofloat *wtscl, 
-		      ofloat *visout)
+ObitIOUVFITSCompress (olong ncorr, olong ncomp, const ofloat *visin, 
+		      ofloat *wtscl, ofloat *visout)
 {
   olong i;
   ofloat maxwt, maxvis, scl;
@@ -2651,6 +2666,12 @@ ObitIOUVFITSCompress (olong ncorr, const ofloat *visin, ofloat *wtscl,
   g_assert (wtscl != NULL);
   g_assert (visout != NULL);
 
+  /* Keeping weights? */
+  if (ncomp==3) {
+    ObitIOUVFITSCompressWt (ncorr, visin, wtscl, visout);
+    return;
+  }
+
   /* find maximum weight and visibility component */
   maxwt = maxvis = 0.0;
   for (i=0; i<ncorr; i++) {
@@ -2709,12 +2730,14 @@ ObitIOUVFITSCompress (olong ncorr, const ofloat *visin, ofloat *wtscl,
  * random parameters and the real and imaginary parts as scaled shorts.
  * Values of -32767 in both of a pair of shorts indicate a flagged value.
  * \param  ncorr  Number of weighted complex numbers
+ * \param  ncomp  Number of values per correlation in the compressed form,
+ *                3 => real, imaginary, weight (see ObitIOUVFITSCompressWt)
  * \param  visin  Compressed visibility array.
  * \param  wtscl  Weight and Scale needed to uncompress.
  * \param  visout (out) Expanded visibility array.
  */
 static void 
-ObitIOUVFITSUncompress (olong ncorr, const ofloat *visin, 
+ObitIOUVFITSUncompress (olong ncorr, olong ncomp, const ofloat *visin, 
 			const ofloat *wtscl, ofloat *visout)
 {
   olong i;
@@ -2727,12 +2750,18 @@ ObitIOUVFITSUncompress (olong ncorr, const ofloat *visin,
   g_assert (wtscl != NULL);
   g_assert (visout != NULL);
 
+  /* With weights? */
+  if (ncomp==3) {
+    ObitIOUVFITSUncompressWt (ncorr, visin, wtscl, visout);
+    return;
+  }
+
   /* weighting and scaling */
   wt  = wtscl[0];
   scl = wtscl[1];
 
   /* loop over visibilities */
-  for (i=0; i<ncorr; i++) { 
+  for (i=0; i<ncorr; i++) {
 
     /* blanked or unblanked */
     if ( packed[i*2] == -32767) { /* Flagged */
@@ -2747,6 +2776,94 @@ ObitIOUVFITSUncompress (olong ncorr, const ofloat *visin,
   }
 } /* end ObitIOUVFITSUncompress */
 
+/**
+ * Compresses UV into scaled shorts keeping a weight per correlation.
+ * The real, imaginary and weight of each correlation are stored as 
+ * shorts scaled by the largest valid component and largest weight 
+ * magnitude, these scalings are stored as the WEIGHT and VISSCALE 
+ * random parameters.
+ * Flagged (weight<=0) correlations keep the sign of their weight 
+ * and have zero amplitude.
+ * Input data assumed in host order and will be swapped to FITS order 
+ * (bigendian) if different.
+ * \param  ncorr  Number of weighted complex numbers
+ * \param  visin  Expanded visibility array
+ * \param  wtscl  (out) Weight scale and visibility scale.
+ * \param  visout (out) Compressed visibility array, 3*ncorr shorts.
+ */
+static void 
+ObitIOUVFITSCompressWt (olong ncorr, const ofloat *visin, ofloat *wtscl, 
+			ofloat *visout)
+{
+  olong i;
+  ofloat maxwt, maxvis, scl, wscl, val;
+  gshort *packed = (gshort*)visout;
+
+  /* find maximum weight and visibility component */
+  maxwt = maxvis = 0.0;
+  for (i=0; i<ncorr; i++) {
+    if (visin[i*3+2] > 0.0) { /* Valid? */
+      maxvis = MAX (maxvis, fabs(visin[i*3]));
+      maxvis = MAX (maxvis, fabs(visin[i*3+1]));
+    }
+    maxwt  = MAX (maxwt, fabs(visin[i*3+2]));
+  }
+
+  /* output weighting and scaling */
+  wtscl[0] = maxwt / 32760.;
+  wtscl[1] = maxvis / 32760.;
+  scl = wscl = 0.0;
+  if (wtscl[0] > 1.0e-20) wscl = 1.0 / wtscl[0];
+  if (wtscl[1] > 1.0e-20) scl  = 1.0 / wtscl[1];
+
+  /* loop over visibilities packing them in. */
+  for (i=0; i<ncorr; i++) { 
+    if (visin[i*3+2] > 0.0) { /* OK - round values */
+      val = scl*visin[i*3];
+      packed[i*3]   = (gshort)(val + ((val>0.0) ? 0.5 : -0.5));
+      val = scl*visin[i*3+1];
+      packed[i*3+1] = (gshort)(val + ((val>0.0) ? 0.5 : -0.5));
+      val = wscl*visin[i*3+2];
+      packed[i*3+2] = (gshort)MAX (1, val + 0.5);
+    } else { /* flagged - keep sign of weight */
+      packed[i*3]   = 0;
+      packed[i*3+1] = 0;
+      val = wscl*visin[i*3+2];
+      packed[i*3+2] = (gshort)MIN (0, val - 0.5);
+      if ((visin[i*3+2]<0.0) && (packed[i*3+2]==0)) packed[i*3+2] = -1;
+    }
+  }
+  /* to FITS byte order */
+  ObitIOUVFITSsH2F (3*ncorr, packed, packed);
+} /* end ObitIOUVFITSCompressWt */
+
+/**
+ * Uncompresses UV from scaled shorts with a weight per correlation.
+ * The shorts must already be in host order.
+ * \param  ncorr  Number of weighted complex numbers
+ * \param  visin  Compressed visibility array, 3*ncorr shorts.
+ * \param  wtscl  Weight scale and visibility scale.
+ * \param  visout (out) Expanded visibility array.
+ */
+static void 
+ObitIOUVFITSUncompressWt (olong ncorr, const ofloat *visin, 
+			  const ofloat *wtscl, ofloat *visout)
+{
+  olong i;
+  ofloat wscl, scl;
+  gshort *packed = (gshort*)visin;
+
+  wscl = wtscl[0];
+  scl  = wtscl[1];
+
+  /* loop over visibilities */
+  for (i=0; i<ncorr; i++) { 
+    visout[i*3]   = scl  * packed[i*3];
+    visout[i*3+1] = scl  * packed[i*3+1];
+    visout[i*3+2] = wscl * packed[i*3+2];
+  }
+} /* end ObitIOUVFITSUncompressWt */
+
 /**
  * Swaps byte order in floats if host order differs from FITS.
  * Input data assumed in host order and will be swapped to FITS order 
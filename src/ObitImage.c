@@ -61,7 +61,15 @@ static ObitGetClassFP ObitParentGetClass = ObitDataGetClass;
  */
 static ObitImageClassInfo myClassInfo = {FALSE};
 
+/** Opens for write per disk file, keyed by ImageFileKey */
+static GHashTable *fileWriteGen = NULL;
+/** Lock for fileWriteGen */
+static GMutex fileWriteGenLock;
+
 /*---------------Private function prototypes----------------*/
+/** Private: Key identifying the disk file of an image. */
+static gchar* ImageFileKey (ObitImage *in);
+
 /** Private: Initialize newly instantiated object. */
 void  ObitImageInit  (gpointer in);
 
@@ -1035,6 +1043,9 @@ void ObitImageCloneMem  (ObitImage *in, ObitImage *out, ObitErr *err)
  * The file etc. info should have been stored in the ObitInfoList:
  * "FileType" OBIT_long scalar = OBIT_IO_FITS or OBIT_IO_AIPS 
  *    or OBIT_IO_MEM (no persistent form )    for file type.
+ * Each open for write increments "writeGen" (OBIT_long) on the info list
+ * and the count for the disk file (see ObitImageGetWriteGen) so that
+ * users caching pixel statistics can tell if the image changed.
  * \param in Pointer to object to be opened.
  * \param access access (OBIT_IO_ReadOnly,OBIT_IO_ReadWrite or
  *               OBIT_IO_WriteOnly).
@@ -1046,6 +1057,10 @@ ObitIOCode ObitImageOpen (ObitImage *in, ObitIOAccess access,
 {
   ObitIOCode retCode = OBIT_IO_SpecErr;
   ObitImageDesc *desc=NULL;
+  gint32 dim[MAXINFOELEMDIM] = {1,1,1,1,1};
+  ObitInfoType type;
+  olong writeGen;
+  gchar *fileKey=NULL;
   gchar *routine = "ObitImageOpen";
 
   /* error checks */
@@ -1067,6 +1082,25 @@ ObitIOCode ObitImageOpen (ObitImage *in, ObitIOAccess access,
   /* set Status */
   in->myStatus = OBIT_Active;
 
+  /* Count opens for write - pixel values may change */
+  if ((access==OBIT_IO_WriteOnly) || (access==OBIT_IO_ReadWrite)) {
+    writeGen = 0;
+    ObitInfoListGetTest(in->info, "writeGen", &type, dim, &writeGen);
+    writeGen++;
+    dim[0] = 1;
+    ObitInfoListAlwaysPut(in->info, "writeGen", OBIT_long, dim, &writeGen);
+    /* and for the file by whatever object */
+    fileKey = ImageFileKey (in);
+    if (fileKey) {
+      g_mutex_lock (&fileWriteGenLock);
+      if (fileWriteGen==NULL)
+	fileWriteGen = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+      writeGen = GPOINTER_TO_INT (g_hash_table_lookup (fileWriteGen, fileKey)) + 1;
+      g_hash_table_replace (fileWriteGen, fileKey, GINT_TO_POINTER(writeGen));
+      g_mutex_unlock (&fileWriteGenLock);
+    }
+  }
+
   /* get selection parameters */
   /* descriptor on IO, if it exists and not WriteOnly, is more accurate 
      reflection of reality */
@@ -1140,6 +1174,37 @@ ObitIOCode ObitImageOpen (ObitImage *in, ObitIOAccess access,
   return retCode;
 } /* end ObitImageOpen */
 
+/**
+ * Number of times the image's disk file has been opened for write in
+ * this process through any ObitImage, or for a memory resident image
+ * through this one ("writeGen").
+ * Writes by other processes are not seen.
+ * \param in Pointer to object.
+ * \return count, -1 if never opened for write
+ */
+olong ObitImageGetWriteGen (ObitImage *in)
+{
+  gint32 dim[MAXINFOELEMDIM] = {1,1,1,1,1};
+  ObitInfoType type;
+  olong writeGen = -1;
+  gchar *fileKey=NULL;
+
+  /* error checks */
+  g_assert (ObitIsA(in, &myClassInfo));
+
+  fileKey = ImageFileKey (in);
+  if (fileKey) {
+    g_mutex_lock (&fileWriteGenLock);
+    if (fileWriteGen && g_hash_table_contains (fileWriteGen, fileKey))
+      writeGen = GPOINTER_TO_INT (g_hash_table_lookup (fileWriteGen, fileKey));
+    g_mutex_unlock (&fileWriteGenLock);
+    g_free(fileKey);
+  } else {
+    ObitInfoListGetTest(in->info, "writeGen", &type, dim, &writeGen);
+  }
+  return writeGen;
+} /* end ObitImageGetWriteGen */
+
 /**
  * Shutdown I/O.
  * \param in Pointer to object to be closed.
@@ -2266,6 +2331,33 @@ static void ObitImageSetupIO (ObitImage *in, ObitErr *err)
 			((ObitIOImageAIPS*)in->myIO)->myDesc, err);
   } else if (in->mySel->FileType==OBIT_IO_MEM) {  /* Memory resident only */
   }
- 
+
 } /* end ObitImageSetupIO */
 
+/**
+ * Return a key identifying the disk file of an image,
+ * FITS disk and file name or AIPS disk, catalog slot and user.
+ * \param in  Image
+ * \return key, g_free when done, NULL if not a disk file
+ */
+static gchar* ImageFileKey (ObitImage *in)
+{
+  ObitInfoType type;
+  gint32 dim[MAXINFOELEMDIM] = {1,1,1,1,1};
+  olong FileType=-1, disk=0, cno=0, user=0;
+  gchar *fileName=NULL, *out=NULL;
+
+  ObitInfoListGetTest(in->info, "FileType", &type, dim, &FileType);
+  ObitInfoListGetTest(in->info, "Disk", &type, dim, &disk);
+  if (FileType==OBIT_IO_FITS) {
+    if (ObitInfoListGetP(in->info, "FileName", &type, dim, (gpointer)&fileName) &&
+	(type==OBIT_string))
+      out = g_strdup_printf ("FITS %d %.*s", disk, dim[0], fileName);
+  } else if (FileType==OBIT_IO_AIPS) {
+    if (ObitInfoListGetTest(in->info, "CNO", &type, dim, &cno) &&
+	ObitInfoListGetTest(in->info, "User", &type, dim, &user))
+      out = g_strdup_printf ("AIPS %d %d %d", disk, cno, user);
+  }
+  return out;
+} /* end ImageFileKey */
+
@@ -1198,6 +1198,7 @@ void ObitImageMFBlank (ObitImageMF *in, ObitErr *err)
 void ObitImageMFCombine (ObitImageMF *in, gboolean addExt, ObitErr *err)
 {
   ObitFArray *imPix=NULL, *extPix=NULL, *extConvl=NULL;
+  ObitFArrayExpr *expr=NULL;
   olong i, plane[5] = {1,1,1,1,1}, pos[2];
   ofloat norm, sigma, sigClip=5.0, lambda=0.1, testSigma=10.0, beamArea, cells;
   ofloat wt, sumWt, p1, p2, minSigma, fblank = ObitMagicF();
@@ -1242,10 +1243,12 @@ void ObitImageMFCombine (ObitImageMF *in, gboolean addExt, ObitErr *err)
     minSigma = MIN (minSigma, wt);  /* Minimum valid sigma */
     wt = 1.0 / wt;
     sumWt += wt;
-    ObitFArraySMul (in->image, wt);
-
-    /* Accumulate */
-    ObitFArrayAdd(imPix, in->image, imPix);
+    /* Scale and accumulate in one pass */
+    expr = ObitFArrayExprCreate (in->image);
+    ObitFArrayExprScalar (expr, OBIT_FAExpr_SMul, wt, 0.0, 0.0);
+    ObitFArrayExprArr (expr, OBIT_FAExpr_Add, imPix);
+    ObitFArrayExprRun (expr, imPix);
+    expr = ObitFArrayExprFree (expr);
 
   } /* end loop accumulating */
  
@@ -1269,10 +1272,13 @@ void ObitImageMFCombine (ObitImageMF *in, gboolean addExt, ObitErr *err)
 	
 	/* Accumulate extrema - first clip below sigClip */
 	sigma = ObitFArrayRMS0(in->image);
-	ObitFArrayInClip (in->image, -sigClip*sigma, sigClip*sigma, 0.0);
 	/* Weight by 1/sigma */
 	wt = 1.0 / sigma;
-	ObitFArraySMul (in->image, wt);   /* Scale by weight */
+	expr = ObitFArrayExprCreate (in->image);
+	ObitFArrayExprScalar (expr, OBIT_FAExpr_InClip, -sigClip*sigma, sigClip*sigma, 0.0);
+	ObitFArrayExprScalar (expr, OBIT_FAExpr_SMul, wt, 0.0, 0.0);   /* Scale by weight */
+	ObitFArrayExprRun (expr, in->image);
+	expr = ObitFArrayExprFree (expr);
 	/* ObitFArrayAbs (in->image);        Absolute value */
 	ObitFArrayExtArr (extPix, in->image, extPix);
       } /* end if valid */
@@ -1933,6 +1939,7 @@ void ObitImageMFEffFqCorr (ObitImageMF *in, ObitImageMF *in2, ObitErr *err)
   gboolean doPBCor=FALSE, doTab=FALSE;
   ObitImage *workIm=NULL;
   ObitFArray *wtArr=NULL, *accumWt=NULL, *accumWtFq=NULL;
+  ObitFArrayExpr *expr=NULL;
   ObitInfoType type;
   ObitHistory *outHist=NULL;
   gint32 dim[MAXINFOELEMDIM] = {1,1,1,1,1};
@@ -2058,19 +2065,23 @@ void ObitImageMFEffFqCorr (ObitImageMF *in, ObitImageMF *in2, ObitErr *err)
     freqs[iplane] = in->specFreq[iplane];
     /* Accumulate */
     ObitFArrayAdd(accumWt, wtArr, accumWt);
-    ObitFArraySMul(wtArr, (ofloat)freqs[iplane]);
-    ObitFArrayAdd(accumWtFq, wtArr, accumWtFq);
+    expr = ObitFArrayExprCreate (wtArr);
+    ObitFArrayExprScalar (expr, OBIT_FAExpr_SMul, (ofloat)freqs[iplane], 0.0, 0.0);
+    ObitFArrayExprArr (expr, OBIT_FAExpr_Add, accumWtFq);
+    ObitFArrayExprRun (expr, accumWtFq);
+    expr = ObitFArrayExprFree (expr);
  } /* end loop over planes */
 
-  /* Get effective Frequency image */
-  ObitFArrayDiv(accumWtFq, accumWt, accumWtFq);
+  /* Get effective Frequency image, divide by reference frequency */
+  iRefFreq = (ofloat)(1.0/refFreq);
+  expr = ObitFArrayExprCreate (accumWtFq);
+  ObitFArrayExprArr (expr, OBIT_FAExpr_Div, accumWt);
+  ObitFArrayExprScalar (expr, OBIT_FAExpr_SMul, iRefFreq, 0.0, 0.0);
+  ObitFArrayExprRun (expr, accumWtFq);
+  expr = ObitFArrayExprFree (expr);
 
   /* DEBUG
   ObitImageUtilArray2Image ("EffFq.fits",0, accumWtFq, err); */
-  
-  /* divide by reference frequency */
-  iRefFreq = (ofloat)(1.0/refFreq);
-  ObitFArraySMul(accumWtFq, iRefFreq);
 
   ObitFArrayLog(accumWtFq, wtArr);  /* Natural log */
   ObitFArraySMul(wtArr, -corAlpha); /* x spectral index - neg for correction */
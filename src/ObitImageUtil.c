@@ -97,8 +97,33 @@ typedef struct {
   ObitErr    *err;
   /* Input Image Interpolator */
   ObitFInterpolate *Interp;
+  /* Maximum error (pixel) of interpolated input pixels, <=0 -> exact */
+  ofloat     ctlTol;
+  /* Spacing (pixels) of coordinate control grid */
+  olong      ctlSpace;
+  /* Number of control points in a row */
+  olong      nCtl;
+  /* Output columns (1-rel) of control points */
+  olong      *ctlCol;
+  /* Output rows of the current control band, 0 -> none */
+  olong      ctlRow1, ctlRow2;
+  /* Input pixel (x,y pairs) at control points on ctlRow1, ctlRow2 */
+  ofloat     *ctl1, *ctl2;
+  /* Are control points valid? */
+  gboolean   *ctlOK1, *ctlOK2;
+  /* Can input pixels be interpolated in control cell? */
+  gboolean   *cellOK;
+  /* Work arrays for a row of input x, y pixels */
+  ofloat     *xRow, *yRow;
+  /* Work array for validity of input pixels in a row */
+  gboolean   *okRow;
 } InterpFuncArg;
 
+/** Default spacing (pixels) of coordinate control grid */
+#define INTERPCTLSPACE 16
+/** Default maximum error (pixels) of interpolated input pixels, 0=>exact */
+#define INTERPCTLTOL 0.0
+
 /* Image primary beam  threaded function Argument */
 typedef struct {
   /** First (1-rel) value in y to process this thread */
@@ -130,11 +155,26 @@ static gpointer ThreadImageInterp (gpointer arg);
 /** Private: Threaded Calculate pixels */
 static gpointer ThreadGetXYPixels (gpointer arg);
 
+/** Private: Input pixels for a row of output image */
+static gboolean InterpRowPixels (InterpFuncArg *largs, olong iy);
+
+/** Private: Input pixels at control points in a row of output image */
+static gboolean InterpCtlRow (InterpFuncArg *largs, olong iy, 
+			      ofloat *ctl, gboolean *ctlOK);
+
+/** Private: Is control grid interpolation accurate at a pixel? */
+static gboolean InterpCtlCheck (InterpFuncArg *largs, olong k,
+				olong ix, olong iy);
+
+/** Private: Exact input pixel for output pixel */
+static gboolean InterpCvtPixel (InterpFuncArg *largs, ofloat *outPixel, 
+				ofloat *inPixel);
+
 /** Private: Make Threaded Image interpolator args */
 static olong MakeInterpFuncArgs (ObitThread *thread, olong radius,
 				 olong nZern, ofloat *ZCoef,
 				 ObitImageDesc *inDesc, ObitImageDesc *outDesc, 
-				 ObitFInterpolate *Interp,
+				 ObitFInterpolate *Interp, ObitInfoList *info,
 				 ObitErr *err, InterpFuncArg ***ThreadArgs);
 
 /** Private: Delete Threaded Image interpolator args */
@@ -1551,6 +1591,9 @@ void ObitImageUtilMakeImagePar (ObitUV *inUV, olong nPar, ObitImage **outImage,
 /**
  * Fill the pixels in outImage by interpolation to the corresponding locations
  * in inImage.
+ * If inImage->info "interpTol" (OBIT_float, pixels) >0, input pixels are
+ * interpolated from a coarse grid of exact coordinate transforms where
+ * accurate to interpTol [def 0 -> exact transform every pixel].
  * There is no interpolation between planes
  * \param inImage  Image to be interpolated.
  * \param outImage Image to be written.  Must be previously instantiated.
@@ -1684,7 +1727,8 @@ ObitImageUtilInterpolateImage (ObitImage *inImage, ObitImage *outImage,
    /* Initialize Threading */
   nThreads = MakeInterpFuncArgs (inImage->thread, -1, 0, NULL,
 				 inImage->myDesc, outImage->myDesc, 
-				 interp, err, &threadArgs);
+				 interp, inImage->info,
+				 err, &threadArgs);
 
   /* Divide up work */
   nrow = outImage->myDesc->inaxes[1];
@@ -1917,7 +1961,8 @@ ObitImageUtilInterpolateImageXY (ObitImage *inImage, ObitImage *outImage,
    /* Initialize Threading */
   nThreads = MakeInterpFuncArgs (inImage->thread, -1, 0, NULL,
 				 inImage->myDesc, outImage->myDesc, 
-				 interp, err, &threadArgs);
+				 interp, inImage->info,
+				 err, &threadArgs);
 
   /* Divide up work */
   nrow = outImage->myDesc->inaxes[1];
@@ -2008,6 +2053,9 @@ ObitImageUtilInterpolateImageXY (ObitImage *inImage, ObitImage *outImage,
 
 /**
  * Get input pixels in InImage for outImage.
+ * If inImage->info "interpTol" (OBIT_float, pixels) >0, input pixels are
+ * interpolated from a coarse grid of exact coordinate transforms where
+ * accurate to interpTol [def 0 -> exact transform every pixel].
  * \param inImage  Image to be interpolated.
  * \param outImage Image to be written.
  * \param XPix     Image of x pixels in inImage for outImage
@@ -2097,7 +2145,7 @@ ObitImageUtilGetXYPixels (ObitImage *inImage, ObitImage *outImage,
   /* Initialize Threading */
   nThreads = MakeInterpFuncArgs (inImage->thread, -1, 0, NULL,
 				 inImage->myDesc, outImage->myDesc, 
-				 NULL, err, &threadArgs);
+				 NULL, inImage->info, err, &threadArgs);
 
   /* Divide up work */
   nrow = outImage->myDesc->inaxes[1];
@@ -2180,6 +2228,9 @@ ObitImageUtilGetXYPixels (ObitImage *inImage, ObitImage *outImage,
 /**
  * Fill the pixels in outImage by interpolation to the corresponding locations
  * in inImage given a Zernike model of distortions in in.
+ * If inImage->info "interpTol" (OBIT_float, pixels) >0, input pixels are
+ * interpolated from a coarse grid of exact coordinate transforms where
+ * accurate to interpTol [def 0 -> exact transform every pixel].
  * There is no interpolation between planes
  * \param inImage  Image to be interpolated.
  * \param outImage Image to be written.  Must be previously instantiated.
@@ -2285,7 +2336,8 @@ ObitImageUtilInterpolateImageZern (ObitImage *inImage, ObitImage *outImage,
   /* Initialize Threading */
   nThreads = MakeInterpFuncArgs (inImage->thread, -1, nZern, ZCoef,
 				 inImage->myDesc, outImage->myDesc, 
-				 interp, err, &threadArgs);
+				 interp, inImage->info,
+				 err, &threadArgs);
 
   /* Divide up work */
   nrow = outImage->myDesc->inaxes[1];
@@ -2353,6 +2405,9 @@ ObitImageUtilInterpolateImageZern (ObitImage *inImage, ObitImage *outImage,
 /**
  * Fill the pixels in outImage by interpolation to the corresponding locations
  * in inImage.
+ * If inImage->info "interpTol" (OBIT_float, pixels) >0, input pixels are
+ * interpolated from a coarse grid of exact coordinate transforms where
+ * accurate to interpTol [def 0 -> exact transform every pixel].
  * Also calculates a weight based on a circle defined by radiusfrom the center; 
  * this is 1.0 in the center and tapers with distance^2 to 0.0 outside.
  * If memOnly then the input image plane is assumed in inImage and only memory
@@ -2457,7 +2512,8 @@ ObitImageUtilInterpolateWeight (ObitImage *inImage, ObitImage *outImage,
   /* Initialize Threading */
   nThreads = MakeInterpFuncArgs (inImage->thread, radius, 0, NULL,
 				 inImage->myDesc, outImage->myDesc, 
-				 interp, err, &threadArgs);
+				 interp, inImage->info,
+				 err, &threadArgs);
 
   /* Divide up work */
   nrow = outImage->myDesc->inaxes[1];
@@ -5996,6 +6052,8 @@ static void ObitImageUtilCurDate (gchar *date, olong len)
  * \li err      ObitErr Obit error stack object
  * \li thread   thread Object
  * \li Interp   ObitFInterpolate Input Image Interpolator
+ * \li ctlTol   Maximum error (pixel) of input pixels from control grid
+ * \li xRow, yRow, okRow Work arrays for a row of input pixels
  * \return NULL
  */
 static gpointer ThreadImageInterp (gpointer args)
@@ -6012,19 +6070,21 @@ static gpointer ThreadImageInterp (gpointer args)
   ObitFArray *YPix      = largs->YPixData;
   olong      radius     = largs->radius;
   olong      nZern      = largs->nZern;
-  ofloat     *ZCoef     = largs->ZCoef;
   olong      loRow      = largs->first;
   olong      hiRow      = largs->last;
   ObitErr    *err       = largs->err;
   ObitThread *thread    = largs->thread;
   ObitFInterpolate *interp = largs->Interp;
+  ofloat     *xRow      = largs->xRow;
+  ofloat     *yRow      = largs->yRow;
+  gboolean   *okRow     = largs->okRow;
   /* local */
-  olong ix, iy, pos[2];
+  olong ix, iy, nx, pos[2];
   ollong indx;
   ofloat *out, *outWt=NULL, rad2=0.0, dist2, irad2=0.0;
-  ofloat crpix[2], wt, val, *xp=NULL, *yp=NULL, fblank =  ObitMagicF();
+  ofloat crpix[2], wt, *xp=NULL, *yp=NULL, fblank =  ObitMagicF();
   ofloat inPixel[2], outPixel[2], offPixel[2];
-  gboolean OK=TRUE, doPixel, sameGrid;
+  gboolean doPixel, sameGrid;
   gchar *routine = "ThreadImageInterp";
 
   /* Previous error? */
@@ -6034,8 +6094,7 @@ static gpointer ThreadImageInterp (gpointer args)
   sameGrid = (nZern==0) && ObitImageDescAligned(inDesc, outDesc, err);
   if (sameGrid) {
     inPixel[0] = 0.0; inPixel[1] = 0.0;
-    OK = ObitImageDescCvtPixel (outDesc, inDesc, inPixel, offPixel, err);
-    OK = TRUE;  /* Reset */
+    ObitImageDescCvtPixel (outDesc, inDesc, inPixel, offPixel, err);
     /* further sanity check, must be integer */
     if (offPixel[0]>0.0) ix = (olong)(offPixel[0]+0.5);
     else                 ix = (olong)(offPixel[0]-0.5);
@@ -6074,49 +6133,45 @@ static gpointer ThreadImageInterp (gpointer args)
   }
 
   /* Loop over image interpolating */
+  nx = outDesc->inaxes[0];
+  largs->ctlRow1 = largs->ctlRow2 = 0;
   for (iy = loRow; iy<=hiRow; iy++) { /* loop in y */
     outPixel[1] = (ofloat)iy;
-    for (ix = 1; ix<=outDesc->inaxes[0]; ix++) {/* loop in x */
-      outPixel[0] = (ofloat)ix;
 
-      /* array index in out for this pixel */
-      indx = (iy-1) * outDesc->inaxes[0] + (ix-1);
+    /* array index in out for first pixel in row */
+    indx = (iy-1) * nx;
       
-      /* Get pixel in input image*/
-      if (doPixel) {   /* Precalculated? */
-	inPixel[0] = xp[indx];
-	inPixel[1] = yp[indx];
-	OK = (inPixel[0]>=0.0) && (inPixel[1]>=0.0);
-      } else {  /* Calculate  - Zernike correction? */
-	if (nZern>0) { /* yes */
-	  OK = ObitImageDescCvtZern (outDesc, inDesc, nZern, ZCoef, 
-				     outPixel, inPixel, err);
-	} else {       /* not precalculated */
-	  if (sameGrid) {  /* Simple shift */
-	    inPixel[0] = outPixel[0] + offPixel[0];
-	    inPixel[1] = outPixel[1] + offPixel[1];
-	    /* Check that in image */
-	    OK = (inPixel[0]>=0.0) && (inPixel[1]>=0.0) &&
-	      (inPixel[0]<inDesc->inaxes[0]) && (inPixel[0]<inDesc->inaxes[1]);
-	  } else { /* Need to convert */
-	  OK = ObitImageDescCvtPixel (outDesc, inDesc, outPixel, inPixel, err);
-	  }
-	}
-	if (err->error) {
-	  ObitThreadLock(thread);  /* Lock against other threads */
-	  Obit_log_error(err, OBIT_Error,"%s: Error projecting pixel",
-			 routine);
-	  ObitThreadUnlock(thread); 
-	  goto finish;
-	}
-      } /* End get Pixel */
+    /* Get pixels in input image*/
+    if (doPixel) {   /* Precalculated? */
+      for (ix=0; ix<nx; ix++) {
+	xRow[ix]  = xp[indx+ix];
+	yRow[ix]  = yp[indx+ix];
+	okRow[ix] = (xRow[ix]>=0.0) && (yRow[ix]>=0.0);
+      }
+    } else if (sameGrid) {  /* Simple shift */
+      for (ix=0; ix<nx; ix++) {
+	xRow[ix] = (ofloat)(ix+1) + offPixel[0];
+	yRow[ix] = outPixel[1] + offPixel[1];
+	/* Check that in image */
+	okRow[ix] = (xRow[ix]>=0.0) && (yRow[ix]>=0.0) &&
+	  (xRow[ix]<inDesc->inaxes[0]) && (yRow[ix]<inDesc->inaxes[1]);
+      }
+    } else {  /* Calculate, control grid or exact */
+      if (!InterpRowPixels (largs, iy)) {
+	ObitThreadLock(thread);  /* Lock against other threads */
+	Obit_log_error(err, OBIT_Error,"%s: Error projecting pixel",
+		       routine);
+	ObitThreadUnlock(thread); 
+	goto finish;
+      }
+    } /* End get Pixels */
 
-      if (doWeight) { /* weighting? */
-	if (OK) { /* In image? */
+    if (doWeight) { /* weighting? */
+      for (ix=0; ix<nx; ix++) {
+	if (okRow[ix]) { /* In image? */
 	  /* weight based on distance from center of inImage */
-	  dist2 = (crpix[0]-inPixel[0])*(crpix[0]-inPixel[0]) + 
-	    (crpix[1]-inPixel[1])*(crpix[1]-inPixel[1]);
-	  /*dist2 = (crpix[0]-xyzi[0])**2 + (crpix[1]-xyzi[1])**2;*/
+	  dist2 = (crpix[0]-xRow[ix])*(crpix[0]-xRow[ix]) + 
+	    (crpix[1]-yRow[ix])*(crpix[1]-yRow[ix]);
 	  if (dist2 <= rad2) {
 	    wt = 1.0 - dist2 * irad2;
 	    wt = MAX (0.001, wt);
@@ -6126,27 +6181,19 @@ static gpointer ThreadImageInterp (gpointer args)
 	} else {
 	  wt = fblank;  /* don't bother */
 	}
-      } else wt = 1.0;
-      
-      /* interpolate */
-      if (wt != fblank ) {
-	val = ObitFInterpolatePixel (interp, inPixel, err);
-	if (doWeight & (val != fblank )) val *= wt;
-	out[indx] = val;
-	if (err->error) {
-	  ObitThreadLock(thread);  /* Lock against other threads */
-	  Obit_log_error(err, OBIT_Error,"%s: Error interpolating pixel in %s",
-			 routine, interp->name);
-	  ObitThreadUnlock(thread); 
-	  goto finish;
-	}
-	if (doWeight) outWt[indx] = wt;
-      } else {
-	out[indx]   = fblank;
-	if (doWeight) outWt[indx] = fblank;
+	outWt[indx+ix] = wt;
+	if (wt == fblank) xRow[ix] = -1.0;  /* Skip interpolation */
       }
+    } /* end weighting */
       
-    } /* end loop over x */
+    /* interpolate row */
+    ObitFInterpolateRow (interp, nx, xRow, yRow, &out[indx]);
+    if (doWeight) {
+      for (ix=0; ix<nx; ix++) {
+	if (outWt[indx+ix] == fblank)   out[indx+ix]  = fblank;
+	else if (out[indx+ix] != fblank) out[indx+ix] *= outWt[indx+ix];
+      }
+    }
   } /* end loop over y */
   
   /* Indicate completion */
@@ -6177,30 +6224,29 @@ static gpointer ThreadImageInterp (gpointer args)
  * \li err      ObitErr Obit error stack object
  * \li thread   thread Object
  * \li Interp   ObitFInterpolate Input Image Interpolator
+ * \li ctlTol   Maximum error (pixel) of input pixels from control grid
+ * \li xRow, yRow, okRow Work arrays for a row of input pixels
  * \return NULL
  */
 static gpointer ThreadGetXYPixels (gpointer args)
 {
   /* Get arguments from structure */
   InterpFuncArg *largs = (InterpFuncArg*)args;
-  ObitImageDesc *inDesc = largs->inDesc;
-  /* ObitFArray *inData    = largs->inData;*/
   ObitImageDesc *outDesc= largs->outDesc;
-  /*ObitFArray *outData   = largs->outData;*/
   ObitFArray *XPix      = largs->XPixData;
   ObitFArray *YPix      = largs->YPixData;
-  olong      nZern      = largs->nZern;
-  ofloat     *ZCoef     = largs->ZCoef;
   olong      loRow      = largs->first;
   olong      hiRow      = largs->last;
   ObitErr    *err       = largs->err;
   ObitThread *thread    = largs->thread;
+  ofloat     *xRow      = largs->xRow;
+  ofloat     *yRow      = largs->yRow;
+  gboolean   *okRow     = largs->okRow;
 
   /* local */
-  olong ix, iy, pos[2];
+  olong ix, iy, nx, pos[2];
   ollong indx;
-  ofloat inPixel[2], outPixel[2], *xp, *yp;
-  gboolean OK;
+  ofloat *xp, *yp;
   gchar *routine = "ThreadGetXYPixels";
 
   /* Get output aray pointers */
@@ -6209,35 +6255,27 @@ static gpointer ThreadGetXYPixels (gpointer args)
   yp    = ObitFArrayIndex (YPix, pos);
 
   /* Loop over image determining pixel numbers */
+  nx = outDesc->inaxes[0];
+  largs->ctlRow1 = largs->ctlRow2 = 0;
   for (iy = loRow; iy<=hiRow; iy++) { /* loop in y */
-    outPixel[1] = (ofloat)iy;
-    for (ix = 1; ix<=outDesc->inaxes[0]; ix++) {/* loop in x */
-      outPixel[0] = (ofloat)ix;
-
-     /* Get pixel in input image - Zernike correction?*/
-      if (nZern>0) { /* yes */
-	OK = ObitImageDescCvtZern (outDesc, inDesc, nZern, ZCoef, 
-				 outPixel, inPixel, err);
-      } else {       /* no */
-	OK = ObitImageDescCvtPixel (outDesc, inDesc, outPixel, inPixel, err);
-      }
-      if (err->error) {
-	ObitThreadLock(thread);  /* Lock against other threads */
-	Obit_log_error(err, OBIT_Error,"%s: Error projecting pixel",
-		       routine);
-	ObitThreadUnlock(thread); 
-	goto finish;
-      }
-      /* Save - array index in outout for this pixel */
-      indx = (iy-1) * outDesc->inaxes[0] + (ix-1);
-      if (OK) {
-	xp[indx] = inPixel[0];
-	yp[indx] = inPixel[1];
+    /* Get pixels in input image */
+    if (!InterpRowPixels (largs, iy)) {
+      ObitThreadLock(thread);  /* Lock against other threads */
+      Obit_log_error(err, OBIT_Error,"%s: Error projecting pixel",
+		     routine);
+      ObitThreadUnlock(thread); 
+      goto finish;
+    }
+    /* Save - array index in outout for this pixel */
+    indx = (iy-1) * nx;
+    for (ix=0; ix<nx; ix++) {
+      if (okRow[ix]) {
+	xp[indx+ix] = xRow[ix];
+	yp[indx+ix] = yRow[ix];
       } else {  /* Not in image */
-	xp[indx] = -1;
-	yp[indx] = -1;
+	xp[indx+ix] = -1;
+	yp[indx+ix] = -1;
       }
-
     } /* end loop over x */
   } /* end loop over y */
   
@@ -6249,6 +6287,207 @@ static gpointer ThreadGetXYPixels (gpointer args)
   return NULL;
 } /* ThreadGetXYPixels */
 
+/**
+ * Determine the input pixels for a row of the output image.
+ * If largs->ctlTol>0 the exact transform is only evaluated on a control 
+ * grid every largs->ctlSpace pixels in each direction and the input 
+ * pixels are bilinearly interpolated inside each control cell.
+ * The interpolation error is checked at the center and the middle of
+ * each edge of each cell and cells exceeding ctlTol at any of these,
+ * or with corners or check points outside of the input image,
+ * use the exact transform for every pixel.
+ * The control points on the two rows bounding the current band of rows 
+ * are kept in largs and reused for all rows in the band.
+ * \param largs  Interpolation thread argument, results in
+ *               xRow, yRow (input pixels) and okRow (in input image?)
+ * \param iy     Output row (1-rel), should be in [largs->first, largs->last]
+ * \return TRUE if OK, FALSE if an error occured
+ */
+static gboolean InterpRowPixels (InterpFuncArg *largs, olong iy)
+{
+  ObitImageDesc *inDesc  = largs->inDesc;
+  ObitImageDesc *outDesc = largs->outDesc;
+  ObitErr       *err     = largs->err;
+  olong         space    = largs->ctlSpace;
+  olong         *ctlCol  = largs->ctlCol;
+  ofloat        *xRow    = largs->xRow;
+  ofloat        *yRow    = largs->yRow;
+  gboolean      *okRow   = largs->okRow;
+  olong ix, k, nx, x1, x2, xe, y1, y2, xc, yc;
+  ofloat *ctl1, *ctl2, *tctl, ty, xl, yl, xr, yr, dx, dy, xmax, ymax;
+  ofloat inPixel[2], outPixel[2];
+  gboolean *tOK, OK;
+
+  nx = outDesc->inaxes[0];
+  outPixel[1] = (ofloat)iy;
+
+  /* Exact transform for every pixel? */
+  if ((largs->ctlTol<=0.0) || (largs->nCtl<2)) {
+    for (ix=0; ix<nx; ix++) {
+      outPixel[0] = (ofloat)(ix+1);
+      okRow[ix] = InterpCvtPixel (largs, outPixel, inPixel);
+      xRow[ix]  = inPixel[0];
+      yRow[ix]  = inPixel[1];
+    }
+    return !err->error;
+  }
+
+  /* Need new band of control rows? */
+  if ((largs->ctlRow1<=0) || (iy<largs->ctlRow1) || (iy>largs->ctlRow2)) {
+    y1 = largs->first + ((iy-largs->first)/space)*space;
+    y2 = MIN (y1+space, largs->last);
+    if ((largs->ctlRow1>0) && (y1==largs->ctlRow2)) {  /* Reuse old upper row */
+      tctl = largs->ctl1;   largs->ctl1   = largs->ctl2;   largs->ctl2   = tctl;
+      tOK  = largs->ctlOK1; largs->ctlOK1 = largs->ctlOK2; largs->ctlOK2 = tOK;
+    } else {
+      if (!InterpCtlRow (largs, y1, largs->ctl1, largs->ctlOK1)) return FALSE;
+    }
+    if (y2>y1) {
+      if (!InterpCtlRow (largs, y2, largs->ctl2, largs->ctlOK2)) return FALSE;
+    } else {  /* Single row band */
+      for (k=0; k<largs->nCtl; k++) {
+	largs->ctl2[2*k]   = largs->ctl1[2*k];
+	largs->ctl2[2*k+1] = largs->ctl1[2*k+1];
+	largs->ctlOK2[k]   = largs->ctlOK1[k];
+      }
+    }
+    largs->ctlRow1 = y1;
+    largs->ctlRow2 = y2;
+
+    /* Check interpolation error at the center and the middle of
+       each edge of each cell, corners are exact */
+    yc = (y1+y2)/2;
+    for (k=0; k<largs->nCtl-1; k++) {
+      largs->cellOK[k] = largs->ctlOK1[k] && largs->ctlOK1[k+1] &&
+	largs->ctlOK2[k] && largs->ctlOK2[k+1];
+      if (!largs->cellOK[k]) continue;
+      x1 = ctlCol[k]; x2 = ctlCol[k+1];
+      xc = (x1+x2)/2;
+      OK = InterpCtlCheck (largs, k, xc, yc) &&  /* Center */
+	InterpCtlCheck (largs, k, xc, y1) &&     /* Bottom */
+	InterpCtlCheck (largs, k, xc, y2) &&     /* Top */
+	InterpCtlCheck (largs, k, x1, yc) &&     /* Left */
+	InterpCtlCheck (largs, k, x2, yc);       /* Right */
+      if (err->error) return FALSE;
+      largs->cellOK[k] = OK;
+    }
+  } /* end new control band */
+
+  /* Fill row by cell */
+  ctl1 = largs->ctl1;
+  ctl2 = largs->ctl2;
+  y1 = largs->ctlRow1; y2 = largs->ctlRow2;
+  if (y2>y1) ty = (ofloat)(iy-y1) / (ofloat)(y2-y1);
+  else       ty = 0.0;
+  xmax = inDesc->inaxes[0] + 0.5;
+  ymax = inDesc->inaxes[1] + 0.5;
+  for (k=0; k<largs->nCtl-1; k++) {
+    x1 = ctlCol[k]; x2 = ctlCol[k+1];
+    /* Last column of cell done by next cell except at the end */
+    if (k<largs->nCtl-2) xe = x2-1;
+    else                 xe = x2;
+    if (largs->cellOK[k]) {  /* Interpolate */
+      xl = ctl1[2*k]   + ty*(ctl2[2*k]   - ctl1[2*k]);
+      yl = ctl1[2*k+1] + ty*(ctl2[2*k+1] - ctl1[2*k+1]);
+      xr = ctl1[2*k+2] + ty*(ctl2[2*k+2] - ctl1[2*k+2]);
+      yr = ctl1[2*k+3] + ty*(ctl2[2*k+3] - ctl1[2*k+3]);
+      dx = (xr-xl) / (ofloat)(x2-x1);
+      dy = (yr-yl) / (ofloat)(x2-x1);
+      for (ix=x1; ix<=xe; ix++) {
+	xRow[ix-1]  = xl + (ix-x1)*dx;
+	yRow[ix-1]  = yl + (ix-x1)*dy;
+	okRow[ix-1] = (xRow[ix-1]>=0.5) && (yRow[ix-1]>=0.5) && 
+	  (xRow[ix-1]<=xmax) && (yRow[ix-1]<=ymax);
+      }
+    } else {                 /* Exact */
+      for (ix=x1; ix<=xe; ix++) {
+	outPixel[0] = (ofloat)ix;
+	okRow[ix-1] = InterpCvtPixel (largs, outPixel, inPixel);
+	xRow[ix-1]  = inPixel[0];
+	yRow[ix-1]  = inPixel[1];
+      }
+      if (err->error) return FALSE;
+    }
+  } /* end loop over cells */
+
+  return TRUE;
+} /* end InterpRowPixels */
+
+/**
+ * Determine the input pixels at the control points of an output row.
+ * \param largs  Interpolation thread argument
+ * \param iy     Output row (1-rel)
+ * \param ctl    [out] Input pixels as (x,y) pairs, one per control point
+ * \param ctlOK  [out] TRUE if control point in input image
+ * \return TRUE if OK, FALSE if an error occured
+ */
+static gboolean InterpCtlRow (InterpFuncArg *largs, olong iy, 
+			      ofloat *ctl, gboolean *ctlOK)
+{
+  olong k;
+  ofloat inPixel[2], outPixel[2];
+
+  outPixel[1] = (ofloat)iy;
+  for (k=0; k<largs->nCtl; k++) {
+    outPixel[0] = (ofloat)largs->ctlCol[k];
+    ctlOK[k] = InterpCvtPixel (largs, outPixel, inPixel);
+    ctl[2*k]   = inPixel[0];
+    ctl[2*k+1] = inPixel[1];
+  }
+  return !largs->err->error;
+} /* end InterpCtlRow */
+
+/**
+ * Check the bilinear interpolation of the input pixel from the control
+ * points of a cell in the current band against the exact transform.
+ * \param largs  Interpolation thread argument, control band set
+ * \param k      Cell number (0-rel), between control columns k and k+1
+ * \param ix     Output column (1-rel) in the cell
+ * \param iy     Output row (1-rel) in the band
+ * \return TRUE if in input image and within largs->ctlTol
+ */
+static gboolean InterpCtlCheck (InterpFuncArg *largs, olong k,
+				olong ix, olong iy)
+{
+  ofloat *ctl1 = largs->ctl1, *ctl2 = largs->ctl2;
+  olong x1, x2, y1, y2;
+  ofloat tx, ty, xl, yl, xr, yr, inPixel[2], outPixel[2];
+
+  x1 = largs->ctlCol[k]; x2 = largs->ctlCol[k+1];
+  y1 = largs->ctlRow1;   y2 = largs->ctlRow2;
+  tx = (ofloat)(ix-x1) / (ofloat)(x2-x1);
+  if (y2>y1) ty = (ofloat)(iy-y1) / (ofloat)(y2-y1);
+  else       ty = 0.0;
+  xl = ctl1[2*k]   + ty*(ctl2[2*k]   - ctl1[2*k]);
+  yl = ctl1[2*k+1] + ty*(ctl2[2*k+1] - ctl1[2*k+1]);
+  xr = ctl1[2*k+2] + ty*(ctl2[2*k+2] - ctl1[2*k+2]);
+  yr = ctl1[2*k+3] + ty*(ctl2[2*k+3] - ctl1[2*k+3]);
+
+  outPixel[0] = (ofloat)ix; outPixel[1] = (ofloat)iy;
+  if (!InterpCvtPixel (largs, outPixel, inPixel)) return FALSE;
+  return (fabs(xl + tx*(xr-xl) - inPixel[0])<=largs->ctlTol) &&
+    (fabs(yl + tx*(yr-yl) - inPixel[1])<=largs->ctlTol);
+} /* end InterpCtlCheck */
+
+/**
+ * Exact input pixel for an output pixel, with Zernike corrections if 
+ * largs->nZern>0.
+ * \param largs    Interpolation thread argument
+ * \param outPixel Pixel in output image
+ * \param inPixel  [out] Pixel in input image
+ * \return TRUE if inPixel is in input image, else FALSE
+ */
+static gboolean InterpCvtPixel (InterpFuncArg *largs, ofloat *outPixel, 
+				ofloat *inPixel)
+{
+  if (largs->nZern>0)
+    return ObitImageDescCvtZern (largs->outDesc, largs->inDesc, largs->nZern, 
+				 largs->ZCoef, outPixel, inPixel, largs->err);
+  else
+    return ObitImageDescCvtPixel (largs->outDesc, largs->inDesc, outPixel, 
+				  inPixel, largs->err);
+} /* end InterpCvtPixel */
+
 /**
  * Make arguments for Threaded ThreadImageInterp
  * \param thread     ObitThread object to be used for interpolator
@@ -6260,6 +6499,10 @@ static gpointer ThreadGetXYPixels (gpointer args)
  * \param outDesc    output image descriptor
  * \param Interp     interpolator for input image
  *                   Cloned for multiple threads
+ * \param info       List with optional control parameter:
+ * \li "interpTol" OBIT_float scalar Maximum error (pixel) of input pixels
+ *                 interpolated from the coordinate control grid, 
+ *                 <=0 -> exact transform every pixel [def 0]
  * \param err        Obit error stack object.
  * \param ThreadArgs[out] Created array of InterpFuncArg, 
  *                   delete with KillInterpFuncArgs
@@ -6268,15 +6511,28 @@ static gpointer ThreadGetXYPixels (gpointer args)
 static olong MakeInterpFuncArgs (ObitThread *thread, olong radius,
 				 olong nZern, ofloat *ZCoef,
 				 ObitImageDesc *inDesc, ObitImageDesc *outDesc, 
-				 ObitFInterpolate *Interp,
+				 ObitFInterpolate *Interp, ObitInfoList *info,
 				 ObitErr *err, InterpFuncArg ***ThreadArgs)
 {
-  olong i, j, nThreads;
+  olong i, j, k, nx, nCtl, space, nThreads;
+  ofloat ctlTol;
+  gint32 dim[MAXINFOELEMDIM];
+  ObitInfoType type;
 
   /* Setup for threading */
   /* How many threads? */
   nThreads = MAX (1, ObitThreadNumProc(thread));
 
+  /* Coordinate control grid */
+  ctlTol = INTERPCTLTOL;
+  if (info) ObitInfoListGetTest(info, "interpTol", &type, dim, &ctlTol);
+  space = INTERPCTLSPACE;
+  nx    = outDesc->inaxes[0];
+  if ((ctlTol>0.0) && (nx>2*space)) {
+    nCtl = 1 + (nx-1)/space;
+    if (((nx-1)%space)!=0) nCtl++;
+  } else nCtl = 0;
+
   /* Initialize threadArg array */
   *ThreadArgs = g_malloc0(nThreads*sizeof(InterpFuncArg*));
   for (i=0; i<nThreads; i++) 
@@ -6302,6 +6558,24 @@ static olong MakeInterpFuncArgs (ObitThread *thread, olong radius,
       if (i==0) (*ThreadArgs)[i]->Interp = ObitFInterpolateRef(Interp);
       else (*ThreadArgs)[i]->Interp      = ObitFInterpolateClone(Interp, NULL);
     }
+    (*ThreadArgs)[i]->ctlTol   = ctlTol;
+    (*ThreadArgs)[i]->ctlSpace = space;
+    (*ThreadArgs)[i]->nCtl     = nCtl;
+    (*ThreadArgs)[i]->ctlRow1  = 0;
+    (*ThreadArgs)[i]->ctlRow2  = 0;
+    if (nCtl>0) {
+      (*ThreadArgs)[i]->ctlCol = g_malloc0(nCtl*sizeof(olong));
+      for (k=0; k<nCtl-1; k++) (*ThreadArgs)[i]->ctlCol[k] = 1 + k*space;
+      (*ThreadArgs)[i]->ctlCol[nCtl-1] = nx;
+      (*ThreadArgs)[i]->ctl1   = g_malloc0(2*nCtl*sizeof(ofloat));
+      (*ThreadArgs)[i]->ctl2   = g_malloc0(2*nCtl*sizeof(ofloat));
+      (*ThreadArgs)[i]->ctlOK1 = g_malloc0(nCtl*sizeof(gboolean));
+      (*ThreadArgs)[i]->ctlOK2 = g_malloc0(nCtl*sizeof(gboolean));
+      (*ThreadArgs)[i]->cellOK = g_malloc0(nCtl*sizeof(gboolean));
+    }
+    (*ThreadArgs)[i]->xRow     = g_malloc0(nx*sizeof(ofloat));
+    (*ThreadArgs)[i]->yRow     = g_malloc0(nx*sizeof(ofloat));
+    (*ThreadArgs)[i]->okRow    = g_malloc0(nx*sizeof(gboolean));
     (*ThreadArgs)[i]->ithread  = i;
     (*ThreadArgs)[i]->thread   = thread;
     (*ThreadArgs)[i]->err      = err;
@@ -6331,6 +6605,15 @@ static void KillInterpFuncArgs (olong nargs, InterpFuncArg **ThreadArgs)
       if (ThreadArgs[i]->wtData)   ObitFArrayUnref(ThreadArgs[i]->wtData);
       if (ThreadArgs[i]->Interp)   ObitFInterpolateUnref(ThreadArgs[i]->Interp);
       if (ThreadArgs[i]->ZCoef)    g_free(ThreadArgs[i]->ZCoef);
+      if (ThreadArgs[i]->ctlCol)   g_free(ThreadArgs[i]->ctlCol);
+      if (ThreadArgs[i]->ctl1)     g_free(ThreadArgs[i]->ctl1);
+      if (ThreadArgs[i]->ctl2)     g_free(ThreadArgs[i]->ctl2);
+      if (ThreadArgs[i]->ctlOK1)   g_free(ThreadArgs[i]->ctlOK1);
+      if (ThreadArgs[i]->ctlOK2)   g_free(ThreadArgs[i]->ctlOK2);
+      if (ThreadArgs[i]->cellOK)   g_free(ThreadArgs[i]->cellOK);
+      if (ThreadArgs[i]->xRow)     g_free(ThreadArgs[i]->xRow);
+      if (ThreadArgs[i]->yRow)     g_free(ThreadArgs[i]->yRow);
+      if (ThreadArgs[i]->okRow)    g_free(ThreadArgs[i]->okRow);
       g_free(ThreadArgs[i]);
     }
   }
@@ -763,6 +763,52 @@ void ObitMatxVec4Mult(ObitMatx *iin1, ObitMatx *iin2, ObitMatx *oout) {
   }
 } /* end ObitMatxVec4Mult */
 
+/**
+ *  Batch of 4x4 complex matrix * 4x1 complex vector multiplies 
+ *  out[i] = mat[i] x vec[i], i=0...n-1
+ *  Vectors are stored as structure of arrays to allow the compiler
+ *  to vectorize over the batch: the real part of element k of vector i
+ *  is vec[(2*k)*n+i] and the imaginary part vec[(2*k+1)*n+i].
+ * \param mat   Matrices, each as 4x4 complex (32 floats) in the order of 
+ *              the array of a 4x4 OBIT_Complex ObitMatx.
+ * \param minc  Increment in floats between matrices, 0=> same for all 
+ * \param vec   Input vectors, 8*n floats
+ * \param out   Output vectors, 8*n floats, must not overlap vec
+ * \param n     Number of vectors
+ */
+void ObitMatxVec4MultBatch(ofloat *mat, olong minc, ofloat *vec, ofloat *out, olong n) 
+{
+  olong i, ic, ii, m;
+  ofloat mr, mi;
+  ofloat *vr, *vi, *outr, *outi;
+
+  /* Zero output */
+  for (i=0; i<8*n; i++) out[i] = 0.0;
+
+  for (ic=0; ic<4; ic++) {
+    outr = &out[(2*ic)*n];
+    outi = &out[(2*ic+1)*n];
+    for (ii=0; ii<4; ii++) {
+      vr = &vec[(2*ii)*n];
+      vi = &vec[(2*ii+1)*n];
+      m  = (ic*4+ii)*2;
+      if (minc==0) { /* Same matrix */
+	mr = mat[m]; mi = mat[m+1];
+	for (i=0; i<n; i++) {
+	  outr[i] += mr*vr[i] - mi*vi[i];
+	  outi[i] += mr*vi[i] + mi*vr[i];
+	}
+      } else {       /* Matrix per vector */
+	for (i=0; i<n; i++) {
+	  mr = mat[i*minc+m]; mi = mat[i*minc+m+1];
+	  outr[i] += mr*vr[i] - mi*vi[i];
+	  outi[i] += mr*vi[i] + mi*vr[i];
+	}
+      }
+    } /* end loop over input element */
+  } /* end loop over output element */
+} /* end ObitMatxVec4MultBatch */
+
 /**
  * Initialize global ClassInfo Structure.
  */
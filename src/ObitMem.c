@@ -27,6 +27,10 @@
 /*--------------------------------------------------------------------*/
 #include <string.h>
 #include "ObitMem.h"
+#if defined(FASTOBITMEM) && (defined(__linux__) || defined(__APPLE__))
+#include <sys/mman.h>
+#define OBITMEM_MMAP 1
+#endif
 
 /*----------------Obit: Merx mollis mortibus nuper ------------------*/
 /**
@@ -36,6 +40,19 @@
  * Obit Memory management class
  * Use compiler switch -DFASTOBITMEM to disable checking or
  * -DMEMWATCH to use MEMWATCH debugging
+ *
+ * With FASTOBITMEM small blocks come directly from g_malloc.
+ * Blocks of at least OBITMEM_LARGE bytes come from an arena of 
+ * (huge) page aligned mappings; freed arena blocks are kept in a 
+ * cache (limited by ObitMemSetCache) for reuse by later requests 
+ * of similar size and released by ObitMemTrim.
+ * Other caches of idle memory (e.g. ObitIO buffers) count against the
+ * same limit through ObitMemCacheHold.
+ * Accounting (per name counters, high water mark) is off unless
+ * enabled by ObitMemSetAccount or environment variable OBIT_MEM_ACCOUNT.
+ * Tracked blocks are kept in a table split into independently locked 
+ * shards and the counters are updated atomically so there is no 
+ * global lock.
  */
 
 /*--------------Class definitions-------------------------------------*/
@@ -62,6 +79,10 @@ typedef struct  {
     GHashTable *memTable;
     /** How many entries */
     gsize number;
+    /** Total bytes allocated */
+    gsize total;
+    /** Maximum of total */
+    gsize hiwater;
 } ObitMemClassInfo;
 
 /**
@@ -77,6 +98,104 @@ typedef struct  {
 /** Switch to use fast memory allocation and no accountability */
 /* #define FASTOBITMEM */
 
+#ifdef FASTOBITMEM
+/** Allocations at least this large (bytes) come from the arena */
+#define OBITMEM_LARGE (4*1024*1024)
+/** Arena blocks are multiples of and aligned to this (huge page) */
+#define OBITMEM_HUGE  (2*1024*1024)
+/** Number of shards in the table of tracked blocks */
+#define OBITMEM_NSHARD 64
+/** Number of slots for per name counters */
+#define OBITMEM_NNAME  512
+
+/**
+ * Tracked (arena or accounted) memory block
+ */
+typedef struct {
+    /**  Pointer */
+    gpointer mem;
+    /** size in bytes requested */
+    gsize size;
+    /** size in bytes mapped (arena blocks) */
+    gsize length;
+    /** Counter slot in memNames, -1 => not counted */
+    olong slot;
+    /** Is this an arena block? */
+    gboolean isLarge;
+} memBlock;
+
+/**
+ * Shard of table of tracked blocks
+ */
+typedef struct {
+    /** Lock for this shard only */
+    GMutex lock;
+    /** Table of memBlock keyed by address */
+    GHashTable *table;
+} memShard;
+
+/**
+ * Counters for allocations with a given name
+ */
+typedef struct {
+    /** name, NULL => slot unused */
+    gchar *name;
+    /** Number of blocks currently allocated */
+    volatile ollong number;
+    /** Bytes currently allocated */
+    volatile ollong bytes;
+    /** Maximum of bytes */
+    volatile ollong hiwater;
+    /** Number of allocations ever */
+    volatile ollong nalloc;
+} memNameCount;
+
+/** Shards of table of tracked blocks */
+static memShard memShards[OBITMEM_NSHARD];
+
+/** Per name counters */
+static memNameCount memNames[OBITMEM_NNAME];
+
+/** Number of tracked blocks */
+static volatile ollong memTracked = 0;
+
+/** Accounting? -1 => not yet determined */
+static volatile gint memAccount = -1;
+
+/** Number of accounted blocks */
+static volatile ollong memNumber = 0;
+
+/** Accounted bytes */
+static volatile ollong memTotal = 0;
+
+/** Maximum of memTotal */
+static volatile ollong memHiWater = 0;
+#endif /* FASTOBITMEM  */
+
+/** Default maximum size of cache of free memory (MByte) */
+#define OBITMEM_CACHE  1024
+
+/**
+ * Cache of free memory.
+ * Holds freed arena blocks (FASTOBITMEM only) and counts memory held
+ * idle by other caches (ObitMemCacheHold) against the same limit.
+ */
+typedef struct {
+    /** Lock */
+    GMutex lock;
+    /** List of free arena blocks (memBlock), oldest first */
+    GSList *blocks;
+    /** Total bytes in blocks */
+    gsize bytes;
+    /** Bytes held by other caches */
+    gsize held;
+    /** Maximum bytes to keep, blocks plus held */
+    gsize maxBytes;
+} memCache;
+
+/** Cache of free memory */
+static memCache memFreeCache = {{0}, NULL, 0, 0, OBITMEM_CACHE*(gsize)1048576};
+
 
 /*--------------- File Global Variables  ----------------*/
 /**
@@ -115,6 +234,50 @@ static void  memTablePrint(gpointer key, gpointer inn, gpointer file);
 /** Private: Accumulate bytes in an memTableElem */
 static void  memTableSum(gpointer key, gpointer inn, gpointer dcount);
 
+#ifdef FASTOBITMEM
+/** Private: allocate, possibly tracked */
+static gpointer fastAlloc(gsize size, const gchar *name, gboolean zero);
+
+/** Private: reallocate, possibly tracked */
+static gpointer fastRealloc(gpointer mem, gsize size);
+
+/** Private: deallocate, possibly tracked */
+static void fastFree(gpointer mem);
+
+/** Private: Is accounting on? */
+static gboolean memAccounting(void);
+
+/** Private: Add to counters, return name slot */
+static olong memCountAdd(const gchar *name, olong slot, ollong nblock, ollong bytes);
+
+/** Private: Add block to table of tracked blocks */
+static void memTrack(memBlock *blk);
+
+/** Private: Remove block from table of tracked blocks */
+static memBlock* memUntrack(gpointer mem);
+
+/** Private: Get arena block */
+static memBlock* memLargeAlloc(gsize size, gboolean zero);
+
+/** Private: Return arena block to cache */
+static void memLargeRelease(memBlock *blk);
+
+/** Private: Unmap arena block */
+static void memLargeUnmap(memBlock *blk);
+
+/** Private: Unlink excess cached blocks */
+static GSList* memCacheExcess(gsize keep);
+
+/** Private: Release unlinked cached blocks */
+static void memCacheDrop(GSList *drop);
+
+/** Private: Atomically raise high water mark */
+static void memRaise(volatile ollong *hiwater, ollong value);
+
+/** Private: Shard of tracked block table for address */
+static memShard* memGetShard(gpointer mem);
+#endif /* FASTOBITMEM  */
+
 /*---------------Public functions---------------------------*/
 #ifndef MEMWATCH
 /**
@@ -127,7 +290,7 @@ static void  memTableSum(gpointer key, gpointer inn, gpointer dcount);
 gpointer ObitMemAlloc(gsize size)
 {
 #ifdef FASTOBITMEM /* Fast allocation */
-    return g_malloc(size);
+    return fastAlloc(size, NULL, FALSE);
 #else              /* Accountability */
 
     gpointer out = NULL;
@@ -168,7 +331,7 @@ gpointer ObitMemAlloc(gsize size)
 gpointer ObitMemAlloc0(gsize size)
 {
 #ifdef FASTOBITMEM /* Fast allocation */
-    return g_malloc0(size);
+    return fastAlloc(size, NULL, TRUE);
 #else              /* Accountability */
     gpointer out = NULL;
     memTableElem *elem = NULL;
@@ -209,7 +372,7 @@ gpointer ObitMemAlloc0(gsize size)
 gpointer ObitMemAllocName(gsize size, const gchar *name)
 {
 #ifdef FASTOBITMEM /* Fast allocation */
-    return g_malloc(size);
+    return fastAlloc(size, name, FALSE);
 #else              /* Accountability */
     gpointer out = NULL;
     memTableElem *elem = NULL;
@@ -250,7 +413,7 @@ gpointer ObitMemAllocName(gsize size, const gchar *name)
 gpointer ObitMemAlloc0Name(gsize size, const gchar *name)
 {
 #ifdef FASTOBITMEM /* Fast allocation */
-    return g_malloc0(size);
+    return fastAlloc(size, name, TRUE);
 #else              /* Accountability */
     gpointer out = NULL;
     memTableElem *elem = NULL;
@@ -296,7 +459,7 @@ gpointer ObitMemAlloc0Name(gsize size, const gchar *name)
 gpointer ObitMemRealloc(gpointer mem, gsize size)
 {
 #ifdef FASTOBITMEM /* Fast allocation */
-    return g_realloc(mem, size);
+    return fastRealloc(mem, size);
 #else              /* Accountability */
     memTableElem *elem = NULL;
     gpointer out = NULL;
@@ -316,7 +479,10 @@ gpointer ObitMemRealloc(gpointer mem, gsize size)
         out = elem->mem;
 
         /* Is it the same size? If so just return */
-        if (elem->size == size) return out;
+        if (elem->size == size) {
+            ObitThreadUnlock(myClassInfo.thread);
+            return out;
+        }
     }
 
     /* Realloc */
@@ -329,8 +495,12 @@ gpointer ObitMemRealloc(gpointer mem, gsize size)
         /* add to list */
         memTableAdd(&myClassInfo, elem);
     } else { /* just reset pointer, size */
+        g_hash_table_steal(myClassInfo.memTable, elem->mem);
+        myClassInfo.total += size - elem->size;
+        myClassInfo.hiwater = MAX(myClassInfo.hiwater, myClassInfo.total);
         elem->mem = out;
         elem->size = size;
+        g_hash_table_insert(myClassInfo.memTable, elem->mem, elem);
     }
 
     /* Unlock object */
@@ -351,7 +521,7 @@ gpointer ObitMemRealloc(gpointer mem, gsize size)
 gpointer ObitMemFree(gpointer mem)
 {
 #ifdef FASTOBITMEM /* Fast allocation */
-    g_free(mem);
+    fastFree(mem);
     return NULL;
 #else              /* Accountability */
     memTableElem *elem = NULL;
@@ -367,7 +537,10 @@ gpointer ObitMemFree(gpointer mem)
     /* is it in the list? */
     elem =  memTableFind(&myClassInfo, mem);
 
-    if (elem == NULL) return NULL; /* bag it if it's not there */
+    if (elem == NULL) { /* bag it if it's not there */
+        ObitThreadUnlock(myClassInfo.thread);
+        return NULL;
+    }
 
     /* DEBUG
     if (elem->mem==(gpointer)0x82d3c88) {
@@ -432,7 +605,26 @@ void ObitMemPrint(FILE *file)
     return;  /* No can do */
 #endif
 #ifdef FASTOBITMEM /* Fast allocation */
-    return;  /* No can do */
+    olong i;
+
+    if (!memAccounting()) {
+        fprintf(file, "Obit memory accounting not enabled\n");
+        return;
+    }
+
+    fprintf(file, "Obit memory allocation has %ld entries, %ld bytes, high water %ld\n",
+            (long)__sync_fetch_and_add(&memNumber, 0),
+            (long)__sync_fetch_and_add(&memTotal, 0),
+            (long)__sync_fetch_and_add(&memHiWater, 0));
+    fprintf(file, "   number        bytes     hiwater   nalloc name\n");
+    for (i=0; i<OBITMEM_NNAME; i++) {
+        if (memNames[i].name == NULL) continue;
+        fprintf(file, "%9ld %12ld %11ld %8ld %s\n",
+                (long)memNames[i].number, (long)memNames[i].bytes,
+                (long)memNames[i].hiwater, (long)memNames[i].nalloc,
+                memNames[i].name);
+    }
+    return;
 #else              /* Accountability */
 
     if (!myClassInfo.init) {
@@ -452,6 +644,8 @@ void ObitMemPrint(FILE *file)
 
 /**
  * Give Summary of contents of myClassInfo
+ * With FASTOBITMEM accounting must be enabled (ObitMemSetAccount) 
+ * else zeroes are returned; no lock is taken.
  * \param number  Number of entries
  * \param total   Total memory allocated in MByte
  */
@@ -463,7 +657,9 @@ void ObitMemSummary(olong *number, olong *total)
     return;  /* No can do */
 #endif
 #ifdef FASTOBITMEM /* Fast allocation */
-    return;  /* No can do */
+    *number = (olong)__sync_fetch_and_add(&memNumber, 0);
+    *total  = (olong)(0.5 + (__sync_fetch_and_add(&memTotal, 0) / (1024.0 * 1024.0)));
+    return;
 #else              /* Accountability */
     odouble count = 0.0;
 
@@ -484,6 +680,114 @@ void ObitMemSummary(olong *number, olong *total)
 #endif /* FASTOBITMEM  */
 } /* end ObitMemSummary */
 
+/**
+ * Give maximum total memory allocated 
+ * With FASTOBITMEM accounting must be enabled (ObitMemSetAccount).
+ * \return high water mark in MByte
+ */
+olong ObitMemHighWater(void)
+{
+#ifdef MEMWATCH /* Using memwatch instead */
+    return 0;  /* No can do */
+#endif
+#ifdef FASTOBITMEM /* Fast allocation */
+    return (olong)(0.5 + (__sync_fetch_and_add(&memHiWater, 0) / (1024.0 * 1024.0)));
+#else              /* Accountability */
+    return (olong)(0.5 + (myClassInfo.hiwater / (1024.0 * 1024.0)));
+#endif /* FASTOBITMEM  */
+} /* end ObitMemHighWater */
+
+/**
+ * Turn accounting of FASTOBITMEM allocations on or off.
+ * Blocks allocated while accounting is off are never counted.
+ * Always on without FASTOBITMEM.
+ * \param doAccount  TRUE to count allocations by name
+ */
+void ObitMemSetAccount(gboolean doAccount)
+{
+#ifdef FASTOBITMEM /* Fast allocation */
+    memAccount = doAccount ? 1 : 0;
+#endif /* FASTOBITMEM  */
+} /* end ObitMemSetAccount */
+
+/**
+ * Set maximum size of the cache of free memory kept for reuse.
+ * This limit covers both freed large blocks (FASTOBITMEM only) and
+ * memory held by other caches through ObitMemCacheHold.
+ * Excess blocks are released.
+ * \param maxMByte  Maximum cache size in MByte, 0 => no cache
+ */
+void ObitMemSetCache(olong maxMByte)
+{
+    g_mutex_lock(&memFreeCache.lock);
+    memFreeCache.maxBytes = MAX(0, maxMByte) * (gsize)1048576;
+    g_mutex_unlock(&memFreeCache.lock);
+    ObitMemTrim(maxMByte);
+} /* end ObitMemSetCache */
+
+/**
+ * Release freed large blocks from the cache, oldest first, until
+ * the cached blocks plus memory held by other caches fit.
+ * NOP without FASTOBITMEM.
+ * \param keepMByte  Maximum to retain in cache in MByte, 0 => all released
+ */
+void ObitMemTrim(olong keepMByte)
+{
+#ifdef FASTOBITMEM /* Fast allocation */
+    GSList *drop = NULL;
+
+    g_mutex_lock(&memFreeCache.lock);
+    drop = memCacheExcess(MAX(0, keepMByte) * (gsize)1048576);
+    g_mutex_unlock(&memFreeCache.lock);
+
+    /* Release outside of lock */
+    memCacheDrop(drop);
+#endif /* FASTOBITMEM  */
+} /* end ObitMemTrim */
+
+/**
+ * Count idle memory held by another cache against the limit
+ * set by ObitMemSetCache.  Cached large blocks are released, oldest
+ * first, to make room.
+ * Holds are returned by ObitMemCacheRelease.
+ * \param bytes  Number of bytes to be held
+ * \return TRUE if held, FALSE if it does not fit; the caller
+ *         should then deallocate the memory.
+ */
+gboolean ObitMemCacheHold(gsize bytes)
+{
+    gboolean out = FALSE;
+#ifdef FASTOBITMEM /* Fast allocation */
+    GSList *drop = NULL;
+#endif /* FASTOBITMEM  */
+
+    g_mutex_lock(&memFreeCache.lock);
+    if (memFreeCache.held + bytes <= memFreeCache.maxBytes) {
+        memFreeCache.held += bytes;
+        out = TRUE;
+#ifdef FASTOBITMEM /* Fast allocation */
+        drop = memCacheExcess(memFreeCache.maxBytes);
+#endif /* FASTOBITMEM  */
+    }
+    g_mutex_unlock(&memFreeCache.lock);
+
+#ifdef FASTOBITMEM /* Fast allocation */
+    memCacheDrop(drop);
+#endif /* FASTOBITMEM  */
+    return out;
+} /* end ObitMemCacheHold */
+
+/**
+ * Return memory held by ObitMemCacheHold
+ * \param bytes  Number of bytes no longer held
+ */
+void ObitMemCacheRelease(gsize bytes)
+{
+    g_mutex_lock(&memFreeCache.lock);
+    memFreeCache.held -= MIN(bytes, memFreeCache.held);
+    g_mutex_unlock(&memFreeCache.lock);
+} /* end ObitMemCacheRelease */
+
 
 /**
  * Initialize global ClassInfo Structure.
@@ -501,6 +805,8 @@ void ObitMemClassInit(void)
     /* initialize list */
     myClassInfo.memTable = g_hash_table_new(NULL, NULL);
     myClassInfo.number  = 0;
+    myClassInfo.total   = 0;
+    myClassInfo.hiwater = 0;
 
 } /* end ObitMemClassInit */
 
@@ -559,6 +865,8 @@ static void memTableAdd(ObitMemClassInfo *in, memTableElem *elem)
     /* add to table */
     g_hash_table_insert(in->memTable, elem->mem, elem);
     in->number++;
+    in->total += elem->size;
+    in->hiwater = MAX(in->hiwater, in->total);
 
 } /* end memTableAdd */
 
@@ -577,6 +885,7 @@ static void memTableRemove(ObitMemClassInfo *in, memTableElem *elem)
     }
 
     in->number--; /* keep count */
+    in->total -= elem->size;
 
 } /* end memTableRemove  */
 
@@ -647,3 +956,400 @@ static void  memTableSum(gpointer key, gpointer inn, gpointer dcount)
     /* Accumulate */
     *count += in->size;
 } /* end memTableSum */
+
+#ifdef FASTOBITMEM
+/**
+ * Allocate block, arena for large blocks, else g_malloc
+ * Small blocks are only tracked if accounting is enabled.
+ * \param size Number of bytes requested
+ * \param name Name for counters, NULL => "unnamed"
+ * \param zero If TRUE zero fill
+ * \return pointer to allocated memory, NULL if size=0
+ */
+static gpointer fastAlloc(gsize size, const gchar *name, gboolean zero)
+{
+    memBlock *blk = NULL;
+    gpointer out  = NULL;
+    gboolean account;
+
+    /* nothing asked for - nothing given */
+    if (size == 0) return NULL;
+
+    account = memAccounting();
+
+    if (size >= OBITMEM_LARGE) { /* arena */
+        blk = memLargeAlloc(size, zero);
+    } else {                     /* small */
+        if (zero) out = g_malloc0(size);
+        else      out = g_malloc(size);
+
+        if (!account) return out;  /* no tracking needed */
+
+        blk = g_malloc0(sizeof(memBlock));
+        blk->mem     = out;
+        blk->size    = size;
+        blk->length  = size;
+        blk->isLarge = FALSE;
+    }
+
+    blk->slot = -1;
+    if (account) blk->slot = memCountAdd(name, -1, 1, (ollong)size);
+
+    memTrack(blk);
+    return blk->mem;
+} /* end fastAlloc */
+
+/**
+ * Reallocate block
+ * Arena blocks are kept in place if they are big enough.
+ * Untracked blocks are simply passed to g_realloc.
+ * \param mem Pointer to old memory, NULL => allocate
+ * \param size Number of bytes requested, 0 => free
+ * \return pointer to allocated memory
+ */
+static gpointer fastRealloc(gpointer mem, gsize size)
+{
+    memBlock *blk = NULL, *nblk = NULL;
+
+    if (mem == NULL) return fastAlloc(size, NULL, FALSE);
+
+    if (size == 0) {
+        fastFree(mem);
+        return NULL;
+    }
+
+    blk = memUntrack(mem);
+    if (blk == NULL) return g_realloc(mem, size);  /* not ours */
+
+    if (blk->slot >= 0)
+        memCountAdd(NULL, blk->slot, 0, (ollong)size - (ollong)blk->size);
+
+    if (blk->isLarge) {
+        if (size <= blk->length) {  /* fits */
+            blk->size = size;
+            memTrack(blk);
+            return blk->mem;
+        }
+
+        /* Copy to new block */
+        nblk = memLargeAlloc(size, FALSE);
+        memcpy(nblk->mem, blk->mem, blk->size);
+        nblk->slot = blk->slot;
+        memLargeRelease(blk);
+        memTrack(nblk);
+        return nblk->mem;
+    }
+
+    /* Small block */
+    blk->mem    = g_realloc(blk->mem, size);
+    blk->size   = size;
+    blk->length = size;
+    memTrack(blk);
+    return blk->mem;
+} /* end fastRealloc */
+
+/**
+ * Free block
+ * \param mem Pointer to memory to be freed, NULL => NOP
+ */
+static void fastFree(gpointer mem)
+{
+    memBlock *blk = NULL;
+
+    if (mem == NULL) return;
+
+    blk = memUntrack(mem);
+    if (blk == NULL) {  /* Untracked small block */
+        g_free(mem);
+        return;
+    }
+
+    if (blk->slot >= 0)
+        memCountAdd(NULL, blk->slot, -1, -(ollong)blk->size);
+
+    if (blk->isLarge) {
+        memLargeRelease(blk);
+    } else {
+        g_free(blk->mem);
+        g_free(blk);
+    }
+} /* end fastFree */
+
+/**
+ * Is accounting enabled?
+ * If not set, initialized from environment variable OBIT_MEM_ACCOUNT
+ * \return TRUE if accounting
+ */
+static gboolean memAccounting(void)
+{
+    gchar *env;
+
+    if (memAccount < 0) {
+        env = getenv("OBIT_MEM_ACCOUNT");
+        memAccount = ((env != NULL) && (env[0] != 0) && (env[0] != '0')) ? 1 : 0;
+    }
+    return memAccount > 0;
+} /* end memAccounting */
+
+/**
+ * Atomically raise high water mark
+ * \param hiwater  Mark to update
+ * \param value    New value
+ */
+static void memRaise(volatile ollong *hiwater, ollong value)
+{
+    ollong old;
+
+    old = *hiwater;
+    while (value > old) {
+        if (__sync_bool_compare_and_swap(hiwater, old, value)) break;
+        old = *hiwater;
+    }
+} /* end memRaise */
+
+/**
+ * Update per name and global counters
+ * A slot for name is claimed by atomically setting its name.
+ * \param name    Name for counters, used if slot<0, NULL => "unnamed"
+ * \param slot    Slot in memNames, <0 => look up name
+ *                OBITMEM_NNAME => table full, global counters only
+ * \param nblock  Change in number of blocks
+ * \param bytes   Change in bytes
+ * \return slot used
+ */
+static olong memCountAdd(const gchar *name, olong slot, ollong nblock, ollong bytes)
+{
+    olong i, n;
+    gchar *tname;
+    ollong total;
+
+    /* Find/claim slot */
+    if (slot < 0) {
+        if (name == NULL) name = "unnamed";
+        slot = OBITMEM_NNAME;
+        i = g_str_hash(name) % OBITMEM_NNAME;
+        for (n=0; n<OBITMEM_NNAME; n++) {
+            if (memNames[i].name == NULL) {
+                tname = g_strdup(name);
+                if (!__sync_bool_compare_and_swap(&memNames[i].name, NULL, tname))
+                    g_free(tname);  /* Someone else got here first */
+            }
+            if (!strcmp(memNames[i].name, name)) {
+                slot = i;
+                break;
+            }
+            i = (i + 1) % OBITMEM_NNAME;
+        }
+    }
+
+    /* Global counters */
+    __sync_add_and_fetch(&memNumber, nblock);
+    total = __sync_add_and_fetch(&memTotal, bytes);
+    memRaise(&memHiWater, total);
+
+    if (slot >= OBITMEM_NNAME) return slot;
+
+    /* Per name */
+    __sync_add_and_fetch(&memNames[slot].number, nblock);
+    total = __sync_add_and_fetch(&memNames[slot].bytes, bytes);
+    memRaise(&memNames[slot].hiwater, total);
+    if (nblock > 0) __sync_add_and_fetch(&memNames[slot].nalloc, nblock);
+
+    return slot;
+} /* end memCountAdd */
+
+/**
+ * Shard of table of tracked blocks for an address
+ * \param mem  Address
+ * \return shard
+ */
+static memShard* memGetShard(gpointer mem)
+{
+    gsize addr = (gsize)mem;
+
+    return &memShards[((addr >> 4) ^ (addr >> 12) ^ (addr >> 21)) % OBITMEM_NSHARD];
+} /* end memGetShard */
+
+/**
+ * Add block to table of tracked blocks
+ * \param blk  Block, MUST NOT be in table
+ */
+static void memTrack(memBlock *blk)
+{
+    memShard *shard = memGetShard(blk->mem);
+
+    g_mutex_lock(&shard->lock);
+    if (shard->table == NULL) shard->table = g_hash_table_new(NULL, NULL);
+    g_hash_table_insert(shard->table, blk->mem, blk);
+    g_mutex_unlock(&shard->lock);
+
+    __sync_add_and_fetch(&memTracked, 1);
+} /* end memTrack */
+
+/**
+ * Remove block from table of tracked blocks
+ * \param mem  Address of block
+ * \return block, NULL if not tracked
+ */
+static memBlock* memUntrack(gpointer mem)
+{
+    memShard *shard;
+    memBlock *blk = NULL;
+
+    if (memTracked <= 0) return NULL;  /* Nothing tracked */
+
+    shard = memGetShard(mem);
+    g_mutex_lock(&shard->lock);
+    if (shard->table != NULL) {
+        blk = g_hash_table_lookup(shard->table, mem);
+        if (blk != NULL) g_hash_table_steal(shard->table, mem);
+    }
+    g_mutex_unlock(&shard->lock);
+
+    if (blk != NULL) __sync_sub_and_fetch(&memTracked, 1);
+    return blk;
+} /* end memUntrack */
+
+/**
+ * Get arena block, best fit from cache if possible, else new mapping
+ * \param size Number of bytes requested
+ * \param zero If TRUE zero fill
+ * \return block, slot not set
+ */
+static memBlock* memLargeAlloc(gsize size, gboolean zero)
+{
+    memBlock *blk = NULL, *best = NULL;
+    GSList *tmp;
+    gsize length;
+#ifdef OBITMEM_MMAP
+    gchar *base;
+    gsize map, lead;
+#endif
+
+    /* Round up to huge pages */
+    length = ((size + OBITMEM_HUGE - 1) / OBITMEM_HUGE) * OBITMEM_HUGE;
+
+    /* Look in cache for smallest block that fits without too much waste */
+    g_mutex_lock(&memFreeCache.lock);
+    for (tmp=memFreeCache.blocks; tmp!=NULL; tmp=g_slist_next(tmp)) {
+        blk = (memBlock*)tmp->data;
+        if ((blk->length < length) || (blk->length > 2 * length)) continue;
+        if ((best == NULL) || (blk->length < best->length)) best = blk;
+        if (best->length == length) break;  /* Can't do better */
+    }
+    if (best != NULL) {
+        memFreeCache.blocks = g_slist_remove(memFreeCache.blocks, best);
+        memFreeCache.bytes -= best->length;
+    }
+    g_mutex_unlock(&memFreeCache.lock);
+
+    if (best != NULL) {  /* reuse */
+        if (zero) memset(best->mem, 0, size);
+        best->size = size;
+        return best;
+    }
+
+    /* New block */
+    blk = g_malloc0(sizeof(memBlock));
+    blk->size    = size;
+    blk->length  = length;
+    blk->isLarge = TRUE;
+    blk->slot    = -1;
+
+#ifdef OBITMEM_MMAP
+    /* Over map by a huge page to allow alignment, new pages are zero */
+    map  = length + OBITMEM_HUGE;
+    base = mmap(NULL, map, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {  /* Release cache and try again */
+        ObitMemTrim(0);
+        base = mmap(NULL, map, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED)
+            g_error("ObitMem: failed to map %lu bytes", (gulong)map);
+    }
+
+    /* Trim to alignment */
+    lead = (OBITMEM_HUGE - ((gsize)base % OBITMEM_HUGE)) % OBITMEM_HUGE;
+    if (lead > 0) munmap(base, lead);
+    if (map > lead + length) munmap(base + lead + length, map - lead - length);
+    blk->mem = base + lead;
+#ifdef MADV_HUGEPAGE
+    madvise(blk->mem, length, MADV_HUGEPAGE);
+#endif
+#else
+    if (zero) blk->mem = g_malloc0(length);
+    else      blk->mem = g_malloc(length);
+#endif /* OBITMEM_MMAP */
+
+    return blk;
+} /* end memLargeAlloc */
+
+/**
+ * Return arena block to cache, oldest blocks released if it is full
+ * \param blk  Block, no longer tracked
+ */
+static void memLargeRelease(memBlock *blk)
+{
+    GSList *drop = NULL;
+
+    g_mutex_lock(&memFreeCache.lock);
+    if (memFreeCache.held + blk->length <= memFreeCache.maxBytes) {
+        memFreeCache.blocks = g_slist_append(memFreeCache.blocks, blk);
+        memFreeCache.bytes += blk->length;
+        blk = NULL;
+    }
+    drop = memCacheExcess(memFreeCache.maxBytes);
+    g_mutex_unlock(&memFreeCache.lock);
+
+    /* Release outside of lock */
+    if (blk != NULL) memLargeUnmap(blk);
+    memCacheDrop(drop);
+} /* end memLargeRelease */
+
+/**
+ * Unlink oldest cached blocks until blocks plus held memory fit.
+ * memFreeCache MUST be locked.
+ * \param keep  Maximum bytes to retain
+ * \return list of unlinked blocks to pass to memCacheDrop
+ */
+static GSList* memCacheExcess(gsize keep)
+{
+    memBlock *old;
+    GSList *drop = NULL;
+
+    while (memFreeCache.blocks && (memFreeCache.bytes + memFreeCache.held > keep)) {
+        old = (memBlock*)memFreeCache.blocks->data;
+        memFreeCache.blocks = g_slist_remove(memFreeCache.blocks, old);
+        memFreeCache.bytes -= old->length;
+        drop = g_slist_prepend(drop, old);
+    }
+    return drop;
+} /* end memCacheExcess */
+
+/**
+ * Release blocks unlinked by memCacheExcess
+ * memFreeCache should NOT be locked.
+ * \param drop  List of blocks, freed
+ */
+static void memCacheDrop(GSList *drop)
+{
+    GSList *tmp;
+
+    for (tmp=drop; tmp!=NULL; tmp=g_slist_next(tmp))
+        memLargeUnmap((memBlock*)tmp->data);
+    g_slist_free(drop);
+} /* end memCacheDrop */
+
+/**
+ * Release arena block memory and descriptor
+ * \param blk  Block, not tracked or cached
+ */
+static void memLargeUnmap(memBlock *blk)
+{
+#ifdef OBITMEM_MMAP
+    munmap(blk->mem, blk->length);
+#else
+    g_free(blk->mem);
+#endif /* OBITMEM_MMAP */
+    g_free(blk);
+} /* end memLargeUnmap */
+#endif /* FASTOBITMEM  */
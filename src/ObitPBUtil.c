@@ -43,6 +43,15 @@
 /** AIPSish Primary beam calculation */
 ofloat pbfact (olong pbtype, olong nfreq, odouble *pbfreq, ofloat pbfsiz, 
 	       olong ifreq, ofloat radius);
+
+/** Private: Beam gain computed directly for a tabulated beam */
+static ofloat PBUtilTabDirect (ObitPBUtilTab *in, odouble Angle, odouble Freq);
+
+/** Private: Beam gain for a table argument Angle*Freq */
+static ofloat PBUtilTabArg (ObitPBUtilTab *in, odouble u, odouble fGHz);
+
+/** Private: Fill beam table */
+static void PBUtilTabFill (ObitPBUtilTab *in, odouble fGHz);
 /*----------------------Public functions---------------------------*/
 
 /**
@@ -328,6 +337,203 @@ ofloat ObitPBUtilPntErr (odouble Angle, odouble AngleO, ofloat antSize,
   return PBfact;
 } /* end ObitPBUtilPntErr */
 
+/**
+ * Create a tabulated beam shape.
+ * Within a frequency band the analytic beam shapes are functions of 
+ * Angle*Freq so the power gain is tabulated in that product and 
+ * linearly interpolated.  The table spacing is halved until the 
+ * interpolation error at the midpoints between entries is less than 
+ * maxErr.  The table extends to the last sidelobe for the Jinc beam and 
+ * to the point where the gain first reaches pbmin for the polynomials; 
+ * larger arguments are evaluated directly.
+ * \param type    Beam shape
+ * \param Freq    Frequency (Hz) selecting the band for OBIT_PBUtil_Poly
+ * \param antSize Antenna diameter in meters (Jinc, defaults to 25.0)
+ * \param pbmin   Minimum antenna gain as passed to the beam function
+ * \param maxErr  Maximum interpolation error in gain, 0 => 1.0e-4
+ * \return new table, delete using ObitPBUtilTabFree
+ */
+ObitPBUtilTab* ObitPBUtilTabCreate (ObitPBUtilType type, odouble Freq, 
+				    ofloat antSize, ofloat pbmin, ofloat maxErr)
+{
+  ObitPBUtilTab *out;
+  olong i, maxN = 65537;
+  odouble u, du, scale, err, maxDiff, fGHz, gmin;
+  ofloat mid, asize;
+  /* VLA polynomial band edges from ObitPBUtilPoly */
+  odouble bandEdge[9] = {0.0, 0.15e9, 1.1e9, 2.0e9, 6.0e9, 10.0e9, 18.0e9, 
+			 30.0e9, 1.0e30};
+
+  out = g_malloc0(sizeof(ObitPBUtilTab));
+  out->type    = type;
+  out->antSize = antSize;
+  out->pbmin   = pbmin;
+  out->freqLo  = 0.0;
+  out->freqHi  = 1.0e30;
+  if (maxErr<=0.0) maxErr = 1.0e-4;
+
+  /* Band and extent of table */
+  if (type==OBIT_PBUtil_Jinc) {
+    /* Jinc constant beyond x = 15 */
+    asize = antSize;
+    if (asize <= 0.0) asize = 25.0;
+    scale = 4.487e-9 * asize / 25.0;
+    out->maxArg = 1.0e-9 * 15.0 / scale;
+  } else {
+    /* Polynomial band */
+    if (type==OBIT_PBUtil_Poly) {
+      for (i=0; i<8; i++) {
+	if ((Freq>=bandEdge[i]) && (Freq<bandEdge[i+1])) {
+	  out->freqLo = bandEdge[i]; out->freqHi = bandEdge[i+1];
+	  break;
+	}
+      }
+    }
+  }
+
+  /* Frequency (GHz) at which to evaluate, in band */
+  if ((Freq>0.0) && (Freq>=out->freqLo) && (Freq<out->freqHi)) fGHz = Freq*1.0e-9;
+  else if (out->freqLo>0.0) fGHz = out->freqLo*1.0e-9;
+  else fGHz = 1.0;
+
+  /* Polynomials: first point where gain reaches the clip level */
+  if (type!=OBIT_PBUtil_Jinc) {
+    gmin = PBUtilTabArg (out, 1.0e6, fGHz);
+    du = 1.0e-3;
+    out->maxArg = 100.0;
+    for (u=du; u<100.0; u+=du) {
+      if (PBUtilTabArg (out, u, fGHz)<=gmin) {out->maxArg = u; break;}
+    }
+  }
+
+  /* Tabulate, refine until accurate enough */
+  out->n = 257;
+  while (1) {
+    PBUtilTabFill (out, fGHz);
+    if (out->n>=maxN) break;
+    /* Check midpoints */
+    maxDiff = 0.0;
+    for (i=0; i<out->n-1; i++) {
+      u   = (i+0.5) / out->iDelta;
+      mid = 0.5 * (out->gain[i] + out->gain[i+1]);
+      err = fabs (mid - PBUtilTabArg (out, u, fGHz));
+      maxDiff = MAX (maxDiff, err);
+    }
+    if (maxDiff<=maxErr) break;
+    out->n = 2*out->n - 1;
+  }
+
+  return out;
+} /* end ObitPBUtilTabCreate */
+
+/**
+ * Copy a tabulated beam shape.
+ * \param in  Table to copy, may be NULL
+ * \return new table, delete using ObitPBUtilTabFree
+ */
+ObitPBUtilTab* ObitPBUtilTabCopy (ObitPBUtilTab *in)
+{
+  ObitPBUtilTab *out;
+
+  if (in==NULL) return NULL;
+  out = g_malloc0(sizeof(ObitPBUtilTab));
+  *out = *in;
+  out->gain = g_malloc(in->n*sizeof(ofloat));
+  memcpy (out->gain, in->gain, in->n*sizeof(ofloat));
+  return out;
+} /* end ObitPBUtilTabCopy */
+
+/**
+ * Delete a tabulated beam shape.
+ * \param in  Table to delete, may be NULL
+ * \return NULL pointer
+ */
+ObitPBUtilTab* ObitPBUtilTabFree (ObitPBUtilTab *in)
+{
+  if (in==NULL) return NULL;
+  if (in->gain) g_free(in->gain);
+  g_free(in);
+  return NULL;
+} /* end ObitPBUtilTabFree */
+
+/**
+ * Is a tabulated beam shape usable for a given frequency, antenna size 
+ * and minimum gain?
+ * \param in      Table, may be NULL
+ * \param Freq    Frequency (Hz)
+ * \param antSize Antenna diameter in meters
+ * \param pbmin   Minimum antenna gain as passed to the beam function
+ * \return TRUE if in covers the request
+ */
+gboolean ObitPBUtilTabValid (ObitPBUtilTab *in, odouble Freq, ofloat antSize, 
+			     ofloat pbmin)
+{
+  if (in==NULL) return FALSE;
+  if ((Freq<in->freqLo) || (Freq>=in->freqHi)) return FALSE;
+  if (in->pbmin!=pbmin) return FALSE;
+  if ((in->type==OBIT_PBUtil_Jinc) && (in->antSize!=antSize)) return FALSE;
+  return TRUE;
+} /* end ObitPBUtilTabValid */
+
+/**
+ * Beam power gain from a tabulated beam shape.
+ * Frequencies out of the band of the table and angles beyond the table 
+ * are evaluated directly.
+ * \param in     Table
+ * \param Angle  Angle from the pointing position (deg)
+ * \param Freq   Frequency (Hz) of observations
+ * \return Fractional antenna power
+ */
+ofloat ObitPBUtilTabGain (ObitPBUtilTab *in, odouble Angle, odouble Freq)
+{
+  odouble x;
+  olong i;
+
+  if ((Freq<in->freqLo) || (Freq>=in->freqHi)) 
+    return PBUtilTabDirect (in, Angle, Freq);
+  x = fabs(Angle) * Freq * 1.0e-9;
+  if (x>=in->maxArg) return PBUtilTabDirect (in, Angle, Freq);
+  x *= in->iDelta;
+  i  = MIN ((olong)x, in->n-2);
+  return in->gain[i] + (ofloat)(x-i) * (in->gain[i+1] - in->gain[i]);
+} /* end ObitPBUtilTabGain */
+
+/**
+ * Beam power gains for an array of angles at one frequency from a 
+ * tabulated beam shape.
+ * \param in     Table
+ * \param n      Number of angles
+ * \param Angle  Angles from the pointing position (deg)
+ * \param Freq   Frequency (Hz) of observations
+ * \param gain   [out] Fractional antenna power, may be the same as Angle
+ */
+void ObitPBUtilTabGainVec (ObitPBUtilTab *in, olong n, ofloat *Angle, 
+			   odouble Freq, ofloat *gain)
+{
+  olong i, j, nm2;
+  ofloat x, fact, maxArg, w, *table;
+
+  /* Out of band? */
+  if ((Freq<in->freqLo) || (Freq>=in->freqHi)) {
+    for (i=0; i<n; i++) gain[i] = PBUtilTabDirect (in, Angle[i], Freq);
+    return;
+  }
+
+  /* Angle to table cell */
+  fact   = (ofloat)(Freq * 1.0e-9 * in->iDelta);
+  maxArg = (ofloat)(in->maxArg * in->iDelta);
+  nm2    = in->n - 2;
+  table  = in->gain;
+  for (i=0; i<n; i++) {
+    x = fabsf(Angle[i]) * fact;
+    if (x<maxArg) {
+      j = MIN ((olong)x, nm2);
+      w = x - j;
+      gain[i] = table[j] + w * (table[j+1] - table[j]);
+    } else gain[i] = PBUtilTabDirect (in, Angle[i], Freq);
+  }
+} /* end ObitPBUtilTabGainVec */
+
 /**
  * Derive an ObitTableCC from the input one in which the fluxes
  * are corrected by the relative antenna gains between refFreq and 
@@ -658,4 +864,48 @@ ofloat pbfact (olong pbtype, olong nfreq, odouble *pbfreq, ofloat pbfsiz,
   return pbf;
 } /* end of routine pbfact */ 
 
+/**
+ * Beam power gain computed directly for the beam shape of a table
+ * \param in     Table
+ * \param Angle  Angle from the pointing position (deg)
+ * \param Freq   Frequency (Hz) of observations
+ * \return Fractional antenna power
+ */
+static ofloat PBUtilTabDirect (ObitPBUtilTab *in, odouble Angle, odouble Freq)
+{
+  if (in->type==OBIT_PBUtil_Jinc) 
+    return ObitPBUtilJinc(Angle, Freq, in->antSize, in->pbmin);
+  else if (in->type==OBIT_PBUtil_KAT7) 
+    return ObitPBUtilKAT7(Angle, Freq, in->pbmin);
+  else 
+    return ObitPBUtilPoly(Angle, Freq, in->pbmin);
+} /* end PBUtilTabDirect */
+
+/**
+ * Beam power gain for a table argument
+ * \param in     Table
+ * \param u      Angle*Freq (deg*GHz)
+ * \param fGHz   Frequency (GHz) in band of table
+ * \return Fractional antenna power
+ */
+static ofloat PBUtilTabArg (ObitPBUtilTab *in, odouble u, odouble fGHz)
+{
+  return PBUtilTabDirect (in, u/fGHz, fGHz*1.0e9);
+} /* end PBUtilTabArg */
+
+/**
+ * Fill beam table, in Angle*Freq (deg*GHz) from 0 to in->maxArg 
+ * in in->n steps.
+ * \param in     Table, type, maxArg, n set
+ * \param fGHz   Frequency (GHz) in band of table
+ */
+static void PBUtilTabFill (ObitPBUtilTab *in, odouble fGHz)
+{
+  olong i;
 
+  in->iDelta = (in->n-1) / in->maxArg;
+  if (in->gain) g_free(in->gain);
+  in->gain = g_malloc(in->n*sizeof(ofloat));
+  for (i=0; i<in->n; i++) 
+    in->gain[i] = PBUtilTabArg (in, i/in->iDelta, fGHz);
+} /* end PBUtilTabFill */
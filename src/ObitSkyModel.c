@@ -90,12 +90,51 @@ gboolean ObitSkyModelLoadPoint (ObitSkyModel *in, ObitUV *uvdata, ObitErr *err);
 gboolean ObitSkyModelLoadComps (ObitSkyModel *in, olong n, ObitUV *uvdata, 
 				ObitErr *err);
 
+/** Private: Subtract model from buffer as read */
+static void SkyModelStreamFilter (Obit *arg, gpointer uvdata, ofloat *data, 
+				  ObitErr *err);
+
 /** Private: Threaded FTDFT */
 static gpointer ThreadSkyModelFTDFT (gpointer arg);
 
 /** Private: Threaded FTGrid */
 static gpointer ThreadSkyModelFTGrid (gpointer arg);
 
+/** Private: Set up incremental subtraction */
+static gboolean SkyModelIncrStart (ObitSkyModel *in, ObitUV *indata, 
+				   ObitUV *outdata, olong *saveStart);
+
+/** Private: Save state after subtraction for next incremental one */
+static void SkyModelIncrSave (ObitSkyModel *in, ObitUV *indata, 
+			      ObitUV *outdata, olong *saveStart, ObitErr *err);
+
+/** Private: Forget incremental subtraction state */
+static void SkyModelIncrReset (ObitSkyModel *in);
+
+/** Private: Group DFT point components into clusters */
+static void SkyModelClusterComps (ObitSkyModel *in);
+
+/** Private: Delete component clusters */
+static void SkyModelClusterFree (ObitSkyModel *in);
+
+/** Private: Exponents and factors of cluster series expansion terms */
+static olong SkyModelClusTerms (olong *tp, olong *tq, olong *tr, 
+				ofloat *tsgn, ofloat *tfact);
+
+/** Private: Compare cluster cell numbers of components for sort */
+static gint SkyModelClusCompare (gconstpointer in1, gconstpointer in2, 
+				 gpointer keys);
+
+/** Order of the cluster series expansion */
+#define CLUSORDER 4
+/** Number of terms in cluster expansion = 
+    (CLUSORDER+1)*(CLUSORDER+2)*(CLUSORDER+3)/6 */
+#define CLUSNTERM 35
+/** Minimum average number of components per cluster in a level */
+#define CLUSMINCOMP 8
+/** Bits per axis in cluster cell numbers */
+#define CLUSBITS 10
+
 /*---------------Private structures----------------*/
 /* FT threaded function argument */
 typedef struct {
@@ -597,6 +636,7 @@ ObitSkyModel* ObitSkyModelCopy  (ObitSkyModel *in, ObitSkyModel *out, ObitErr *e
   out->modelMode = in->modelMode;
   out->minDFT    = in->minDFT;
   out->maxGrid   = in->maxGrid;
+  out->clusTol   = in->clusTol;
   out->doDFT     = in->doDFT;
   out->doGrid   = in->doGrid;
   if ((out->mosaic) && (out->mosaic->numberImages>0)) {
@@ -773,6 +813,7 @@ void ObitSkyModelShutDownMod (ObitSkyModel* in, ObitUV *uvdata, ObitErr *err)
   /*fprintf(stderr,"DEBUG in ObitSkyModelShutDownMod \n");*/
   in->myInterp = ObitCInterpolateUnref(in->myInterp);
   in->plane    = ObitFArrayUnref(in->plane);
+  SkyModelClusterFree (in);
   ObitThreadPoolFree (in->thread);  /* Shut down any threading */
   if (in->threadArgs) {
     /* Check type - only handle "base" */
@@ -823,6 +864,12 @@ void ObitSkyModelInitModel (ObitSkyModel* in, ObitErr *err)
 
 /**
  * Calculates the Fourier transform of the model and subtracts from UV data
+ * If info member "doIncr" is TRUE, a components model is subtracted 
+ * incrementally: when called again with the same indata and outdata, 
+ * CC tables and startComp, only components beyond those already subtracted
+ * are subtracted from outdata rather than the whole model from indata.
+ * outdata must not be otherwise modified between calls; 
+ * CC tables may only be extended.
  * \param in      SkyModel to Fourier transform
  * \param indata  UV data set to subtract model from
  * \param outdata UV data set to write to
@@ -839,10 +886,11 @@ ObitIOCode ObitSkyModelSubUV (ObitSkyModel *in, ObitUV *indata, ObitUV *outdata,
   gint32 dim[MAXINFOELEMDIM] = {1,1,1,1,1};
   ObitUV *inUV;
   ObitIOAccess access;
-  gboolean same, doCalSelect, gotSome, done, isFirst;
+  gboolean same, doCalSelect, gotSome, done, isFirst, isIncr=FALSE, any;
   olong i, image, nimage, nload;
-  olong firstVis, bufSize, nVisPIO;
+  olong firstVis, bufSize, nVisPIO, *saveStart=NULL;
   ofloat *Buffer;
+  ObitUV *origIn = indata;
   gchar *routine = "ObitSkyModelSubUV";
   
   /* error checks */
@@ -882,6 +930,24 @@ ObitIOCode ObitSkyModelSubUV (ObitSkyModel *in, ObitUV *indata, ObitUV *outdata,
   err->error = 1;*/
   if (err->error) goto cleanup;
 
+  /* Incremental subtraction from output of last call? */
+  if (in->mosaic) {
+    saveStart = g_malloc0(in->mosaic->numberImages*sizeof(olong));
+    for (i=0; i<in->mosaic->numberImages; i++) saveStart[i] = in->startComp[i];
+    isIncr = SkyModelIncrStart (in, indata, outdata, saveStart);
+  }
+  if (isIncr) {
+    /* Anything new? */
+    any = FALSE;
+    for (i=0; i<in->mosaic->numberImages; i++) 
+      any = any || ((in->startComp[i]<=in->endComp[i]) && (in->endComp[i]>0));
+    if (!any) {retCode = OBIT_IO_OK; goto cleanup;}
+    if (in->prtLv>1) 
+      Obit_log_error(err, OBIT_InfoErr, 
+		     "%s: subtracting only new components", routine);
+    indata = outdata;  /* Rewrite previous residual */
+  }
+
   /* Do we need to calibrate/select input? */
   doCalSelect = FALSE;
   ObitInfoListGetTest(indata->info, "doCalSelect", &type, dim, &doCalSelect);
@@ -1064,6 +1130,13 @@ ObitIOCode ObitSkyModelSubUV (ObitSkyModel *in, ObitUV *indata, ObitUV *outdata,
 
   /* Cleanup */
  cleanup:
+  /* Remember what was subtracted, restore requested components */
+  if (saveStart) {
+    if (err->error) SkyModelIncrReset (in);
+    else SkyModelIncrSave (in, origIn, outdata, saveStart, err);
+    for (i=0; i<in->mosaic->numberImages; i++) in->startComp[i] = saveStart[i];
+    g_free(saveStart);
+  }
   myClass->ObitSkyModelShutDownMod(in, indata, err);
   if (err->error) Obit_traceback_val (err, routine, in->name, retCode);
   
@@ -1366,6 +1439,169 @@ ObitIOCode ObitSkyModelDivUV (ObitSkyModel *in, ObitUV *indata, ObitUV *outdata,
   return OBIT_IO_OK;
 }  /* end ObitSkyModelDivUV */
 
+/**
+ * Start subtracting the Fourier transform of the model from UV data 
+ * as it is read.
+ * If the whole model can be applied in a single pass through the data
+ * (DFT, single field or point model, no primary beam channel blocks) 
+ * the model is loaded and set as the read filter on uvdata 
+ * (see ObitUVSetReadFilter) so that every buffer subsequently read with 
+ * ObitUVRead or ObitUVReadSelect, e.g. by ObitUVGridReadUV, has the
+ * model subtracted (or divided if the doDivide member is set) before
+ * it is used.
+ * Only ReadOnly/ReadCal access is filtered so passes that rewrite the
+ * data, e.g. ObitUVWeightData, see and keep the unmodified data.
+ * This replaces a call to ObitSkyModelSubUV and the write and reread 
+ * of the residual data; nothing is written.
+ * Incremental subtraction (see ObitSkyModelSubUV) is reset.
+ * If TRUE is returned ObitSkyModelSubUVStreamEnd must be called when
+ * done, otherwise ObitSkyModelSubUV should be used instead.
+ * \param in      SkyModel to Fourier transform
+ * \param uvdata  UV data set to be read, should not be open
+ *                and must not be passed to ObitSkyModelSubUV while 
+ *                the filter is set.
+ * \param err     Obit error stack object.
+ * \return TRUE if the model will be subtracted as data are read.
+ */
+gboolean ObitSkyModelSubUVStream (ObitSkyModel *in, ObitUV *uvdata, 
+				  ObitErr *err)
+{
+  ObitIOCode retCode;
+  const ObitSkyModelClassInfo 
+    *myClass=(const ObitSkyModelClassInfo*)in->ClassInfo;
+  ObitInfoType type;
+  gint32 dim[MAXINFOELEMDIM] = {1,1,1,1,1};
+  ObitIOAccess access;
+  gboolean doCalSelect, done, doStream=FALSE, gotSome=FALSE;
+  olong i, nimage, nload;
+  gchar *routine = "ObitSkyModelSubUVStream";
+  
+  /* error checks */
+  g_assert (ObitErrIsA(err));
+  if (err->error) return doStream;
+  g_assert (ObitSkyModelIsA(in));
+  g_assert (ObitUVIsA(uvdata));
+  Obit_retval_if_fail ((uvdata->readFilter==NULL), err, doStream,
+		       "%s: %s already has a read filter", routine, uvdata->name);
+
+  /* Get inputs */
+  myClass->ObitSkyModelGetInput (in, err);
+  if (err->error) goto cleanup;
+
+   /* initialize model */
+  myClass->ObitSkyModelInitMod(in, uvdata, err);
+  if (err->error) goto cleanup;
+
+ /* Unless using "point" model, check mosaic */
+  if (in->pointFlux==0.0) {
+    if (!ObitImageMosaicIsA(in->mosaic)) {
+      Obit_log_error(err, OBIT_Error,"%s mosaic member not defined in %s",
+		     routine, in->name);
+      goto cleanup;
+    }
+    
+    /* valid images? */
+    for (i=0; i<in->mosaic->numberImages; i++) {
+      if (!ObitImageIsA(in->mosaic->images[i])) {
+	Obit_log_error(err, OBIT_Error,"%s mosaic image %d not defined in %s",
+		       routine, i+1, in->name);
+	goto cleanup;
+      }
+    }
+  } /* end check images */
+
+  /* Open as it will be read to set up selection */
+  doCalSelect = FALSE;
+  ObitInfoListGetTest(uvdata->info, "doCalSelect", &type, dim, &doCalSelect);
+  if (doCalSelect) access = OBIT_IO_ReadCal;
+  else access = OBIT_IO_ReadOnly;
+  retCode = ObitUVOpen (uvdata, access, err);
+  if ((retCode!=OBIT_IO_OK) || (err->error)) goto cleanup;
+
+  /* Update frequency tables on uvdata */
+  ObitUVGetFreq (uvdata, err);
+  if (err->error) goto cleanup;
+
+  /* Fill in data selection */
+  myClass->ObitSkyModelSetSelect (in, uvdata, err);
+  if (err->error) goto cleanup;
+ 
+  /* Choose mode if requested */
+  myClass->ObitSkyModelChose (in, uvdata);
+
+  /* Can the whole model be done in one pass? */
+  if (in->mosaic!=NULL) nimage = in->mosaic->numberImages;
+  else nimage = 1;
+  if (in->currentMode==OBIT_SkyModel_DFT) nimage = 1;  /* All at once with DFT */
+  /* Mixed model division has to be accumulated first */
+  if (in->doDivide && (in->currentMode==OBIT_SkyModel_Mixed)) nimage = 2;
+  in->startIFPB = in->startChannelPB = -1;  /* to initialize setPBChans */
+  done = myClass->ObitSkyModelsetPBChans(in, uvdata, err);
+  if (err->error) goto cleanup;
+  doStream = (nimage==1) && !done &&
+    ((!in->doPBCor) || ((in->numberIFPB>=in->numberIF) && 
+			(in->numberChannelPB>=in->numberChannel)));
+
+  /* Load model */
+  if (doStream) {
+    nload = 0;
+    if (in->currentMode==OBIT_SkyModel_DFT) nload = -1;
+    gotSome = myClass->ObitSkyModelLoad (in, nload, uvdata, err);
+    if (err->error) goto cleanup;
+    
+    /* Any model initialization at beginning of pass */
+    if (gotSome) myClass->ObitSkyModelInitModel(in, err);
+  }
+
+  /* Close until read */
+  retCode = ObitUVClose (uvdata, err);
+  if (err->error) goto cleanup;
+
+  /* Subtract as read */
+  if (gotSome) ObitUVSetReadFilter (uvdata, SkyModelStreamFilter, (Obit*)in);
+
+  /* Residuals are not being rewritten */
+  if (doStream) SkyModelIncrReset (in);
+
+ cleanup:
+  if (err->error) doStream = FALSE;
+  if (!doStream) myClass->ObitSkyModelShutDownMod(in, uvdata, err);
+  if (err->error) Obit_traceback_val (err, routine, in->name, doStream);
+  
+  return doStream;
+}  /* end ObitSkyModelSubUVStream */
+
+/**
+ * Stop subtracting the model from UV data as it is read.
+ * Must follow a call to ObitSkyModelSubUVStream returning TRUE.
+ * \param in      SkyModel being subtracted
+ * \param uvdata  UV data set passed to ObitSkyModelSubUVStream
+ * \param err     Obit error stack object.
+ */
+void ObitSkyModelSubUVStreamEnd (ObitSkyModel *in, ObitUV *uvdata, 
+				 ObitErr *err)
+{
+  const ObitSkyModelClassInfo 
+    *myClass=(const ObitSkyModelClassInfo*)in->ClassInfo;
+
+  /* error checks */
+  g_assert (ObitErrIsA(err));
+  g_assert (ObitSkyModelIsA(in));
+  g_assert (ObitUVIsA(uvdata));
+
+  /* Remove filter */
+  if (uvdata->readFilterArg==(Obit*)in) 
+    ObitUVSetReadFilter (uvdata, NULL, NULL);
+
+  /* if doReplace, have already thrown data away - just accumulate model */
+  if (in->doReplace) {
+    in->doReplace = FALSE; 
+    in->factor = -fabs(in->factor);
+  }
+
+  myClass->ObitSkyModelShutDownMod(in, uvdata, err);
+} /* end ObitSkyModelSubUVStreamEnd */
+
 /**
  * Loads the model for a specified image on mosaic member
  * \param in      SkyModel to Fourier transform
@@ -1419,6 +1655,10 @@ gboolean ObitSkyModelLoad (ObitSkyModel *in, olong image, ObitUV *uvdata,
   }; /* end switch by model type */
   if (err->error) Obit_traceback_val (err, routine, in->name, FALSE);
 
+  /* Group components into clusters for DFT if requested */
+  if (gotSome) SkyModelClusterComps (in);
+  else         SkyModelClusterFree (in);
+
   return gotSome;
 }  /* end ObitSkyModelLoad */
 
@@ -2352,6 +2592,10 @@ static gpointer ThreadSkyModelFTDFT (gpointer args)
   olong it, jt, itcnt, lim;
   odouble tx, ty, tz, sumReal, sumImag, *freqArr, SMRefFreq, specFreqFact, lnspecFreqFact;
   odouble u, v, w;
+  olong lev, nclus, lclus=0, nEven=0, tp[CLUSNTERM], tq[CLUSNTERM], tr[CLUSNTERM];
+  ofloat tsgn[CLUSNTERM], tfact[CLUSNTERM], *clusData=NULL, *clData, clusDelta=0.0;
+  odouble bl, sr, si, rscl, up[CLUSORDER+1], vp[CLUSORDER+1], wp[CLUSORDER+1];
+  odouble basis[CLUSNTERM];
   gchar *routine = "ThreadSkyModelFTDFT";
 
   /* error checks - assume most done at higher level */
@@ -2382,6 +2626,18 @@ static gpointer ThreadSkyModelFTDFT (gpointer args)
     if (ccData[0]!=0.0) mcomp = iComp+1;
     ccData += lcomp;  /* update pointer */
   } /* end loop over components */
+
+  /* Component clusters? Maximum phase excursion in a cluster for which 
+     the truncation error of the expansion is less than clusTol */
+  if ((in->nClusLev>0) && (in->modType==OBIT_SkyModel_PointMod)) {
+    naxis[0] = 0; naxis[1] = 0; 
+    clusData  = ObitFArrayIndex(in->clusTab, naxis);
+    lclus     = in->clusTab->naxis[0];
+    nEven     = SkyModelClusTerms (tp, tq, tr, tsgn, tfact);
+    temp = 1.0;
+    for (iterm=2; iterm<=CLUSORDER+1; iterm++) temp *= iterm;
+    clusDelta = pow (in->clusTol*temp, 1.0/(CLUSORDER+1));
+  }
   
   /* Visibility pointers */
   ilocu =  uvdata->myDesc->ilocu;
@@ -2459,6 +2715,53 @@ static gpointer ThreadSkyModelFTDFT (gpointer args)
 	/* Sum by model type */
 	switch (in->modType) {
 	case OBIT_SkyModel_PointMod:     /* Point */
+	  /* Coarsest level of clusters accurate enough for this baseline 
+	     and cheaper than the components */
+	  lev = -1;
+	  if (clusData!=NULL) {
+	    bl = sqrt (u*u + v*v + w*w);
+	    for (it=in->nClusLev-1; it>=0; it--) {
+	      if (in->clusRad[it]*bl<=clusDelta) {lev = it; break;}
+	    }
+	    if ((lev>=0) && (in->clusNum[lev]*CLUSMINCOMP>mcomp)) lev = -1;
+	  }
+	  if (lev>=0) {  /* Sum cluster expansions */
+	    /* Expansion basis in units of the level maximum radius */
+	    if (in->clusRad[lev]>0.0) rscl = in->clusRad[lev];
+	    else                      rscl = 1.0;
+	    up[0] = vp[0] = wp[0] = 1.0;
+	    for (iterm=1; iterm<=CLUSORDER; iterm++) {
+	      up[iterm] = up[iterm-1] * u * rscl;
+	      vp[iterm] = vp[iterm-1] * v * rscl;
+	      wp[iterm] = wp[iterm-1] * w * rscl;
+	    }
+	    for (iterm=0; iterm<CLUSNTERM; iterm++) 
+	      basis[iterm] = tsgn[iterm] * up[tp[iterm]] * vp[tq[iterm]] * wp[tr[iterm]];
+	    clData = clusData + ((ollong)in->clusOff[lev])*lclus;
+	    nclus  = in->clusNum[lev];
+	    for (it=0; it<nclus; it+=FazArrSize) {
+	      itcnt = 0;
+	      lim = MIN (nclus, it+FazArrSize);
+	      for (iComp=it; iComp<lim; iComp++) {
+		FazArr[itcnt] = clData[0]*u + clData[1]*v + clData[2]*w;
+		sr = si = 0.0;
+		for (iterm=0; iterm<nEven; iterm++)         sr += clData[4+iterm]*basis[iterm];
+		for (iterm=nEven; iterm<CLUSNTERM; iterm++) si += clData[4+iterm]*basis[iterm];
+		AmpArr[itcnt] = (ofloat)sr;
+		ExpArg[itcnt] = (ofloat)si;
+		clData += lclus;  /* update pointer */
+		itcnt++;
+	      } /* end inner loop over clusters */
+	      /* Convert phases to sin/cos */
+	      ObitSinCosVec(itcnt, FazArr, SinArr, CosArr);
+	      /* Accumulate real and imaginary parts */
+	      for (jt=0; jt<itcnt; jt++) {
+		sumReal += AmpArr[jt]*CosArr[jt] - ExpArg[jt]*SinArr[jt];
+		sumImag += AmpArr[jt]*SinArr[jt] + ExpArg[jt]*CosArr[jt];
+	      }
+	    } /* end outer loop over clusters */
+	    break;
+	  } /* end clusters */
 	  /* From the AIPSish QXXPTS.FOR  */
 	  /* outer loop */
 	  for (it=0; it<mcomp; it+=FazArrSize) {
@@ -2954,14 +3257,15 @@ gpointer ThreadSkyModelFTGrid (gpointer args)
   olong startPoln, numberPoln, jincs, startChannel, numberChannel;
   olong jincf, startIF, numberIF, jincif, kincf, kincif;
   olong offset, offsetChannel, offsetIF;
-  olong ilocu, ilocv, ilocw;
-  ofloat *visData, *fscale, vis[2], flip;
+  olong ilocu, ilocv, ilocw, nuvw, iuvw;
+  ofloat *visData, *fscale, *vis, flip;
+  ofloat *uArr=NULL, *vArr=NULL, *wArr=NULL, *visArr=NULL;
   ofloat sumReal, sumImag, modReal, modImag;
   ofloat freqFact, wt=0.0, temp;
   ofloat dxyzc[3],  uvw[3], ut, vt, rt, it, fblank = ObitMagicF();
   ofloat umat[3][3], pmat[3][3], rmat[3][3], dmat[3][3];
   ofloat PC, cosPC, sinPC, maprot, uvrot, ssrot, ccrot;
-  gboolean doRot, doConjg, isBad, do3Dmul, doPC;
+  gboolean doRot, doConjg, isBad, do3Dmul, doPC, *conjArr=NULL;
   gchar *routine = "ThreadSkyModelFTGrid";
 
   /* error checks - assume most done at higher level */
@@ -3057,16 +3361,23 @@ gpointer ThreadSkyModelFTGrid (gpointer args)
   /* Rotation needed? */
   doRot = (fabs (ssrot)>1.0e-10) || (fabs (ccrot-1.0)>1.0e-4);
 
+  /* Work arrays for all channels/IFs of a visibility */
+  nuvw    = numberIF * numberChannel;
+  uArr    = g_malloc0(nuvw*sizeof(ofloat));
+  vArr    = g_malloc0(nuvw*sizeof(ofloat));
+  wArr    = g_malloc0(nuvw*sizeof(ofloat));
+  visArr  = g_malloc0(2*nuvw*sizeof(ofloat));
+  conjArr = g_malloc0(nuvw*sizeof(gboolean));
+
   /* Loop over vis in buffer */
   lrec    = uvdata->myDesc->lrec;         /* Length of record */
   visData = uvdata->buffer+loVis*lrec;    /* Buffer pointer with appropriate offset */
   nrparm  = uvdata->myDesc->nrparm;       /* Words of "random parameters" */
   for (iVis=loVis; iVis<hiVis; iVis++) {
-    /* Loop over IFs */
+    /* Get projected u, v, w of all IFs and channels */
+    iuvw = 0;
     for (iIF=startIF; iIF<startIF+numberIF; iIF++) {
-      offsetIF = nrparm + iIF*jincif; 
       for (iChannel=startChannel; iChannel<startChannel+numberChannel; iChannel++) {
-	offsetChannel = offsetIF + iChannel*jincf; 
 	freqFact = fscale[iIF*kincif + iChannel*kincf];  /* Frequency scaling factor */
 	
 	/* Get u, v, w at wavelength */
@@ -3096,23 +3407,32 @@ gpointer ThreadSkyModelFTGrid (gpointer args)
 	  uvw[1] = -uvw[1];
 	  uvw[2] = -uvw[2];
 	}
-	
-	/* Interpolate from UV grid */
-	ObitCInterpolateOffset (Interp, uvw, vis, err);
-	if (err->error) {
-	  ObitThreadLock(in->thread);  /* Lock against other threads */
-	  Obit_log_error(err, OBIT_Error,"%s: Error interpolatingFT of model",
-			 routine);
-	  ObitThreadUnlock(in->thread); 
-	  goto finish;
-	}
+	uArr[iuvw]    = uvw[0];
+	vArr[iuvw]    = uvw[1];
+	wArr[iuvw]    = uvw[2];
+	conjArr[iuvw] = doConjg;
+	iuvw++;
+      } /* end loop over Channel */
+    } /* end loop over IF */
+
+    /* Interpolate all from UV grid */
+    ObitCInterpolateOffsetRow (Interp, nuvw, uArr, vArr, visArr);
+
+    /* Apply to data */
+    iuvw = 0;
+    for (iIF=startIF; iIF<startIF+numberIF; iIF++) {
+      offsetIF = nrparm + iIF*jincif; 
+      for (iChannel=startChannel; iChannel<startChannel+numberChannel; iChannel++) {
+	offsetChannel = offsetIF + iChannel*jincf; 
+	vis     = &visArr[2*iuvw];
+	doConjg = conjArr[iuvw];
       
 	/* Blanked if outside grid  - zero data and weight */
 	isBad = (vis[0]==fblank);
 	
 	/* Phase correction for field offset? */
 	if (doPC && !isBad) {
-	  PC = uvw[0]*dxyzc[0] + uvw[1]*dxyzc[1] + uvw[2]*dxyzc[2];
+	  PC = uArr[iuvw]*dxyzc[0] + vArr[iuvw]*dxyzc[1] + wArr[iuvw]*dxyzc[2];
 	  cosPC = cos(PC);
 	  sinPC = sin(PC);
 	  rt = cosPC * vis[0] - sinPC * vis[1];
@@ -3183,6 +3503,7 @@ gpointer ThreadSkyModelFTGrid (gpointer args)
 	  
 	  offset += jincs;
 	} /* end loop over Stokes */
+	iuvw++;
 	offsetChannel += jincf;
       } /* end loop over Channel */
       offsetIF += jincif;
@@ -3193,6 +3514,11 @@ gpointer ThreadSkyModelFTGrid (gpointer args)
 
   /* Indicate completion */
   finish: 
+  if (uArr)    g_free(uArr);
+  if (vArr)    g_free(vArr);
+  if (wArr)    g_free(wArr);
+  if (visArr)  g_free(visArr);
+  if (conjArr) g_free(conjArr);
   if (largs->ithread>=0)
     ObitThreadPoolDone (in->thread, (gpointer)&largs->ithread);
   
@@ -3353,6 +3679,9 @@ void ObitSkyModelCompressCC (ObitSkyModel *in, ObitErr *err)
     CCTable = ObitTableCCUnref (CCTable);
 
   } /* end loop over fields */
+
+  /* Tables rewritten - previous subtraction no longer describable */
+  SkyModelIncrReset (in);
   
   return;
 } /* end ObitSkyModelCompressCC  */
@@ -3516,6 +3845,17 @@ void ObitSkyModelGetInput (ObitSkyModel* in, ObitErr *err)
   in->prtLv = 0;  /* default = none */
   ObitInfoListGetTest(in->info, "prtLv", &type, dim, &in->prtLv);
 
+  /* Incremental subtraction wanted? */
+  InfoReal.itg = (olong)in->doIncr; type = OBIT_bool;
+  ObitInfoListGetTest(in->info, "doIncr", &type, (gint32*)dim, &InfoReal);
+  in->doIncr = InfoReal.itg;
+  if (!in->doIncr) SkyModelIncrReset (in);
+
+  /* Component clustering in DFT */
+  InfoReal.flt = in->clusTol; type = OBIT_float;
+  ObitInfoListGetTest(in->info, "clusTol", &type, (gint32*)dim, &InfoReal);
+  in->clusTol = InfoReal.flt;
+
 } /* end ObitSkyModelGetInput */
 
 /**
@@ -4939,6 +5279,10 @@ static void ObitSkyModelClassInfoDefFn (gpointer inClass)
   theClass->ObitSkyModelLoad    = (ObitSkyModelLoadFP)ObitSkyModelLoad;
   theClass->ObitSkyModelSubUV   = (ObitSkyModelSubUVFP)ObitSkyModelSubUV;
   theClass->ObitSkyModelDivUV   = (ObitSkyModelDivUVFP)ObitSkyModelDivUV;
+  theClass->ObitSkyModelSubUVStream = 
+    (ObitSkyModelSubUVStreamFP)ObitSkyModelSubUVStream;
+  theClass->ObitSkyModelSubUVStreamEnd = 
+    (ObitSkyModelSubUVStreamEndFP)ObitSkyModelSubUVStreamEnd;
   theClass->ObitSkyModelFT      = (ObitSkyModelFTFP)ObitSkyModelFT;
   theClass->ObitSkyModelLoadPoint = (ObitSkyModelLoadPointFP)ObitSkyModelLoadPoint;
   theClass->ObitSkyModelLoadComps = (ObitSkyModelLoadCompsFP)ObitSkyModelLoadComps;
@@ -5030,6 +5374,19 @@ void ObitSkyModelInit  (gpointer inn)
   in->GridFunc  = NULL;
   in->nSpecTerm = 0;
   for (i=0; i<10; i++) in->pointParms[i] = 0.0;
+  in->doIncr     = FALSE;
+  in->incrNumber = 0;
+  in->incrStart  = NULL;
+  in->incrComp   = NULL;
+  in->incrVer    = NULL;
+  in->incrFactor = 0.0;
+  in->incrIn     = NULL;
+  in->incrOut    = NULL;
+  in->clusTol    = 0.0;
+  in->nClusLev   = 0;
+  in->clusFirst  = NULL;
+  in->clusCount  = NULL;
+  in->clusTab    = NULL;
 #if HAVE_GPU==1  /*  GPU? */
   in->GPUSkyModel = NULL;
 #endif /* HAVE_GPU */
@@ -5064,6 +5421,8 @@ void ObitSkyModelClear (gpointer inn)
   in->CCver     = ObitMemFree(in->CCver); 
   in->startComp = ObitMemFree(in->startComp); 
   in->endComp   = ObitMemFree(in->endComp); 
+  SkyModelIncrReset (in);
+  SkyModelClusterFree (in);
   if (in->threadArgs) {
     /* Check type - only handle "base" */
     if (!strncmp((gchar*)in->threadArgs[0], "base", 4)) {
@@ -5088,3 +5447,402 @@ void ObitSkyModelClear (gpointer inn)
   
 } /* end ObitSkyModelClear */
 
+/**
+ * Check if the model can be subtracted incrementally from the output of
+ * the previous call to ObitSkyModelSubUV and if so, set startComp to
+ * the first component not yet subtracted.
+ * Requires a components model subtracted with the same factor, the same 
+ * indata and outdata, CC table versions and startComp, no calibration or 
+ * selection and endComp not less than previously subtracted.
+ * Otherwise any saved state is discarded.
+ * \param in         SkyModel, GetInput should have been called
+ * \param indata     UV data set to subtract model from
+ * \param outdata    UV data set to write to
+ * \param saveStart  Requested startComp per image
+ * \return TRUE if incremental subtraction possible
+ */
+static gboolean SkyModelIncrStart (ObitSkyModel *in, ObitUV *indata, 
+				   ObitUV *outdata, olong *saveStart)
+{
+  ObitInfoType type;
+  gint32 dim[MAXINFOELEMDIM] = {1,1,1,1,1};
+  gboolean doCalSelect, OK;
+  olong i;
+
+  OK = in->doIncr && (in->incrComp!=NULL) && (in->mosaic!=NULL);
+  OK = OK && (in->incrIn==indata) && (in->incrOut==outdata);
+  OK = OK && (in->modelType==OBIT_SkyModel_Comps) && (in->pointFlux==0.0);
+  OK = OK && !in->doReplace && !in->doDivide && (in->factor==in->incrFactor);
+  OK = OK && (in->mosaic->numberImages>=in->incrNumber);
+  if (OK) {
+    doCalSelect = FALSE;
+    ObitInfoListGetTest(indata->info, "doCalSelect", &type, dim, &doCalSelect);
+    OK = !doCalSelect;
+    doCalSelect = FALSE;
+    ObitInfoListGetTest(outdata->info, "doCalSelect", &type, dim, &doCalSelect);
+    OK = OK && !doCalSelect;
+  }
+  /* Same components, none fewer than already subtracted */
+  for (i=0; OK && (i<in->incrNumber); i++) {
+    if (in->incrComp[i]<in->incrStart[i]) continue;  /* Nothing yet */
+    OK = (in->CCver[i]==in->incrVer[i]) && (saveStart[i]==in->incrStart[i]) &&
+      (in->endComp[i]>=in->incrComp[i]);
+  }
+
+  if (!OK) {
+    SkyModelIncrReset (in);
+    return FALSE;
+  }
+
+  /* Only new ones */
+  for (i=0; i<in->incrNumber; i++) 
+    in->startComp[i] = MAX (in->startComp[i], in->incrComp[i]+1);
+  return TRUE;
+} /* end SkyModelIncrStart */
+
+/**
+ * Save the components subtracted to allow the next call to 
+ * ObitSkyModelSubUV to be incremental.
+ * Nothing is saved unless the model could be subtracted incrementally.
+ * \param in         SkyModel
+ * \param indata     UV data set model subtracted from
+ * \param outdata    UV data set written
+ * \param saveStart  Requested startComp per image
+ * \param err        Obit error stack object.
+ */
+static void SkyModelIncrSave (ObitSkyModel *in, ObitUV *indata, 
+			      ObitUV *outdata, olong *saveStart, ObitErr *err)
+{
+  ObitTable *tempTable=NULL;
+  ObitTableCC *CCTable = NULL;
+  olong i, ver, nrow;
+  gchar *tabType = "AIPS CC";
+  gchar *routine = "SkyModelIncrSave";
+
+  if (err->error) return;
+  if (!in->doIncr || (in->mosaic==NULL) || 
+      (in->modelType!=OBIT_SkyModel_Comps) || (in->pointFlux!=0.0) ||
+      in->doReplace || in->doDivide) {
+    SkyModelIncrReset (in);
+    return;
+  }
+
+  /* (Re)allocate */
+  if (in->incrNumber!=in->mosaic->numberImages) {
+    in->incrNumber = in->mosaic->numberImages;
+    in->incrStart  = g_realloc(in->incrStart, in->incrNumber*sizeof(olong));
+    in->incrComp   = g_realloc(in->incrComp,  in->incrNumber*sizeof(olong));
+    in->incrVer    = g_realloc(in->incrVer,   in->incrNumber*sizeof(olong));
+  }
+
+  for (i=0; i<in->incrNumber; i++) {
+    in->incrStart[i] = saveStart[i];
+    in->incrVer[i]   = in->CCver[i];
+    in->incrComp[i]  = saveStart[i] - 1;  /* Nothing subtracted */
+    if ((in->endComp[i]<saveStart[i]) || (in->endComp[i]<=0)) continue;
+
+    /* Limit to what is in the table */
+    ver = in->CCver[i];
+    tempTable = newObitImageTable (in->mosaic->images[i], OBIT_IO_ReadOnly, 
+				   tabType, &ver, err);
+    if ((tempTable==NULL) || (err->error)) break;
+    CCTable = ObitTableCCConvert(tempTable);
+    tempTable = ObitTableUnref(tempTable);
+    ObitTableCCOpen (CCTable, OBIT_IO_ReadOnly, err);
+    nrow = CCTable->myDesc->nrow;
+    ObitTableCCClose (CCTable, err);
+    CCTable = ObitTableCCUnref(CCTable);
+    if (err->error) break;
+    in->incrComp[i] = MIN (nrow, in->endComp[i]);
+  }
+  if (err->error) {
+    SkyModelIncrReset (in);
+    Obit_traceback_msg (err, routine, in->name);
+  }
+
+  in->incrFactor = in->factor;
+  in->incrIn  = ObitUVUnref(in->incrIn);
+  in->incrIn  = ObitUVRef(indata);
+  in->incrOut = ObitUVUnref(in->incrOut);
+  in->incrOut = ObitUVRef(outdata);
+} /* end SkyModelIncrSave */
+
+/**
+ * Forget any previous subtraction, the next will be of the full model.
+ * \param in  SkyModel
+ */
+static void SkyModelIncrReset (ObitSkyModel *in)
+{
+  g_free(in->incrStart); in->incrStart = NULL;
+  g_free(in->incrComp);  in->incrComp  = NULL;
+  g_free(in->incrVer);   in->incrVer   = NULL;
+  in->incrNumber = 0;
+  in->incrIn  = ObitUVUnref(in->incrIn);
+  in->incrOut = ObitUVUnref(in->incrOut);
+} /* end SkyModelIncrReset */
+
+/**
+ * Group the point components of a DFT model into spatial clusters.
+ * Components are sorted by a cell number interleaving the bits of the
+ * x and y cells on a (2^CLUSBITS)^2 grid covering the components, so
+ * that each cell at any coarser level is a contiguous range of in->comps.
+ * Levels with on average at least CLUSMINCOMP components per cluster
+ * are kept.  Each cluster has the series expansion moments about its
+ * center of exp(i phase) to order CLUSORDER, scaled by the maximum 
+ * cluster radius of the level.
+ * Only done if clusTol>0 and the model is point components using the 
+ * DFT in this class, otherwise any clusters are deleted.
+ * \param in  SkyModel with components loaded
+ */
+static void SkyModelClusterComps (ObitSkyModel *in)
+{
+  olong i, k, n, t, lev, ilev, lcomp, ncomp, nvalid, nclus, ntot, lclus, first;
+  olong naxis[2], shift[SKYMODEL_MAXCLUSLEV];
+  olong tp[CLUSNTERM], tq[CLUSNTERM], tr[CLUSNTERM], *index=NULL;
+  guint32 *keys=NULL, *skeys=NULL, ix, iy, maxCell, cell;
+  ofloat tsgn[CLUSNTERM], tfact[CLUSNTERM], *data, *sorted, *cc, *row;
+  ofloat xmin, xmax, ymin, ymax, xscl, yscl, dx, dy, dz, rad, rscl;
+  ofloat xp[CLUSORDER+1], yp[CLUSORDER+1], zp[CLUSORDER+1];
+  odouble cx, cy, cz;
+
+  /* Delete any old clusters */
+  SkyModelClusterFree (in);
+
+  /* Wanted and possible? */
+  if (in->clusTol<=0.0) return;
+  if ((in->modelType!=OBIT_SkyModel_Comps) || 
+      (in->currentMode!=OBIT_SkyModel_DFT) ||
+      (in->modType!=OBIT_SkyModel_PointMod) || 
+      (in->DFTFunc!=(ObitThreadFunc)ThreadSkyModelFTDFT) ||
+      in->doGPU || (in->comps==NULL)) return;
+
+  naxis[0] = 0; naxis[1] = 0; 
+  data  = ObitFArrayIndex(in->comps, naxis);
+  lcomp = in->comps->naxis[0];  /* Length of row in comp table */
+  ncomp = in->comps->naxis[1];  /* number of components */
+
+  /* Extent of valid components */
+  nvalid = 0;
+  xmin = ymin =  1.0e30;
+  xmax = ymax = -1.0e30;
+  cc = data;
+  for (i=0; i<ncomp; i++) {
+    if (cc[0]!=0.0) {
+      nvalid++;
+      xmin = MIN (xmin, cc[1]); xmax = MAX (xmax, cc[1]);
+      ymin = MIN (ymin, cc[2]); ymax = MAX (ymax, cc[2]);
+    }
+    cc += lcomp;
+  }
+  /* Enough to bother? */
+  if (nvalid<CLUSMINCOMP*CLUSMINCOMP) return;
+
+  /* Cell numbers, invalid components sort to the end */
+  maxCell = (1<<CLUSBITS) - 1;
+  xscl = maxCell / MAX (xmax-xmin, 1.0e-30);
+  yscl = maxCell / MAX (ymax-ymin, 1.0e-30);
+  keys  = g_malloc(ncomp*sizeof(guint32));
+  index = g_malloc(ncomp*sizeof(olong));
+  cc = data;
+  for (i=0; i<ncomp; i++) {
+    index[i] = i;
+    if (cc[0]!=0.0) {
+      ix = (guint32)((cc[1]-xmin)*xscl + 0.5); ix = MIN (ix, maxCell);
+      iy = (guint32)((cc[2]-ymin)*yscl + 0.5); iy = MIN (iy, maxCell);
+      cell = 0;
+      for (k=0; k<CLUSBITS; k++) 
+	cell |= (((ix>>k)&1)<<(2*k)) | (((iy>>k)&1)<<(2*k+1));
+      keys[i] = cell;
+    } else keys[i] = G_MAXUINT32;
+    cc += lcomp;
+  }
+  g_qsort_with_data (index, ncomp, sizeof(olong), SkyModelClusCompare, keys);
+
+  /* Reorder components */
+  sorted = g_malloc(((ollong)ncomp)*lcomp*sizeof(ofloat));
+  skeys  = g_malloc(ncomp*sizeof(guint32));
+  for (i=0; i<ncomp; i++) {
+    memcpy (&sorted[((ollong)i)*lcomp], &data[((ollong)index[i])*lcomp], 
+	    lcomp*sizeof(ofloat));
+    skeys[i] = keys[index[i]];
+  }
+  memcpy (data, sorted, ((ollong)ncomp)*lcomp*sizeof(ofloat));
+  g_free(sorted); g_free(keys); g_free(index);
+
+  /* Select levels, finest first */
+  in->nClusLev = 0;
+  ntot = 0;
+  for (lev=0; lev<=CLUSBITS; lev++) {
+    nclus = 1;
+    for (i=1; i<nvalid; i++) 
+      if ((skeys[i]>>(2*lev))!=(skeys[i-1]>>(2*lev))) nclus++;
+    if ((nclus*CLUSMINCOMP<=nvalid) && (in->nClusLev<SKYMODEL_MAXCLUSLEV)) {
+      shift[in->nClusLev] = 2*lev;
+      in->clusNum[in->nClusLev] = nclus;
+      in->clusOff[in->nClusLev] = ntot;
+      ntot += nclus;
+      in->nClusLev++;
+    }
+    if (nclus<=1) break;
+  }
+
+  /* Cluster tables */
+  lclus = 4 + CLUSNTERM;
+  naxis[0] = lclus; naxis[1] = MAX (1, ntot);
+  in->clusTab   = ObitFArrayCreate("Cluster table", 2, naxis);
+  in->clusFirst = g_malloc0(MAX (1, ntot)*sizeof(olong));
+  in->clusCount = g_malloc0(MAX (1, ntot)*sizeof(olong));
+  SkyModelClusTerms (tp, tq, tr, tsgn, tfact);
+
+  for (ilev=0; ilev<in->nClusLev; ilev++) {
+    /* Cluster ranges, centers and radii */
+    n = in->clusOff[ilev];
+    first = 0;
+    in->clusRad[ilev] = 0.0;
+    for (i=1; i<=nvalid; i++) {
+      if ((i<nvalid) && ((skeys[i]>>shift[ilev])==(skeys[first]>>shift[ilev]))) continue;
+      in->clusFirst[n] = first;
+      in->clusCount[n] = i - first;
+      naxis[0] = 0; naxis[1] = n;
+      row = ObitFArrayIndex(in->clusTab, naxis);
+      cx = cy = cz = 0.0;
+      cc = &data[((ollong)first)*lcomp];
+      for (k=first; k<i; k++) {
+	cx += cc[1]; cy += cc[2]; cz += cc[3];
+	cc += lcomp;
+      }
+      row[0] = cx / (i-first);
+      row[1] = cy / (i-first);
+      row[2] = cz / (i-first);
+      rad = 0.0;
+      cc = &data[((ollong)first)*lcomp];
+      for (k=first; k<i; k++) {
+	dx = cc[1]-row[0]; dy = cc[2]-row[1]; dz = cc[3]-row[2];
+	rad = MAX (rad, dx*dx + dy*dy + dz*dz);
+	cc += lcomp;
+      }
+      row[3] = sqrt (rad);
+      in->clusRad[ilev] = MAX (in->clusRad[ilev], row[3]);
+      n++;
+      first = i;
+    } /* end loop defining clusters */
+
+    /* Moments in units of the maximum radius */
+    if (in->clusRad[ilev]>0.0) rscl = 1.0 / in->clusRad[ilev];
+    else                      rscl = 1.0;
+    for (n=in->clusOff[ilev]; n<in->clusOff[ilev]+in->clusNum[ilev]; n++) {
+      naxis[0] = 0; naxis[1] = n;
+      row = ObitFArrayIndex(in->clusTab, naxis);
+      for (t=0; t<CLUSNTERM; t++) row[4+t] = 0.0;
+      cc = &data[((ollong)in->clusFirst[n])*lcomp];
+      for (k=0; k<in->clusCount[n]; k++) {
+	xp[0] = yp[0] = zp[0] = 1.0;
+	for (t=1; t<=CLUSORDER; t++) {
+	  xp[t] = xp[t-1] * (cc[1]-row[0]) * rscl;
+	  yp[t] = yp[t-1] * (cc[2]-row[1]) * rscl;
+	  zp[t] = zp[t-1] * (cc[3]-row[2]) * rscl;
+	}
+	for (t=0; t<CLUSNTERM; t++) 
+	  row[4+t] += cc[0] * tfact[t] * xp[tp[t]] * yp[tq[t]] * zp[tr[t]];
+	cc += lcomp;
+      }
+    } /* end loop over clusters */
+  } /* end loop over levels */
+
+  g_free(skeys);
+} /* end SkyModelClusterComps */
+
+/**
+ * Delete any component clusters.
+ * \param in  SkyModel
+ */
+static void SkyModelClusterFree (ObitSkyModel *in)
+{
+  in->nClusLev = 0;
+  g_free(in->clusFirst); in->clusFirst = NULL;
+  g_free(in->clusCount); in->clusCount = NULL;
+  in->clusTab = ObitFArrayUnref(in->clusTab);
+} /* end SkyModelClusterFree */
+
+/**
+ * Terms of the cluster series expansion of exp(i(dx*u+dy*v+dz*w)) 
+ * to order CLUSORDER; term t is 
+ * tsgn[t] * tfact[t] * (dx*u)^tp[t] * (dy*v)^tq[t] * (dz*w)^tr[t]
+ * and is real for the first (even order) terms and imaginary for the rest.
+ * \param tp    [out] Power of x per term, CLUSNTERM entries
+ * \param tq    [out] Power of y per term
+ * \param tr    [out] Power of z per term
+ * \param tsgn  [out] Sign of i^order per term
+ * \param tfact [out] 1/(tp! tq! tr!) per term
+ * \return number of real (even order) terms at the beginning
+ */
+static olong SkyModelClusTerms (olong *tp, olong *tq, olong *tr, 
+				ofloat *tsgn, ofloat *tfact)
+{
+  olong n, p, q, k, pass, nEven=0;
+  ofloat fact[CLUSORDER+1];
+
+  fact[0] = 1.0;
+  for (n=1; n<=CLUSORDER; n++) fact[n] = fact[n-1] * n;
+
+  k = 0;
+  for (pass=0; pass<2; pass++) {  /* Even orders then odd */
+    for (n=pass; n<=CLUSORDER; n+=2) {
+      for (p=n; p>=0; p--) {
+	for (q=n-p; q>=0; q--) {
+	  tp[k] = p; tq[k] = q; tr[k] = n-p-q;
+	  tsgn[k]  = ((n%4)<2) ? 1.0 : -1.0;
+	  tfact[k] = 1.0 / (fact[p]*fact[q]*fact[n-p-q]);
+	  k++;
+	}
+      }
+    }
+    if (pass==0) nEven = k;
+  }
+  return nEven;
+} /* end SkyModelClusTerms */
+
+/**
+ * Compare cluster cell numbers of two components for g_qsort_with_data.
+ * \param in1   index of first component
+ * \param in2   index of second component
+ * \param keys  cell number per component
+ * \return <0 -> in1 first, 0 -> same, >0 -> in2 first
+ */
+static gint SkyModelClusCompare (gconstpointer in1, gconstpointer in2, 
+				 gpointer keys)
+{
+  guint32 k1 = ((guint32*)keys)[*(olong*)in1];
+  guint32 k2 = ((guint32*)keys)[*(olong*)in2];
+
+  if (k1<k2) return -1;
+  if (k1>k2) return  1;
+  return (*(olong*)in1) - (*(olong*)in2);
+} /* end SkyModelClusCompare */
+
+/**
+ * Subtract model from a buffer of UV data as read.
+ * Read filter set by ObitSkyModelSubUVStream.
+ * \param arg     SkyModel as Obit*
+ * \param uvdata  ObitUV being read
+ * \param data    Buffer of data read
+ * \param err     Obit error stack object.
+ */
+static void SkyModelStreamFilter (Obit *arg, gpointer uvdata, ofloat *data, 
+				  ObitErr *err)
+{
+  ObitSkyModel *in = (ObitSkyModel*)arg;
+  ObitUV *inUV = (ObitUV*)uvdata;
+  const ObitSkyModelClassInfo 
+    *myClass=(const ObitSkyModelClassInfo*)in->ClassInfo;
+  ofloat *saveBuffer;
+
+  if (err->error) return;
+
+  /* FT works on buffer member */
+  saveBuffer   = inUV->buffer;
+  inUV->buffer = data;
+  myClass->ObitSkyModelFT (in, 0, inUV, err);
+  inUV->buffer = saveBuffer;
+} /* end SkyModelStreamFilter */
+
@@ -107,6 +107,10 @@ typedef struct {
   olong prior;
   /* PFollowing index in NIArray */
   olong follow;
+  /* Work array for Zernike coefficients at current time (ncoef) */
+  ofloat *ionCoef;
+  /* Work array for position offset terms per field (3 per field) */
+  ofloat *fieldOff;
 } VMIonFTFuncArg;
 /*----------------------Public functions---------------------------*/
 /**
@@ -289,6 +293,7 @@ ObitSkyModelVMIon* ObitSkyModelVMIonCreate (gchar* name, ObitImageMosaic* mosaic
  *              Only fields with actual components are included
  * \li ZernX    Table of Zernike X gradient terms per field
  * \li ZernY    Table of Zernike Y gradient terms per field
+ * \li ZernXYZ  Table of x,y,z phase terms per unit Zernike coefficient per field
  * \li do3D     if true need 3D rotation 
  * \li ccrot, ssrot = cosine, sine of rotation difference between uv, image
  * \param inn  SkyModel to initialize
@@ -302,8 +307,8 @@ void ObitSkyModelVMIonInitMod (ObitSkyModel* inn, ObitUV *uvdata, ObitErr *err)
   olong ierr, ncoef=5;
   ObitImageDesc *imDesc=NULL;
   ObitUVDesc *uvDesc=NULL;
-  ofloat maprot, uvrot, *rotTable, *XTable, *YTable;
-  ofloat umat[3][3], pmat[3][3], shift[2], ZernXY[2];
+  ofloat maprot, uvrot, *rotTable, *XTable, *YTable, *XYZTable;
+  ofloat umat[3][3], pmat[3][3], shift[2], ZernXY[2], konst, xp[2];
   ofloat xpix, ypix;
   ObitInfoType type;
   gint32 dim[MAXINFOELEMDIM]={1,1,1,1,1};
@@ -317,6 +322,9 @@ void ObitSkyModelVMIonInitMod (ObitSkyModel* inn, ObitUV *uvdata, ObitErr *err)
    /* Setup for threading - delete existing threadArgs */
   if (in->threadArgs) {
     for (i=0; i<in->nThreads; i++) {
+      args = (VMIonFTFuncArg*)in->threadArgs[i];
+      if (args->ionCoef)  g_free(args->ionCoef);
+      if (args->fieldOff) g_free(args->fieldOff);
       g_free(in->threadArgs[i]);
     }
     g_free(in->threadArgs);
@@ -342,6 +350,8 @@ void ObitSkyModelVMIonInitMod (ObitSkyModel* inn, ObitUV *uvdata, ObitErr *err)
     args->endVMModelTime = -1.0e20;
     args->prior  = -1;
     args->follow = -1;
+    args->ionCoef  = NULL;
+    args->fieldOff = NULL;
   }
 
   /* Call parent initializer */
@@ -514,6 +524,40 @@ void ObitSkyModelVMIonInitMod (ObitSkyModel* inn, ObitUV *uvdata, ObitErr *err)
     } /* end if got data */
   } /* end loop over fields */
 
+  /* Combine gradients, rotation and phase constant into one matrix 
+     per field giving the x, y, z phase terms for unit coefficients */
+  konst = DG2RAD * 2.0 * G_PI;
+  naxis[0] = 3*in->ncoef; naxis[1] = count;
+  in->ZernXYZ = ObitFArrayUnref(in->ZernXYZ);
+  in->ZernXYZ = ObitFArrayCreate("ZernXYZ", ndim, naxis);
+  for (field=0; field<count; field++) {
+    naxis[0] = 0; naxis[1] = field; 
+    rotTable = ObitFArrayIndex(in->uRotTab, naxis);
+    XTable   = ObitFArrayIndex(in->ZernX,   naxis);
+    YTable   = ObitFArrayIndex(in->ZernY,   naxis);
+    XYZTable = ObitFArrayIndex(in->ZernXYZ, naxis);
+    for (i=0; i<in->ncoef; i++) {
+      xp[0] = -XTable[i] * konst;
+      xp[1] = -YTable[i] * konst;
+      if (in->do3Dmul) {
+	XYZTable[i]             = xp[0]*rotTable[0] + xp[1]*rotTable[1];
+	XYZTable[i+in->ncoef]   = xp[0]*rotTable[2] + xp[1]*rotTable[3];
+	XYZTable[i+2*in->ncoef] = xp[0]*rotTable[4] + xp[1]*rotTable[5];
+      } else {  /* no 3D */
+	XYZTable[i]             = in->ccrot * xp[0] + in->ssrot * xp[1];
+	XYZTable[i+in->ncoef]   = in->ccrot * xp[1] - in->ssrot * xp[0];
+	XYZTable[i+2*in->ncoef] = 0.0;
+      }
+    }
+  } /* end loop over fields */
+
+  /* Thread work arrays */
+  for (i=0; i<in->nThreads; i++) {
+    args = (VMIonFTFuncArg*)in->threadArgs[i];
+    args->ionCoef  = g_malloc0(MAX(1,in->ncoef)*sizeof(ofloat));
+    args->fieldOff = g_malloc0(MAX(1,3*count)*sizeof(ofloat));
+  }
+
 } /* end ObitSkyModelVMIonInitMod */
 
 /**
@@ -541,6 +585,8 @@ void ObitSkyModelVMIonShutDownMod (ObitSkyModel* inn, ObitUV *uvdata,
       for (i=0; i<in->nThreads; i++) {
 	args = (VMIonFTFuncArg*)in->threadArgs[i];
 	if (args->VMComps) ObitFArrayUnref(args->VMComps);
+	if (args->ionCoef)  g_free(args->ionCoef);
+	if (args->fieldOff) g_free(args->fieldOff);
 	g_free(in->threadArgs[i]);
       }
       g_free(in->threadArgs);
@@ -551,6 +597,7 @@ void ObitSkyModelVMIonShutDownMod (ObitSkyModel* inn, ObitUV *uvdata,
   in->uRotTab  = ObitFArrayUnref(in->uRotTab);
   in->ZernX    = ObitFArrayUnref(in->ZernX);
   in->ZernY    = ObitFArrayUnref(in->ZernY);
+  in->ZernXYZ  = ObitFArrayUnref(in->ZernXYZ);
   if (in->fieldIndex) {g_free(in->fieldIndex);} in->fieldIndex = NULL;
 
   /* Delete NI data */
@@ -612,11 +659,11 @@ void ObitSkyModelVMIonUpdateModel (ObitSkyModelVM *inn,
   ObitSkyModelVMIon *in = (ObitSkyModelVMIon*)inn;
   ObitFArray *VMComps;
   VMIonFTFuncArg *args;
-  olong i, field, itmp, icomp, ncomp, lcomp, naxis[2], pos[2], lithread;
-  ofloat dra, ddec, draP, draF, ddecP, ddecF, wtP, wtF;
+  olong i, j, field, itmp, icomp, ncomp, lcomp, ncoef, nfield;
+  olong naxis[2], pos[2], lithread;
+  ofloat wtP, wtF, sum, *coef, *xyz;
   ofloat *RowP, *RowF, priorTime, followTime, priorWeight, followWeight;
-  ofloat konst, xyz[3]={0.0,0.0,0.0}, xp[2];
-  ofloat *rotTable, *XTable, *YTable, *inData, *outData;
+  ofloat *XYZTable, *inData, *outData;
   gchar *routine = "ObitSkyModelVMIonUpdateModel";
 
   /* Data in ccomps are per row:
@@ -665,8 +712,33 @@ void ObitSkyModelVMIonUpdateModel (ObitSkyModelVM *inn,
   priorWeight  = RowP[5];
   followWeight = RowF[5];
 
-  /* geometric constant */
-  konst = DG2RAD * 2.0 * G_PI;
+  /* Zernike coefficients at time - before first? or following bad*/
+  coef  = args->ionCoef;
+  ncoef = in->ncoef;
+  if ((time<priorTime) || (followWeight<=0.0)) {
+    wtP = (priorWeight>0.0) ? 1.0 : 0.0;
+    wtF = 0.0;
+  } else if ((time>followTime) || (priorWeight<=0.0)){ 
+    /* after last or preceeding bad */
+    wtP = 0.0;
+    wtF = (followWeight>0.0) ? 1.0 : 0.0;
+  } else {  /* in between and both OK, interpolate */
+    wtF = (time - priorTime) / (followTime-priorTime+1.0e-10);
+    wtP = 1.0 - wtF;
+  }
+  for (i=0; i<ncoef; i++) coef[i] = wtP*RowP[6+i] + wtF*RowF[6+i];
+
+  /* Position offset terms for all fields, 
+     (3 x nfield) by ncoef matrix times coefficient vector */
+  nfield  = in->ZernXYZ->naxis[1];
+  naxis[0] = 0; naxis[1] = 0;
+  XYZTable = ObitFArrayIndex(in->ZernXYZ, naxis);
+  for (i=0; i<3*nfield; i++) {
+    sum = 0.0;
+    for (j=0; j<ncoef; j++) sum += XYZTable[j]*coef[j];
+    args->fieldOff[i] = sum;
+    XYZTable += ncoef;
+  }
 
  /* Loop through data in VMComps adding corruptions to in->comps */
   lcomp = VMComps->naxis[0];
@@ -675,72 +747,18 @@ void ObitSkyModelVMIonUpdateModel (ObitSkyModelVM *inn,
   inData  = ObitFArrayIndex(in->comps, naxis);
   outData = ObitFArrayIndex(VMComps, naxis);
   field = -1;
+  xyz   = args->fieldOff;
   for (icomp=0; icomp<ncomp; icomp++) {
 
-    /* If new field the calculate offset */
+    /* If new field get offset */
     itmp = inData[0] + 0.5;
     if ((field!=itmp) && (itmp>=0)) {
-      /* Calculate, interpolate current position offset */
-      /* Get pointing position for offsets */
       field = itmp;
-      naxis[0] = 0; naxis[1] = in->fieldIndex[field]; 
       /* Barf and die if invalid */
-      Obit_return_if_fail((naxis[1]>=0), err,
+      Obit_return_if_fail((in->fieldIndex[field]>=0), err,
 			  "%s: Internal tables corrupted or invalid", routine);
-      rotTable = ObitFArrayIndex(in->uRotTab, naxis);
-      XTable   = ObitFArrayIndex(in->ZernX, naxis);
-      YTable   = ObitFArrayIndex(in->ZernY, naxis);
-      
-      draP  = 0.0;
-      ddecP = 0.0;
-      if (priorWeight>0.0) {
-	for (i=0; i<in->ncoef; i++) {
-	  draP  += RowP[6+i]*XTable[i];
-	  ddecP += RowP[6+i]*YTable[i];
-	} 
-      }
-      
-      draF  = 0.0;
-      ddecF = 0.0;
-      if (followWeight>0.0) {
-	for (i=0; i<in->ncoef; i++) {
-	  draF  += RowF[6+i]*XTable[i];
-	  ddecF += RowF[6+i]*YTable[i];
-	} 
-      }
-
-      /* Interpolate - before first? or following bad*/
-      if ((time<priorTime) || (followWeight<=0.0)) {
-	dra  = draP;
-	ddec = ddecP;
-      } else if ((time>followTime) || (priorWeight<=0.0)){ 
-	/* after last or preceeding bad */
-	dra  = draF;
-	ddec = ddecF;
-      } else {  /* in between and both OK, interpolate */
-	wtF = (time - priorTime) / (followTime-priorTime+1.0e-10);
-	wtP = 1.0 - wtF;
-	dra  = wtP*draP  + wtF*draF;
-	ddec = wtP*ddecP + wtF*ddecF;
-      }
-
-      /* Position offset term */
-      xp[0] = -dra  * konst;
-      xp[1] = -ddec * konst;
-      if (in->do3Dmul) {
-	xyz[0] = xp[0]*rotTable[0] + xp[1]*rotTable[1];
-	xyz[1] = xp[0]*rotTable[2] + xp[1]*rotTable[3];
-	xyz[2] = xp[0]*rotTable[4] + xp[1]*rotTable[5];
-	/* PRJMUL (2, XP, UMAT, XYZ); */
-      } else {  /* no 3D */
-	xyz[0] = in->ccrot * xp[0] + in->ssrot * xp[1];
-	xyz[1] = in->ccrot * xp[1] - in->ssrot * xp[0];
-	xyz[2] = 0.0;
-      }
-    } /* end calculate new field offset */
-
-    /* DEBUG
-    xyz[0] = xyz[1] = xyz[2] = 0.0; */
+      xyz = &args->fieldOff[3*in->fieldIndex[field]];
+    } /* end new field offset */
 
     /* Update - copy to outData */
     if (inData[0]>=0.0) {
@@ -748,7 +766,7 @@ void ObitSkyModelVMIonUpdateModel (ObitSkyModelVM *inn,
       outData[1] = inData[4] + xyz[0]; /* X phase term */
       outData[2] = inData[5] + xyz[1]; /* Y phase term */
       outData[3] = inData[6] + xyz[2]; /* Z phase term */
-      for (i=7; i<lcomp; i++) outData[4+i] = inData[7+i]; /* other terms */
+      for (i=7; i<lcomp; i++) outData[i-3] = inData[i]; /* other terms */
     } else {
       outData[0] = 0.0;
       outData[1] = 0.0;
@@ -906,6 +924,7 @@ void ObitSkyModelVMIonInit  (gpointer inn)
   in->uRotTab    = NULL;
   in->ZernX      = NULL; 
   in->ZernY      = NULL; 
+  in->ZernXYZ    = NULL; 
   in->NITable    = NULL;
   in->NIArray    = NULL;
   in->fieldIndex = NULL;
@@ -933,6 +952,7 @@ void ObitSkyModelVMIonClear (gpointer inn)
   in->uRotTab  = ObitFArrayUnref(in->uRotTab);
   in->ZernX    = ObitFArrayUnref(in->ZernX);
   in->ZernY    = ObitFArrayUnref(in->ZernY);
+  in->ZernXYZ  = ObitFArrayUnref(in->ZernXYZ);
   in->NITable  = ObitTableNIUnref(in->NITable);
   in->NIArray  = ObitFArrayUnref(in->NIArray);
   if (in->fieldIndex) g_free(in->fieldIndex);
@@ -943,6 +963,8 @@ void ObitSkyModelVMIonClear (gpointer inn)
       for (i=0; i<in->nThreads; i++) {
 	args = (VMIonFTFuncArg*)in->threadArgs[i];
 	if (args->VMComps) ObitFArrayUnref(args->VMComps);
+	if (args->ionCoef)  g_free(args->ionCoef);
+	if (args->fieldOff) g_free(args->fieldOff);
 	g_free(in->threadArgs[i]);
       }
       g_free(in->threadArgs);
@@ -95,6 +95,10 @@ static ofloat FeedAzE (ObitSkyModelVMSquint* in,  ObitUV *uvdata, ofloat *squint
 /** Private: Get Angle from center of the beam */
 ofloat BeamAngle (ObitImageDesc *in, ofloat x, ofloat y, ofloat offx, ofloat offy);
 
+/** Private: Beam power gains for an array of angles */
+static void SquintBeamGain (ObitSkyModelVMSquint* in, olong n, ofloat *Angle, 
+			    odouble Freq, ofloat antSize, ofloat pbmin);
+
 /*---------------Private structures----------------*/
 /* FT threaded function argument 
  Note: Derived classes MUST have the following entries at the beginning 
@@ -132,6 +136,8 @@ typedef struct {
   ofloat *REgain;
   /** Array of time/spatially variable EVLA L component gain */
   ofloat *LEgain;
+  /** Work array of unsquinted component beam gain */
+  ofloat *PBref;
 } VMSquintFTFuncArg;
 /*----------------------Public functions---------------------------*/
 /**
@@ -313,7 +319,8 @@ void ObitSkyModelVMSquintInitMod (ObitSkyModel* inn, ObitUV *uvdata,
   ObitTableList *list=NULL;
   ObitTableAN *TableAN=NULL;
   ObitUVDesc *uvDesc;
-  ofloat phase=0.5, cp, sp;
+  ofloat phase=0.5, cp, sp, antsize = 24.5, pbmin;
+  odouble Freq;
   gchar *blank="    ";
   olong i;
   VMSquintFTFuncArg *args;
@@ -375,6 +382,7 @@ void ObitSkyModelVMSquintInitMod (ObitSkyModel* inn, ObitUV *uvdata,
     args->Lgain  = NULL;
     args->REgain = NULL;
     args->LEgain = NULL;
+    args->PBref  = NULL;
   }
 
   /* Call parent initializer */
@@ -400,10 +408,13 @@ void ObitSkyModelVMSquintInitMod (ObitSkyModel* inn, ObitUV *uvdata,
   numAntList = ObitTableListGetHigh (list, "AIPS AN");  /* How many subarrays? */
   if (numAntList!=in->numAntList) { /* Rebuild Antenna Lists if needed */
     for (iver=1; iver<=in->numAntList; iver++) { 
-      in->AntList[iver-1] = ObitAntennaListUnref(in->AntList[iver-1]);
+      in->AntList[iver-1]  = ObitAntennaListUnref(in->AntList[iver-1]);
+      in->AntEphem[iver-1] = ObitAntennaEphemUnref(in->AntEphem[iver-1]);
     }
     if (in->AntList) {g_free(in->AntList);} in->AntList = NULL;
-    in->AntList = g_malloc0((numAntList)*sizeof(ObitAntennaList*));
+    if (in->AntEphem) {g_free(in->AntEphem);} in->AntEphem = NULL;
+    in->AntList  = g_malloc0((numAntList)*sizeof(ObitAntennaList*));
+    in->AntEphem = g_malloc0((numAntList)*sizeof(ObitAntennaEphem*));
   }
   in->numAntList = numAntList;
   for (iver=1; iver<=numAntList; iver++) { 
@@ -413,6 +424,9 @@ void ObitSkyModelVMSquintInitMod (ObitSkyModel* inn, ObitUV *uvdata,
     in->AntList[iver-1] = ObitTableANGetList(TableAN, err);
     if (err->error) Obit_traceback_msg (err, routine, in->name);
     TableAN = ObitTableANUnref(TableAN);
+    /* Tabulated parallactic angles, shared between threads */
+    in->AntEphem[iver-1] = ObitAntennaEphemUnref(in->AntEphem[iver-1]);
+    in->AntEphem[iver-1] = ObitAntennaEphemCreate ("Ephem", in->AntList[iver-1], 0.0);
   }
   
   /* Source */
@@ -423,6 +437,17 @@ void ObitSkyModelVMSquintInitMod (ObitSkyModel* inn, ObitUV *uvdata,
   /* Precess to get Apparent position */
   ObitPrecessUVJPrecessApp (uvdata->myDesc, in->curSource);
 
+  /* Tabulated beam shape for squint corrections */
+  pbmin = 0.0;
+  ObitInfoListGetTest(in->info, "PBmin", &type, dim, &pbmin);
+  pbmin = MAX (pbmin, 0.01);
+  Freq  = uvdata->myDesc->crval[uvdata->myDesc->jlocf];
+  in->PBTab = ObitPBUtilTabFree(in->PBTab);
+  if (Freq >= 1.0e9) 
+    in->PBTab = ObitPBUtilTabCreate (OBIT_PBUtil_Jinc, Freq, antsize, pbmin, 0.0);
+  else
+    in->PBTab = ObitPBUtilTabCreate (OBIT_PBUtil_Poly, Freq, antsize, pbmin, 0.0);
+
   /* Init Sine/Cosine, exp calculator - just to be sure about threading */
   ObitSinCosCalc(phase, &sp, &cp);
 
@@ -455,6 +480,7 @@ void ObitSkyModelVMSquintShutDownMod (ObitSkyModel* inn, ObitUV *uvdata,
 	if (args->Lgain)  g_free(args->Lgain);
 	if (args->REgain) g_free(args->REgain);
 	if (args->LEgain) g_free(args->LEgain);
+	if (args->PBref)  g_free(args->PBref);
 	g_free(in->threadArgs[i]);
       }
       g_free(in->threadArgs);
@@ -519,9 +545,9 @@ void ObitSkyModelVMSquintUpdateModel (ObitSkyModelVM *inn,
 				      ObitErr *err)
 {
   ObitSkyModelVMSquint *in = (ObitSkyModelVMSquint*)inn;
-  odouble Freq, Angle, AngleRR, AngleLL;
+  odouble Freq;
   olong npos[2], lcomp, ncomp, i, ifield, lithread;
-  ofloat *ccData, *Rgain, *Lgain, curPA, tPA, tTime;
+  ofloat *ccData, *Rgain, *Lgain, *PBref, curPA, tPA, tTime;
   ofloat feedPA, squint, dx, dy, x, y, antsize = 24.5, pbmin = 0.0;
   ObitInfoType type;
   gint32 dim[MAXINFOELEMDIM] = {1,1,1,1,1};
@@ -553,7 +579,7 @@ void ObitSkyModelVMSquintUpdateModel (ObitSkyModelVM *inn,
 
   /* Need Parallactic angle */
   tTime = time - 5.0*suba;  /* Correct time for subarray offset  from DBCON */
-  curPA = ObitAntennaListParAng (in->AntList[suba], 1, tTime, in->curSource);
+  curPA = ObitAntennaEphemParAng (in->AntEphem[suba], 1, tTime, in->curSource);
   Freq = uvdata->myDesc->crval[uvdata->myDesc->jlocf];
 
   /* Which antennas are EVLA ? */
@@ -596,10 +622,11 @@ void ObitSkyModelVMSquintUpdateModel (ObitSkyModelVM *inn,
   lcomp = in->comps->naxis[0];  /* Length of row in comp table */
   ncomp = in->numComp;  /* number of components */
 
-  /* Compute antenna gains and put in to Rgain, Lgain */
+  /* Angles wrt pointing position, unsquinted into PBref, 
+     with squint into Rgain, Lgain */
+  PBref = args->PBref;
   for (i=0; i<ncomp; i++) {
-    Lgain[i] = 1.0;
-    Rgain[i] = 1.0;
+    PBref[i] = Lgain[i] = Rgain[i] = 0.0;
     /* Where in the beam? */
     x = ccData[i*lcomp+1];
     y = ccData[i*lcomp+2];
@@ -607,19 +634,28 @@ void ObitSkyModelVMSquintUpdateModel (ObitSkyModelVM *inn,
     if (ifield<0) continue;
     /* Determine angle wrt pointing position */
     /*Angle = ObitImageDescAngle(in->mosaic->images[ifield]->myDesc, y, x);*/
-    Angle = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, 0.0, 0.0);
+    PBref[i] = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, 0.0, 0.0);
 
     /* Angle with squint LL */
     /*AngleLL = ObitImageDescAngle(in->mosaic->images[ifield]->myDesc, 
       y-dy, x-dx);*/
-    AngleLL = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, -dx, -dy);
-    Lgain[i] = sqrt(ObitPBUtilPntErr (Angle, AngleLL, antsize, pbmin, Freq));
+    Lgain[i] = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, -dx, -dy);
 
     /* Angle with squint RR */
     /* AngleRR = ObitImageDescAngle(in->mosaic->images[ifield]->myDesc, 
        y+dy, x+dx);*/
-    AngleRR = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, dx, dy);
-    Rgain[i] = sqrt(ObitPBUtilPntErr (Angle, AngleRR, antsize, pbmin, Freq));
+    Rgain[i] = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, dx, dy);
+  } /* end angle loop for VLA */
+
+  /* Beam gains, unsquinted are the same for EVLA */
+  SquintBeamGain (in, ncomp, PBref, Freq, antsize, pbmin);
+  SquintBeamGain (in, ncomp, Lgain, Freq, antsize, pbmin);
+  SquintBeamGain (in, ncomp, Rgain, Freq, antsize, pbmin);
+
+  /* Antenna amplitude gains */
+  for (i=0; i<ncomp; i++) {
+    Lgain[i] = sqrt(PBref[i] / Lgain[i]);
+    Rgain[i] = sqrt(PBref[i] / Rgain[i]);
 
     /* DEBUG 
     if (i==0) {
@@ -658,32 +694,36 @@ void ObitSkyModelVMSquintUpdateModel (ObitSkyModelVM *inn,
   lcomp = in->comps->naxis[0];  /* Length of row in comp table */
   ncomp = in->numComp;          /* number of components */
 
-  /* Compute antenna gains and put in to Rgain, Lgain */
+  /* Angles wrt pointing position with squint into Rgain, Lgain */
   for (i=0; i<ncomp; i++) {
-    Lgain[i] = 1.0;
-    Rgain[i] = 1.0;
+    Lgain[i] = Rgain[i] = 0.0;
     /* Where in the beam? */
     x = ccData[i*lcomp+1];
     y = ccData[i*lcomp+2];
     ifield = ccData[i*lcomp+0]+0.5;
     if (ifield<0) continue;
-    /* Determine angle wrt pointing position */
-    /*Angle = ObitImageDescAngle(in->mosaic->images[ifield]->myDesc, y, x);*/
-    Angle = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, 0.0, 0.0);
 
     /* Angle with squint LL */
     /*AngleLL = ObitImageDescAngle(in->mosaic->images[ifield]->myDesc, 
       y-dy, x-dx);*/
     /* DEBUG AngleLL = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, -dx, -dy);*/
-    AngleLL = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, dx, dy);
-    Lgain[i] = sqrt(ObitPBUtilPntErr (Angle, AngleLL, antsize, pbmin, Freq));
+    Lgain[i] = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, dx, dy);
 
     /* Angle with squint RR */
     /* AngleRR = ObitImageDescAngle(in->mosaic->images[ifield]->myDesc, 
        y+dy, x+dx);*/
     /* DEBUG AngleRR = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, dx, dy);*/
-    AngleRR = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, -dx, -dy);
-    Rgain[i] = sqrt(ObitPBUtilPntErr (Angle, AngleRR, antsize, pbmin, Freq));
+    Rgain[i] = BeamAngle(in->mosaic->images[ifield]->myDesc, x, y, -dx, -dy);
+  } /* end angle loop for EVLA */
+
+  /* Beam gains */
+  SquintBeamGain (in, ncomp, Lgain, Freq, antsize, pbmin);
+  SquintBeamGain (in, ncomp, Rgain, Freq, antsize, pbmin);
+
+  /* Antenna amplitude gains */
+  for (i=0; i<ncomp; i++) {
+    Lgain[i] = sqrt(PBref[i] / Lgain[i]);
+    Rgain[i] = sqrt(PBref[i] / Rgain[i]);
 
     /* DEBUG 
     if (i==0) {
@@ -697,11 +737,11 @@ void ObitSkyModelVMSquintUpdateModel (ObitSkyModelVM *inn,
 
   /* end time - need Parallactic angle */
   tTime += 1.0/1440.0;
-  tPA = ObitAntennaListParAng (in->AntList[suba], 1, tTime, in->curSource);
+  tPA = ObitAntennaEphemParAng (in->AntEphem[suba], 1, tTime, in->curSource);
   /* Step by a min until the parallactic angle changes by 1 deg */
   while (fabs(tPA-curPA) < 1.0*DG2RAD) {
     tTime += 1.0/1440.0;
-    tPA = ObitAntennaListParAng (in->AntList[suba], 1, tTime, in->curSource);
+    tPA = ObitAntennaEphemParAng (in->AntEphem[suba], 1, tTime, in->curSource);
     /* But not forever */
     if (tTime-time>0.25) break;
   }
@@ -837,6 +877,8 @@ void ObitSkyModelVMSquintInit  (gpointer inn)
   in->REgain       = NULL;
   in->LEgain       = NULL;
   in->AntList      = NULL;
+  in->AntEphem     = NULL;
+  in->PBTab        = NULL;
   in->curSource    = NULL;
   in->numAntList   = 0;
   in->Threshold    = 0.0;
@@ -868,12 +910,19 @@ void ObitSkyModelVMSquintClear (gpointer inn)
   if (in->REgain) {g_free(in->REgain);} in->REgain = NULL;
   if (in->LEgain) {g_free(in->LEgain);} in->LEgain = NULL;
   in->curSource = ObitSourceUnref(in->curSource);
+  in->PBTab     = ObitPBUtilTabFree(in->PBTab);
   if (in->AntList)  {
     for (i=0; i<in->numAntList; i++) { 
       in->AntList[i] = ObitAntennaListUnref(in->AntList[i]);
     }
     g_free(in->AntList); in->AntList = NULL;
   }
+  if (in->AntEphem)  {
+    for (i=0; i<in->numAntList; i++) { 
+      in->AntEphem[i] = ObitAntennaEphemUnref(in->AntEphem[i]);
+    }
+    g_free(in->AntEphem); in->AntEphem = NULL;
+  }
     
   /* Thread stuff */
   if (in->threadArgs) {
@@ -885,6 +934,7 @@ void ObitSkyModelVMSquintClear (gpointer inn)
 	if (args->Lgain)  g_free(args->Lgain);
 	if (args->REgain) g_free(args->REgain);
 	if (args->LEgain) g_free(args->LEgain);
+	if (args->PBref)  g_free(args->PBref);
 	g_free(in->threadArgs[i]);
       }
       g_free(in->threadArgs);
@@ -1063,11 +1113,13 @@ void ObitSkyModelVMSquintFTDFT (ObitSkyModelVM *inn, olong field, ObitUV *uvdata
       if (args->Lgain)  g_free(args->Lgain);
       if (args->REgain) g_free(args->REgain);
       if (args->LEgain) g_free(args->LEgain);
+      if (args->PBref)  g_free(args->PBref);
       args->dimGain = in->numComp;
       args->Rgain  = g_malloc0(args->dimGain*sizeof(ofloat));
       args->Lgain  = g_malloc0(args->dimGain*sizeof(ofloat));
       args->REgain = g_malloc0(args->dimGain*sizeof(ofloat));
       args->LEgain = g_malloc0(args->dimGain*sizeof(ofloat));
+      args->PBref  = g_malloc0(args->dimGain*sizeof(ofloat));
     }
     /* Update which vis */
     lovis += nvisPerThread;
@@ -1602,3 +1654,27 @@ ofloat BeamAngle (ObitImageDesc *in, ofloat x, ofloat y, ofloat offx, ofloat off
   return dist;
 } /* end BeamAngle */
 
+/**
+ * Beam power gains for an array of angles from the pointing position.
+ * Uses the tabulated beam if valid, else ObitPBUtilJinc (>= 1 GHz) 
+ * or ObitPBUtilPoly as ObitPBUtilPntErr does.
+ * \param in      SkyModel
+ * \param n       Number of angles
+ * \param Angle   [in] Angles (deg), [out] power gains
+ * \param Freq    Frequency (Hz)
+ * \param antSize Antenna diameter (m)
+ * \param pbmin   Minimum antenna gain
+ */
+static void SquintBeamGain (ObitSkyModelVMSquint* in, olong n, ofloat *Angle, 
+			    odouble Freq, ofloat antSize, ofloat pbmin)
+{
+  olong i;
+
+  if (ObitPBUtilTabValid(in->PBTab, Freq, antSize, pbmin)) {
+    ObitPBUtilTabGainVec (in->PBTab, n, Angle, Freq, Angle);
+  } else if (Freq >= 1.0e9) {
+    for (i=0; i<n; i++) Angle[i] = ObitPBUtilJinc(Angle[i], Freq, antSize, pbmin);
+  } else {
+    for (i=0; i<n; i++) Angle[i] = ObitPBUtilPoly(Angle[i], Freq, pbmin);
+  }
+} /* end SquintBeamGain */
@@ -38,6 +38,59 @@
  * ObitTableCC class utility function definitions.
  */
 
+/*---------------Private structures----------------*/
+/** Number of values per component in a sky index */
+#define CCSKYINDEXSIZE 4
+
+/** Minimum number of components for a threaded sort by flux */
+#ifndef CCSORTMINTHREAD
+#define CCSORTMINTHREAD 100000
+#endif
+
+/** Components of one field in a sky index */
+typedef struct {
+  /* Image descriptor of field */
+  ObitImageDesc *desc;
+  /* Number of components */
+  olong ncomp;
+  /* Size of sort structure entries as in ObitTableCCUtilCrossList */
+  olong fsize;
+  /* Parameterized spectra, tabulated spectra, delta Z? */
+  gboolean doSpec, doTSpec, doZ;
+  /* Gaussian parameters of the components */
+  ofloat gparm[3];
+  /* Components (X, Y (1-rel pixel), flux, deltaZ) sorted by declination */
+  ofloat *comp;
+  /* Component positions (RA, Dec deg) in the same order */
+  odouble *pos;
+  /* Center of field (RA, Dec deg) */
+  odouble center[2];
+  /* Radius (deg) about center containing field and components */
+  ofloat radius;
+} CCSkyIndexField;
+
+/* Threaded flux sort function argument */
+typedef struct {
+  /* Start of block of entries */
+  ofloat *base;
+  /* Size in floats of an entry */
+  olong  size;
+  /* Number of entries in block */
+  olong  number;
+  /* thread number, <0 -> no threading  */
+  olong  ithread;
+  /* Obit Thread object */
+  ObitThread *thread;
+} CCSortFuncArg;
+
+/** Sky position index, see ObitTableCCUtilSkyIndexCreate */
+struct ObitTableCCUtilSkyIndexStr {
+  /* Number of fields */
+  olong nfield;
+  /* Per field entries */
+  CCSkyIndexField *field;
+};
+
 /*----------------------Private function prototypes----------------------*/
 /** Private: Form sort structure for a table */
 static ofloat* 
@@ -56,9 +109,9 @@ MakeCCSortStructSel2 (ObitTableCC *in, olong startComp, olong endComp,
 		      olong *size, olong *number, olong *ncomp,
 		      ObitSkyModelCompType *type, ObitErr *err);
 
-/** Private: Sort comparison function for positions */
-static gint CCComparePos (gconstpointer in1, gconstpointer in2, 
-			  gpointer ncomp);
+/** Private: Group and sum entries of a sort structure by position */
+static olong CCHashMerge (ofloat *base, olong size, olong number, 
+			  olong nkey, olong *key, olong toff);
 
 /** Private: Sort comparison function for Flux density */
 static gint CCCompareFlux (gconstpointer in1, gconstpointer in2, 
@@ -67,6 +120,36 @@ static gint CCCompareFlux (gconstpointer in1, gconstpointer in2,
 /** Private: Merge entries in Sort structure */
 static void CCMerge (ofloat *base, olong size, olong number); 
 
+/** Private: Sort valid entries to descending flux, possibly threaded */
+static void CCSortFlux (ObitThread *thread, ofloat *base, olong size, 
+			olong number);
+
+/** Private: Threaded sort of a block of entries */
+static gpointer ThreadCCSortFlux (gpointer arg);
+
+/** Private: Sort, merge and copy CCs to list */
+static ObitFArray* 
+CCCrossListMake (ObitThread *thread, ofloat *SortStruct, olong count, 
+		 olong fsize, gboolean doSpec, gboolean doTSpec, gboolean doZ, 
+		 gchar *name, olong *ncomps, ObitErr *err);
+
+/** Private: Release contents of sky index field */
+static void CCSkyIndexFieldClear (CCSkyIndexField *fld);
+
+/** Private: Sort comparison function for declination */
+static gint CCSkyIndexCompareDec (gconstpointer in1, gconstpointer in2, 
+				  gpointer pos);
+
+/** Private: Angular separation */
+static ofloat CCSkySep (odouble *pos1, odouble *pos2);
+
+/** Private: Circle containing an image */
+static void CCSkyFootprint (ObitImageDesc *desc, odouble *center, 
+			    ofloat *radius, ObitErr *err);
+
+/** Private: Are two images in the same coordinate frame? */
+static gboolean CCSkySameFrame (ObitImageDesc *desc1, ObitImageDesc *desc2);
+
 /** Private: Merge spectral entries in Sort structure */
 static void CCMergeSpec (ofloat *base, olong size, olong number, 
 			 gboolean doSpec, gboolean doTSpec, 
@@ -584,13 +667,11 @@ ObitTableCCUtilCrossList (ObitTableCC *inCC, ObitImageDesc *inDesc,
   ObitFArray *outArray=NULL;
   ObitIOCode retCode;
   ObitTableCCRow *CCRow = NULL;
-  olong i, count, number, nout, irow, lrec;
-  olong ncomp;
-  olong nrow, ndim, naxis[2], size, fsize, tsize;
-  ofloat *table, inPixel[2], outPixel[2], *SortStruct = NULL;
+  olong i, count, irow;
+  olong nrow, size, fsize, tsize;
+  ofloat inPixel[2], outPixel[2], *SortStruct = NULL;
   ofloat *entry;
   gboolean wanted, doSpec=TRUE, doTSpec=FALSE, doZ=FALSE;
-  gchar *outName;
   ObitCCCompType modType;
   gchar *routine = "ObitTableCCUtilCrossList";
   
@@ -700,78 +781,328 @@ ObitTableCCUtilCrossList (ObitTableCC *inCC, ObitImageDesc *inDesc,
   *ncomps = count;
   if (count<=0) goto cleanup;
     
-  /* Sort */
-  number = count; /* Total number of entries */
-  ncomp  = 2;     /* number of values to compare */
-  g_qsort_with_data (SortStruct, number, size, CCComparePos, &ncomp);
-
-  /* Merge entries - Normal or with spectra? */
+  /* Sort, merge and copy to list */
   doSpec = (inCC->noParms>4);
-  if (doSpec || doTSpec) 
-    CCMergeSpec (SortStruct, fsize, number, doSpec, doTSpec, doZ);
-  else
-    CCMerge (SortStruct, fsize, number);
+  outArray = CCCrossListMake (inCC->thread, SortStruct, count, fsize, 
+			      doSpec, doTSpec, doZ, inCC->name, ncomps, err);
+
+  /* Cleanup */
+ cleanup:
+  if (SortStruct) ObitMemFree(SortStruct);
+  if (err->error) Obit_traceback_val (err, routine, inCC->name, outArray);
+
+  return outArray;
+} /*  end ObitTableCCUtilCrossList */
+
+/**
+ * Create a sky position index for the CC tables of a set of images.
+ * The components of each field are added by ObitTableCCUtilSkyIndexAdd,
+ * reading each table once; the lists of components from one field 
+ * appearing in another are then obtained with 
+ * ObitTableCCUtilSkyIndexCrossList without rereading the tables and only
+ * testing components near the other field.
+ * \param nfield  Number of fields
+ * \return new index, delete with ObitTableCCUtilSkyIndexFree
+ */
+ObitTableCCUtilSkyIndex* ObitTableCCUtilSkyIndexCreate (olong nfield)
+{
+  ObitTableCCUtilSkyIndex *out=NULL;
+
+  out = g_malloc0 (sizeof(ObitTableCCUtilSkyIndex));
+  out->nfield = nfield;
+  out->field  = g_malloc0 (MAX(1,nfield)*sizeof(CCSkyIndexField));
+  return out;
+} /* end ObitTableCCUtilSkyIndexCreate */
+
+/**
+ * Add the components of one field to a sky index.
+ * Components are read with the same model type checks as
+ * ObitTableCCUtilCrossList and kept sorted by declination.
+ * \param index   Sky index
+ * \param ifield  0-rel field number
+ * \param inCC    Table of CCs for the field
+ * \param inDesc  Descriptor for image from which components derived
+ * \param err     ObitErr error stack.
+ */
+void ObitTableCCUtilSkyIndexAdd (ObitTableCCUtilSkyIndex *index, olong ifield,
+				 ObitTableCC *inCC, ObitImageDesc *inDesc, 
+				 ObitErr *err)
+{
+  CCSkyIndexField *fld;
+  ObitIOCode retCode;
+  ObitTableCCRow *CCRow = NULL;
+  olong i, j, nrow, count, *order=NULL;
+  ofloat inPixel[2], *comp=NULL, sep;
+  odouble *pos=NULL;
+  ObitCCCompType modType;
+  gchar *routine = "ObitTableCCUtilSkyIndexAdd";
   
-  /* Sort to descending merged flux densities */
-  ncomp = 1;
-  g_qsort_with_data (SortStruct, number, size, CCCompareFlux, &ncomp);
+  /* error checks */
+  if (err->error) return;
+  g_assert (index!=NULL);
+  g_assert ((ifield>=0) && (ifield<index->nfield));
+  fld = &index->field[ifield];
 
-  /* Count number of valid entries left */
-  entry = SortStruct;
-  count = 0;
-  for (i=0; i<number; i++) {
-    if (entry[0]>-1.0e19) count++;
-    entry += fsize;  /* pointer in table */
+  /* Open */
+  retCode = ObitTableCCOpen (inCC, OBIT_IO_ReadOnly, err);
+  /* If this fails try ReadWrite */
+  if (err->error) { 
+    ObitErrClearErr(err);  /* delete failure messages */
+    retCode = ObitTableCCOpen (inCC, OBIT_IO_ReadWrite, err);
   }
+  if ((retCode != OBIT_IO_OK) || (err->error))
+      Obit_traceback_msg (err, routine, inCC->name);
+
+  /* Replace any previous entry */
+  CCSkyIndexFieldClear (fld);
+  fld->desc  = ObitImageDescRef(inDesc);
+  fld->doZ   = inCC->DeltaZCol>=0;
+  fld->doSpec = (inCC->noParms>4);
+  if (fld->doSpec) fld->fsize = 4;
+  else fld->fsize = 3;
+  if (fld->doZ) fld->fsize++;  /* One for deltaZ */
+  nrow = inCC->myDesc->nrow;
+  comp = ObitMemAlloc0Name ((nrow+1)*CCSKYINDEXSIZE*sizeof(ofloat), "CCSkyIndex");
+  pos  = ObitMemAlloc0Name ((nrow+1)*2*sizeof(odouble), "CCSkyIndex");
 
-  /* Create FArray list large enough for merged CCs */
-  ndim = 2; naxis[0] = 3; naxis[1] = count;
-  if (doZ) naxis[0]++;   /* One for delta Z*/
-  nout = naxis[1];
-  lrec = naxis[0];   /* size of table row */
-  nout = naxis[1];   /* Size of output array */
-  outName =  g_strconcat ("CC List:", inCC->name, NULL);
-  outArray = ObitFArrayCreate (outName, ndim, naxis);
-  g_free (outName);  /* deallocate name */
-
-  /* Get pointer to array */
-  naxis[0] = naxis[1] = 0;
-  table = ObitFArrayIndex (outArray, naxis);
+  /* Create table row */
+  CCRow = newObitTableCCRow (inCC);
 
-  /* Copy structure to output array */
-  entry = SortStruct;
+  /* Initialize */
+  fld->gparm[0] = fld->gparm[1] = fld->gparm[2] = -1.0;  /* No Gaussian yet */
   count = 0;
-  for (i=0; i<number; i++) {
+  /* If only 3 col, or parmsCol 0 size then this is a point model */
+  if ((inCC->myDesc->nfield==3) || 
+      (inCC->parmsCol<0) ||
+      (inCC->myDesc->dim[inCC->parmsCol]<=0)) 
+    modType = OBIT_CC_PointMod;
+  else  
+    modType = OBIT_CC_Unknown; /* Model type not yet known */
 
-    /* Deleted? */
-    if (entry[0]>-1.0e19) {
-      /* Check that array not blown */
-      if (count>nout) {
-	Obit_log_error(err, OBIT_Error,"%s: Internal array overrun",
-		       routine);
+  /* Get spectrum type */
+  fld->doTSpec = (CCRow->parms[3]>=19.9) && (CCRow->parms[3]<=29.0);
+  
+  /* Loop over table reading CCs */
+  for (i=1; i<=nrow; i++) {
+    retCode = ObitTableCCReadRow (inCC, i, CCRow, err);
+    if ((retCode != OBIT_IO_OK) || (err->error)) goto cleanup;
+
+    /* Get model type  */
+    if (modType == OBIT_CC_Unknown) {
+      modType = (olong)(CCRow->parms[3] + 0.5);
+      /* If Gaussian take model */
+      if ((modType==OBIT_CC_GaussMod)     || (modType==OBIT_CC_CGaussMod) ||
+	  (modType==OBIT_CC_GaussModSpec) || (modType==OBIT_CC_CGaussModSpec)) {
+	fld->gparm[0] = CCRow->parms[0];
+	fld->gparm[1] = CCRow->parms[1];
+	fld->gparm[2] = CCRow->parms[2];
+      }
+      /* If neither a point nor Gaussian - barf */
+      if ((modType!=OBIT_CC_GaussMod) && (modType!=OBIT_CC_CGaussMod) && 
+	  (modType!=OBIT_CC_PointMod) && (modType!=OBIT_CC_GaussModSpec) && 
+	  (modType!=OBIT_CC_CGaussModSpec) && (modType!=OBIT_CC_PointModSpec) &&
+	  (modType!=OBIT_CC_GaussModTSpec) && (modType!=OBIT_CC_CGaussModTSpec) && 
+	  (modType!=OBIT_CC_PointModTSpec)) {
+	Obit_log_error(err, OBIT_Error,
+		       "%s: Model type %d neither point nor Gaussian in %s",
+		       routine, modType, inCC->name);
 	goto cleanup;
       }
-      /* copy to out */
-      table[0] = entry[0];
-      table[1] = entry[1];
-      table[2] = entry[2];
-      if (doZ) table[3] = entry[3];
-      table += lrec;
+    } /* end model type checking */
+
+    /* Pixel and position */
+    inPixel[0] = CCRow->DeltaX / inDesc->cdelt[0] + inDesc->crpix[0];
+    inPixel[1] = CCRow->DeltaY / inDesc->cdelt[1] + inDesc->crpix[1];
+    ObitImageDescGetPos (inDesc, inPixel, &pos[count*2], err);
+    if (err->error) goto cleanup;
+    comp[count*CCSKYINDEXSIZE+0] = inPixel[0];
+    comp[count*CCSKYINDEXSIZE+1] = inPixel[1];
+    comp[count*CCSKYINDEXSIZE+2] = CCRow->Flux;
+    if (fld->doZ) comp[count*CCSKYINDEXSIZE+3] = CCRow->DeltaZ;
+    count++;
+  } /* end loop over TableCC */
+
+  /* Close */
+  retCode = ObitTableCCClose (inCC, err);
+  if ((retCode != OBIT_IO_OK) || (err->error)) goto cleanup;
+
+  /* Sort by declination */
+  order = g_malloc0 ((count+1)*sizeof(olong));
+  for (i=0; i<count; i++) order[i] = i;
+  g_qsort_with_data (order, count, sizeof(olong), CCSkyIndexCompareDec, pos);
+  fld->comp = ObitMemAlloc0Name ((count+1)*CCSKYINDEXSIZE*sizeof(ofloat), "CCSkyIndex");
+  fld->pos  = ObitMemAlloc0Name ((count+1)*2*sizeof(odouble), "CCSkyIndex");
+  for (i=0; i<count; i++) {
+    j = order[i];
+    memcpy (&fld->comp[i*CCSKYINDEXSIZE], &comp[j*CCSKYINDEXSIZE], 
+	    CCSKYINDEXSIZE*sizeof(ofloat));
+    fld->pos[i*2]   = pos[j*2];
+    fld->pos[i*2+1] = pos[j*2+1];
+  }
+  fld->ncomp = count;
+
+  /* Extent of components about center of field */
+  CCSkyFootprint (inDesc, fld->center, &fld->radius, err);
+  if (err->error) goto cleanup;
+  for (i=0; i<count; i++) {
+    sep = CCSkySep (fld->center, &fld->pos[i*2]);
+    fld->radius = MAX (fld->radius, sep);
+  }
+
+  /* Cleanup */
+ cleanup:
+  CCRow = ObitTableCCRowUnref (CCRow);
+  if (comp)  ObitMemFree(comp);
+  if (pos)   ObitMemFree(pos);
+  if (order) g_free(order);
+  if (err->error) Obit_traceback_msg (err, routine, inCC->name);
+} /* end ObitTableCCUtilSkyIndexAdd */
+
+/**
+ * Might any components of a field in a sky index appear in an image?
+ * Compares the circle containing the components with that 
+ * containing the image.
+ * \param index    Sky index
+ * \param ifield   0-rel field number
+ * \param outDesc  Descriptor for output image 
+ * \return FALSE if no components can be in outDesc
+ */
+gboolean ObitTableCCUtilSkyIndexOverlap (ObitTableCCUtilSkyIndex *index, 
+					 olong ifield, ObitImageDesc *outDesc)
+{
+  CCSkyIndexField *fld;
+  odouble center[2];
+  ofloat radius;
+  ObitErr *err=NULL;
+  gboolean out;
+
+  g_assert (index!=NULL);
+  g_assert ((ifield>=0) && (ifield<index->nfield));
+  fld = &index->field[ifield];
+  if (fld->ncomp<=0) return FALSE;
+  if (!CCSkySameFrame (fld->desc, outDesc)) return TRUE;
+
+  err = newObitErr();
+  CCSkyFootprint (outDesc, center, &radius, err);
+  out = err->error || (CCSkySep (center, fld->center) <= (radius+fld->radius));
+  err = ObitErrUnref(err);
+  return out;
+} /* end ObitTableCCUtilSkyIndexOverlap */
+
+/**
+ * Return an ObitFArray containing the list of components of one field
+ * in a sky index which appear in another image.
+ * The result is the same as ObitTableCCUtilCrossList on the field's table
+ * but only components in the declination band of the output image and
+ * within the circle containing it are tested.
+ * \param index      Sky index
+ * \param ifield     0-rel field number
+ * \param outDesc    Descriptor for output image 
+ * \param gparm      [out] Gaussian parameters (major, minor, PA (all deg)) 
+ *                   if the components are Gaussians, else, -1.
+ * \param ncomps     [out] number of components in output list
+ * \param err        ObitErr error stack.
+ * \return pointer to list of components, may be NULL if none,
+ *  MUST be Unreffed.
+ */
+ObitFArray* 
+ObitTableCCUtilSkyIndexCrossList (ObitTableCCUtilSkyIndex *index, olong ifield,
+				  ObitImageDesc *outDesc, ofloat gparm[3], 
+				  olong *ncomps, ObitErr *err)
+{
+  ObitFArray *outArray=NULL;
+  CCSkyIndexField *fld;
+  olong i, lo, hi, mid, count, fsize;
+  ofloat inPixel[2], outPixel[2], *SortStruct = NULL, *entry, *cc;
+  ofloat radius;
+  odouble center[2], decLo, decHi;
+  gboolean wanted, prune;
+  gchar *routine = "ObitTableCCUtilSkyIndexCrossList";
+
+  /* error checks */
+  *ncomps = 0;
+  if (err->error) return outArray;
+  g_assert (index!=NULL);
+  g_assert ((ifield>=0) && (ifield<index->nfield));
+  fld = &index->field[ifield];
+  gparm[0] = fld->gparm[0]; gparm[1] = fld->gparm[1]; gparm[2] = fld->gparm[2];
+  if (fld->ncomp<=0) return outArray;
+
+  /* Region of output image */
+  prune = CCSkySameFrame (fld->desc, outDesc);
+  if (prune) {
+    CCSkyFootprint (outDesc, center, &radius, err);
+    if (err->error) Obit_traceback_val (err, routine, outDesc->name, outArray);
+    decLo = center[1] - radius;
+    decHi = center[1] + radius;
+  } else {
+    decLo = -1.0e20;
+    decHi =  1.0e20;
+  }
+
+  /* First component in declination band */
+  lo = 0; hi = fld->ncomp;
+  while (lo<hi) {
+    mid = (lo+hi)/2;
+    if (fld->pos[mid*2+1]<decLo) lo = mid+1;
+    else hi = mid;
+  }
+
+  fsize = fld->fsize;
+  SortStruct = ObitMemAlloc0Name ((fld->ncomp-lo+10)*fsize*sizeof(ofloat), 
+				  "CCSortStructure");
+  count = 0;
+  for (i=lo; i<fld->ncomp; i++) {
+    if (fld->pos[i*2+1]>decHi) break;
+    if (prune && (CCSkySep(center, &fld->pos[i*2])>radius)) continue;
+
+    /* Is this one in outDesc? */
+    cc = &fld->comp[i*CCSKYINDEXSIZE];
+    inPixel[0] = cc[0];
+    inPixel[1] = cc[1];
+    wanted = ObitImageDescCvtPixel (fld->desc, outDesc, inPixel, outPixel, err);
+    if (err->error) goto cleanup;
+
+    if (wanted) { /* yes */
+      entry = (ofloat*)(SortStruct + count * fsize);
+      entry[0] = outPixel[0] - 1.0;  /* Make zero rel. pixels */
+      entry[1] = outPixel[1] - 1.0;
+      entry[2] = cc[2];
+      if (fld->doZ) entry[3] = cc[3];
       count++;
-    } /* end of contains value */
-    entry += fsize;  /* pointer in table */
-  } /* end loop over array */
-  
-  /* How many? */
+    }
+  } /* end loop over components */
+
+  /* Sort, merge and copy to list */
   *ncomps = count;
+  if (count>0) 
+    outArray = CCCrossListMake (NULL, SortStruct, count, fsize, fld->doSpec, 
+				fld->doTSpec, fld->doZ, outDesc->name, 
+				ncomps, err);
 
-  /* Cleanup */
  cleanup:
   if (SortStruct) ObitMemFree(SortStruct);
-  if (err->error) Obit_traceback_val (err, routine, inCC->name, outArray);
+  if (err->error) Obit_traceback_val (err, routine, outDesc->name, outArray);
 
   return outArray;
-} /*  end ObitTableCCUtilCrossList */
+} /* end ObitTableCCUtilSkyIndexCrossList */
+
+/**
+ * Delete a sky index.
+ * \param index  Sky index
+ * \return NULL pointer
+ */
+ObitTableCCUtilSkyIndex* 
+ObitTableCCUtilSkyIndexFree (ObitTableCCUtilSkyIndex *index)
+{
+  olong i;
+
+  if (index==NULL) return NULL;
+  for (i=0; i<index->nfield; i++) CCSkyIndexFieldClear (&index->field[i]);
+  g_free (index->field);
+  g_free (index);
+  return NULL;
+} /* end ObitTableCCUtilSkyIndexFree */
 
 /**
  * Return an ObitFArray containing the list of spectral components in the 
@@ -810,7 +1141,7 @@ ObitTableCCUtilCrossListSpec (ObitTableCC *inCC, ObitImageDesc *inDesc,
   ObitIOCode retCode;
   ObitTableCCRow *CCRow = NULL;
   olong i, count, number, nout, irow, lrec, toff;
-  olong ncomp, parmoff=3;
+  olong parmoff=3;
   olong nrow, ndim, naxis[2], size, fsize, tsize;
   ofloat *table, inPixel[2], outPixel[2], *SortStruct = NULL;
   ofloat *entry, spectTerm;
@@ -936,17 +1267,13 @@ ObitTableCCUtilCrossListSpec (ObitTableCC *inCC, ObitImageDesc *inDesc,
   *ncomps = count;
   if (count<=0) goto cleanup;
     
-  /* Sort */
   number = count; /* Total number of entries */
-  ncomp  = 2;     /* number of values to compare */
-  g_qsort_with_data (SortStruct, number, size, CCComparePos, &ncomp);
 
   /* Merge entries */
   CCMergeSpec (SortStruct, fsize, number, doSpec, doTSpec, doZ);
   
   /* Sort to descending merged flux densities */
-  ncomp = 1;
-  g_qsort_with_data (SortStruct, number, size, CCCompareFlux, &ncomp);
+  CCSortFlux (inCC->thread, SortStruct, fsize, number);
 
   /* Count number of valid entries left */
   entry = SortStruct;
@@ -1134,7 +1461,7 @@ ObitTableCCUtilCrossTable (ObitTableCC *inCC, ObitImageDesc *inDesc,
 
 /**
  * Merge elements of an ObitTableCC on the same position.
- * First sorts table, collapses, sorts to desc. flux
+ * Groups table by position, collapses, sorts to desc. flux
  * \param in      Table to sort
  * \param out     Table to write output to
  * \param err     ObitErr error stack.
@@ -1181,9 +1508,6 @@ ObitIOCode ObitTableCCUtilMerge (ObitTableCC *in, ObitTableCC *out,
   if ((retCode != OBIT_IO_OK) || (err->error))
     Obit_traceback_val (err, routine, in->name, retCode);
 
-  /* Sort */
-  g_qsort_with_data (SortStruct, number, size, CCComparePos, &ncomp);
-
   /* Get spectrum type */
   doSpec  = (parms[3]>=9.9)  && (parms[3]<=19.0);
   doTSpec = (parms[3]>=19.9) && (parms[3]<=29.0);
@@ -1196,8 +1520,7 @@ ObitIOCode ObitTableCCUtilMerge (ObitTableCC *in, ObitTableCC *out,
     CCMerge (SortStruct, fsize, number);
   
   /* Sort to descending merged flux densities */
-  ncomp = 1;
-  g_qsort_with_data (SortStruct, number, size, CCCompareFlux, &ncomp);
+  CCSortFlux (in->thread, SortStruct, fsize, number);
 
   /* Clone output table from input */
   out = (ObitTableCC*)ObitTableClone ((ObitTable*)in, (ObitTable*)out);
@@ -1217,7 +1540,7 @@ ObitIOCode ObitTableCCUtilMerge (ObitTableCC *in, ObitTableCC *out,
 /**
  * Merge elements of an ObitTableCC on the same position.
  * with selection by row number.
- * First sorts table, collapses, sorts to desc. flux
+ * Groups table by position, collapses, sorts to desc. flux
  * \param in        Table to sort
  * \param startComp First component to select 
  * \param endComp   Last component to select, 0=> all
@@ -1284,9 +1607,6 @@ ObitFArray* ObitTableCCUtilMergeSel (ObitTableCC *in, olong startComp,
   retCode = ObitTableCCClose (in, err);
   if ((retCode != OBIT_IO_OK) || (err->error)) goto cleanup;
 
-  /* Sort */
-  g_qsort_with_data (SortStruct, number, size, CCComparePos, &ncomp);
-
   /* Get spectrum type */
   doSpec  = (lparms[3]>=9.9)  && (lparms[3]<=19.0);
   doTSpec = (lparms[3]>=19.9) && (lparms[3]<=29.0);
@@ -1299,8 +1619,7 @@ ObitFArray* ObitTableCCUtilMergeSel (ObitTableCC *in, olong startComp,
     CCMerge (SortStruct, fsize, number);
   
   /* Sort to descending merged flux densities */
-  ncomp = 1;
-  g_qsort_with_data (SortStruct, number, size, CCCompareFlux, &ncomp);
+  CCSortFlux (in->thread, SortStruct, fsize, number);
 
   /* Count number of valid entries left */
   entry = SortStruct;
@@ -1363,7 +1682,7 @@ ObitFArray* ObitTableCCUtilMergeSel (ObitTableCC *in, olong startComp,
 /**
  * Merge elements of an ObitTableCC on the same position.
  * with selection by row number.
- * First sorts table, collapses, sorts to desc. flux
+ * Groups table by position, collapses, sorts to desc. flux
  * \param in        Table to sort
  * \param startComp First component to select 
  * \param endComp   Last component to select, 0=> all
@@ -1428,9 +1747,6 @@ ObitFArray* ObitTableCCUtilMergeSel2 (ObitTableCC *in, olong startComp,
   retCode = ObitTableCCClose (in, err);
   if ((retCode != OBIT_IO_OK) || (err->error)) goto cleanup;
 
-  /* Sort */
-  g_qsort_with_data (SortStruct, number, size, CCComparePos, &ncomp);
-
   /* Get spectrum type */
   doSpec  = (lparms[3]>=9.9)  && (lparms[3]<=19.0);
   doTSpec = (lparms[3]>=19.9) && (lparms[3]<=29.0);
@@ -1443,8 +1759,7 @@ ObitFArray* ObitTableCCUtilMergeSel2 (ObitTableCC *in, olong startComp,
     CCMerge (SortStruct, fsize, number);
   
   /* Sort to descending merged flux densities */
-  ncomp = 1;
-  g_qsort_with_data (SortStruct, number, size, CCCompareFlux, &ncomp);
+  CCSortFlux (in->thread, SortStruct, fsize, number);
 
   /* Count number of valid entries left */
   entry = SortStruct;
@@ -1507,7 +1822,7 @@ ObitFArray* ObitTableCCUtilMergeSel2 (ObitTableCC *in, olong startComp,
  * Merge spectral elements of an ObitTableCC on the same position.
  * with selection by row number.
  * Spectral components are flux weighted average
- * First sorts table, collapses, sorts to desc. flux
+ * Groups table by position, collapses, sorts to desc. flux
  * \param in        Table to sort
  * \param startComp First component to select 
  * \param endComp   Last component to select, 0=> all
@@ -1572,9 +1887,6 @@ ObitFArray* ObitTableCCUtilMergeSelSpec (ObitTableCC *in, olong startComp,
   retCode = ObitTableCCClose (in, err);
   if ((retCode != OBIT_IO_OK) || (err->error)) goto cleanup;
 
-  /* Sort */
-  g_qsort_with_data (SortStruct, number, size, CCComparePos, &ncomp);
-
   /* Get spectrum type */
   doSpec  = (lparms[3]>=9.9)  && (lparms[3]<=19.0);
   doTSpec = (lparms[3]>=19.9) && (lparms[3]<=29.0);
@@ -1584,8 +1896,7 @@ ObitFArray* ObitTableCCUtilMergeSelSpec (ObitTableCC *in, olong startComp,
   CCMergeSpec (SortStruct, fsize, number, doSpec, doTSpec, doZ);
   
   /* Sort to descending merged flux densities */
-  ncomp = 1;
-  g_qsort_with_data (SortStruct, number, size, CCCompareFlux, &ncomp);
+  CCSortFlux (in->thread, SortStruct, fsize, number);
 
   /* Count number of valid entries left */
   entry = SortStruct;
@@ -3088,37 +3399,6 @@ MakeCCSortStructSel2 (ObitTableCC *in, olong startComp, olong endComp,
   return out;
 } /* end MakeSortStrucSel2 */ 
 
-/**
- * Compare two lists of floats
- * Conformant to function type GCompareDataFunc
- * \param in1   First list
- * \param in2   Second list
- * \param ncomp Number of values to compare (2)
- * \return <0 -> in1 < in2; =0 -> in1 == in2; >0 -> in1 > in2; 
- */
-static gint CCComparePos (gconstpointer in1, gconstpointer in2, 
-			  gpointer ncomp)
-{
-  gint out = 0;
-  ofloat *float1, *float2;
-
-  /* get correctly typed local values */
-  float1 = (float*)(in1);
-  float2 = (float*)(in2);
-
-  if (float1[0]<float2[0])      out = -1;
-  else if (float1[0]>float2[0]) out = 1;
-  else                          out = 0;
-  if (!out) { /* compare second needed? */
-    if (float1[1]<float2[1])      out = -1;
-    else if (float1[1]>float2[1]) out = 1;
-    else                          out = 0;
-  }
-
-  return out;
-} /* end CCComparePos */
-
-
 /**
  * Compare fluxes, to give descending abs order.
  * Conformant to function type GCompareDataFunc
@@ -3144,36 +3424,421 @@ static gint CCCompareFlux (gconstpointer in1, gconstpointer in2,
 
 /**
  * Merge entries in sort structure
+ * Entries at the same position are summed into the first; 
  * leaves "X" entry in defunct rows -1.0e20
- * table and then copies over the input table.
+ * The entries need not be sorted.
  * \param base    Base address of sort structure
  * \param size    Size in gfloats of a sort element
  * \param number  Number of sort elements
  */
 static void CCMerge (ofloat *base, olong size, olong number)
 {
-  olong i, j;
-  ofloat *array = base;
-  
-  i = 0;
-  while (i<number) {
-    j=i+1;
-    while (j<number) {
-      if ((array[j*size]!=array[i*size]) || (array[j*size+1]!=array[i*size+1]))
-	break;
-      array[i*size+2] += array[j*size+2];  /* sum fluxes */
-      array[j*size] = -1.0e20;             /* Don't need any more */
-      j++;
-    } /* end finding matches */
-    i = j;   /* move on */
-  } /* end loop over table */
+  olong key[2] = {0, 1};
+
+  /* Sum fluxes at same position */
+  CCHashMerge (base, size, number, 2, key, size);
 
 } /* end CCMerge */
 
+/**
+ * Group entries in sort structure by hash of their position and sum.
+ * The entries in a group are summed into the first entry of the group
+ * and "X" in the others is set to -1.0e20.
+ * Entries match if all of the key elements are exactly equal.
+ * A single pass through the entries with an open addressing hash 
+ * table replaces the sort by position and merge of neighbours.
+ * \param base    Base address of sort structure
+ * \param size    Size in gfloats of a sort element
+ * \param number  Number of sort elements
+ * \param nkey    Number of elements in key
+ * \param key     Element numbers (0-rel) forming key, first two X, Y
+ * \param toff    First of elements to sum in addition to flux (2),
+ *                size -> flux only
+ * \return number of distinct entries
+ */
+static olong CCHashMerge (ofloat *base, olong size, olong number, 
+			  olong nkey, olong *key, olong toff)
+{
+  olong i, j, k, nhash, mask, ngroup=0, *head=NULL;
+  ofloat *entry, *first, kval;
+  guint32 hash, bits;
+  gboolean match;
+
+  if (number<=0) return 0;
+
+  /* Hash table at least twice number of entries, power of 2 */
+  nhash = 16;
+  while (nhash<2*number) nhash *= 2;
+  mask = nhash - 1;
+  head = g_malloc(nhash*sizeof(olong));
+  for (i=0; i<nhash; i++) head[i] = -1;
+
+  entry = base;
+  for (i=0; i<number; i++, entry+=size) {
+    if (entry[0]<-1.0e19) continue;  /* Already defunct */
+
+    /* Hash of key, FNV-1a on the bits of the values */
+    hash = 2166136261U;
+    for (k=0; k<nkey; k++) {
+      kval = entry[key[k]] + 0.0;  /* -0 -> +0 */
+      memcpy (&bits, &kval, sizeof(guint32));
+      hash = (hash ^ bits) * 16777619U;
+    }
+    hash ^= hash>>15;
+    j = (olong)(hash & mask);
+
+    /* Find group or empty slot */
+    while (head[j]>=0) {
+      first = base + head[j]*size;
+      match = TRUE;
+      for (k=0; k<nkey; k++) 
+	if (first[key[k]]!=entry[key[k]]) {match = FALSE; break;}
+      if (match) break;
+      j = (j+1) & mask;
+    }
+
+    if (head[j]<0) { /* New group */
+      head[j] = i;
+      ngroup++;
+    } else {         /* Sum into first of group */
+      first = base + head[j]*size;
+      first[2] += entry[2];
+      for (k=toff; k<size; k++) first[k] += entry[k];
+      entry[0] = -1.0e20;   /* Don't need any more */
+    }
+  } /* end loop over entries */
+
+  g_free(head);
+  return ngroup;
+} /* end CCHashMerge */
+
+/**
+ * Sort valid entries in a sort structure to descending abs. flux.
+ * Valid entries are first packed to the start of the structure and
+ * the remainder marked defunct ("X" = -1.0e20).
+ * Large structures are sorted in blocks in parallel and the sorted 
+ * blocks merged.
+ * \param thread  Thread object, NULL -> no threading
+ * \param base    Base address of sort structure
+ * \param size    Size in gfloats of a sort element
+ * \param number  Number of sort elements
+ */
+static void CCSortFlux (ObitThread *thread, ofloat *base, olong size, 
+			olong number)
+{
+  CCSortFuncArg **threadArgs=NULL;
+  olong i, j, k, nvalid, nTh, nThreads, nPerThread, lo, *start=NULL;
+  olong na, nb, ia, ib, ncomp=1, bsize=size*sizeof(ofloat);
+  ofloat *entry, *work=NULL, *from, *to, *tmp, *a, *b;
+  gboolean OK;
+
+  if (number<=0) return;
+
+  /* Pack valid entries to front */
+  nvalid = 0;
+  entry = base;
+  for (i=0; i<number; i++, entry+=size) {
+    if (entry[0]<-1.0e19) continue;
+    if (i!=nvalid) memmove (base+nvalid*size, entry, bsize);
+    nvalid++;
+  }
+  for (i=nvalid; i<number; i++) base[i*size] = -1.0e20;
+  if (nvalid<=1) return;
+
+  /* How many threads? */
+  nThreads = 1;
+  if ((thread!=NULL) && (nvalid>=CCSORTMINTHREAD)) 
+    nThreads = MAX (1, ObitThreadNumProc(thread));
+  if (nThreads<=1) {
+    g_qsort_with_data (base, nvalid, bsize, CCCompareFlux, &ncomp);
+    return;
+  }
+
+  /* Sort blocks */
+  nTh = nThreads;
+  nPerThread = nvalid/nTh;
+  start = g_malloc((nTh+1)*sizeof(olong));
+  threadArgs = g_malloc0(nTh*sizeof(CCSortFuncArg*));
+  lo = 0;
+  for (i=0; i<nTh; i++) {
+    start[i] = lo;
+    threadArgs[i] = g_malloc0(sizeof(CCSortFuncArg));
+    threadArgs[i]->base    = base + lo*size;
+    threadArgs[i]->size    = size;
+    if (i==(nTh-1)) threadArgs[i]->number = nvalid - lo;  /* Make sure do all */
+    else            threadArgs[i]->number = nPerThread;
+    threadArgs[i]->ithread = i;
+    threadArgs[i]->thread  = thread;
+    lo += threadArgs[i]->number;
+  }
+  start[nTh] = nvalid;
+  OK = ObitThreadIterator (thread, nTh, 
+			   (ObitThreadFunc)ThreadCCSortFlux,
+			   (gpointer**)threadArgs);
+  for (i=0; i<nTh; i++) g_free(threadArgs[i]);
+  g_free(threadArgs);
+
+  /* Threading failed - sort the lot */
+  if (!OK) {
+    g_qsort_with_data (base, nvalid, bsize, CCCompareFlux, &ncomp);
+    g_free(start);
+    return;
+  }
+
+  /* Merge pairs of sorted blocks until one left */
+  work = g_malloc(nvalid*bsize);
+  from = base; to = work;
+  while (nTh>1) {
+    k = 0;
+    for (i=0; i<nTh; i+=2) {
+      if (i+1>=nTh) { /* Odd one out - copy */
+	memmove (to+start[i]*size, from+start[i]*size, 
+		 (start[i+1]-start[i])*bsize);
+	start[k++] = start[i];
+	continue;
+      }
+      a  = from + start[i]*size;   na = start[i+1] - start[i];
+      b  = from + start[i+1]*size; nb = start[i+2] - start[i+1];
+      ia = ib = 0;
+      j  = start[i];
+      while ((ia<na) && (ib<nb)) {
+	if (fabs(b[ib*size+2])>fabs(a[ia*size+2])) 
+	  memmove (to+(j++)*size, b+(ib++)*size, bsize);
+	else
+	  memmove (to+(j++)*size, a+(ia++)*size, bsize);
+      }
+      if (ia<na) memmove (to+j*size, a+ia*size, (na-ia)*bsize);
+      if (ib<nb) memmove (to+j*size, b+ib*size, (nb-ib)*bsize);
+      start[k++] = start[i];
+    }
+    start[k] = nvalid;
+    nTh = k;
+    tmp = from; from = to; to = tmp;
+  } /* end merge passes */
+
+  /* Result in work? */
+  if (from!=base) memmove (base, from, nvalid*bsize);
+  g_free(work);
+  g_free(start);
+} /* end CCSortFlux */
+
+/**
+ * Sort a block of a sort structure to descending abs. flux
+ * Callable as thread
+ * \param arg Pointer to CCSortFuncArg argument with elements:
+ * \li base     Start of block
+ * \li size     Size in gfloats of an entry
+ * \li number   Number of entries in block
+ * \li ithread  thread number, <0 -> no threading
+ * \li thread   thread Object
+ * \return NULL
+ */
+static gpointer ThreadCCSortFlux (gpointer arg)
+{
+  CCSortFuncArg *largs = (CCSortFuncArg*)arg;
+  olong ncomp = 1;
+
+  if (largs->number>1)
+    g_qsort_with_data (largs->base, largs->number, largs->size*sizeof(ofloat), 
+		       CCCompareFlux, &ncomp);
+
+  /* Indicate completion */
+  if (largs->ithread>=0)
+    ObitThreadPoolDone (largs->thread, (gpointer)&largs->ithread);
+  
+  return NULL;
+} /* end ThreadCCSortFlux */
+
+/**
+ * Merge, sort and copy a sort structure of components to a CC list 
+ * as returned by ObitTableCCUtilCrossList.
+ * \param thread      Thread object for parallel sort, NULL -> serial
+ * \param SortStruct  Sort structure, entries (X, Y, flux, [deltaZ...])
+ * \param count       Number of entries
+ * \param fsize       Size in floats of an entry
+ * \param doSpec      TRUE if parameterized spectra (table noParms>4)
+ * \param doTSpec     TRUE if tabulated spectra
+ * \param doZ         TRUE if entries have delta Z
+ * \param name        Name for output list
+ * \param ncomps      [out] number of components in output list
+ * \param err         ObitErr error stack.
+ * \return pointer to list of components, may be NULL on failure, 
+ *  MUST be Unreffed.
+ */
+static ObitFArray* 
+CCCrossListMake (ObitThread *thread, ofloat *SortStruct, olong count, 
+		 olong fsize, gboolean doSpec, gboolean doTSpec, gboolean doZ, 
+		 gchar *name, olong *ncomps, ObitErr *err)
+{
+  ObitFArray *outArray=NULL;
+  olong i, number, nout, lrec, ndim, naxis[2];
+  ofloat *table, *entry;
+  gchar *outName;
+  gchar *routine = "CCCrossListMake";
+
+  number = count; /* Total number of entries */
+
+  /* Merge entries - Normal or with spectra? */
+  if (doSpec || doTSpec) 
+    CCMergeSpec (SortStruct, fsize, number, doSpec, doTSpec, doZ);
+  else
+    CCMerge (SortStruct, fsize, number);
+  
+  /* Sort to descending merged flux densities */
+  CCSortFlux (thread, SortStruct, fsize, number);
+
+  /* Count number of valid entries left */
+  entry = SortStruct;
+  count = 0;
+  for (i=0; i<number; i++) {
+    if (entry[0]>-1.0e19) count++;
+    entry += fsize;  /* pointer in table */
+  }
+
+  /* Create FArray list large enough for merged CCs */
+  ndim = 2; naxis[0] = 3; naxis[1] = count;
+  if (doZ) naxis[0]++;   /* One for delta Z*/
+  nout = naxis[1];
+  lrec = naxis[0];   /* size of table row */
+  nout = naxis[1];   /* Size of output array */
+  outName =  g_strconcat ("CC List:", name, NULL);
+  outArray = ObitFArrayCreate (outName, ndim, naxis);
+  g_free (outName);  /* deallocate name */
+
+  /* Get pointer to array */
+  naxis[0] = naxis[1] = 0;
+  table = ObitFArrayIndex (outArray, naxis);
+
+  /* Copy structure to output array */
+  entry = SortStruct;
+  count = 0;
+  for (i=0; i<number; i++) {
+
+    /* Deleted? */
+    if (entry[0]>-1.0e19) {
+      /* Check that array not blown */
+      if (count>nout) {
+	Obit_log_error(err, OBIT_Error,"%s: Internal array overrun",
+		       routine);
+	goto cleanup;
+      }
+      /* copy to out */
+      table[0] = entry[0];
+      table[1] = entry[1];
+      table[2] = entry[2];
+      if (doZ) table[3] = entry[3];
+      table += lrec;
+      count++;
+    } /* end of contains value */
+    entry += fsize;  /* pointer in table */
+  } /* end loop over array */
+  
+  /* How many? */
+  *ncomps = count;
+
+ cleanup:
+  return outArray;
+} /* end CCCrossListMake */
+
+/**
+ * Release the contents of one field of a sky index.
+ * \param fld  Field entry
+ */
+static void CCSkyIndexFieldClear (CCSkyIndexField *fld)
+{
+  fld->desc = ObitImageDescUnref(fld->desc);
+  if (fld->comp) ObitMemFree(fld->comp);
+  if (fld->pos)  ObitMemFree(fld->pos);
+  fld->comp  = NULL;
+  fld->pos   = NULL;
+  fld->ncomp = 0;
+} /* end CCSkyIndexFieldClear */
+
+/**
+ * Compare declinations of two sky index entries, ascending order.
+ * Conformant to function type GCompareDataFunc
+ * \param in1   First entry number
+ * \param in2   Second entry number
+ * \param pos   Position array (RA, Dec pairs)
+ * \return <0 -> in1 < in2; =0 -> in1 == in2; >0 -> in1 > in2; 
+ */
+static gint CCSkyIndexCompareDec (gconstpointer in1, gconstpointer in2, 
+				  gpointer pos)
+{
+  odouble dec1, dec2;
+
+  dec1 = ((odouble*)pos)[2*(*(olong*)in1)+1];
+  dec2 = ((odouble*)pos)[2*(*(olong*)in2)+1];
+  if (dec1<dec2) return -1;
+  if (dec1>dec2) return  1;
+  return 0;
+} /* end CCSkyIndexCompareDec */
+
+/**
+ * Angular separation of two positions
+ * \param pos1  First (RA, Dec) deg
+ * \param pos2  Second (RA, Dec) deg
+ * \return separation in deg
+ */
+static ofloat CCSkySep (odouble *pos1, odouble *pos2)
+{
+  odouble cosd;
+
+  cosd = sin(pos1[1]*DG2RAD)*sin(pos2[1]*DG2RAD) + 
+    cos(pos1[1]*DG2RAD)*cos(pos2[1]*DG2RAD)*cos((pos1[0]-pos2[0])*DG2RAD);
+  cosd = MAX (-1.0, MIN (1.0, cosd));
+  return (ofloat)(acos(cosd)*RAD2DG);
+} /* end CCSkySep */
+
+/**
+ * Circle containing an image: the position of the center pixel and the 
+ * largest distance to a corner, plus a pixel and a half.
+ * \param desc    Image descriptor
+ * \param center  [out] (RA, Dec) deg of center
+ * \param radius  [out] radius in deg
+ * \param err     ObitErr error stack.
+ */
+static void CCSkyFootprint (ObitImageDesc *desc, odouble *center, 
+			    ofloat *radius, ObitErr *err)
+{
+  olong i;
+  ofloat pixel[2], sep;
+  odouble pos[2];
+  ofloat corner[4][2];
+
+  pixel[0] = desc->inaxes[0]/2; pixel[1] = desc->inaxes[1]/2;
+  ObitImageDescGetPos (desc, pixel, center, err);
+  corner[0][0] = 1.0;              corner[0][1] = 1.0;
+  corner[1][0] = desc->inaxes[0];  corner[1][1] = 1.0;
+  corner[2][0] = 1.0;              corner[2][1] = desc->inaxes[1];
+  corner[3][0] = desc->inaxes[0];  corner[3][1] = desc->inaxes[1];
+  *radius = 0.0;
+  for (i=0; i<4; i++) {
+    ObitImageDescGetPos (desc, corner[i], pos, err);
+    sep = CCSkySep (center, pos);
+    *radius = MAX (*radius, sep);
+  }
+  *radius += 1.5 * MAX (fabs(desc->cdelt[0]), fabs(desc->cdelt[1]));
+} /* end CCSkyFootprint */
+
+/**
+ * Are positions in two images in the same frame so that positions from 
+ * ObitImageDescGetPos can be compared directly?
+ * \param desc1  First image descriptor
+ * \param desc2  Second image descriptor
+ * \return TRUE if same coordinate type and equinox
+ */
+static gboolean CCSkySameFrame (ObitImageDesc *desc1, ObitImageDesc *desc2)
+{
+  return (desc1->coordType==desc2->coordType) && 
+    (desc1->equinox==desc2->equinox);
+} /* end CCSkySameFrame */
+
 /**
  * Merge Spectral entries in sort structure
  * leaves "X" posn entry in defunct rows -1.0e20
  * table and then copies over the input table.
+ * The entries need not be sorted.
  * For parameterized spectra:
  * Takes flux weighted average of spectral components,
  * assumed to be entries 3+
@@ -3190,7 +3855,7 @@ static void CCMergeSpec (ofloat *base, olong size, olong number,
 			 gboolean doSpec, gboolean doTSpec, 
 			 gboolean doZ)
 {
-  olong i, j, k, toff;
+  olong i, j, k, toff, key[2] = {0, 1};
   ofloat *array = base;
 
   /* Merging doSpec data too risky */
@@ -3209,21 +3874,8 @@ static void CCMergeSpec (ofloat *base, olong size, olong number,
     }
   }
 
-  i = 0;
-  while (i<number) {
-    j=i+1;
-    while (j<number) {
-      if ((array[j*size]!=array[i*size]) || (array[j*size+1]!=array[i*size+1]))
-	break;
-      /* Sum spectral components  flux */
-      for (k=toff; k<size; k++) 
-	array[i*size+k] += array[j*size+k]; 
-      array[i*size+2] += array[j*size+2];  /* sum fluxes */
-      array[j*size] = -1.0e20;             /* Don't need any more */
-      j++;
-    } /* end finding matches */
-    i = j;   /* move on */
-  } /* end loop over table */
+  /* Sum flux and spectral components at same position */
+  CCHashMerge (base, size, number, 2, key, toff);
 
   /* Normalize parameterized spectra by sum of flux */
   if (doSpec) {
@@ -3243,6 +3895,7 @@ static void CCMergeSpec (ofloat *base, olong size, olong number,
  * Merge Spectral entries in sort structure allowing mixed Gaussians
  * leaves "X" posn entry in defunct rows -1.0e20
  * table and then copies over the input table.
+ * The entries need not be sorted.
  * For parameterized spectra:
  * Takes flux weighted average of spectral components,
  * assumed to be entries 3+
@@ -3259,7 +3912,7 @@ static void CCMergeSpec2 (ofloat *base, olong size, olong number,
 			  gboolean doSpec, gboolean doTSpec, 
 			  gboolean doZ)
 {
-  olong i, j, k, toff;
+  olong i, j, k, toff, key[5] = {0, 1, 3, 4, 5};
   ofloat *array = base;
 
   /* Merging doSpec data too risky */
@@ -3278,25 +3931,9 @@ static void CCMergeSpec2 (ofloat *base, olong size, olong number,
     }
   }
 
-  i = 0;
-  while (i<number) {
-    j=i+1;
-    while (j<number) {
-      if ((array[j*size]!=array[i*size]) || (array[j*size+1]!=array[i*size+1]))
-	break;
-      /* only combine like sized Gaussians (and same DELTAZ) */
-      if ((array[j*size+3]==array[i*size+3]) && 
-	  (array[j*size+4]==array[i*size+4]) && 
-	  (array[j*size+5]==array[i*size+5])) {
-	/* Sum spectral components  flux */
-	for (k=toff; k<size; k++) array[i*size+k] += array[j*size+k]; 
-	array[i*size+2] += array[j*size+2];  /* sum fluxes */
-	array[j*size]    = -1.0e20;          /* Don't need any more */
-      }
-      j++;
-    } /* end finding matches */
-    i = j;   /* move on */
-  } /* end loop over table */
+  /* Sum flux and spectral components at same position,
+     only combine like sized Gaussians */
+  CCHashMerge (base, size, number, 5, key, toff);
 
   /* Normalize parameterized spectra by sum of flux */
   if (doSpec) {
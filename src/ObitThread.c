@@ -24,8 +24,15 @@
 /*;                         520 Edgemont Road                         */
 /*;                         Charlottesville, VA 22903-2475 USA        */
 /*--------------------------------------------------------------------*/
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE   /* for sched_setaffinity */
+#endif
 #include <string.h>
+#include <stdio.h>
 #include "ObitThread.h"
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 /** name of the class defined in this file */
 static gchar *myClassName = "ObitThread";
@@ -36,6 +43,52 @@ static gchar *myClassName = "ObitThread";
  */
 static ObitThreadClassInfo myClassInfo = {FALSE};
 
+/*---------------Private structures----------------*/
+/** Job wrapper used when worker threads are pinned */
+typedef struct {
+  /** Function to call */
+  ObitThreadFunc func;
+  /** Argument for func */
+  gpointer arg;
+  /** Thread number (0-rel) and number of threads in the call */
+  olong ithread, nthreads;
+} ThreadAffJob;
+
+/** First touch threaded function argument */
+typedef struct {
+  /** ObitThread to signal completion */
+  ObitThread *thread;
+  /** Start of memory chunk */
+  gchar *mem;
+  /** Size of chunk in bytes */
+  gsize size;
+} FirstTouchArg;
+
+#if defined(__linux__)
+/** Maximum number of NUMA nodes considered */
+#define MAXAFFNODE 64
+/** Usable CPUs, ordered by NUMA node */
+static olong nAffCPU=0, *affCPU=NULL;
+/** Number of NUMA nodes with usable CPUs and their CPU sets */
+static olong nAffNode=0;
+static cpu_set_t affNodeSet[MAXAFFNODE];
+/** Placement slot (+1) of the current thread, 0 => not pinned */
+static GPrivate affSlot = G_PRIVATE_INIT(NULL);
+#endif /* __linux__ */
+
+/*---------------Private functions---------------------------*/
+/** Private: Get CPU/NUMA topology */
+static void ThreadAffinityInit (void);
+
+/** Private: Pin calling thread for a given thread number */
+static void ThreadPin (olong ithread, olong nthreads);
+
+/** Private: Pool function for pinned jobs */
+static void ThreadAffWrap (gpointer data, gpointer user_data);
+
+/** Private: Threaded first touch */
+static gpointer ThreadFirstTouch (gpointer arg);
+
 /**
  * \file ObitThread.c
  * ObitThread (for multi threading) class function definitions.
@@ -61,6 +114,7 @@ ObitThread* newObitThread (void)
     myClassInfo.initialized = TRUE;  /* Now initialized */
     myClassInfo.haveThreads = FALSE; /* Don't know about threading yet */
     myClassInfo.nProcessor = 0;      /* Don't know about threading yet */
+    myClassInfo.affinity   = 0;      /* No thread placement */
   }
 
   /* allocate structure */
@@ -70,6 +124,7 @@ ObitThread* newObitThread (void)
   strncpy (me->className, myClassName, 11);
   me->ReferenceCount = 1;
   me->myClassInfo = &myClassInfo;
+  me->poolFunc = NULL;
   me->pool     = NULL;
   me->queue    = NULL;
   me->myMutex  = NULL;
@@ -390,11 +445,14 @@ gboolean ObitThreadHaveThreads (ObitThread* in)
  * No change is made if compilations did not have OBIT_THREADS_ENABLED
  * \param myInput  an ObitInfoList possible containing
  * \li "nThreads"   OBIT_long (1,1,1) Number of threads to attempt per pool.
+ * \li "threadAffinity" OBIT_long (1,1,1) Placement of worker threads,
+ *                   0=none (default), 1=pin to cores, 2=pin to NUMA nodes.
+ *                   See ObitThreadSetAffinity.
  */
 void ObitThreadInit (ObitInfoList *myInput)
 {
   ObitThread *thread=NULL;
-  olong nThreads;
+  olong nThreads, affinity;
   ObitInfoType type;
   gint32       dim[MAXINFOELEMDIM] = {1,1,1,1,1};
 
@@ -405,8 +463,13 @@ void ObitThreadInit (ObitInfoList *myInput)
   nThreads = 1;
   ObitInfoListGetTest(myInput, "nThreads", &type, dim, &nThreads);
 
+  /* Thread placement */
+  affinity = 0;
+  ObitInfoListGetTest(myInput, "threadAffinity", &type, dim, &affinity);
+
   /* Init */
   ObitThreadAllowThreads (thread, nThreads);
+  ObitThreadSetAffinity (thread, affinity);
   freeObitThread (thread);  /* Cleanup */
 
 } /* end ObitThreadInit*/
@@ -452,6 +515,97 @@ olong ObitThreadNumProc (ObitThread* in)
   return out;
 } /* end ObitThreadNumProc */
 
+/**
+ * Sets the placement of the worker threads used by ObitThreadIterator.
+ * Thread number i of a call is run on a fixed core (mode 1, core 
+ * i modulo the number of usable cores, taken node by node) or on a 
+ * fixed NUMA node (mode 2, the threads of a call being divided evenly 
+ * and in order over the nodes) so that contiguous work split by thread
+ * number, and the memory it uses, stay on one memory domain.
+ * Only the CPUs in the affinity mask of the process are used.
+ * Noop unless compiled with OBIT_THREADS_ENABLED on Linux.
+ * \param in   Pointer to a ObitThread object.
+ * \param mode 0=none, 1=pin to cores, 2=pin to NUMA nodes
+ */
+void ObitThreadSetAffinity (ObitThread* in, olong mode)
+{
+  /* error checks */
+  g_assert (in != NULL);
+
+#if defined(OBIT_THREADS_ENABLED) && defined(__linux__)
+  ThreadAffinityInit ();
+  if ((mode<0) || (mode>2)) mode = 0;
+  /* Need more than one node to bother with nodes */
+  if ((mode==2) && (nAffNode<=1)) mode = 0;
+  if (nAffCPU<=0) mode = 0;
+  in->myClassInfo->affinity = mode;
+#endif  /* OBIT_THREADS_ENABLED && __linux__ */
+} /* end ObitThreadSetAffinity */
+
+/**
+ * Tells the placement mode of worker threads
+ * \param in Pointer to a Thread object
+ * \return 0=none, 1=pinned to cores, 2=pinned to NUMA nodes
+ */
+olong ObitThreadGetAffinity (ObitThread* in)
+{
+  /* error checks */
+  g_assert (in != NULL);
+
+  if (!in->myClassInfo->haveThreads) return 0;
+  return in->myClassInfo->affinity;
+} /* end ObitThreadGetAffinity */
+
+/**
+ * Zeroes a block of memory in nthreads contiguous chunks, chunk i being
+ * written by thread number i of an ObitThreadIterator call.
+ * With thread placement enabled (ObitThreadSetAffinity) the pages of 
+ * freshly allocated memory are thereby placed on the memory domain of the 
+ * thread that processes that part of the block when work is divided
+ * in the same way.  
+ * Otherwise, or with only one thread, the block is simply zeroed.
+ * \param in        Pointer to Thread object
+ * \param nthreads  Number of threads work on mem is divided over
+ * \param mem       Memory to zero
+ * \param size      Size of mem in bytes
+ */
+void ObitThreadFirstTouch (ObitThread* in, olong nthreads, 
+			   gpointer mem, gsize size)
+{
+  FirstTouchArg **args=NULL;
+  gsize chunk;
+  olong i;
+
+  /* error checks */
+  g_assert (in != NULL);
+  if ((mem==NULL) || (size<=0)) return;
+
+  /* Anything to place? */
+  if ((nthreads<=1) || (ObitThreadGetAffinity(in)<=0)) {
+    memset (mem, 0, size);
+    return;
+  }
+
+  /* Split into contiguous chunks */
+  chunk = size / nthreads;
+  args = g_malloc0(nthreads*sizeof(FirstTouchArg*));
+  for (i=0; i<nthreads; i++) {
+    args[i] = g_malloc0(sizeof(FirstTouchArg));
+    args[i]->thread = in;
+    args[i]->mem    = (gchar*)mem + i*chunk;
+    if (i==(nthreads-1)) args[i]->size = size - i*chunk;
+    else                 args[i]->size = chunk;
+  }
+
+  ObitThreadIterator (in, nthreads, (ObitThreadFunc)ThreadFirstTouch, 
+		      (gpointer**)args);
+  ObitThreadPoolFree (in);  /* Free thread pool */
+
+  /* Cleanup */
+  for (i=0; i<nthreads; i++) g_free(args[i]);
+  g_free(args);
+} /* end ObitThreadFirstTouch */
+
 /** 
  * Initializes Thread Pool and asynchronous queue
  * Noop unless compiled with OBIT_THREADS_ENABLED
@@ -464,7 +618,12 @@ void ObitThreadPoolInit (ObitThread* in, olong nthreads,
 			 ObitThreadFunc func, gpointer **args)
 {
 #ifdef OBIT_THREADS_ENABLED
-  in->pool  = g_thread_pool_new ((GFunc)func, args, nthreads, FALSE, NULL);
+  /* Pinned jobs are run through ThreadAffWrap */
+  if (in->myClassInfo->affinity>0)
+    in->pool  = g_thread_pool_new ((GFunc)ThreadAffWrap, args, nthreads, FALSE, NULL);
+  else
+    in->pool  = g_thread_pool_new ((GFunc)func, args, nthreads, FALSE, NULL);
+  in->poolFunc = (gpointer)func;
   in->queue = g_async_queue_new ();
 #endif  /* OBIT_THREADS_ENABLED */
 } /* end ObitThreadPoolInit */
@@ -477,6 +636,8 @@ void ObitThreadPoolInit (ObitThread* in, olong nthreads,
  * if not already done.
  * When threaded operations are finished, call ObitThreadPoolFree to release
  * Thread pool.
+ * If thread placement is enabled (ObitThreadSetAffinity) the thread running 
+ * args[i] is first pinned to the core/NUMA node for thread number i.
  * \param in Pointer to object
  * \param nthreads  Number of threads to create/run
  * \param func      Function to call to start thread
@@ -491,6 +652,8 @@ gboolean ObitThreadIterator (ObitThread* in, olong nthreads,
   /* old GTimeVal end_time;*/
   guint64 add_time;
   gpointer rval;
+  ThreadAffJob *jobs=NULL;
+  gboolean timeout=FALSE;
   olong i;
 
   /* error checks */
@@ -516,8 +679,11 @@ gboolean ObitThreadIterator (ObitThread* in, olong nthreads,
     return out;
   }
 
-  /* Make sure pool is using the correct function */
-  if ((in->pool) && (((GFunc)in->pool->func)!=((GFunc)func))) {
+  /* Make sure pool is using the correct function and placement */
+  if ((in->pool) && 
+      ((in->poolFunc!=(gpointer)func) ||
+       ((in->myClassInfo->affinity>0) && (((GFunc)in->pool->func)!=((GFunc)ThreadAffWrap))) ||
+       ((in->myClassInfo->affinity<=0) && (((GFunc)in->pool->func)!=((GFunc)func))))) {
      g_thread_pool_free(in->pool, TRUE, TRUE);  
      in->pool = NULL;
      if (in->queue) g_async_queue_unref (in->queue);
@@ -528,8 +694,20 @@ gboolean ObitThreadIterator (ObitThread* in, olong nthreads,
   if (in->pool==NULL) ObitThreadPoolInit (in, nthreads, func, args);
 
   /* Submit jobs to the pool */
-  for (i=0; i<nthreads; i++) {
-    g_thread_pool_push (in->pool, args[i], NULL);
+  if (in->myClassInfo->affinity>0) {
+    /* Wrap with thread number for placement */
+    jobs = g_malloc0(nthreads*sizeof(ThreadAffJob));
+    for (i=0; i<nthreads; i++) {
+      jobs[i].func     = func;
+      jobs[i].arg      = args[i];
+      jobs[i].ithread  = i;
+      jobs[i].nthreads = nthreads;
+      g_thread_pool_push (in->pool, &jobs[i], NULL);
+    }
+  } else {
+    for (i=0; i<nthreads; i++) {
+      g_thread_pool_push (in->pool, args[i], NULL);
+    }
   }
 
   /* Wait for them to finish, expects each to send a message to the asynchronous 
@@ -545,9 +723,12 @@ gboolean ObitThreadIterator (ObitThread* in, olong nthreads,
     /* oldrval = g_async_queue_timed_pop (in->queue, &end_time);*/
     rval = g_async_queue_timeout_pop (in->queue, add_time);
     /* Check for timeout */
-    if (rval==NULL) fprintf (stderr, "Timeout on Thread %d\n", i);
+    if (rval==NULL) {fprintf (stderr, "Timeout on Thread %d\n", i); timeout = TRUE;}
   }
 
+  /* Job wrappers may still be in use after a timeout */
+  if (!timeout && jobs) g_free(jobs);
+
   return out;
 } /* end ObitThreadIterator */
 
@@ -655,3 +836,128 @@ void ObitThreadQueueFree (ObitThread* in)
 #endif  /* OBIT_THREADS_ENABLED */
 } /* end ObitThreadQueueFree */
 
+/*---------------Private functions---------------------------*/
+/**
+ * Determine the usable CPUs (affinity mask of the process) and their 
+ * grouping in NUMA nodes from /sys/devices/system/node/node*\/cpulist.
+ * CPUs are listed node by node; only done once.
+ */
+static void ThreadAffinityInit (void)
+{
+#if defined(__linux__)
+  cpu_set_t allowed, nodeSet;
+  FILE *file;
+  gchar path[128], line[4096], *next;
+  olong i, inode, lo, hi, n;
+  gboolean *used=NULL;
+
+  if (affCPU) return;  /* Already done? */
+
+  CPU_ZERO (&allowed);
+  if (sched_getaffinity (0, sizeof(allowed), &allowed)) return;
+  affCPU = g_malloc0((CPU_SETSIZE+1)*sizeof(olong));
+  used   = g_malloc0(CPU_SETSIZE*sizeof(gboolean));
+  nAffCPU = 0; nAffNode = 0;
+
+  /* Loop over NUMA nodes - numbers may not be contiguous */
+  for (inode=0; inode<MAXAFFNODE; inode++) {
+    g_snprintf (path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", inode);
+    file = fopen (path, "r");
+    if (file==NULL) continue;
+    if (fgets (line, sizeof(line), file)==NULL) line[0] = 0;
+    fclose (file);
+
+    /* Parse list as "0-7,16-23" */
+    CPU_ZERO (&nodeSet);
+    n = 0;
+    next = line;
+    while (sscanf (next, "%d", &lo)==1) {
+      while ((*next>='0') && (*next<='9')) next++;
+      hi = lo;
+      if (*next=='-') {next++; if (sscanf (next, "%d", &hi)!=1) hi = lo;}
+      while ((*next>='0') && (*next<='9')) next++;
+      for (i=lo; (i<=hi) && (i<CPU_SETSIZE); i++) {
+	if (CPU_ISSET(i, &allowed) && !used[i]) {
+	  CPU_SET (i, &nodeSet);
+	  affCPU[nAffCPU++] = i;
+	  used[i] = TRUE;
+	  n++;
+	}
+      }
+      if (*next!=',') break;
+      next++;
+    } /* end parse loop */
+    if ((n>0) && (nAffNode<MAXAFFNODE)) affNodeSet[nAffNode++] = nodeSet;
+  } /* end loop over nodes */
+
+  /* Any usable CPUs not in a node (no NUMA info) */
+  for (i=0; i<CPU_SETSIZE; i++) {
+    if (CPU_ISSET(i, &allowed) && !used[i]) affCPU[nAffCPU++] = i;
+  }
+  g_free(used);
+#endif /* __linux__ */
+} /* end ThreadAffinityInit */
+
+/**
+ * Pin the calling thread to the core or NUMA node for thread number 
+ * ithread of nthreads according to the class placement mode.
+ * The system call is skipped if the thread is already there.
+ * \param ithread   Thread number (0-rel)
+ * \param nthreads  Number of threads in call
+ */
+static void ThreadPin (olong ithread, olong nthreads)
+{
+#if defined(__linux__)
+  cpu_set_t set;
+  olong slot, inode;
+
+  if ((myClassInfo.affinity==1) && (nAffCPU>0)) {
+    slot = ithread % nAffCPU;
+    CPU_ZERO (&set);
+    CPU_SET (affCPU[slot], &set);
+  } else if ((myClassInfo.affinity==2) && (nAffNode>1)) {
+    inode = (ithread * nAffNode) / MAX (1, nthreads);
+    inode = MIN (inode, nAffNode-1);
+    set   = affNodeSet[inode];
+    slot  = nAffCPU + inode;
+  } else return;
+
+  /* Already placed? */
+  if (GPOINTER_TO_INT(g_private_get (&affSlot))==(slot+1)) return;
+  if (sched_setaffinity (0, sizeof(set), &set)==0)
+    g_private_set (&affSlot, GINT_TO_POINTER(slot+1));
+#endif /* __linux__ */
+} /* end ThreadPin */
+
+/**
+ * Thread pool function for pinned jobs, places the thread and 
+ * calls the job function.
+ * \param data      ThreadAffJob for this job
+ * \param user_data Unused
+ */
+static void ThreadAffWrap (gpointer data, gpointer user_data)
+{
+  ThreadAffJob *job = (ThreadAffJob*)data;
+  ObitThreadFunc func = job->func;
+  gpointer       arg  = job->arg;
+
+  ThreadPin (job->ithread, job->nthreads);
+  (func)(arg);
+} /* end ThreadAffWrap */
+
+/**
+ * Zero a chunk of memory 
+ * Callable as thread
+ * \param arg Pointer to FirstTouchArg argument
+ * \return NULL
+ */
+static gpointer ThreadFirstTouch (gpointer arg)
+{
+  FirstTouchArg *largs = (FirstTouchArg*)arg;
+
+  memset (largs->mem, 0, largs->size);
+
+  /* Indicate completion */
+  ObitThreadPoolDone (largs->thread, (gpointer)&largs->size);
+  return NULL;
+} /* end ThreadFirstTouch */
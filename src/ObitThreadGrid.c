@@ -33,6 +33,7 @@
 #include "ObitUVGridMF.h"
 #include "ObitUVGridWB.h"
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 
 /*----------------Obit: Merx mollis mortibus nuper ------------------*/
@@ -78,6 +79,8 @@ typedef struct {
   ofloat       *data;
   /* uv grid */
   ofloat       *grid;
+  /* bytes of grid still to be zeroed by its thread, 0 => done */
+  gsize        gridSize;
   /* gridding info */
   ObitThreadGridInfo *gridInfo;
   /* output merged/swapped grid */
@@ -118,6 +121,8 @@ static gpointer ThreadGrid (gpointer args);
 static gpointer ThreadFlip (gpointer args);
 /** Private: swap/merge grids */
 static gpointer ThreadMerge (gpointer args);
+/** Private: Zero a thread's grid on its first use */
+static void GridFirstTouch (GridFuncArg *largs);
 /** Private: prep data for gridding routine */
 void fast_prep_grid(olong ivis, GridFuncArg *args);
 /** Private: inner gridding routine */
@@ -347,7 +352,8 @@ void ObitThreadGridSetupBase (ObitThreadGrid *in, ObitUV *UVin,
 	funcarg[iGrid]->hivis  = (j+1)*nvisPth;	
 	size = 2 * (1 + UVGrids[i]->convWidth/2 + UVGrids[i]->nxBeam/2) * 
 	  UVGrids[i]->nyBeam;
-	funcarg[iGrid]->grid = g_malloc0(size*sizeof(ofloat));
+	funcarg[iGrid]->grid = g_malloc(size*sizeof(ofloat));
+	funcarg[iGrid]->gridSize = size*sizeof(ofloat); /* zeroed on first use */
 	funcarg[iGrid]->outGrid = ObitCArrayRef(UVGrids[i]->grid);
 	funcarg[iGrid]->beamOrd = 0;  /* (SW) beam order */
 	/* Channel selection */
@@ -393,7 +399,8 @@ void ObitThreadGridSetupBase (ObitThreadGrid *in, ObitUV *UVin,
 	funcarg[iGrid]->hivis  = (j+1)*nvisPth;
 	size = 2 * (1 + UVGrids[i]->convWidth/2 + UVGrids[i]->nxImage/2) * 
 	  UVGrids[i]->nyImage;
-	funcarg[iGrid]->grid = g_malloc0(size*sizeof(ofloat));
+	funcarg[iGrid]->grid = g_malloc(size*sizeof(ofloat));
+	funcarg[iGrid]->gridSize = size*sizeof(ofloat); /* zeroed on first use */
 	funcarg[iGrid]->outGrid = ObitCArrayRef(UVGrids[i]->grid);
 	/* Channel selection */
 	funcarg[iGrid]->bChan = 0;
@@ -546,7 +553,8 @@ void ObitThreadGridSetupMF (ObitThreadGrid *in, ObitUV *UVin,
 	  funcarg[iGrid]->hivis  = (j+1)*nvisPth;	
 	  size = 2 * (1 + UVGrids[i]->convWidth/2 + UVGrids[i]->nxBeam/2) * 
 	    UVGrids[i]->nyBeam;
-	  funcarg[iGrid]->grid    = g_malloc0(size*sizeof(ofloat));
+	  funcarg[iGrid]->grid    = g_malloc(size*sizeof(ofloat));
+	  funcarg[iGrid]->gridSize = size*sizeof(ofloat); /* zeroed on first use */
 	  funcarg[iGrid]->outGrid = ObitCArrayRef(UVGrids[i]->grids[iSpec]);
 	  funcarg[iGrid]->beamOrd = 0;  /* (SW) beam order */
 	  /* Channel selection */
@@ -601,7 +609,8 @@ void ObitThreadGridSetupMF (ObitThreadGrid *in, ObitUV *UVin,
 	  funcarg[iGrid]->hivis  = (j+1)*nvisPth;
 	  size = 2 * (1 + UVGrids[i]->convWidth/2 + UVGrids[i]->nxImage/2) * 
 	    UVGrids[i]->nyImage;
-	  funcarg[iGrid]->grid = g_malloc0(size*sizeof(ofloat));
+	  funcarg[iGrid]->grid = g_malloc(size*sizeof(ofloat));
+	  funcarg[iGrid]->gridSize = size*sizeof(ofloat); /* zeroed on first use */
 	  funcarg[iGrid]->outGrid = ObitCArrayRef(UVGrids[i]->grids[iSpec]);
 	  /* Channel selection */
 	  bCh = UVGrids[i]->BIFSpec[iSpec]*nChan + UVGrids[i]->BChanSpec[iSpec];
@@ -760,7 +769,8 @@ void ObitThreadGridSetupWB (ObitThreadGrid *in, ObitUV *UVin,
 	funcarg[iGrid]->hivis  = (j+1)*nvisPth;	
 	size = 2 * (1 + UVGrids[i]->convWidth/2 + UVGrids[i]->nxBeam/2) * 
 	  UVGrids[i]->nyBeam;
-	funcarg[iGrid]->grid = g_malloc0(size*sizeof(ofloat));
+	funcarg[iGrid]->grid = g_malloc(size*sizeof(ofloat));
+	funcarg[iGrid]->gridSize = size*sizeof(ofloat); /* zeroed on first use */
 	funcarg[iGrid]->outGrid = ObitCArrayRef(UVGrids[i]->grid);
 	funcarg[iGrid]->beamOrd = UVGrids[i]->order;  /* (SW) beam order */
 	/* Channel selection - all */
@@ -806,7 +816,8 @@ void ObitThreadGridSetupWB (ObitThreadGrid *in, ObitUV *UVin,
 	funcarg[iGrid]->hivis  = (j+1)*nvisPth;
 	size = 2 * (1 + UVGrids[i]->convWidth/2 + UVGrids[i]->nxImage/2) * 
 	  UVGrids[i]->nyImage;
-	funcarg[iGrid]->grid = g_malloc0(size*sizeof(ofloat));
+	funcarg[iGrid]->grid = g_malloc(size*sizeof(ofloat));
+	funcarg[iGrid]->gridSize = size*sizeof(ofloat); /* zeroed on first use */
 	funcarg[iGrid]->outGrid = ObitCArrayRef(UVGrids[i]->grid);
 	/* Channel selection */
 	funcarg[iGrid]->bChan = 0;
@@ -970,6 +981,9 @@ static gpointer ThreadGrid (gpointer args)
   olong fullWidth    = gridInfo->convWidth;           // full width of convolution kernal
   olong kvis, ichan, lrow;
 
+  /* Zero grid from this thread if not yet done */
+  GridFirstTouch (largs);
+
   lrow  = 2*(1 + gridInfo->nx[ifacet]/2 + halfWidth);  // length of grid row in floats
   eChan = MAX (eChan, bChan+1);  /* At least 1 channel */
   /* Loop over vis */
@@ -1005,6 +1019,9 @@ static gpointer ThreadFlip (gpointer args)
   ofloat *gxi, *gxo, *gci, *gco, xxo[2], cjo[2], xxi[2], cji[2];
   olong ny, ny2, vrow, iu, vc, lrow;
 
+  /* Zero grid from this thread if not yet done */
+  GridFirstTouch (largs);
+
   lrow = 2*(1 + gridInfo->nx[ifacet]/2 + halfWidth);  /* length of grid row */
   ny   = gridInfo->ny[ifacet];
   ny2  = ny/2;
@@ -1060,6 +1077,9 @@ static gpointer ThreadMerge (gpointer args)
   ofloat *gi, *go, czero[] = {0.0,0.0};
   olong ny, vrow, iu, vs, ilrow, olrow;
 
+  /* Zero grid from this thread if not yet done */
+  GridFirstTouch (largs);
+
   /* Zero output on first */
   if (largs->iGpI==0) ObitCArrayFill(largs->outGrid, czero);
 
@@ -1104,6 +1124,21 @@ static gpointer ThreadMerge (gpointer args)
   return NULL;
 } /* end ThreadMerge */
 
+/**
+ * Zero the grid of a thread argument if not yet done.
+ * Grids are allocated uninitialized and zeroed here by the first thread 
+ * to work on them so that the pages are placed in memory local to that 
+ * thread (the thread number for a grid is the same in every call and 
+ * is pinned if ObitThreadSetAffinity is enabled).
+ * \param largs  Threading argument
+ */
+static void GridFirstTouch (GridFuncArg *largs)
+{
+  if (largs->gridSize<=0) return;
+  memset (largs->grid, 0, largs->gridSize);
+  largs->gridSize = 0;
+} /* end GridFirstTouch */
+
 /**
  * Initialize global ClassInfo Structure.
  */
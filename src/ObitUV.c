@@ -93,6 +93,24 @@ static void ObitUVSetupIO (ObitUV *in, ObitErr *err);
 /** Private: Copy tables with selection */
 static ObitIOCode CopyTablesSelect (ObitUV *inUV, ObitUV *outUV, ObitErr *err);
 
+/** Private: Setup memory resident copy on open */
+static void UVMemCacheOpen (ObitUV *in, ObitIOAccess access);
+
+/** Private: Save selection of memory resident copy */
+static void UVMemCacheSetSel (ObitUVMemCache *cache, ObitUVSel *sel);
+
+/** Private: Does memory resident copy have a given selection? */
+static gboolean UVMemCacheSameSel (ObitUVMemCache *cache, ObitUVSel *sel);
+
+/** Private: Read buffer from memory resident copy */
+static gboolean UVMemCacheRead (ObitUV *in, ofloat *data, ObitIOCode *retCode);
+
+/** Private: Save buffer to memory resident copy */
+static void UVMemCacheSave (ObitUV *in, ofloat *data, ObitIOCode retCode);
+
+/** Private: Reposition memory resident copy */
+static void UVMemCacheReset (ObitUV *in, olong startVis);
+
 /** Private: Set Class function pointers. */
 static void ObitUVClassInfoDefFn (gpointer inClass);
 
@@ -455,6 +473,8 @@ ObitUV* ObitUVFromFileInfo (gchar *prefix, ObitInfoList *inList,
  * Necessary tables are copied.
  * \param in  The object to copy,  control parameters:
  * \li "copyCalTab" OBIT_boolean (1,1,1) If true and doCalib<=0 copy SN, CL 
+ * \li "CompressScratch" OBIT_boolean (1,1,1) If true the scratch file is
+ *     written compressed with weights ("CompressWt"), default FALSE.
  * \param err Error stack, returns if not empty.
  * \return pointer to the new object.
  */
@@ -466,6 +486,7 @@ ObitUV* newObitUVScratch (ObitUV *in, ObitErr *err)
   gint32 dim[MAXINFOELEMDIM] = {1,1,1,1,1};
   gchar *outName;
   olong NPIO;
+  gboolean doComp=FALSE;
   /* Don't copy Cal and Soln tables 
   gchar *exclude[]={"AIPS UV", "AIPS CL", "AIPS NI",
     "AIPS SN", "AIPS NX", "AIPS HI", "AIPS PL", "AIPS SL", NULL};*/
@@ -501,6 +522,13 @@ ObitUV* newObitUVScratch (ObitUV *in, ObitErr *err)
   ObitInfoListGet (in->info, "nVisPIO", &type, dim,  (gpointer)&NPIO, err);
   ObitInfoListPut (out->info, "nVisPIO", type, dim,  (gpointer)&NPIO, err);
 
+  /* Compressed scratch storage? */
+  ObitInfoListGetTest(in->info, "CompressScratch", &type, dim, &doComp);
+  if (doComp) {
+    dim[0] = dim[1] = dim[2] = 1;
+    ObitInfoListAlwaysPut (out->info, "CompressWt", OBIT_bool, dim, &doComp);
+  }
+
   /* Allocate underlying file */
   ObitSystemGetScratch (in->mySel->FileType, "UV", out->info, err);
   if (err->error) Obit_traceback_val (err, routine, in->name, out);
@@ -1009,6 +1037,11 @@ void ObitUVClone  (ObitUV *in, ObitUV *out, ObitErr *err)
  *               fewer) and is used to create buffers.
  * \li "Compress" Obit_bool scalar = TRUE indicates output is to be 
  *               in compressed format. (access=OBIT_IO_WriteOnly only).
+ * \li "CompressWt" Obit_bool scalar = TRUE indicates output is to be 
+ *               in compressed format keeping a weight per correlation,
+ *               real, imaginary and weight as scaled 16 bit integers.
+ *               Ignored if the number of correlations is odd.
+ *               (access=OBIT_IO_WriteOnly only).
  * \li "SubScanTime" Obit_float scalar [Optional] if given, this is the 
  *               desired time (day) of a sub scan.  This is used by the 
  *               selector to suggest a value close to this which will
@@ -1162,6 +1195,9 @@ ObitIOCode ObitUVOpen (ObitUV *in, ObitIOAccess access, ObitErr *err)
   in->myDesc->firstVis   = ((ObitUVDesc*)in->myIO->myDesc)->firstVis;
   in->myDesc->numVisBuff = ((ObitUVDesc*)in->myIO->myDesc)->numVisBuff;
 
+  /* Memory resident copy of data */
+  UVMemCacheOpen (in, access);
+
   return retCode;
 } /* end ObitUVOpen */
 
@@ -1222,6 +1258,9 @@ ObitIOCode ObitUVClose (ObitUV *in, ObitErr *err)
   ObitIOFreeBuffer(in->buffer);
   in->buffer = NULL;
 
+  /* Drop incomplete memory resident copy */
+  if (in->memCache && !in->memCache->complete) ObitUVMemCacheFree (in);
+
   /* set Status */
   in->myStatus = OBIT_Inactive;
 
@@ -1323,13 +1362,27 @@ ObitIOCode ObitUVRead (ObitUV *in, ofloat *data, ObitErr *err)
   Obit_retval_if_fail((myBuf != NULL), err, retCode,
  		      "%s: No buffer allocated for %s", routine, in->name);
 
-  retCode = ObitIORead (in->myIO, myBuf, err);
-  if ((retCode > OBIT_IO_EOF) || (err->error)) /* add traceback,return */
-    Obit_traceback_val (err, routine, in->name, retCode);
+  /* Available in memory? */
+  if (!UVMemCacheRead (in, myBuf, &retCode)) {
+    retCode = ObitIORead (in->myIO, myBuf, err);
+    if ((retCode > OBIT_IO_EOF) || (err->error)) /* add traceback,return */
+      Obit_traceback_val (err, routine, in->name, retCode);
 
-  /* save current location */
-  in->myDesc->firstVis   = ((ObitUVDesc*)in->myIO->myDesc)->firstVis;
-  in->myDesc->numVisBuff = ((ObitUVDesc*)in->myIO->myDesc)->numVisBuff;
+    /* save current location */
+    in->myDesc->firstVis   = ((ObitUVDesc*)in->myIO->myDesc)->firstVis;
+    in->myDesc->numVisBuff = ((ObitUVDesc*)in->myIO->myDesc)->numVisBuff;
+
+    /* Save in memory if requested */
+    UVMemCacheSave (in, myBuf, retCode);
+  }
+
+  /* Any processing of the data read - only if it cannot be rewritten */
+  if (in->readFilter && (retCode==OBIT_IO_OK) && (in->myDesc->numVisBuff>0) &&
+      ((in->myDesc->access==OBIT_IO_ReadOnly) ||
+       (in->myDesc->access==OBIT_IO_ReadCal))) {
+    in->readFilter (in->readFilterArg, in, myBuf, err);
+    if (err->error) Obit_traceback_val (err, routine, in->name, OBIT_IO_ReadErr);
+  }
 
   return retCode;
 } /* end ObitUVRead */
@@ -1366,6 +1419,9 @@ ObitIOCode ObitUVReadMulti (olong nBuff, ObitUV **in, ofloat **data,
   if (err->error) return retCode;
   if (nBuff<=0)   return retCode;
 
+  /* Incomplete memory resident copy cannot follow */
+  if (in[0]->memCache && !in[0]->memCache->complete) ObitUVMemCacheFree (in[0]);
+
   /* Setup for multiple buffers on first in */
   if (in[0]->nParallel!=nBuff) {
     /* Out with any old */
@@ -1554,13 +1610,27 @@ ObitIOCode ObitUVReadSelect (ObitUV *in, ofloat *data, ObitErr *err)
  		      "%s: No buffer allocated for %s", routine, in->name);
 
 
-  retCode = ObitIOReadSelect (in->myIO, myBuf, err);
-  if ((retCode > OBIT_IO_EOF) || (err->error)) /* add traceback,return */
-    Obit_traceback_val (err, routine, in->name, retCode);
+  /* Available in memory? */
+  if (!UVMemCacheRead (in, myBuf, &retCode)) {
+    retCode = ObitIOReadSelect (in->myIO, myBuf, err);
+    if ((retCode > OBIT_IO_EOF) || (err->error)) /* add traceback,return */
+      Obit_traceback_val (err, routine, in->name, retCode);
 
-  /* save current location */
-  in->myDesc->firstVis   = ((ObitUVDesc*)in->myIO->myDesc)->firstVis;
-  in->myDesc->numVisBuff = ((ObitUVDesc*)in->myIO->myDesc)->numVisBuff;
+    /* save current location */
+    in->myDesc->firstVis   = ((ObitUVDesc*)in->myIO->myDesc)->firstVis;
+    in->myDesc->numVisBuff = ((ObitUVDesc*)in->myIO->myDesc)->numVisBuff;
+
+    /* Save in memory if requested */
+    UVMemCacheSave (in, myBuf, retCode);
+  }
+
+  /* Any processing of the data read - only if it cannot be rewritten */
+  if (in->readFilter && (retCode==OBIT_IO_OK) && (in->myDesc->numVisBuff>0) &&
+      ((in->myDesc->access==OBIT_IO_ReadOnly) ||
+       (in->myDesc->access==OBIT_IO_ReadCal))) {
+    in->readFilter (in->readFilterArg, in, myBuf, err);
+    if (err->error) Obit_traceback_val (err, routine, in->name, OBIT_IO_ReadErr);
+  }
 
   return retCode;
 } /* end ObitUVReadSelect */
@@ -1593,6 +1663,9 @@ ObitIOCode ObitUVReadMultiSelect (olong nBuff, ObitUV **in, ofloat **data,
   if (err->error) return retCode;
   if (nBuff<=0)   return retCode;
 
+  /* Incomplete memory resident copy cannot follow */
+  if (in[0]->memCache && !in[0]->memCache->complete) ObitUVMemCacheFree (in[0]);
+
   /* Setup for multiple buffers on first in */
   if (in[0]->nParallel!=nBuff) {
     /* Out with any old */
@@ -1758,6 +1831,9 @@ ObitIOCode ObitUVWrite (ObitUV *in, ofloat *data, ObitErr *err)
   if (err->error) return retCode;
   g_assert (ObitIsA((Obit*)in, &myClassInfo));
 
+  /* Any memory resident copy is now invalid */
+  if (in->memCache) ObitUVMemCacheFree (in);
+
   /* check and see if its open - if not attempt */
   if ((in->myStatus!=OBIT_Modified) && (in->myStatus!=OBIT_Active)) {
     access = OBIT_IO_WriteOnly;
@@ -2104,6 +2180,9 @@ ObitIOCode ObitUVIOSet (ObitUV *in, ObitErr *err)
 		     err);
   if (err->error)  Obit_traceback_val (err, routine, in->name, retCode);
 
+  /* Rewind any memory resident copy */
+  UVMemCacheReset (in, 1);
+
   return ObitIOSet (in->myIO, in->info, err);
 } /* end ObitUVIOSet */
 
@@ -2142,10 +2221,62 @@ ObitIOCode ObitUVIOReset (ObitUV *in, olong startVis, ObitErr *err)
     ObitUVSelNextInit (sel, ((ObitUVDesc*)in->myIO->myDesc), err);
   }
   if(err->error)  Obit_traceback_val (err, routine, in->name, retCode);
+
+  /* Reposition any memory resident copy */
+  UVMemCacheReset (in, startVis+sel->nVisPIO);
+
   retCode =   OBIT_IO_OK;
   return retCode;
 } /* end ObitUVIOReset */
 
+/**
+ * Discard any memory resident copy of the data (see "doMemCache").
+ * Should be called if the underlying data are modified other than 
+ * through this object.
+ * \param in   Pointer to object
+ */
+void ObitUVMemCacheFree (ObitUV *in)
+{
+  ObitUVMemCache *cache = in->memCache;
+
+  if (cache==NULL) return;
+  if (cache->blockFirst) g_free(cache->blockFirst);
+  if (cache->blockNum)   g_free(cache->blockNum);
+  if (cache->rparm)      g_free(cache->rparm);
+  if (cache->data)       g_free(cache->data);
+  if (cache->IFSel)      g_free(cache->IFSel);
+  if (cache->ants)       g_free(cache->ants);
+  if (cache->sources)    g_free(cache->sources);
+  g_free(cache);
+  in->memCache = NULL;
+} /* end ObitUVMemCacheFree */
+
+/**
+ * Set a function to be applied to each buffer read by ObitUVRead or 
+ * ObitUVReadSelect after any calibration and selection.
+ * This allows processing, e.g. model subtraction, of the data in the
+ * same pass as whatever is reading it, e.g. gridding.
+ * The function is only applied when the data are opened OBIT_IO_ReadOnly
+ * or OBIT_IO_ReadCal so processed data can never be written back,
+ * e.g. by the OBIT_IO_ReadWrite pass of uniform weighting.
+ * Data from a memory resident copy (see "doMemCache") are processed 
+ * after being restored so the copy is of the unprocessed data.
+ * \param in   Pointer to object
+ * \param func Function to apply, NULL => none
+ * \param arg  Argument to pass to func, a reference is kept while set
+ */
+void ObitUVSetReadFilter (ObitUV *in, ObitUVReadFilterFP func, Obit *arg)
+{
+  /* error checks */
+  g_assert (ObitIsA((Obit*)in, &myClassInfo));
+
+  if (func && arg) arg = ObitRef(arg);
+  else             arg = NULL;
+  in->readFilterArg = ObitUnref(in->readFilterArg);
+  in->readFilter    = func;
+  in->readFilterArg = arg;
+} /* end ObitUVSetReadFilter */
+
 /**
  * Get source position.  
  * If single source file get from uvDesc, 
@@ -2922,6 +3053,9 @@ void ObitUVInit  (gpointer inn)
   in->nParallel = 0;
   in->multiBufIO= NULL;
   in->multiBuf  = NULL;
+  in->memCache  = NULL;
+  in->readFilter    = NULL;
+  in->readFilterArg = NULL;
   in->isScratch = FALSE;
 
 } /* end ObitUVInit */
@@ -2964,6 +3098,8 @@ void ObitUVClear (gpointer inn)
   in->myIO      = ObitUnref(in->myIO);
   if (in->buffer) ObitIOFreeBuffer(in->buffer); 
   if (in->multiBuf) g_free(in->multiBuf);
+  ObitUVMemCacheFree (in);
+  in->readFilterArg = ObitUnref(in->readFilterArg);
   if ((in->nParallel>0) && (in->multiBufIO)) {
     for (ib=0; ib<in->nParallel; ib++) 
       in->multiBufIO[ib] = ObitIOUnref(in->multiBufIO[ib]);
@@ -3040,6 +3176,12 @@ static void ObitUVGetSelect (ObitUV *in, ObitInfoList *info, ObitUVSel *sel,
   /* Compress output? */
   sel->Compress = FALSE;
   ObitInfoListGetTest(info, "Compress", &type, dim, &sel->Compress);
+  /* Compress keeping weights? (output only) */
+  sel->CompressWt = FALSE;
+  if (in->myDesc->access==OBIT_IO_WriteOnly) {
+    ObitInfoListGetTest(info, "CompressWt", &type, dim, &sel->CompressWt);
+    if (sel->CompressWt) sel->Compress = TRUE;
+  }
 
   /* Following only needed for other than ReadCal */
   if (in->myDesc->access != OBIT_IO_ReadCal) {
@@ -3749,3 +3891,381 @@ static ObitIOCode CopyTablesSelect (ObitUV *inUV, ObitUV *outUV, ObitErr *err)
 
   return retCode;
 } /* end CopyTablesSelect */
+
+/**
+ * Setup memory resident copy of the data on Open.
+ * If "doMemCache" is TRUE on in->info and access is read only, either
+ * rewinds an existing complete copy made with the same selection or 
+ * starts saving a new one.  Otherwise any copy is discarded.
+ * \param in      Object just opened
+ * \param access  Access of Open
+ */
+static void UVMemCacheOpen (ObitUV *in, ObitIOAccess access)
+{
+  ObitUVMemCache *cache = in->memCache;
+  ObitUVSel *sel = in->mySel;
+  ObitInfoType type;
+  gint32 dim[MAXINFOELEMDIM];
+  gboolean doMemCache=FALSE, same;
+  ofloat maxMB=0.0;
+  olong ncorr;
+
+  ObitInfoListGetTest(in->info, "doMemCache", &type, dim, &doMemCache);
+  if (!doMemCache || 
+      ((access!=OBIT_IO_ReadOnly) && (access!=OBIT_IO_ReadCal))) {
+    ObitUVMemCacheFree (in);
+    return;
+  }
+
+  /* Existing complete copy with same selection? */
+  if (cache && cache->complete) {
+    same = (cache->access==access) && (cache->lrec==in->myDesc->lrec) &&
+      (cache->nrparm==in->myDesc->nrparm) && UVMemCacheSameSel (cache, sel);
+    if (same) {
+      cache->nextBlock = 0;
+      cache->nextVis   = 0;
+      return;
+    }
+  }
+  ObitUVMemCacheFree (in);
+
+  /* Need (real, imaginary, weight) correlations */
+  ncorr = (in->myDesc->lrec - in->myDesc->nrparm) / 3;
+  if ((in->myDesc->inaxes[0]!=3) || 
+      (in->myDesc->lrec!=(in->myDesc->nrparm+3*ncorr))) return;
+
+  /* Start new copy */
+  ObitInfoListGetTest(in->info, "maxMemCache", &type, dim, &maxMB);
+  cache = g_malloc0(sizeof(ObitUVMemCache));
+  cache->access      = access;
+  cache->complete    = FALSE;
+  cache->filling     = TRUE;
+  cache->lrec        = in->myDesc->lrec;
+  cache->nrparm      = in->myDesc->nrparm;
+  cache->ncorr       = ncorr;
+  UVMemCacheSetSel (cache, sel);
+  cache->maxBytes    = (ollong)(maxMB * 1024.0 * 1024.0);
+  in->memCache = cache;
+} /* end UVMemCacheOpen */
+
+/**
+ * Save the selection, calibration and buffering of a memory resident
+ * copy of the data as it is started.
+ * \param cache  Memory resident copy
+ * \param sel    Selector of the data being saved
+ */
+static void UVMemCacheSetSel (ObitUVMemCache *cache, ObitUVSel *sel)
+{
+  olong i;
+
+  cache->nVisPIO     = sel->nVisPIO;
+  cache->startChann  = sel->startChann;
+  cache->numberChann = sel->numberChann;
+  cache->channInc    = sel->channInc;
+  cache->startIF     = sel->startIF;
+  cache->numberIF    = sel->numberIF;
+  cache->IFInc       = sel->IFInc;
+  cache->SubA        = sel->SubA;
+  cache->FreqID      = sel->FreqID;
+  strncpy (cache->Stokes, sel->Stokes, 5);
+  cache->doCal       = sel->doCal;
+  cache->calVersion  = sel->calVersion;
+  cache->doCalWt     = sel->doCalWt;
+  cache->doBand      = sel->doBand;
+  cache->BPversion   = sel->BPversion;
+  cache->doBPCal     = sel->doBPCal;
+  cache->doBLCal     = sel->doBLCal;
+  cache->BLversion   = sel->BLversion;
+  cache->doFlag      = sel->doFlag;
+  cache->FGversion   = sel->FGversion;
+  cache->doPolCal    = sel->doPolCal;
+  cache->corrType    = sel->corrType;
+  cache->passAll     = sel->passAll;
+  cache->transPol    = sel->transPol;
+  cache->bothCorr    = sel->bothCorr;
+  cache->dropSubA    = sel->dropSubA;
+  cache->alpha       = sel->alpha;
+  cache->alphaRefF   = sel->alphaRefF;
+  for (i=0; i<3; i++) cache->smooth[i] = sel->smooth[i];
+  cache->timeRange[0]= sel->timeRange[0];
+  cache->timeRange[1]= sel->timeRange[1];
+  cache->UVRange[0]  = sel->UVRange[0];
+  cache->UVRange[1]  = sel->UVRange[1];
+
+  /* Lists */
+  cache->nifsel = 0;
+  if (sel->IFSel && (sel->nifsel>0)) {
+    cache->nifsel = sel->nifsel;
+    cache->IFSel  = g_malloc(cache->nifsel*sizeof(gboolean));
+    for (i=0; i<cache->nifsel; i++) cache->IFSel[i] = sel->IFSel[i];
+  }
+  cache->selectAnts    = sel->selectAnts;
+  cache->numberAntList = 0;
+  if (sel->ants && (sel->numberAntList>0)) {
+    cache->numberAntList = sel->numberAntList;
+    cache->ants = g_malloc(cache->numberAntList*sizeof(olong));
+    for (i=0; i<cache->numberAntList; i++) cache->ants[i] = sel->ants[i];
+  }
+  cache->selectSources     = sel->selectSources;
+  cache->numberSourcesList = 0;
+  if (sel->sources && (sel->numberSourcesList>0)) {
+    cache->numberSourcesList = sel->numberSourcesList;
+    cache->sources = g_malloc(cache->numberSourcesList*sizeof(olong));
+    for (i=0; i<cache->numberSourcesList; i++) cache->sources[i] = sel->sources[i];
+  }
+} /* end UVMemCacheSetSel */
+
+/**
+ * Test if a memory resident copy of the data was made with the same
+ * selection, calibration and buffering as a selector now specifies.
+ * Any difference, including the number of visibilities per buffer,
+ * means the copy cannot be replayed.
+ * \param cache  Memory resident copy
+ * \param sel    Selector of the data being opened
+ * \return TRUE if the copy may be used.
+ */
+static gboolean UVMemCacheSameSel (ObitUVMemCache *cache, ObitUVSel *sel)
+{
+  olong i, n;
+  gboolean same;
+
+  same = (cache->nVisPIO==sel->nVisPIO) &&
+    (cache->startChann==sel->startChann) && (cache->numberChann==sel->numberChann) &&
+    (cache->channInc==sel->channInc) &&
+    (cache->startIF==sel->startIF) && (cache->numberIF==sel->numberIF) &&
+    (cache->IFInc==sel->IFInc) &&
+    (cache->SubA==sel->SubA) && (cache->FreqID==sel->FreqID) &&
+    (!strncmp(cache->Stokes, sel->Stokes, 4)) &&
+    (cache->doCal==sel->doCal) && (cache->calVersion==sel->calVersion) &&
+    (cache->doCalWt==sel->doCalWt) &&
+    (cache->doBand==sel->doBand) && (cache->BPversion==sel->BPversion) &&
+    (cache->doBPCal==sel->doBPCal) &&
+    (cache->doBLCal==sel->doBLCal) && (cache->BLversion==sel->BLversion) &&
+    (cache->doFlag==sel->doFlag) && (cache->FGversion==sel->FGversion) &&
+    (cache->doPolCal==sel->doPolCal) && (cache->corrType==sel->corrType) &&
+    (cache->passAll==sel->passAll) && (cache->transPol==sel->transPol) &&
+    (cache->bothCorr==sel->bothCorr) && (cache->dropSubA==sel->dropSubA) &&
+    (cache->alpha==sel->alpha) && (cache->alphaRefF==sel->alphaRefF) &&
+    (cache->smooth[0]==sel->smooth[0]) && (cache->smooth[1]==sel->smooth[1]) &&
+    (cache->smooth[2]==sel->smooth[2]) &&
+    (cache->timeRange[0]==sel->timeRange[0]) && (cache->timeRange[1]==sel->timeRange[1]) &&
+    (cache->UVRange[0]==sel->UVRange[0]) && (cache->UVRange[1]==sel->UVRange[1]) &&
+    (cache->selectAnts==sel->selectAnts) &&
+    (cache->selectSources==sel->selectSources);
+  if (!same) return FALSE;
+
+  /* IF selection */
+  n = (sel->IFSel) ? sel->nifsel : 0;
+  if (cache->nifsel!=n) return FALSE;
+  for (i=0; i<n; i++) if (cache->IFSel[i]!=sel->IFSel[i]) return FALSE;
+
+  /* Antenna list */
+  n = (sel->ants) ? MAX (0, sel->numberAntList) : 0;
+  if (cache->numberAntList!=n) return FALSE;
+  for (i=0; i<n; i++) if (cache->ants[i]!=sel->ants[i]) return FALSE;
+
+  /* Source list */
+  n = (sel->sources) ? MAX (0, sel->numberSourcesList) : 0;
+  if (cache->numberSourcesList!=n) return FALSE;
+  for (i=0; i<n; i++) if (cache->sources[i]!=sel->sources[i]) return FALSE;
+
+  return TRUE;
+} /* end UVMemCacheSameSel */
+
+/**
+ * Fill a buffer from a complete memory resident copy of the data.
+ * Buffers are returned in the same sequence as originally read.
+ * \param in       Object being read
+ * \param data     Buffer to fill
+ * \param retCode  [out] Return code, OBIT_IO_EOF at end
+ * \return TRUE if served from memory, FALSE if disk I/O needed
+ */
+static gboolean UVMemCacheRead (ObitUV *in, ofloat *data, ObitIOCode *retCode)
+{
+  ObitUVMemCache *cache = in->memCache;
+  ObitUVDesc *IODesc;
+  olong i, k, nv, nrparm, ncorr, lrec;
+  ofloat vscale, wscale, *rp, *rec;
+  gint16 *dp;
+
+  if ((cache==NULL) || !cache->complete) return FALSE;
+
+  IODesc = (ObitUVDesc*)in->myIO->myDesc;
+  if (cache->nextBlock>=cache->nblock) {  /* At end */
+    in->myDesc->numVisBuff = 0;
+    IODesc->numVisBuff     = 0;
+    *retCode = OBIT_IO_EOF;
+    return TRUE;
+  }
+
+  nrparm = cache->nrparm;
+  ncorr  = cache->ncorr;
+  lrec   = cache->lrec;
+  nv     = cache->blockNum[cache->nextBlock];
+  rp     = cache->rparm + cache->nextVis*(nrparm+2);
+  dp     = cache->data  + cache->nextVis*3*ncorr;
+  rec    = data;
+  for (i=0; i<nv; i++) {
+    for (k=0; k<nrparm; k++) rec[k] = rp[k];
+    vscale = rp[nrparm];
+    wscale = rp[nrparm+1];
+    for (k=0; k<ncorr; k++) {
+      rec[nrparm+3*k]   = vscale * dp[3*k];
+      rec[nrparm+3*k+1] = vscale * dp[3*k+1];
+      rec[nrparm+3*k+2] = wscale * dp[3*k+2];
+    }
+    rec += lrec;
+    rp  += nrparm+2;
+    dp  += 3*ncorr;
+  }
+
+  /* Location as originally read */
+  in->myDesc->firstVis   = cache->blockFirst[cache->nextBlock];
+  in->myDesc->numVisBuff = nv;
+  IODesc->firstVis       = in->myDesc->firstVis;
+  IODesc->numVisBuff     = nv;
+  cache->nextVis += nv;
+  cache->nextBlock++;
+  *retCode = OBIT_IO_OK;
+  return TRUE;
+} /* end UVMemCacheRead */
+
+/**
+ * Append a buffer just read from disk to a memory resident copy being saved.
+ * Visibilities are scaled by the largest unflagged component and weights
+ * by the largest weight in each visibility.
+ * The copy becomes complete when the end of the data is reached and is 
+ * abandoned on a read error or if it would exceed maxBytes.
+ * \param in       Object being read
+ * \param data     Buffer just read
+ * \param retCode  Return code from the read
+ */
+static void UVMemCacheSave (ObitUV *in, ofloat *data, ObitIOCode retCode)
+{
+  ObitUVMemCache *cache = in->memCache;
+  olong i, k, nv, nrparm, ncorr, lrec;
+  ollong recBytes, newMax;
+  ofloat amax, wmax, vfact, wfact, val, *rp, *rec;
+  gint16 *dp;
+
+  if ((cache==NULL) || !cache->filling) return;
+
+  /* Done? */
+  if (retCode==OBIT_IO_EOF) {
+    cache->filling   = FALSE;
+    cache->complete  = TRUE;
+    cache->nextBlock = cache->nblock;
+    cache->nextVis   = cache->nvis;
+    return;
+  }
+  if ((retCode!=OBIT_IO_OK) || (in->myDesc->lrec!=cache->lrec)) {
+    ObitUVMemCacheFree (in);
+    return;
+  }
+
+  nrparm = cache->nrparm;
+  ncorr  = cache->ncorr;
+  lrec   = cache->lrec;
+  nv     = in->myDesc->numVisBuff;
+
+  /* Grow as needed */
+  if (cache->nblock>=cache->maxBlock) {
+    cache->maxBlock   = MAX (1024, 2*cache->maxBlock);
+    cache->blockFirst = g_realloc(cache->blockFirst, cache->maxBlock*sizeof(olong));
+    cache->blockNum   = g_realloc(cache->blockNum,   cache->maxBlock*sizeof(olong));
+  }
+  if ((cache->nvis+nv)>cache->maxVis) {
+    recBytes = (nrparm+2)*sizeof(ofloat) + 3*ncorr*sizeof(gint16);
+    if ((cache->maxBytes>0) && ((cache->nvis+nv)*recBytes>cache->maxBytes)) {
+      ObitUVMemCacheFree (in);  /* Too big */
+      return;
+    }
+    newMax = MAX (cache->nvis+nv, 2*cache->maxVis);
+    if (cache->maxBytes>0) newMax = MIN (newMax, cache->maxBytes/recBytes);
+    cache->maxVis = newMax;
+    cache->rparm  = g_realloc(cache->rparm, newMax*(nrparm+2)*sizeof(ofloat));
+    cache->data   = g_realloc(cache->data,  newMax*3*ncorr*sizeof(gint16));
+  }
+
+  rp  = cache->rparm + cache->nvis*(nrparm+2);
+  dp  = cache->data  + cache->nvis*3*ncorr;
+  rec = data;
+  for (i=0; i<nv; i++) {
+    for (k=0; k<nrparm; k++) rp[k] = rec[k];
+    /* Scaling from largest unflagged component and largest weight */
+    amax = wmax = 0.0;
+    for (k=0; k<ncorr; k++) {
+      if (rec[nrparm+3*k+2]>0.0) {
+	amax = MAX (amax, fabs(rec[nrparm+3*k]));
+	amax = MAX (amax, fabs(rec[nrparm+3*k+1]));
+      }
+      wmax = MAX (wmax, fabs(rec[nrparm+3*k+2]));
+    }
+    rp[nrparm]   = amax / 32767.0;
+    rp[nrparm+1] = wmax / 32767.0;
+    if (amax>0.0) vfact = 32767.0 / amax;
+    else          vfact = 0.0;
+    if (wmax>0.0) wfact = 32767.0 / wmax;
+    else          wfact = 0.0;
+    for (k=0; k<ncorr; k++) {
+      if (rec[nrparm+3*k+2]>0.0) {
+	val = vfact * rec[nrparm+3*k];
+	dp[3*k]   = (gint16)(val + ((val>=0.0) ? 0.5 : -0.5));
+	val = vfact * rec[nrparm+3*k+1];
+	dp[3*k+1] = (gint16)(val + ((val>=0.0) ? 0.5 : -0.5));
+      } else {  /* Flagged */
+	dp[3*k]   = 0;
+	dp[3*k+1] = 0;
+      }
+      /* Keep sign of nonzero weights */
+      val = wfact * rec[nrparm+3*k+2];
+      dp[3*k+2] = (gint16)(val + ((val>=0.0) ? 0.5 : -0.5));
+      if ((rec[nrparm+3*k+2]>0.0) && (dp[3*k+2]<1))  dp[3*k+2] =  1;
+      if ((rec[nrparm+3*k+2]<0.0) && (dp[3*k+2]>-1)) dp[3*k+2] = -1;
+    }
+    rec += lrec;
+    rp  += nrparm+2;
+    dp  += 3*ncorr;
+  }
+
+  cache->blockFirst[cache->nblock] = in->myDesc->firstVis;
+  cache->blockNum[cache->nblock]   = nv;
+  cache->nblock++;
+  cache->nvis += nv;
+} /* end UVMemCacheSave */
+
+/**
+ * Reposition memory resident copy of the data.
+ * A complete copy is positioned to the buffer starting at startVis,
+ * and discarded if there is no such buffer.
+ * A copy being saved is restarted if startVis=1, otherwise discarded.
+ * \param in       Object being repositioned
+ * \param startVis Visibility number (1-rel) of start of next read
+ */
+static void UVMemCacheReset (ObitUV *in, olong startVis)
+{
+  ObitUVMemCache *cache = in->memCache;
+  olong ib;
+  ollong nvis;
+
+  if (cache==NULL) return;
+
+  if (cache->complete) {
+    nvis = 0;
+    for (ib=0; ib<cache->nblock; ib++) {
+      if (cache->blockFirst[ib]>=startVis) break;
+      nvis += cache->blockNum[ib];
+    }
+    if ((startVis<=1) || 
+	((ib<cache->nblock) && (cache->blockFirst[ib]==startVis))) {
+      cache->nextBlock = ib;
+      cache->nextVis   = nvis;
+      return;
+    }
+  } else if (startVis<=1) {
+    cache->nblock = 0;
+    cache->nvis   = 0;
+    return;
+  }
+  ObitUVMemCacheFree (in);
+} /* end UVMemCacheReset */
@@ -1294,17 +1294,16 @@ static void BPACShift (ObitCArray  *Spectrum,  ObitCArray  *Work,
 		       ObitFFT *FFTFor, ObitFFT *FFTRev, 
 		       olong sideband, olong nchan, ofloat shift, olong doSmo)
 {
-  ofloat dela, rfact, arg, xre, xim, norm, *spectrum, *work;
-  olong   nfrq, nfrq2, i, n2, jf, jbin, fftdir;
+  ofloat dela, rfact, arg, norm, *spectrum;
+  ofloat cmpx[2];
+  olong   nfrq, i, n2, jf, jbin, fftdir;
   olong pos[2] = {0, 0};
   
   nfrq = nchan;
   rfact = 1.0;
   spectrum = ObitCArrayIndex (Spectrum, pos);
-  work     = ObitCArrayIndex (Work, pos);
 
   /* reflect spectrum */
-  nfrq2 = nfrq * 2;
   /*ntrans = nfrq;*/
   fftdir = -1;
   /*call fourg (Spectrum, ntrans, fftdir, work);*/
@@ -1313,7 +1312,11 @@ static void BPACShift (ObitCArray  *Spectrum,  ObitCArray  *Work,
   /* determine shift parms */
   dela  = -2.0*G_PI * shift / nfrq;
 
-  /* shift AC spectrum. */
+  /* Build phase ramp (with smoothing and normalization) in Spectrum,
+     cells beyond nfrq are only normalized */
+  norm = 1.0 / (ofloat)nfrq;
+  cmpx[0] = norm; cmpx[1] = 0.0;
+  ObitCArrayFill (Spectrum, cmpx);
   n2 = nfrq / 2;
   for (i= 0; i< nfrq; i++) { /* loop 200 */
     if (i+1 <= n2) {
@@ -1326,25 +1329,19 @@ static void BPACShift (ObitCArray  *Spectrum,  ObitCArray  *Work,
     /* Hanning? */
     if (doSmo == 1) rfact = 0.5*(1.0-cos(2.0*G_PI*jbin/(nfrq-1)));
 
-    /* Multiple by phase ramp to shift */
     arg = dela * jf;
-    xre = work[2+i];
-    xim = work[2*i+1];
-    work[2*i]   = rfact * (cos (arg) * xre - sin (arg) * xim);
-    work[2*i+1] = rfact * (sin (arg) * xre + cos (arg) * xim);
+    spectrum[2*i]   = rfact * norm * cos (arg);
+    spectrum[2*i+1] = rfact * norm * sin (arg);
   } /* end loop   L200 */;
 
+  /* Multiply by phase ramp to shift */
+  ObitCArrayMul (Work, Spectrum, Work);
+
   /* transform back to spectrum */
   fftdir = -fftdir;
   /* call fourg ( Spectrum, ntrans, fftdir, work ); */
   ObitFFTC2C (FFTRev, Work, Spectrum);
 
-  /* normalize */
-  norm = 1.0 / (ofloat)nfrq;
-  for (i= 0; i< nfrq2; i++) { /* loop 300 */
-    spectrum[i] *= norm;
-  } /* end loop   L300 */;
-
   /* form real only */
   for (i= 0; i< nfrq; i++) { /* loop 400 */
     spectrum[2*i]   = sqrt(spectrum[2*i]*spectrum[2*i] + spectrum[2*i+1]*spectrum[2*i+1]);
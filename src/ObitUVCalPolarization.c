@@ -75,8 +75,6 @@ static void SetInvJonesIF(ObitUVCalPolarizationS *in, ObitAntennaList *Ant,
 /** Private: Set inverse antenna Jones matrix per channel/IF */
 static void SetInvJonesCh(ObitUVCalPolarizationS *in, ObitUVCalCalibrateS *cal, 
 			  olong iChan, olong iant, ObitErr *err);
-/** Private: 4x4 Matrix * 4x1 vector multiply */
-static void MatxVec4Mult(ofloat* in1, ofloat* in2, ofloat* out);
 /** Private: Muller matrix from outer product of Jones matrices */
 static void MatxOuter(ofloat* in1, ofloat* in2, ofloat* out);
 /** Private: Convert circular to linear basis (RR,LL...->YY,YY */
@@ -155,6 +153,8 @@ void ObitUVCalPolarizationInit (ObitUVCal *in, ObitUVSel *sel, ObitUVDesc *desc,
   if (me->perChan) size = 32 * me->numIF * me->numChan;
   else             size = 32 * me->numIF;
   me->PolCal     = g_realloc(me->PolCal, size*sizeof(ofloat));
+  /* Work space for data and calibrated data for all channels */
+  me->workVec    = g_realloc(me->workVec, 16*me->numChan*sizeof(ofloat));
   /* Init time, source */
   me->curTime   = -1.0e20;
   me->curSourID = -1;
@@ -203,10 +203,10 @@ void ObitUVCalPolarization (ObitUVCal *in, float time, olong ant1, olong ant2,
 {
   olong SubA, SourID, FreqID, iChan, limit, jndex, loff;
   olong i, iif, ifreq, ipol, ioff, joff, koff, jrl, jlr, ia1, ia2, ifoff;
-  olong choff, chdelta, it1, it2;
+  olong choff, chdelta, it1, it2, ich, nch, k;
   /*olong  voff[4], */
   gboolean wflag, someOK;
-  ofloat ytemp[8], dtemp[8], Lambda2, fblank = ObitMagicF();
+  ofloat ytemp[8], *vec, *vout, Lambda2, fblank = ObitMagicF();
   ofloat gr, gi, gr1, gi1, tr, ti;
   ObitUVCalPolarizationS *me;
   ObitUVCalCalibrateS   *cal;
@@ -297,14 +297,17 @@ void ObitUVCalPolarization (ObitUVCal *in, float time, olong ant1, olong ant2,
   else             chdelta = 1;                         /* per IF */
 
   /* loop thru if */
+  nch = me->eChan - me->bChan + 1;
+  vec  = me->workVec;           /* Reordered data for all channels */
+  vout = me->workVec + 8*nch;   /* Calibrated data for all channels */
   ifoff = 0; /* Offset to beginning of IF matrix in PolCal */
   for (iif=  me->bIF; iif<=me->eIF; iif++) { /* loop 400 */
     ioff = (iif-1) * desc->incif;
 
-    /* loop thru channels */
-    choff = 0; /* Offset to beginning of channel matrix in PolCal for perChan */
+    /* loop thru channels fixing up data */
     for (ifreq=me->bChan; ifreq<=me->eChan; ifreq++) {  /* loop 300 */
       joff = ((ifreq-1) * desc->incf + ioff); /* Offset of RR (or XX) */
+      ich  = ifreq - me->bChan;
 
 
       /* deal with case of missing  parallel poln; use one present for correction.
@@ -376,28 +379,37 @@ void ObitUVCalPolarization (ObitUVCal *in, float time, olong ant1, olong ant2,
 	} /* end loop L120:  */;
       } 
       
-      /* Save in reordered array */
-      dtemp[0] = visIn[joff+0]; dtemp[1] = visIn[joff+1]; 
-      dtemp[6] = visIn[joff+3]; dtemp[7] = visIn[joff+4]; 
+      /* Save in reordered array, element k of channel ich in vec[k*nch+ich] */
+      vec[0*nch+ich] = visIn[joff+0]; vec[1*nch+ich] = visIn[joff+1]; 
+      vec[6*nch+ich] = visIn[joff+3]; vec[7*nch+ich] = visIn[joff+4]; 
       /* Special hack for circular feeds with elp/ori solutions
 	 zero cross pols and calculate model and correct vis.
 	 Don't know why this is necessary */
       if ((me->polType==OBIT_UVPoln_ELORI) && me->circFeed) {
-	dtemp[2] = 0.0; dtemp[3] = 0.0;
-	dtemp[4] = 0.0; dtemp[5] = 0.0; 
+	vec[2*nch+ich] = 0.0; vec[3*nch+ich] = 0.0;
+	vec[4*nch+ich] = 0.0; vec[5*nch+ich] = 0.0; 
       } else {
-	dtemp[2] = visIn[joff+6]; dtemp[3] = visIn[joff+7];
-	dtemp[4] = visIn[joff+9]; dtemp[5] = visIn[joff+10];
+	vec[2*nch+ich] = visIn[joff+6]; vec[3*nch+ich] = visIn[joff+7];
+	vec[4*nch+ich] = visIn[joff+9]; vec[5*nch+ich] = visIn[joff+10];
       }
- 
+    } /* end loop over channels fixing up data */
+
+    /* Now apply calibration by multiplying the inverse Mueller matrices by 
+       the data vectors for all channels at once. */
+    if (me->perChan) ObitMatxVec4MultBatch(&me->PolCal[ifoff], 32, vec, vout, nch);
+    else             ObitMatxVec4MultBatch(&me->PolCal[ifoff], 0,  vec, vout, nch);
+
+    /* loop thru channels saving results */
+    choff = 0; /* Offset to beginning of channel matrix in PolCal for perChan */
+    for (ifreq=me->bChan; ifreq<=me->eChan; ifreq++) {
+      joff = ((ifreq-1) * desc->incf + ioff); /* Offset of RR (or XX) */
+      ich  = ifreq - me->bChan;
+
       if (me->perChan) jndex = (ifoff + choff);
       else             jndex = ifoff;
       /* Is poln cal flagged? */
       if (me->PolCal[jndex]!=fblank) { /* OK */
-
-	/* Now apply calibration by multiplying the inverse Mueller matrix by 
-	   the data vector.*/
-	MatxVec4Mult(&me->PolCal[jndex], dtemp, ytemp); 
+	for (k=0; k<8; k++) ytemp[k] = vout[k*nch+ich];
 	
 	/* Reorder - make corrections for cross hand */
 	visIn[joff+0]  = ytemp[0];  visIn[joff+1]   = ytemp[1]; 
@@ -490,7 +502,9 @@ ObitUVCalPolarizationSUnref (ObitUVCalPolarizationS *in)
   if (in->curPA)    g_free(in->curPA);
   if (in->curCosPA) g_free(in->curCosPA);
   if (in->curSinPA) g_free(in->curSinPA);
+  in->ephem = ObitAntennaEphemUnref(in->ephem);
   if (in->PolCal)   g_free(in->PolCal);
+  if (in->workVec)  g_free(in->workVec);
   if (in->C2L_Matrix) ObitMatxUnref(in->C2L_Matrix);
   if (in->Jones) {
     for (i=0; i<in->numAnt; i++) if (in->Jones[i]) g_free(in->Jones[i]);
@@ -521,7 +535,10 @@ newObitUVCalPolarizationS (ObitUVCal *in)
   out->curPA        = NULL;
   out->curCosPA     = NULL;
   out->curSinPA     = NULL;
+  out->ephem        = NULL;
+  out->ephemSubA    = -1;
   out->PolCal       = NULL;
+  out->workVec      = NULL;
   out->C2L_Matrix   = NULL;
   out->Jones        = NULL;
   out->PCal         = NULL;
@@ -576,12 +593,18 @@ static void ObitUVCalPolarizationUpdate (ObitUVCalPolarizationS *in, ObitUVCal *
     in->curSinDec = sin(Dec);
   }
 
-  /* Parallactic angles */
+  /* Parallactic angles, all antennas from tabulation */
   Ant = UVCal->antennaLists[SubA-1];
+  if ((in->ephem==NULL) || (in->ephemSubA!=SubA)) {
+    in->ephem = ObitAntennaEphemUnref(in->ephem);
+    in->ephem = ObitAntennaEphemCreate ("PolEphem", Ant, 0.0);
+    in->ephemSubA = SubA;
+  }
+  sid = MAX (1, SourID) - 1;
+  ObitAntennaEphemGeom (in->ephem, time, UVCal->sourceList->SUlist[sid],
+			NULL, NULL, in->curPA);
   for (i=0; i<Ant->number; i++) {
-    sid = MAX (1, SourID) - 1;
-    PA = ObitAntennaListParAng(Ant, i, time, UVCal->sourceList->SUlist[sid]);
-    in->curPA[i]    = PA;
+    PA = in->curPA[i];
     in->curCosPA[i] = cos(PA);
     in->curSinPA[i] = sin(PA);
   }
@@ -1333,22 +1356,6 @@ static void SetInvJonesCh(ObitUVCalPolarizationS *in, ObitUVCalCalibrateS *cal,
   } /* end loop over IFs */
 } /* end SetInvJonesCh */
 
-  /** Private: 4x4 complex matrix * 4x1 complex vector multiply */
-  static void MatxVec4Mult(ofloat* in1, ofloat* in2, ofloat* out)
-{
-  olong ic, ii, n=4;
-  ofloat sumr, sumi;
-  for (ic=0; ic<4; ic++) {
-    sumr = sumi = 0.0;
-    for (ii=0; ii<4; ii++) {
-      sumr += in1[(ic*n+ii)*2]*in2[ii*2]   - in1[(ic*n+ii)*2+1]*in2[ii*2+1];
-      sumi += in1[(ic*n+ii)*2]*in2[ii*2+1] + in1[(ic*n+ii)*2+1]*in2[ii*2];
-    }
-    out[ic*2]   = sumr;
-    out[ic*2+1] = sumi;
-  }
-} /* end MatxVec4Mult */
-
 /** Private: Muller matrix from outer product of Jones matrices 
     conjugate the second argument 
    Supports blanking */
@@ -1400,15 +1407,14 @@ Cir2Lin (ObitUVCal *in, float time, olong ant1, olong ant2, ofloat *RP, ofloat *
   ObitMatx *Jones = NULL;
   olong j, incs=desc->incs;
   olong ndim=2, naxis[]={4,1};
+  ofloat vec[8], out[8];
 
 
-  /* Need rotation matrix? Work arrays?*/
+  /* Need rotation matrix? */
   if (me->C2L_Matrix==NULL) {
     naxis[1] = 4;
     me->C2L_Matrix = ObitMatxCreate(OBIT_Complex, ndim, naxis);
     naxis[1] = 1;
-    if (in->workMatx1==NULL) in->workMatx1 = ObitMatxCreate(OBIT_Complex, ndim, naxis);
-    if (in->workMatx2==NULL) in->workMatx2 = ObitMatxCreate(OBIT_Complex, ndim, naxis);
     Jones = ObitMatxCreate(OBIT_Complex, ndim, naxis);
     ObitMatxIPerfCirJones(Jones);  /* Inverse perfect feed */
     ObitMatxOuterMult2C(Jones, Jones, me->C2L_Matrix);
@@ -1423,18 +1429,18 @@ Cir2Lin (ObitUVCal *in, float time, olong ant1, olong ant2, ofloat *RP, ofloat *
    return;
  }
  /* Load input vector [RR,RL,LR,LL]*/
- ObitMatxSet(in->workMatx1, (void*)&visIn[0],      0, 0);
- ObitMatxSet(in->workMatx1, (void*)&visIn[2*incs], 1, 0);
- ObitMatxSet(in->workMatx1, (void*)&visIn[3*incs], 2, 0);
- ObitMatxSet(in->workMatx1, (void*)&visIn[incs],   3, 0);
+ vec[0] = visIn[0];      vec[1] = visIn[1];
+ vec[2] = visIn[2*incs]; vec[3] = visIn[2*incs+1];
+ vec[4] = visIn[3*incs]; vec[5] = visIn[3*incs+1];
+ vec[6] = visIn[incs];   vec[7] = visIn[incs+1];
 
  /* Multiply by inverse Muller matrix */
- ObitMatxVec4Mult(me->C2L_Matrix, in->workMatx1, in->workMatx2);
+ ObitMatxVec4MultBatch((ofloat*)me->C2L_Matrix->array, 0, vec, out, 1);
 
  /* unload output vector from [XX,YY,XY,YX] */
- ObitMatxGet(in->workMatx2, 0, 0, (void*)&visIn[0]); 
- ObitMatxGet(in->workMatx2, 3, 0, (void*)&visIn[incs]);
- ObitMatxGet(in->workMatx2, 1, 0, (void*)&visIn[2*incs]);
- ObitMatxGet(in->workMatx2, 2, 0, (void*)&visIn[3*incs]);
+ visIn[0]      = out[0]; visIn[1]        = out[1]; 
+ visIn[incs]   = out[6]; visIn[incs+1]   = out[7];
+ visIn[2*incs] = out[2]; visIn[2*incs+1] = out[3];
+ visIn[3*incs] = out[4]; visIn[3*incs+1] = out[5];
  
 } /* end Cir2Lin */
@@ -1349,7 +1349,7 @@ ObitUVCalSelectYXInit (ObitUVCal *in, olong kstoke0, olong nstok,
 static void 
 Lin2Cir (ObitUVCal *in, ObitUVDesc *desc, ofloat *RP, ofloat *visIn, ofloat *visOut)
 {
-  ofloat PA, cosPA, sinPA, time, sum, tr, ti;
+  ofloat PA, cosPA, sinPA, time, sum, tr, ti, iV[8], oV[8];
   gboolean flag;
   olong suId, sid, j, incs=desc->incs;
 
@@ -1384,29 +1384,20 @@ Lin2Cir (ObitUVCal *in, ObitUVDesc *desc, ofloat *RP, ofloat *visIn, ofloat *vis
  /* Load input vector [XX,XY,YX,YY]*/
  sum = 0.0;
  for (j=0; j<4; j++) sum += visIn[j*3+2];
- ObitMatxSet(in->workMatx1, (void*)&visIn[0],      0, 0);
- ObitMatxSet(in->workMatx1, (void*)&visIn[2*incs], 1, 0);
- ObitMatxSet(in->workMatx1, (void*)&visIn[3*incs], 2, 0);
- ObitMatxSet(in->workMatx1, (void*)&visIn[incs],   3, 0);
- /*iV[0] = visIn[0]; iV[1] = visIn[1];
-   iV[2] = visIn[6]; iV[3] = visIn[7];
-   iV[4] = visIn[9]; iV[5] = visIn[10];
-   iV[6] = visIn[3]; iV[7] = visIn[4];
- */
+ iV[0] = visIn[0];        iV[1] = visIn[1];
+ iV[2] = visIn[2*incs];   iV[3] = visIn[2*incs+1];
+ iV[4] = visIn[3*incs];   iV[5] = visIn[3*incs+1];
+ iV[6] = visIn[incs];     iV[7] = visIn[incs+1];
 
  /* Multiply by inverse Muller matrix */
- ObitMatxVec4Mult(in->Muller, in->workMatx1, in->workMatx2);
+ ObitMatxVec4MultBatch((ofloat*)in->Muller->array, 0, iV, oV, 1);
 
  /* unload output vector from [RR,RL,LR,LL] */
  sum *= 0.25;
- ObitMatxGet(in->workMatx2, 0, 0, (void*)&visOut[0]); visOut[2]             = sum;
- ObitMatxGet(in->workMatx2, 3, 0, (void*)&visOut[incs]); visOut[incs+2]     = sum;
- ObitMatxGet(in->workMatx2, 1, 0, (void*)&visOut[2*incs]); visOut[2*incs+2] = sum;
- ObitMatxGet(in->workMatx2, 2, 0, (void*)&visOut[3*incs]); visOut[3*incs+2] = sum;
- /* visOut[0] = oV[0]; visOut[1]  = oV[1]; visOut[2]  = sum;
-    visOut[3] = oV[6]; visOut[4]  = oV[7]; visOut[5]  = sum;
-    visOut[6] = oV[2]; visOut[7]  = oV[3]; visOut[8]  = sum;
-    visOut[9] = oV[4]; visOut[10] = oV[5]; visOut[11] = sum;*/
+ visOut[0]      = oV[0]; visOut[1]        = oV[1]; visOut[2]        = sum;
+ visOut[incs]   = oV[6]; visOut[incs+1]   = oV[7]; visOut[incs+2]   = sum;
+ visOut[2*incs] = oV[2]; visOut[2*incs+1] = oV[3]; visOut[2*incs+2] = sum;
+ visOut[3*incs] = oV[4]; visOut[3*incs+1] = oV[5]; visOut[3*incs+2] = sum;
  
  /* Parallactic angle correction 
     Correct RL */
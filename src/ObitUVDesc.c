@@ -394,6 +394,7 @@ void ObitUVDescIndex (ObitUVDesc* in)
   /* random parameter values */
   /* initialize */
   in->ilocws = -1;
+  in->ilocvs = -1;
   in->ilocu  = -1;
   in->ilocv  = -1;
   in->ilocw  = -1;
@@ -425,6 +426,7 @@ void ObitUVDescIndex (ObitUVDesc* in)
     if (!strncmp (in->ptype[i], "INTTIM",   6)) in->ilocit = i;
     if (!strncmp (in->ptype[i], "CORR-ID",  7)) in->ilocid = i;
     if (!strncmp (in->ptype[i], "WEIGHT",   6)) in->ilocws = i;
+    if (!strncmp (in->ptype[i], "VISSCALE", 8)) in->ilocvs = i;
   }
 
   /* number of correlations */
@@ -433,6 +435,9 @@ void ObitUVDescIndex (ObitUVDesc* in)
   /* trap for FITS compressed uv data for which the descriptors
      are for the data as pairs of shorts */
   if (in->inaxes[in->jlocc]==2) size /= (sizeof(ofloat)/sizeof(gshort));
+  /* and compressed data with weights as triplets of shorts */
+  if ((in->inaxes[in->jlocc]==3) && (in->ilocvs>=0)) 
+    size /= (sizeof(ofloat)/sizeof(gshort));
 
   /* total size */
   in->lrec = in->nrparm + size;
@@ -36,6 +36,7 @@
 #include "ObitTableSUUtil.h"
 #include "ObitPrecess.h"
 #include "ObitUVWCalc.h"
+#include "ObitAntennaEphem.h"
 #ifndef VELIGHT
 #define VELIGHT 2.997924562e8
 #endif
@@ -4123,6 +4124,7 @@ void ObitUVEditElev (ObitUV *inUV, ObitUV *outUV, ObitErr *err)
   ObitSource      *mySource = NULL, *curSource;
   ObitTableSU     *SUTable  = NULL;
   ObitAntennaList *AntList  = NULL;
+  ObitAntennaEphem *Ephem   = NULL;
   ObitTableAN     *ANTable  = NULL;
   gchar Stokes[5], Reason[25], tString1[25], tString2[25];
   gchar *routine = "ObitUVEditElev";
@@ -4233,6 +4235,9 @@ void ObitUVEditElev (ObitUV *inUV, ObitUV *outUV, ObitErr *err)
   if (err->error) Obit_traceback_msg (err, routine, inUV->name);
   ANTable = ObitTableANUnref(ANTable);
 
+  /* Tabulated source elevations */
+  Ephem = ObitAntennaEphemCreate ("Ephem", AntList, oneMin);
+
   /* List of antennas to display */
   maxAnt = 0;
   for (i=0; i<AntList->number; i++) maxAnt = MAX (maxAnt, AntList->ANlist[i]->AntID);
@@ -4276,14 +4281,14 @@ void ObitUVEditElev (ObitUV *inUV, ObitUV *outUV, ObitErr *err)
       for (iant=0; iant<maxAnt; iant++) {
 	if (!AntOK[iant]) continue;  /* selected? */
 	/* Check Elevation at beginning and end */
-	elevBeg = ObitAntennaListElev(AntList, iant+1, tBeg, curSource);	
-	elevEnd = ObitAntennaListElev(AntList, iant+1, tEnd, curSource);
+	elevBeg = ObitAntennaEphemElev(Ephem, iant+1, tBeg, curSource);	
+	elevEnd = ObitAntennaEphemElev(Ephem, iant+1, tEnd, curSource);
 	if ((elevBeg>minElevRad) && (elevEnd>minElevRad)) continue;  /* Both OK */
 	/* If OK at start but not end, test by one min increments */
 	if (elevBeg>minElevRad) {
 	  t = tBeg + oneMin;
 	  while (t<tEnd) {
-	    elevBeg = ObitAntennaListElev(AntList, iant+1, t, curSource);	
+	    elevBeg = ObitAntennaEphemElev(Ephem, iant+1, t, curSource);	
 	    if (elevBeg<minElevRad) break;
 	    tBeg = t;
 	    t += oneMin;
@@ -4293,7 +4298,7 @@ void ObitUVEditElev (ObitUV *inUV, ObitUV *outUV, ObitErr *err)
 	if (elevEnd>minElevRad) {
 	  t = tEnd - oneMin;
 	  while (t<tEnd) {
-	    elevEnd = ObitAntennaListElev(AntList, iant+1, t, curSource);	
+	    elevEnd = ObitAntennaEphemElev(Ephem, iant+1, t, curSource);	
 	    if (elevEnd<minElevRad) break;
 	    tEnd = t;
 	    t -= oneMin;
@@ -4339,6 +4344,7 @@ void ObitUVEditElev (ObitUV *inUV, ObitUV *outUV, ObitErr *err)
   mySource= ObitSourceUnref(mySource);
   SUTable = ObitTableSUUnref(SUTable);
   AntList = ObitAntennaListUnref(AntList);
+  Ephem   = ObitAntennaEphemUnref(Ephem);
   ANTable = ObitTableANUnref(ANTable);
   if (AntOK) g_free(AntOK);
   if (err->error) Obit_traceback_msg (err, routine, inUV->name);
@@ -4374,7 +4380,7 @@ void ObitUVEditShadCross (ObitUV *inUV, ObitUV *outUV, ObitErr *err)
   gboolean *AntOK=NULL, doFlag, want, killAll;
   ofloat minShad, minShadLam2, minCross, minCrossLam2;
   ofloat sumFlagS, sumFlagC;
-  ofloat tBeg, tEnd, bl2, bl2B, bl2E;
+  ofloat tBeg, tEnd, bl2, bl2B, bl2E, *bl2Beg=NULL;
   ofloat time, oneMin=1.0/1440.0, uvw[3];
   ObitTableFG  *FlagTab=NULL;
   ObitTableFGRow *row=NULL;
@@ -4482,6 +4488,7 @@ void ObitUVEditShadCross (ObitUV *inUV, ObitUV *outUV, ObitErr *err)
   AntOK  = g_malloc0((maxAnt+2)*sizeof(gboolean));
   for (iant = 0; iant<maxAnt; iant++)
     AntOK[iant] = ObitUVSelWantAnt (sel, iant+1);
+  bl2Beg = g_malloc0((maxAnt*maxAnt+1)*sizeof(ofloat));
 
   /* How much flagged */
   cntFlagS = cntFlagC = 0;
@@ -4516,6 +4523,19 @@ void ObitUVEditShadCross (ObitUV *inUV, ObitUV *outUV, ObitErr *err)
 	row->TimeRange[0] = time-oneMin/2;
 	row->TimeRange[1] = time+oneMin/2;
 
+	/* Baselines at start, all first so the antenna u,v,w in UVWCalc 
+	   are only computed once per time */
+	for (iant=0; iant<maxAnt-1; iant++) {
+	  if (!AntOK[iant]) continue;  /* selected? */
+	  for (ibase=iant+1; ibase<maxAnt; ibase++) {
+	    if (!AntOK[ibase]) continue;  /* selected? */
+	    ObitUVWCalcUVW (UVWCalc, time-oneMin/2, row->SourID, row->SubA, 
+			    iant+1, ibase+1, uvw, err);
+	    bl2Beg[iant*maxAnt+ibase] = uvw[0]*uvw[0] + uvw[1]*uvw[1];
+	  }
+	}
+	if (err->error) goto cleanup;
+
 	/* Loop over antennas */
 	for (iant=0; iant<maxAnt-1; iant++) {
 	  if (!AntOK[iant]) continue;  /* selected? */
@@ -4524,9 +4544,7 @@ void ObitUVEditShadCross (ObitUV *inUV, ObitUV *outUV, ObitErr *err)
 	    if (!AntOK[ibase]) continue;  /* selected? */
 	    
 	    /* Get baseline at start and end */
-	    ObitUVWCalcUVW (UVWCalc, time-oneMin/2, row->SourID, row->SubA, 
-			    iant+1, ibase+1, uvw, err);
-	    bl2B = uvw[0]*uvw[0] + uvw[1]*uvw[1];
+	    bl2B = bl2Beg[iant*maxAnt+ibase];
 	    ObitUVWCalcUVW (UVWCalc, time+oneMin/2, row->SourID, row->SubA, 
 			    iant+1, ibase+1, uvw, err);
 	    if (err->error) goto cleanup;
@@ -4598,6 +4616,7 @@ void ObitUVEditShadCross (ObitUV *inUV, ObitUV *outUV, ObitErr *err)
   nxrow   = ObitTableNXRowUnref(nxrow);
   UVWCalc = ObitUVWCalcUnref(UVWCalc);
   if (AntOK) g_free(AntOK);
+  if (bl2Beg) g_free(bl2Beg);
   if (err->error) Obit_traceback_msg (err, routine, inUV->name);
 } /* end ObitUVEditShadCross */
 
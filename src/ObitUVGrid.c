@@ -106,6 +106,12 @@ static void ObitUVGridClassInfoDefFn (gpointer inClass);
 /** Private: Threaded FFT/gridding correct */
 static gpointer ThreadFFT2Im (gpointer arg);
 
+/** Private: Pruned FFT of grid to image */
+static void GridPrunedFFT (ObitUVGrid *in, ObitFFT *FFT, ObitFArray *array);
+
+/** Private: Number of leading grid columns used */
+static olong GridUsedCols (ObitCArray *grid);
+
 /*----------------------Public functions---------------------------*/
 /**
  * Constructor.
@@ -674,9 +680,18 @@ void ObitUVGridReadUVPar (olong nPar, ObitUVGrid **in, ObitUV *UVin, ObitErr *er
  * Perform half plane complex to real FFT, convert to center at the center order and
  * apply corrections for the convolution  function used in gridding
  * Requires setup by #ObitUVGridCreate and gridding by #ObitUVGridReadUV.
+ * The FFT is pruned: columns of the grid past the last used one are not
+ * transformed and, for images, only the part kept is computed.
+ * If there is little to prune the ordinary FFT is used.
+ * "FFTKeep" is not set here: the whole image is written so only a 
+ * caller that uses just the center of the image (e.g. the inner part of 
+ * an oversized facet, excluding the region affected by "Guardband") 
+ * can set it on in->info before this call.
  * Image written to disk
  * \param in      Object to process
  *                info element "Channel" has plane number, def[1]
+ *                info element "FFTKeep" OBIT_float fraction of each image 
+ *                axis about the center to compute, the rest is zeroed, def[1.0]
  * \param oout    Output image, as Obit* should be open for call
  * \param err     ObitErr stack for reporting problems.
  */
@@ -729,7 +744,7 @@ void ObitUVGridFFT2Im (ObitUVGrid *in, Obit *oout, ObitErr *err)
       } */
 
    /* do FFT */
-    ObitFFTC2R (in->FFTBeam, in->grid, array);
+    GridPrunedFFT (in, in->FFTBeam, array);
  
     /* reorder to center at center */
     ObitFArray2DCenter (array);
@@ -794,7 +809,7 @@ void ObitUVGridFFT2Im (ObitUVGrid *in, Obit *oout, ObitErr *err)
     }
     
     /* do FFT */
-    ObitFFTC2R (in->FFTImage, in->grid, array);
+    GridPrunedFFT (in, in->FFTImage, array);
 
     /* reorder to cernter at center */
     ObitFArray2DCenter (array);
@@ -855,6 +870,8 @@ void ObitUVGridFFT2Im (ObitUVGrid *in, Obit *oout, ObitErr *err)
  * \param nPar    Number of parallel griddings
  * \param in      Array of  objects to process
  *                info element "Channel" has plane number, def[1]
+ *                info element "FFTKeep" fraction of image computed, def[1.0]
+ *                (see #ObitUVGridFFT2Im)
  * \param oout    Array of output images,  pixel array elements must correspond 
  *                to those in in., as Obit* 
  * \param err     ObitErr stack for reporting problems.
@@ -918,7 +935,7 @@ void ObitUVGridFFT2ImPar (olong nPar, ObitUVGrid **in, Obit **oout, ObitErr *err
       } */
 
       /* do FFT */
-      ObitFFTC2R (in[i]->FFTBeam, in[i]->grid, array);
+      GridPrunedFFT (in[i], in[i]->FFTBeam, array);
       
     } else { /* Image */
       /* Create FFT object if not done before */
@@ -930,7 +947,7 @@ void ObitUVGridFFT2ImPar (olong nPar, ObitUVGrid **in, Obit **oout, ObitErr *err
       }
       
       /* do FFT */
-      ObitFFTC2R (in[i]->FFTImage, in[i]->grid, array);
+      GridPrunedFFT (in[i], in[i]->FFTImage, array);
     }
   } /* end loop doing FFTs */
 
@@ -1675,6 +1692,63 @@ void GridCorrFn (ObitUVGrid* in, long n, olong icent,
  
 } /* end GridCorrFn */
 
+/**
+ * Half plane complex to real FFT of the grid of in, pruned to the 
+ * grid columns containing data and, for images, to the inner part 
+ * of the image given by "FFTKeep" on in->info (set by the caller, see
+ * #ObitUVGridFFT2Im).  ObitFFTC2RPruned does a full FFT if this would 
+ * not save work.
+ * The grid and output are in FFT order (center at the corner).
+ * \param in     Object with filled grid, the grid is disturbed.
+ * \param FFT    Half complex to real FFT object for the grid
+ * \param array  Output image array
+ */
+static void GridPrunedFFT (ObitUVGrid *in, ObitFFT *FFT, ObitFArray *array)
+{
+  olong nUsed, nKeepX=0, nKeepY=0;
+  ofloat keep=1.0;
+  gint32 dim[MAXINFOELEMDIM] = {1,1,1,1,1};
+  ObitInfoType type;
+
+  /* Columns with data */
+  nUsed = GridUsedCols (in->grid);
+
+  /* Part of image wanted - all of beam */
+  if (!in->doBeam) {
+    ObitInfoListGetTest(in->info, "FFTKeep", &type, dim, &keep);
+    if ((keep>0.0) && (keep<1.0)) {
+      nKeepX = MAX (1, (olong)(0.5*keep*array->naxis[0] + 0.5));
+      nKeepY = MAX (1, (olong)(0.5*keep*array->naxis[1] + 0.5));
+    }
+  }
+
+  ObitFFTC2RPruned (FFT, in->grid, nUsed, nKeepX, nKeepY, array);
+} /* end GridPrunedFFT */
+
+/**
+ * Find number of leading columns (u cells) of a half plane grid
+ * containing any nonzero value.
+ * Rows are scanned from the end only as far as the highest found so far.
+ * \param grid  Half plane complex grid
+ * \return number of columns used, at least 1
+ */
+static olong GridUsedCols (ObitCArray *grid)
+{
+  olong iu, iv, nu, nv, nUsed=1;
+  ofloat *row;
+
+  nu = grid->naxis[0];
+  nv = grid->naxis[1];
+  for (iv=0; iv<nv; iv++) {
+    row = grid->array + 2*iv*nu;
+    for (iu=nu-1; iu>=nUsed; iu--) {
+      if ((row[2*iu]!=0.0) || (row[2*iu+1]!=0.0)) {nUsed = iu+1; break;}
+    }
+    if (nUsed>=nu) break;
+  }
+  return nUsed;
+} /* end GridUsedCols */
+
 /** 
  * Reorders grid and do gridding correction.
  * NOTE: threading in FFTW apparently conflicts with Obit threads.
@@ -1128,8 +1128,9 @@ cleanup:
 * Requires setup by #ObitUVGridMFCreate and gridding by #ObitUVGridMFReadUV.
 * If Beams are being made, there should be entries in in and array for both
 * beam and image with the beam immediately prior to the associated image.
-* Apparently the threading in FFTW clashes with that in Obit so here the
-* FFTs are done sequentially
+* The spectral planes of each image are transformed as a set by
+* #ObitFFTC2RPlanes which threads over planes for small grids (using
+* single threaded FFTW plans) and within each transform for large ones.
 * Images written to disk
 * Wideband version:
 * \param nPar    Number of parallel griddings
@@ -1144,13 +1145,14 @@ void ObitUVGridMFFFT2ImPar(olong nPar, ObitUVGrid **inn, Obit **oout, ObitErr *e
 {
     ObitImage **out = (ObitImage **)oout;
     olong i, ii, j, ip, nTh, nnTh, off, nLeft, pos[5], xdim[7], pln;
-    olong narr, nThread, plane[5] = {1, 1, 1, 1, 1};
+    olong narr, nThread, nFFT, plane[5] = {1, 1, 1, 1, 1};
     ObitInfoType type;
     gint32 dim[MAXINFOELEMDIM];
     FFT2ImFuncArg *args = NULL;
     ObitUVGridMF **in = (ObitUVGridMF **)inn;
     ObitThreadFunc func = (ObitThreadFunc)ThreadFFT2ImMF;
-    ObitFArray **array = NULL;
+    ObitFArray **array = NULL, **FFTarrays = NULL;
+    ObitCArray **FFTgrids = NULL;
     ObitImageClassInfo *imgClass;
     ObitImage *theBeam;
     gboolean OK, allBlank = FALSE;
@@ -1172,6 +1174,9 @@ void ObitUVGridMFFFT2ImPar(olong nPar, ObitUVGrid **inn, Obit **oout, ObitErr *e
     /* Create FArray array */
     narr = nPar * in[0]->nSpec;
     array = g_malloc0(narr * sizeof(ObitFArray *));
+    /* Work lists of planes to FFT for one image */
+    FFTgrids  = g_malloc0(in[0]->nSpec * sizeof(ObitCArray *));
+    FFTarrays = g_malloc0(in[0]->nSpec * sizeof(ObitFArray *));
 
     if (err->prtLv >= 5) { /* Diagnostics */
         Obit_log_error(err, OBIT_InfoErr, "%s: start FFTs", routine);
@@ -1207,15 +1212,19 @@ void ObitUVGridMFFFT2ImPar(olong nPar, ObitUVGrid **inn, Obit **oout, ObitErr *e
             dbgRArr = ObitFArrayUnref(dbgRArr);
             dbgIArr = ObitFArrayUnref(dbgIArr);
                  }   end DEBUG */
-            /* Create array of pixel arrays then FFT */
+            /* Create array of pixel arrays then FFT as a set */
+            nFFT = 0;
+
             for (j = 0; j < in[i]->nSpec; j++) {
                 if (in[i]->isDone && in[i]->isDone[j]) continue;  /* This one finished? */
 
                 array[ip] = ObitFArrayCreate("Beam", 2, xdim);
-                /* do FFT */
-                ObitFFTC2R(in[i]->FFTBeam, in[i]->grids[j], array[ip++]);
+                FFTgrids[nFFT]   = in[i]->grids[j];
+                FFTarrays[nFFT++] = array[ip++];
             }
 
+            ObitFFTC2RPlanes(in[i]->FFTBeam, nFFT, FFTgrids, FFTarrays);
+
             /* DEBUG - look at first complex grid
             if (i==0) {
             dbgRArr = ObitCArrayMakeF(in[0]->grids[0]);
@@ -1251,7 +1260,9 @@ void ObitUVGridMFFFT2ImPar(olong nPar, ObitUVGrid **inn, Obit **oout, ObitErr *e
             dbgIArr = ObitFArrayUnref(dbgIArr);
 
                  }  *//* end DEBUG */
-            /* Create array of pixel arrays */
+            /* Create array of pixel arrays then FFT as a set */
+            nFFT = 0;
+
             for (j = 0; j < in[i]->nSpec; j++) {
                 if (in[i]->isDone && in[i]->isDone[j]) {
                     ip++;    /* This one finished? */
@@ -1259,9 +1270,11 @@ void ObitUVGridMFFFT2ImPar(olong nPar, ObitUVGrid **inn, Obit **oout, ObitErr *e
                 }
 
                 array[ip] = ObitFArrayCreate("Image", 2, xdim);
-                /* do FFT */
-                ObitFFTC2R(in[i]->FFTImage, in[i]->grids[j], array[ip++]);
+                FFTgrids[nFFT]   = in[i]->grids[j];
+                FFTarrays[nFFT++] = array[ip++];
             }
+
+            ObitFFTC2RPlanes(in[i]->FFTImage, nFFT, FFTgrids, FFTarrays);
         }
 
     } /* end loop doing FFTs */
@@ -1499,6 +1512,9 @@ cleanup:
         g_free(array);
     }
 
+    if (FFTgrids)  g_free(FFTgrids);
+    if (FFTarrays) g_free(FFTarrays);
+
     /* Delete FFT objects */
     for (i = 0; i < nPar; i++) {
         if (in[i]->doBeam) { /* Beam? */
@@ -664,6 +664,63 @@ void ObitUVImagerImage (ObitUVImager *in, olong *field, gboolean doWeight,
   if (imageList) g_free(imageList);
 } /* end ObitUVImagerImage */
 
+/**
+ * Image the residuals after subtracting skyModel from the data in
+ * uvwork if defined, else uvdata, writing results in mosaic.
+ * If the model can be subtracted as the data are read
+ * (see ObitSkyModelSubUVStream) the residuals are gridded in the same pass
+ * and nothing is written; otherwise the model is subtracted from uvwork
+ * in place which then must exist.  uvdata is never modified.
+ * \param in        The input object
+ * \param skyModel  Model to subtract
+ * \param field     zero terminated list of field numbers to image, 0=> all
+ * \param doWeight  If TRUE do Weighting ov uv data first
+ * \param doBeam    If True calculate dirty beams first
+ * \param doFlatten If TRUE, flatten images when done
+ * \param err       Obit error stack object.
+ */
+void ObitUVImagerImageResid (ObitUVImager *in, ObitSkyModel *skyModel,
+			     olong *field, gboolean doWeight,
+			     gboolean doBeam, gboolean doFlatten, ObitErr *err)
+{
+  ObitUV *data=NULL;
+  gboolean doStream;
+  ObitUVImagerClassInfo *imgClass = (ObitUVImagerClassInfo*)in->ClassInfo;
+  gchar *routine = "ObitUVImagerImageResid";
+
+  /* error checks */
+  g_assert (ObitErrIsA(err));
+  if (err->error) return;
+  g_assert (ObitIsA(in, &myClassInfo));
+  g_assert (ObitSkyModelIsA(skyModel));
+
+  /* Weight first - this rewrites the data */
+  if (doWeight) imgClass->ObitUVImagerWeight (in, err);
+  if (err->error) Obit_traceback_msg (err, routine, in->name);
+
+  data = in->uvwork;
+  if (!data) data = in->uvdata;
+
+  /* Subtract as data are gridded? */
+  doStream = ObitSkyModelSubUVStream (skyModel, data, err);
+  if (err->error) Obit_traceback_msg (err, routine, in->name);
+
+  if (!doStream) {
+    /* Subtract in place - must not be the input data */
+    Obit_return_if_fail((in->uvwork!=NULL), err,
+			"%s: No work UV data to subtract model from in %s",
+			routine, in->name);
+    ObitSkyModelSubUV (skyModel, in->uvwork, in->uvwork, err);
+    if (err->error) Obit_traceback_msg (err, routine, in->name);
+  }
+
+  imgClass->ObitUVImagerImage (in, field, FALSE, doBeam, doFlatten, err);
+
+  /* Always remove the read filter */
+  if (doStream) ObitSkyModelSubUVStreamEnd (skyModel, data, err);
+  if (err->error) Obit_traceback_msg (err, routine, in->name);
+} /* end ObitUVImagerImageResid */
+
 /**
  * Create shifted 2D imaging facets
  * \param in     The input UVImager object
@@ -970,6 +1027,8 @@ static void ObitUVImagerClassInfoDefFn (gpointer inClass)
   theClass->ObitUVImagerCreate2= (ObitUVImagerCreate2FP)ObitUVImagerCreate2;
   theClass->ObitUVImagerWeight = (ObitUVImagerWeightFP)ObitUVImagerWeight;
   theClass->ObitUVImagerImage  = (ObitUVImagerImageFP)ObitUVImagerImage;
+  theClass->ObitUVImagerImageResid =
+    (ObitUVImagerImageResidFP)ObitUVImagerImageResid;
   theClass->ObitUVImagerShifty = (ObitUVImagerShiftyFP)ObitUVImagerShifty;
   theClass->ObitUVImagerFlatten= (ObitUVImagerFlattenFP)ObitUVImagerFlatten;
   theClass->ObitUVImagerGetMosaic = 
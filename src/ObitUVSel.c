@@ -147,6 +147,7 @@ ObitUVSel* ObitUVSelCopy (ObitUVSel* in, ObitUVSel* out,
   out->lrecUC      = in->lrecUC;
   out->nrparmUC    = in->nrparmUC;
   out->Compress    = in->Compress;
+  out->CompressWt  = in->CompressWt;
   out->numberVis   = in->numberVis;
   out->numberPoln  = in->numberPoln;
   out->jincs       = in->jincs;
@@ -334,8 +335,22 @@ void ObitUVSelGetDesc (ObitUVDesc* in, ObitUVSel* sel,
   if ((sel->numberSourcesList==1) && (out->ilocsu>=0)  && !KeepSou)
     strncpy (out->ptype[out->ilocsu], "REMOVED ", UVLEN_KEYWORD); 
 
+  /* Compression with weights needs an even number of correlations */
+  if (sel->CompressWt && ((in->ncorr%2)!=0)) {
+    sel->Compress   = FALSE;
+    sel->CompressWt = FALSE;
+  }
+
   /* compress iff sel->Compress */
-  if (sel->Compress) {
+  if (sel->Compress && sel->CompressWt) {
+    /* (real, imaginary, weight) as shorts, WEIGHT and VISSCALE
+       random parameters give the scaling */
+    if (out->ilocws<0) {
+      out->ilocws = in->nrparm;
+      strncpy (out->ptype[out->nrparm++], "WEIGHT  ", UVLEN_KEYWORD);
+      strncpy (out->ptype[out->nrparm++], "VISSCALE", UVLEN_KEYWORD);
+    }
+  } else if (sel->Compress) {
     out->inaxes[0] = 1; /* not quite true for but gets float count
 			  correct */
     /* Make sure there are WEIGHT and SCALE random parameters */
@@ -405,6 +420,16 @@ void ObitUVSelSetDesc (ObitUVDesc* in, ObitUVSel* sel,
 	out->inaxes[0] = 3;
       }
       out->lrec =  out->nrparm + (in->lrec - in->nrparm) * 3;
+    } else if ((in->inaxes[0]==3) && (in->ilocvs>=0)) {
+      /* Compressed with weights */
+      sel->Compress = TRUE;
+      /* If they're last drop WEIGHT and VISSCALE random parameters */
+      if (out->ilocws == out->nrparm-2) {
+	out->nrparm -= 2;
+	out->ilocws = -1;
+	out->ilocvs = -1;
+      }
+      out->lrec =  out->nrparm + 3 * in->ncorr;
     }
   }
 
@@ -911,6 +936,7 @@ void ObitUVSelInit  (gpointer inn)
 
   /* set members in this class */
   in->nVisPIO       = 1;
+  in->CompressWt    = FALSE;
   in->numberVis     = 1;
   in->numberPoln    = 1;
   in->startChann    = 1;
@@ -4755,8 +4755,6 @@ void ObitUVUtilCalcUVW (ObitUV *inUV, ObitUV *outUV,  ObitErr *err)
 		    NULL};
   gchar *sourceInclude[] = {"AIPS SU", NULL};
   ObitUVWCalc *uvwCalc=NULL;
-  olong i, indx, SId, subA, ant1, ant2;
-  ofloat uvw[3];
   ObitInfoType type;
   gint32 dim[MAXINFOELEMDIM];
   ObitIOAccess access;
@@ -4846,7 +4844,6 @@ void ObitUVUtilCalcUVW (ObitUV *inUV, ObitUV *outUV,  ObitErr *err)
   /* Get descriptors */
   inDesc  = inUV->myDesc;
   outDesc = outUV->myDesc;
-  SId = 0;   /* In case single source */
 
   uvwCalc = ObitUVWCalcCreate("UVWCalc", outUV, err);
   if (err->error) Obit_traceback_msg (err, routine, outUV->name);
@@ -4859,18 +4856,12 @@ void ObitUVUtilCalcUVW (ObitUV *inUV, ObitUV *outUV,  ObitErr *err)
    /* How many */
     outDesc->numVisBuff = inDesc->numVisBuff;
 
-    /* Modify data */
-    for (i=0; i<inDesc->numVisBuff; i++) { /* loop over visibilities */
-      indx = i*inDesc->lrec;
-      if (inUV->myDesc->ilocsu>=0) 
-	SId = (olong)(inUV->buffer[indx+inUV->myDesc->ilocsu] + 0.5);
-      ObitUVDescGetAnts(inUV->myDesc, &inUV->buffer[indx], &ant1, &ant2, &subA);
-      ObitUVWCalcUVW(uvwCalc, inUV->buffer[indx+inDesc->iloct], SId, 
-		     subA, ant1, ant2, uvw, err);
-      inUV->buffer[indx+inDesc->ilocu] = uvw[0];
-      inUV->buffer[indx+inDesc->ilocv] = uvw[1];
-      inUV->buffer[indx+inDesc->ilocw] = uvw[2];
-    } /* end loop over visibilities */
+    /* Modify data - u,v,w per antenna once per time */
+    ObitUVWCalcUVWBuffer(uvwCalc, inDesc, inUV->buffer, inDesc->numVisBuff, err);
+    if (err->error) {
+      uvwCalc = ObitUVWCalcUnref(uvwCalc);
+      Obit_traceback_msg (err, routine,inUV->name);
+    }
 
     /* Write */
     oretCode = ObitUVWrite (outUV, inUV->buffer, err);
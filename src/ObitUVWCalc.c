@@ -69,6 +69,10 @@ static void ObitUVWCalcClassInfoDefFn (gpointer inClass);
 /** Private: Set Subarray stuff */
 static void ObitUVWCalcSetSubA (ObitUVWCalc *in, olong subA, ObitErr *err);
 
+/** Private: Update antenna, source geometry and per antenna u,v,w */
+static void ObitUVWCalcUpdate (ObitUVWCalc *in, ofloat tt, olong SId, 
+			       ObitErr *err);
+
 
 /*----------------------Public functions---------------------------*/
 /**
@@ -252,6 +256,8 @@ ObitUVWCalc* ObitUVWCalcCreate (gchar* name, ObitUV *inUV, ObitErr *err)
 
 /**
  * Calculate the u,v,w for a given source, time, baseline
+ * The u,v,w of each antenna are computed once per time/source/subarray 
+ * and baseline values are their differences.
  * \param in   The object with antenna/source information
  * \param time Time (days) wrt reference day for subA, offset =5*(subA-1)
  * \param SId  Source identifier
@@ -265,11 +271,8 @@ void ObitUVWCalcUVW (ObitUVWCalc *in, ofloat time, olong SId,
 		     olong subA, olong ant1, olong ant2, ofloat *uvw, 
 		     ObitErr *err)
 {
-  ofloat t,tt, u, v, w, equin, uvrot, vw, basex, basey, basez, polar[2];
-  olong i, ia1, ia2, iant;
-  odouble xm, ym, zm, length;
-  odouble dRa, dDec, delta, RAOff, DecOff, RAMeanR, DecMeanR, RAAppR, DecAppR;
-  odouble RAAnt, DecAnt, RAAnt0, DecAnt0, GSTRA, deldat = 0.1;
+  ofloat tt;
+  olong ia1, ia2;
   gchar *routine = "ObitUVWCalcUVW";
 
   /* error checks */
@@ -301,130 +304,14 @@ void ObitUVWCalcUVW (ObitUVWCalc *in, ofloat time, olong SId,
   if ((ia1<0) || (ia2<0)) return;
   if ((ia1>=in->maxAnt) || (ia2>=in->maxAnt)) return;
 
-      /* New time? Compute antenna coordinates in celestial frame */
-  if (tt>in->curTime) {
-    in->curTime = tt;
-    /* Current UTC Julian Date corrected to UT1*/
-    t      =  tt + (in->AntList->ut1Utc + in->AntList->dataUtc)/(2.0*G_PI);
-    in->JD = in->AntList->JD + t; 
-    /* Rotation angle for antennas to celestial */
-    GSTRA  = (in->GSTUTC0 + 24*in->Rate*t) * 15 * DG2RAD;
-    /* Equinox */
-    if (in->myData->myDesc->equinox>0.0) equin = in->myData->myDesc->equinox;
-    else                                 equin = 2000.0;
-    /* Offset of pole */
-    polar[0] = in->AntList->PolarXY[0]; polar[1] = in->AntList->PolarXY[1];
-    for (iant=0; iant<in->nant; iant++) {
-      /* Rotate antenna coordinates by time, 
-	 need left handed - flip sign of Y */
-      xm = in->AntList->ANlist[iant]->AntXYZ[0] * cos(GSTRA) - 
-  	   in->AntList->ANlist[iant]->AntXYZ[1] * sin(GSTRA);
-      ym = in->AntList->ANlist[iant]->AntXYZ[0] * sin(GSTRA) + 
-  	   in->AntList->ANlist[iant]->AntXYZ[1] * cos(GSTRA);
-      zm = in->AntList->ANlist[iant]->AntXYZ[2];
-      length = sqrt (xm*xm + ym*ym + zm*zm);
-      RAAnt = atan2(ym, xm);
-      if (length==0.0) DecAnt = asin(0.0);
-      else             DecAnt = asin(zm/length);
-     /* Precess from apparent to mean position */
-      ObitPrecessPrecess (in->AntList->JD, equin, deldat, -1, FALSE, in->obsPos, 
-			  polar, &RAAnt0, &DecAnt0, &RAAnt, &DecAnt);
-      in->xm[iant] = length * cos(DecAnt0) * cos(RAAnt0);
-      in->ym[iant] = length * cos(DecAnt0) * sin(RAAnt0);
-      in->zm[iant] = length * sin(DecAnt0);
-    } /* end loop over antennas */
-  } /* end new time */
-    
-  /* New source?  */
-  if (in->curSID!=SId) {
-    in->curSID = SId;
-    /* Find in Source List */
-    if (in->SouList) {
-      in->curSource = NULL;
-      for (i=0; i<in->SouList->number; i++) {
-	if (in->SouList->SUlist[i]->SourID==SId) {
-	  in->curSource = in->SouList->SUlist[i];
-	  break;}
-      }
-    } else { /* Single source */
-      in->curSource = in->mySource;
-    }
-    
-    /* Check */
-    Obit_return_if_fail((in->curSource!=NULL), err,
-			"%s: Source ID %d not found", routine, SId);
-
-    /* Reference wavelength plus source specific offset */
-    if (in->curSource->FreqOff)
-      in->ilambda = 1.0 / (VELIGHT/(in->myData->myDesc->freq + in->curSource->FreqOff[0]));  
-    else
-      in->ilambda = 1.0 / (VELIGHT/(in->myData->myDesc->freq));
- 
-    /* Precess this source for now 
-       Current UTC Julian Date corrected to UT1 */
-    t      =  tt + (in->AntList->ut1Utc + in->AntList->dataUtc)/(2.0*G_PI);
-    in->JD = in->AntList->JD + t; 
-    /* Equinox */
-    if (in->myData->myDesc->equinox>0.0) equin = in->myData->myDesc->equinox;
-    else                                 equin = 2000.0;
-    /* Offset of pole */
-    polar[0] = in->AntList->PolarXY[0]; polar[1] = in->AntList->PolarXY[1];
-
-    RAMeanR  = in->curSource->RAMean*DG2RAD;
-    DecMeanR = in->curSource->DecMean*DG2RAD;
-    ObitPrecessPrecess (in->JD, equin, deldat, 1, FALSE, in->obsPos, polar,
-			&RAMeanR, &DecMeanR, &RAAppR, &DecAppR);
-    in->curSource->RAApp  = RAAppR*RAD2DG;
-    in->curSource->DecApp = DecAppR*RAD2DG;
-
-    /* Lorentz contraction from differential abberation - 
-       precess posn. 10" north */
-    delta = 10.0/3600.0;
-    dDec = in->curSource->DecMean+delta;
-    RAMeanR  = in->curSource->RAMean*DG2RAD;
-    DecMeanR = dDec*DG2RAD;
-    ObitPrecessPrecess (in->JD, equin, deldat, 1, FALSE, in->obsPos, polar,
-			&RAMeanR, &DecMeanR, &RAAppR, &DecAppR);
-    RAOff  = RAAppR*RAD2DG;
-    DecOff = DecAppR*RAD2DG;
-    dRa  = (RAOff-in->curSource->RAApp) * cos(DG2RAD*in->curSource->DecApp);
-    dDec = (DecOff-in->curSource->DecApp);
-    in->LorentzFact = sqrt(dRa*dRa + dDec*dDec) / delta;
-    /* Trap gonzo values */
-    if ((in->LorentzFact>1.05) || (in->LorentzFact<0.95)) in->LorentzFact = 1.0;
-    in->cRA    = cos(in->curSource->RAMean*DG2RAD);
-    in->sRA    = sin(in->curSource->RAMean*DG2RAD);
-    in->cDec   = cos(in->curSource->DecMean*DG2RAD);
-    in->sDec   = sin(in->curSource->DecMean*DG2RAD);
-    /* uvrot global = rotation to north */
-    uvrot = -(ofloat)atan2(dRa, dDec);
-    /* Rotation due to differential precession */
-    in->cuvrot = cos(uvrot);
-    in->suvrot = sin(uvrot);
-  } /* end new source */
+  /* Update geometry if needed */
+  ObitUVWCalcUpdate (in, tt, SId, err);
+  if (err->error) Obit_traceback_msg (err, routine, in->name);
 
-  /* Baseline vector in celestial coordinates */
-  basex = in->xm[ia1] - in->xm[ia2];
-  basey = in->ym[ia1] - in->ym[ia2];
-  basez = in->zm[ia1] - in->zm[ia2];
-
-  /* uvw from baseline, source posn */
-  vw = basex*in->cRA + basey*in->sRA;
-  u = -basex*in->sRA + basey*in->cRA;
-  v = -vw*in->sDec + basez*in->cDec;
-  w =  vw*in->cDec + basez*in->sDec;
-
-  /* Flip signs? */
-  if (in->doFlip) {
-    u = -u;
-    v = -v;
-    w = -w;
-  }
-  
-  /* Apply Lorentz contraction, convert to wavelengths */
-  uvw[0] = u*in->LorentzFact*in->ilambda;
-  uvw[1] = v*in->LorentzFact*in->ilambda;
-  uvw[2] = w*in->ilambda;
+  /* Baseline u,v,w from antenna values */
+  uvw[0] = (ofloat)(in->uAnt[ia1] - in->uAnt[ia2]);
+  uvw[1] = (ofloat)(in->vAnt[ia1] - in->vAnt[ia2]);
+  uvw[2] = (ofloat)(in->wAnt[ia1] - in->wAnt[ia2]);
 
   /* Rotate in u-v plane to north of standard epoch
      THIS DOESN'T SEEM TO BE RIGHT
@@ -435,6 +322,76 @@ void ObitUVWCalcUVW (ObitUVWCalc *in, ofloat time, olong SId,
   
 } /* end ObitUVWCalcUVW */
 
+/**
+ * Calculate the u,v,w for all visibilities in a buffer
+ * Geometry is updated once per run of visibilities with the same 
+ * time, source and subarray.  Autocorrelations and visibilities with 
+ * antennas not in the antenna table get zero u,v,w.
+ * \param in     The object with antenna/source information
+ * \param desc   Descriptor for data in buffer
+ * \param buffer Visibility records, u,v,w replaced in wavelengths 
+ *               at reference frequency
+ * \param nvis   Number of visibilities in buffer
+ * \param err    Obit error stack object.
+ */
+void ObitUVWCalcUVWBuffer (ObitUVWCalc *in, ObitUVDesc *desc, ofloat *buffer, 
+			   olong nvis, ObitErr *err)
+{
+  olong i, j, last, indx, SId, subA, tsubA, ant1, ant2, ia1, ia2, lrec;
+  ofloat time, tt, *rec;
+  gchar *routine = "ObitUVWCalcUVWBuffer";
+
+  /* error checks */
+  if (err->error) return;
+  lrec = desc->lrec;
+
+  i = 0;
+  while (i<nvis) {
+    /* Start of run of same time/source/subarray */
+    indx = i*lrec;
+    time = buffer[indx+desc->iloct];
+    if (desc->ilocsu>=0) SId = (olong)(buffer[indx+desc->ilocsu] + 0.5);
+    else                 SId = 0;
+    ObitUVDescGetAnts(desc, &buffer[indx], &ant1, &ant2, &subA);
+
+    /* Find end of run */
+    for (last=i+1; last<nvis; last++) {
+      rec = &buffer[last*lrec];
+      if (rec[desc->iloct]!=time) break;
+      if ((desc->ilocsu>=0) && ((olong)(rec[desc->ilocsu]+0.5)!=SId)) break;
+      ObitUVDescGetAnts(desc, rec, &ant1, &ant2, &tsubA);
+      if (tsubA!=subA) break;
+    }
+
+    /* Update subarray, geometry */
+    if (subA!=in->subArr) ObitUVWCalcSetSubA (in, subA, err);
+    if (err->error) Obit_traceback_msg (err, routine, in->name);
+    tt = time - (subA-1)*5.0;
+    ObitUVWCalcUpdate (in, tt, SId, err);
+    if (err->error) Obit_traceback_msg (err, routine, in->name);
+
+    /* Baselines in run */
+    for (j=i; j<last; j++) {
+      rec = &buffer[j*lrec];
+      ObitUVDescGetAnts(desc, rec, &ant1, &ant2, &subA);
+      Obit_return_if_fail(((ant1>=0) && (ant1<=in->maxAnt) && 
+			   (ant2>=0) && (ant2<=in->maxAnt)), err,
+			  "%s: Antenna %d or %d out of bounds", routine, ant1, ant2);
+      ia1 = in->antIndex[ant1];
+      ia2 = in->antIndex[ant2];
+      if ((ant1==ant2) || (ia1<0) || (ia2<0) || 
+	  (ia1>=in->maxAnt) || (ia2>=in->maxAnt)) {
+	rec[desc->ilocu] = rec[desc->ilocv] = rec[desc->ilocw] = 0.0;
+	continue;
+      }
+      rec[desc->ilocu] = (ofloat)(in->uAnt[ia1] - in->uAnt[ia2]);
+      rec[desc->ilocv] = (ofloat)(in->vAnt[ia1] - in->vAnt[ia2]);
+      rec[desc->ilocw] = (ofloat)(in->wAnt[ia1] - in->wAnt[ia2]);
+    }
+    i = last;
+  } /* end loop over runs */
+} /* end ObitUVWCalcUVWBuffer */
+
 /**
  * Initialize global ClassInfo Structure.
  */
@@ -482,6 +439,7 @@ static void ObitUVWCalcClassInfoDefFn (gpointer inClass)
   theClass->ObitInit      = (ObitInitFP)ObitUVWCalcInit;
   theClass->ObitUVWCalcCreate = (ObitUVWCalcCreateFP)ObitUVWCalcCreate;
   theClass->ObitUVWCalcUVW    = (ObitUVWCalcUVWFP)ObitUVWCalcUVW;
+  theClass->ObitUVWCalcUVWBuffer = (ObitUVWCalcUVWBufferFP)ObitUVWCalcUVWBuffer;
 } /* end ObitUVWCalcClassDefFn */
 
 /*---------------Private functions--------------------------*/
@@ -513,7 +471,11 @@ void ObitUVWCalcInit  (gpointer inn)
   in->antIndex = NULL;
   in->xm       = NULL;
   in->ym       = NULL;
-  in->xm       = NULL;
+  in->zm       = NULL;
+  in->uAnt     = NULL;
+  in->vAnt     = NULL;
+  in->wAnt     = NULL;
+  in->uvwValid = FALSE;
   in->nant     = 0;
   in->doFlip   = FALSE;
   in->subArr   = -1;
@@ -548,8 +510,11 @@ void ObitUVWCalcClear (gpointer inn)
   in->mySource = ObitSourceUnref (in->mySource);
   if (in->antIndex) g_free(in->antIndex);
   if (in->xm) {g_free(in->xm); in->xm = NULL;}
-  if (in->ym) {g_free(in->ym); in->xm = NULL;}
-  if (in->zm) {g_free(in->zm); in->xm = NULL;}
+  if (in->ym) {g_free(in->ym); in->ym = NULL;}
+  if (in->zm) {g_free(in->zm); in->zm = NULL;}
+  if (in->uAnt) {g_free(in->uAnt); in->uAnt = NULL;}
+  if (in->vAnt) {g_free(in->vAnt); in->vAnt = NULL;}
+  if (in->wAnt) {g_free(in->wAnt); in->wAnt = NULL;}
   
   /* unlink parent class members */
   ParentClass = (ObitClassInfo*)(myClassInfo.ParentClass);
@@ -632,6 +597,14 @@ static void ObitUVWCalcSetSubA (ObitUVWCalc *in, olong subA, ObitErr *err)
   in->xm   = g_malloc0(in->nant*sizeof(odouble));
   in->ym   = g_malloc0(in->nant*sizeof(odouble));
   in->zm   = g_malloc0(in->nant*sizeof(odouble));
+  /* Antenna u,v,w */
+  if (in->uAnt) g_free(in->uAnt);
+  if (in->vAnt) g_free(in->vAnt);
+  if (in->wAnt) g_free(in->wAnt);
+  in->uAnt = g_malloc0(in->nant*sizeof(odouble));
+  in->vAnt = g_malloc0(in->nant*sizeof(odouble));
+  in->wAnt = g_malloc0(in->nant*sizeof(odouble));
+  in->uvwValid = FALSE;
 
   in->curTime = -1.0e20;  /* Current time */
   ObitPrecessGST0 (in->AntList->JD, &in->GSTUTC0, &in->Rate);
@@ -651,3 +624,143 @@ static void ObitUVWCalcSetSubA (ObitUVWCalc *in, olong subA, ObitErr *err)
   if (!strncmp("KAT-7",  ArrName, 5)) in->doFlip = TRUE;
 
 } /* end ObitUVWCalcSetSubA */
+
+/**
+ * Update antenna positions for a new time, source parameters for a 
+ * new source and, if either changed, the u,v,w of each antenna.
+ * \param in   The object with antenna/source information, subarray set
+ * \param tt   Time (days) wrt reference day for subarray
+ * \param SId  Source identifier
+ * \param err  Obit error stack object.
+ */
+static void ObitUVWCalcUpdate (ObitUVWCalc *in, ofloat tt, olong SId, 
+			       ObitErr *err)
+{
+  ofloat t, equin, uvrot, polar[2];
+  olong i, iant;
+  odouble xm, ym, zm, length, u, v, w, vw, scale;
+  odouble dRa, dDec, delta, RAOff, DecOff, RAMeanR, DecMeanR, RAAppR, DecAppR;
+  odouble RAAnt, DecAnt, RAAnt0, DecAnt0, GSTRA, deldat = 0.1;
+  gchar *routine = "ObitUVWCalcUpdate";
+
+  /* New time? Compute antenna coordinates in celestial frame */
+  if (tt>in->curTime) {
+    in->curTime = tt;
+    in->uvwValid = FALSE;
+    /* Current UTC Julian Date corrected to UT1*/
+    t      =  tt + (in->AntList->ut1Utc + in->AntList->dataUtc)/(2.0*G_PI);
+    in->JD = in->AntList->JD + t; 
+    /* Rotation angle for antennas to celestial */
+    GSTRA  = (in->GSTUTC0 + 24*in->Rate*t) * 15 * DG2RAD;
+    /* Equinox */
+    if (in->myData->myDesc->equinox>0.0) equin = in->myData->myDesc->equinox;
+    else                                 equin = 2000.0;
+    /* Offset of pole */
+    polar[0] = in->AntList->PolarXY[0]; polar[1] = in->AntList->PolarXY[1];
+    for (iant=0; iant<in->nant; iant++) {
+      /* Rotate antenna coordinates by time, 
+	 need left handed - flip sign of Y */
+      xm = in->AntList->ANlist[iant]->AntXYZ[0] * cos(GSTRA) - 
+  	   in->AntList->ANlist[iant]->AntXYZ[1] * sin(GSTRA);
+      ym = in->AntList->ANlist[iant]->AntXYZ[0] * sin(GSTRA) + 
+  	   in->AntList->ANlist[iant]->AntXYZ[1] * cos(GSTRA);
+      zm = in->AntList->ANlist[iant]->AntXYZ[2];
+      length = sqrt (xm*xm + ym*ym + zm*zm);
+      RAAnt = atan2(ym, xm);
+      if (length==0.0) DecAnt = asin(0.0);
+      else             DecAnt = asin(zm/length);
+     /* Precess from apparent to mean position */
+      ObitPrecessPrecess (in->AntList->JD, equin, deldat, -1, FALSE, in->obsPos, 
+			  polar, &RAAnt0, &DecAnt0, &RAAnt, &DecAnt);
+      in->xm[iant] = length * cos(DecAnt0) * cos(RAAnt0);
+      in->ym[iant] = length * cos(DecAnt0) * sin(RAAnt0);
+      in->zm[iant] = length * sin(DecAnt0);
+    } /* end loop over antennas */
+  } /* end new time */
+    
+  /* New source?  */
+  if (in->curSID!=SId) {
+    in->curSID = SId;
+    in->uvwValid = FALSE;
+    /* Find in Source List */
+    if (in->SouList) {
+      in->curSource = NULL;
+      for (i=0; i<in->SouList->number; i++) {
+	if (in->SouList->SUlist[i]->SourID==SId) {
+	  in->curSource = in->SouList->SUlist[i];
+	  break;}
+      }
+    } else { /* Single source */
+      in->curSource = in->mySource;
+    }
+    
+    /* Check */
+    Obit_return_if_fail((in->curSource!=NULL), err,
+			"%s: Source ID %d not found", routine, SId);
+
+    /* Reference wavelength plus source specific offset */
+    if (in->curSource->FreqOff)
+      in->ilambda = 1.0 / (VELIGHT/(in->myData->myDesc->freq + in->curSource->FreqOff[0]));  
+    else
+      in->ilambda = 1.0 / (VELIGHT/(in->myData->myDesc->freq));
+ 
+    /* Precess this source for now 
+       Current UTC Julian Date corrected to UT1 */
+    t      =  tt + (in->AntList->ut1Utc + in->AntList->dataUtc)/(2.0*G_PI);
+    in->JD = in->AntList->JD + t; 
+    /* Equinox */
+    if (in->myData->myDesc->equinox>0.0) equin = in->myData->myDesc->equinox;
+    else                                 equin = 2000.0;
+    /* Offset of pole */
+    polar[0] = in->AntList->PolarXY[0]; polar[1] = in->AntList->PolarXY[1];
+
+    RAMeanR  = in->curSource->RAMean*DG2RAD;
+    DecMeanR = in->curSource->DecMean*DG2RAD;
+    ObitPrecessPrecess (in->JD, equin, deldat, 1, FALSE, in->obsPos, polar,
+			&RAMeanR, &DecMeanR, &RAAppR, &DecAppR);
+    in->curSource->RAApp  = RAAppR*RAD2DG;
+    in->curSource->DecApp = DecAppR*RAD2DG;
+
+    /* Lorentz contraction from differential abberation - 
+       precess posn. 10" north */
+    delta = 10.0/3600.0;
+    dDec = in->curSource->DecMean+delta;
+    RAMeanR  = in->curSource->RAMean*DG2RAD;
+    DecMeanR = dDec*DG2RAD;
+    ObitPrecessPrecess (in->JD, equin, deldat, 1, FALSE, in->obsPos, polar,
+			&RAMeanR, &DecMeanR, &RAAppR, &DecAppR);
+    RAOff  = RAAppR*RAD2DG;
+    DecOff = DecAppR*RAD2DG;
+    dRa  = (RAOff-in->curSource->RAApp) * cos(DG2RAD*in->curSource->DecApp);
+    dDec = (DecOff-in->curSource->DecApp);
+    in->LorentzFact = sqrt(dRa*dRa + dDec*dDec) / delta;
+    /* Trap gonzo values */
+    if ((in->LorentzFact>1.05) || (in->LorentzFact<0.95)) in->LorentzFact = 1.0;
+    in->cRA    = cos(in->curSource->RAMean*DG2RAD);
+    in->sRA    = sin(in->curSource->RAMean*DG2RAD);
+    in->cDec   = cos(in->curSource->DecMean*DG2RAD);
+    in->sDec   = sin(in->curSource->DecMean*DG2RAD);
+    /* uvrot global = rotation to north */
+    uvrot = -(ofloat)atan2(dRa, dDec);
+    /* Rotation due to differential precession */
+    in->cuvrot = cos(uvrot);
+    in->suvrot = sin(uvrot);
+  } /* end new source */
+
+  /* Antenna u,v,w */
+  if (!in->uvwValid) {
+    in->uvwValid = TRUE;
+    /* Lorentz contraction, wavelengths, flip sign? */
+    scale = in->ilambda;
+    if (in->doFlip) scale = -scale;
+    for (iant=0; iant<in->nant; iant++) {
+      vw = in->xm[iant]*in->cRA + in->ym[iant]*in->sRA;
+      u  = -in->xm[iant]*in->sRA + in->ym[iant]*in->cRA;
+      v  = -vw*in->sDec + in->zm[iant]*in->cDec;
+      w  =  vw*in->cDec + in->zm[iant]*in->sDec;
+      in->uAnt[iant] = u*in->LorentzFact*scale;
+      in->vAnt[iant] = v*in->LorentzFact*scale;
+      in->wAnt[iant] = w*scale;
+    }
+  } /* end update antenna u,v,w */
+} /* end ObitUVWCalcUpdate */